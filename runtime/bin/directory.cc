@@ -299,7 +299,9 @@ CObject* Directory::ListNextRequest(const CObjectArray& request) {
     if (dir_listing->IsEmpty()) {
       return new CObjectArray(CObject::NewArray(0));
     }
-    const int kArraySize = 128;
+    // Each entry takes two slots, its type and its path. Large batches keep
+    // the number of messages down when listing large directories.
+    const int kArraySize = 2048;
     CObjectArray* response = new CObjectArray(CObject::NewArray(kArraySize));
     dir_listing->SetArray(response, kArraySize);
     Directory::List(dir_listing);
@@ -395,42 +397,52 @@ bool AsyncDirectoryListing::HandleError() {
 }
 
 
-bool SyncDirectoryListing::HandleDirectory(const char* dir_name) {
-  Dart_Handle dir_name_dart = DartUtils::NewString(dir_name);
-  Dart_Handle dir =
-      Dart_New(directory_type_, Dart_Null(), 1, &dir_name_dart);
-  Dart_Handle result = Dart_Invoke(results_, add_string_, 1, &dir);
-  if (Dart_IsError(result)) {
-    Dart_PropagateError(result);
+void SyncDirectoryListing::AddEntry(Dart_Handle type, const char* path) {
+  if (batch_index_ == 0) {
+    batch_ = ThrowIfError(Dart_NewList(2 * kBatchSize));
   }
+  ThrowIfError(Dart_ListSetAt(batch_, 2 * batch_index_, type));
+  ThrowIfError(Dart_ListSetAt(batch_, 2 * batch_index_ + 1,
+                              DartUtils::NewString(path)));
+  batch_index_++;
+  if (batch_index_ == kBatchSize) {
+    AddBatch();
+  }
+}
+
+
+void SyncDirectoryListing::AddBatch() {
+  ThrowIfError(Dart_Invoke(results_, add_string_, 1, &batch_));
+  batch_ = Dart_Null();
+  batch_index_ = 0;
+}
+
+
+bool SyncDirectoryListing::HandleDirectory(const char* dir_name) {
+  AddEntry(directory_type_, dir_name);
   return true;
 }
 
 
 bool SyncDirectoryListing::HandleLink(const char* link_name) {
-  Dart_Handle link_name_dart = DartUtils::NewString(link_name);
-  Dart_Handle link =
-      Dart_New(link_type_, Dart_Null(), 1, &link_name_dart);
-  Dart_Handle result = Dart_Invoke(results_, add_string_, 1, &link);
-  if (Dart_IsError(result)) {
-    Dart_PropagateError(result);
-  }
+  AddEntry(link_type_, link_name);
   return true;
 }
 
 
 bool SyncDirectoryListing::HandleFile(const char* file_name) {
-  Dart_Handle file_name_dart = DartUtils::NewString(file_name);
-  Dart_Handle file =
-      Dart_New(file_type_, Dart_Null(), 1, &file_name_dart);
-  Dart_Handle result = Dart_Invoke(results_, add_string_, 1, &file);
-  if (Dart_IsError(result)) {
-    Dart_PropagateError(result);
-  }
+  AddEntry(file_type_, file_name);
   return true;
 }
 
 
+void SyncDirectoryListing::HandleDone() {
+  if (batch_index_ > 0) {
+    AddBatch();
+  }
+}
+
+
 bool SyncDirectoryListing::HandleError() {
   Dart_Handle dart_os_error = DartUtils::NewDartOSError();
   Dart_Handle args[3];
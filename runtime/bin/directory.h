@@ -220,34 +220,45 @@ class AsyncDirectoryListing : public ReferenceCounted<AsyncDirectoryListing>,
 };
 
 
+// Adds the entries to the results list in batches. Each batch is a list of
+// kBatchSize pairs of an AsyncDirectoryListing::Response type and a path,
+// where the last batch ends with a null type if it is not full. The Dart
+// objects for the entries are created in Dart.
 class SyncDirectoryListing: public DirectoryListing {
  public:
+  static const intptr_t kBatchSize = 1024;
+
   SyncDirectoryListing(Dart_Handle results,
                        const char* dir_name,
                        bool recursive,
                        bool follow_links)
       : DirectoryListing(dir_name, recursive, follow_links),
-        results_(results) {
+        results_(results),
+        batch_(Dart_Null()),
+        batch_index_(0) {
     add_string_ = DartUtils::NewString("add");
-    directory_type_ =
-        DartUtils::GetDartType(DartUtils::kIOLibURL, "Directory");
-    file_type_ =
-        DartUtils::GetDartType(DartUtils::kIOLibURL, "File");
-    link_type_ =
-        DartUtils::GetDartType(DartUtils::kIOLibURL, "Link");
+    directory_type_ = Dart_NewInteger(AsyncDirectoryListing::kListDirectory);
+    file_type_ = Dart_NewInteger(AsyncDirectoryListing::kListFile);
+    link_type_ = Dart_NewInteger(AsyncDirectoryListing::kListLink);
   }
   virtual ~SyncDirectoryListing() {}
   virtual bool HandleDirectory(const char* dir_name);
   virtual bool HandleFile(const char* file_name);
   virtual bool HandleLink(const char* file_name);
   virtual bool HandleError();
+  virtual void HandleDone();
 
  private:
+  void AddEntry(Dart_Handle type, const char* path);
+  void AddBatch();
+
   Dart_Handle results_;
   Dart_Handle add_string_;
   Dart_Handle directory_type_;
   Dart_Handle file_type_;
   Dart_Handle link_type_;
+  Dart_Handle batch_;
+  intptr_t batch_index_;
 
   DISALLOW_ALLOCATION()
   DISALLOW_IMPLICIT_CONSTRUCTORS(SyncDirectoryListing);
@@ -9,10 +9,12 @@
 
 #include <dirent.h>  // NOLINT
 #include <errno.h>  // NOLINT
+#include <fcntl.h>  // NOLINT
 #include <stdlib.h>  // NOLINT
 #include <string.h>  // NOLINT
 #include <sys/param.h>  // NOLINT
 #include <sys/stat.h>  // NOLINT
+#include <sys/syscall.h>  // NOLINT
 #include <unistd.h>  // NOLINT
 
 #include "bin/dartutils.h"
@@ -89,17 +91,70 @@ struct LinkList {
 };
 
 
+// Reads directory entries in bulk with getdents64, so that listing a large
+// directory takes one system call per buffer full of entries rather than one
+// readdir call per entry.
+class DirectoryReader {
+ public:
+  // Returns NULL and sets errno if the directory cannot be opened.
+  static DirectoryReader* Open(const char* path) {
+    int fd = TEMP_FAILURE_RETRY(
+        open64(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (fd < 0) {
+      return NULL;
+    }
+    return new DirectoryReader(fd);
+  }
+
+  ~DirectoryReader() {
+    VOID_TEMP_FAILURE_RETRY(close(fd_));
+    delete[] buffer_;
+  }
+
+  // Returns the next entry, or NULL when there are no more entries or on
+  // error. On error errno is set, otherwise it is 0.
+  struct dirent64* Next() {
+    if (offset_ == length_) {
+      intptr_t result = TEMP_FAILURE_RETRY(
+          syscall(SYS_getdents64, fd_, buffer_, kBufferSize));
+      if (result <= 0) {
+        if (result == 0) {
+          errno = 0;
+        }
+        return NULL;
+      }
+      offset_ = 0;
+      length_ = result;
+    }
+    struct dirent64* entry =
+        reinterpret_cast<struct dirent64*>(buffer_ + offset_);
+    offset_ += entry->d_reclen;
+    return entry;
+  }
+
+ private:
+  static const intptr_t kBufferSize = 32 * KB;
+
+  explicit DirectoryReader(int fd)
+      : fd_(fd), buffer_(new uint8_t[kBufferSize]), offset_(0), length_(0) {}
+
+  int fd_;
+  uint8_t* buffer_;
+  intptr_t offset_;
+  intptr_t length_;
+
+  DISALLOW_COPY_AND_ASSIGN(DirectoryReader);
+};
+
+
 ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
   if (done_) {
     return kListDone;
   }
 
   if (lister_ == 0) {
-    do {
-      lister_ = reinterpret_cast<intptr_t>(
-          opendir(listing->path_buffer().AsString()));
-    } while ((lister_ == 0) && (errno == EINTR));
-
+    lister_ = reinterpret_cast<intptr_t>(
+        DirectoryReader::Open(listing->path_buffer().AsString()));
     if (lister_ == 0) {
       done_ = true;
       return kListError;
@@ -117,20 +172,17 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
 
   // Iterate the directory and post the directories and files to the
   // ports.
-  int status = 0;
-  dirent entry;
-  dirent* result;
-  status = NO_RETRY_EXPECTED(readdir_r(
-      reinterpret_cast<DIR*>(lister_), &entry, &result));
-  if ((status == 0) && (result != NULL)) {
-    if (!listing->path_buffer().Add(entry.d_name)) {
+  struct dirent64* entry = reinterpret_cast<DirectoryReader*>(lister_)->Next();
+  int status = (entry == NULL) ? errno : 0;
+  if (entry != NULL) {
+    if (!listing->path_buffer().Add(entry->d_name)) {
       done_ = true;
       return kListError;
     }
-    switch (entry.d_type) {
+    switch (entry->d_type) {
       case DT_DIR:
-        if ((strcmp(entry.d_name, ".") == 0) ||
-            (strcmp(entry.d_name, "..") == 0)) {
+        if ((strcmp(entry->d_name, ".") == 0) ||
+            (strcmp(entry->d_name, "..") == 0)) {
           return Next(listing);
         }
         return kListDirectory;
@@ -144,7 +196,7 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
         // Fall through.
       case DT_UNKNOWN: {
         // On some file systems the entry type is not determined by
-        // readdir_r. For those and for links we use stat to determine
+        // getdents64. For those and for links we use stat to determine
         // the actual entry type. Notice that stat returns the type of
         // the file pointed to.
         struct stat64 entry_info;
@@ -178,16 +230,16 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
             // Recurse into the subdirectory with current_link added to the
             // linked list of seen file system links.
             link_ = new LinkList(current_link);
-            if ((strcmp(entry.d_name, ".") == 0) ||
-                (strcmp(entry.d_name, "..") == 0)) {
+            if ((strcmp(entry->d_name, ".") == 0) ||
+                (strcmp(entry->d_name, "..") == 0)) {
               return Next(listing);
             }
             return kListDirectory;
           }
         }
         if (S_ISDIR(entry_info.st_mode)) {
-          if ((strcmp(entry.d_name, ".") == 0) ||
-              (strcmp(entry.d_name, "..") == 0)) {
+          if ((strcmp(entry->d_name, ".") == 0) ||
+              (strcmp(entry->d_name, "..") == 0)) {
             return Next(listing);
           }
           return kListDirectory;
@@ -216,7 +268,7 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
 DirectoryListingEntry::~DirectoryListingEntry() {
   ResetLink();
   if (lister_ != 0) {
-    VOID_NO_RETRY_EXPECTED(closedir(reinterpret_cast<DIR*>(lister_)));
+    delete reinterpret_cast<DirectoryReader*>(lister_);
   }
 }
 
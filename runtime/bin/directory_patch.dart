@@ -14,7 +14,7 @@ patch class _Directory {
   /* patch */ static _rename(String path, String newPath)
       native "Directory_Rename";
   /* patch */ static void _fillWithDirectoryListing(
-      List<FileSystemEntity> list, String path, bool recursive,
+      List<List> batches, String path, bool recursive,
       bool followLinks)
       native "Directory_FillWithDirectoryListing";
 }
@@ -60,6 +60,8 @@ void TimeoutQueue::UpdateTimeout(Dart_Port port, int64_t timeout) {
 
 static EventHandler* event_handler = NULL;
 static Monitor *shutdown_monitor = NULL;
+bool EventHandler::use_io_uring_ = false;
+intptr_t EventHandler::num_threads_ = 1;
 
 
 void EventHandler::Start() {
@@ -144,6 +146,147 @@ void FUNCTION_NAME(EventHandler_TimerMillisecondClock)(
   Dart_SetReturnValue(args, Dart_NewInteger(now));
 }
 
+
+/*
+ * Returns the load of the event handler threads as a flat list with the
+ * number of descriptors, events posted and messages received for each
+ * thread, or null if the platform does not report it.
+ */
+void FUNCTION_NAME(EventHandler_ShardStatistics)(Dart_NativeArguments args) {
+#if defined(TARGET_OS_LINUX)
+  EventHandlerImplementation* delegate = EventHandler::delegate();
+  intptr_t num_shards = delegate->num_shards();
+  Dart_Handle result = Dart_NewList(num_shards * 3);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  for (intptr_t i = 0; i < num_shards; i++) {
+    EventHandlerShard* shard = delegate->shard(i);
+    Dart_ListSetAt(result, i * 3,
+                   Dart_NewInteger(shard->num_descriptors()));
+    Dart_ListSetAt(result, i * 3 + 1, Dart_NewInteger(shard->num_events()));
+    Dart_ListSetAt(result, i * 3 + 2,
+                   Dart_NewInteger(shard->num_messages()));
+  }
+  Dart_SetReturnValue(args, result);
+#else
+  Dart_SetReturnValue(args, Dart_Null());
+#endif
+}
+
+
+/*
+ * Copies the data of the buffers args[2] between the offsets args[3] and
+ * args[4] into up to args[5] write buffers of the event handler and queues
+ * them for the socket args[0]. Each buffer is filled before the next one is
+ * used. The completions are posted to the send port args[1]. Returns the
+ * number of bytes queued, 0 if no write buffer is free, or null if the event
+ * handler does not write for the socket.
+ */
+void FUNCTION_NAME(EventHandler_QueueWrite)(Dart_NativeArguments args) {
+#if defined(TARGET_OS_LINUX)
+  static bool short_socket_writes = Dart_IsVMFlagSet("short_socket_write");
+  intptr_t socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  EventHandlerShard* shard = EventHandler::delegate()->DescriptorShard(socket);
+  if (!shard->uses_completions()) {
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  Dart_Port dart_port;
+  Dart_Handle result =
+      Dart_SendPortGetId(Dart_GetNativeArgument(args, 1), &dart_port);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  Dart_Handle buffers_obj = Dart_GetNativeArgument(args, 2);
+  Dart_Handle starts_obj = Dart_GetNativeArgument(args, 3);
+  Dart_Handle ends_obj = Dart_GetNativeArgument(args, 4);
+  int64_t max_writes =
+      DartUtils::GetIntegerValue(Dart_GetNativeArgument(args, 5));
+  intptr_t count = 0;
+  result = Dart_ListLength(buffers_obj, &count);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  intptr_t limit = EventHandlerShard::kUringBufferSize;
+  if (short_socket_writes) {
+    // Only queue the first half of the data, in one buffer.
+    intptr_t total_bytes = 0;
+    for (intptr_t i = 0; i < count; i++) {
+      total_bytes +=
+          DartUtils::GetIntptrValue(Dart_ListGetAt(ends_obj, i)) -
+          DartUtils::GetIntptrValue(Dart_ListGetAt(starts_obj, i));
+    }
+    if ((total_bytes + 1) / 2 < limit) {
+      limit = (total_bytes + 1) / 2;
+    }
+    max_writes = 1;
+  }
+  intptr_t queued = 0;
+  // The next data to copy is from offset start of buffer i.
+  intptr_t i = 0;
+  intptr_t start = 0;
+  if (count > 0) {
+    start = DartUtils::GetIntptrValue(Dart_ListGetAt(starts_obj, 0));
+  }
+  for (int64_t writes = 0; (writes < max_writes) && (i < count); writes++) {
+    UringBuffer* buffer = shard->TakeWriteBuffer();
+    if (buffer == NULL) {
+      break;
+    }
+    // The buffers are acquired one at a time, no Dart API calls are allowed
+    // while data is acquired.
+    intptr_t length = 0;
+    while ((i < count) && (length < limit)) {
+      Dart_Handle buffer_obj = Dart_ListGetAt(buffers_obj, i);
+      if (Dart_IsError(buffer_obj)) {
+        shard->ReturnWriteBuffer(buffer);
+        Dart_PropagateError(buffer_obj);
+      }
+      intptr_t end = DartUtils::GetIntptrValue(Dart_ListGetAt(ends_obj, i));
+      ASSERT(start <= end);
+      intptr_t bytes = end - start;
+      if (bytes > limit - length) {
+        bytes = limit - length;
+      }
+      Dart_TypedData_Type type;
+      uint8_t* data = NULL;
+      intptr_t len;
+      result = Dart_TypedDataAcquireData(
+          buffer_obj, &type, reinterpret_cast<void**>(&data), &len);
+      if (Dart_IsError(result)) {
+        shard->ReturnWriteBuffer(buffer);
+        Dart_PropagateError(result);
+      }
+      ASSERT(end <= len);
+      memmove(buffer->data + length, data + start, bytes);
+      Dart_TypedDataReleaseData(buffer_obj);
+      length += bytes;
+      start += bytes;
+      if (start == end) {
+        i++;
+        if (i < count) {
+          start = DartUtils::GetIntptrValue(Dart_ListGetAt(starts_obj, i));
+        }
+      }
+    }
+    if (length == 0) {
+      shard->ReturnWriteBuffer(buffer);
+      break;
+    }
+    shard->QueueWrite(socket, dart_port, buffer, length);
+    queued += length;
+    if (length < limit) {
+      break;
+    }
+  }
+  Dart_SetReturnValue(args, Dart_NewInteger(queued));
+#else
+  Dart_SetReturnValue(args, Dart_Null());
+#endif
+}
+
 }  // namespace bin
 }  // namespace dart
 
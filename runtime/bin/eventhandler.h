@@ -29,15 +29,31 @@ enum MessageFlags {
   kShutdownWriteCommand = 10,
   kReturnTokenCommand = 11,
   kSetEventMaskCommand = 12,
+  kReturnReadTokenCommand = 13,
+  kWriteCommand = 14,
   kListeningSocket = 16,
   kPipe = 17,
+  kTcpSocket = 18,
+};
+
+// The kinds of the list messages posted when the event handler reads,
+// writes and accepts for a TCP socket itself, which only the Linux event
+// handler does with --io-uring. The data read is posted as a Uint8List.
+// These should be kept in sync with the constants in socket_patch.dart.
+enum CompletionKind {
+  kAcceptCompletion = 0,
+  kWriteCompletion = 1,
+  kReadErrorCompletion = 2,
+  kWriteErrorCompletion = 3,
 };
 
 #define COMMAND_MASK ((1 << kCloseCommand) | \
                       (1 << kShutdownReadCommand) | \
                       (1 << kShutdownWriteCommand) | \
                       (1 << kReturnTokenCommand) | \
-                      (1 << kSetEventMaskCommand))
+                      (1 << kSetEventMaskCommand) | \
+                      (1 << kReturnReadTokenCommand) | \
+                      (1 << kWriteCommand))
 #define EVENT_MASK ((1 << kInEvent) | \
                     (1 << kOutEvent) | \
                     (1 << kErrorEvent) | \
@@ -52,6 +68,8 @@ enum MessageFlags {
      (data & ~(1 << kInEvent | 1 << kOutEvent | 1 << kCloseEvent)) == 0)
 #define IS_LISTENING_SOCKET(data) \
     ((data & (1 << kListeningSocket)) != 0)  // NOLINT
+#define IS_TCP_SOCKET(data) \
+    ((data & (1 << kTcpSocket)) != 0)  // NOLINT
 #define TOKEN_COUNT(data) (data & ((1 << kCloseCommand) - 1))
 
 class TimeoutQueue {
@@ -643,10 +661,27 @@ class EventHandler {
 
   static EventHandlerImplementation* delegate();
 
+  // Whether the event handler should use io_uring instead of epoll, see
+  // --io-uring. Ignored on platforms other than Linux.
+  static bool use_io_uring() { return use_io_uring_; }
+  static void set_use_io_uring(bool value) { use_io_uring_ = value; }
+
+  // The number of event handler threads, see --event-handler-threads. Each
+  // thread waits for the events of its share of the descriptors and
+  // timers. Only Linux uses more than one thread.
+  static intptr_t num_threads() { return num_threads_; }
+  static void set_num_threads(intptr_t value) {
+    ASSERT(value >= 1);
+    num_threads_ = value;
+  }
+
  private:
   friend class EventHandlerImplementation;
   EventHandlerImplementation delegate_;
 
+  static bool use_io_uring_;
+  static intptr_t num_threads_;
+
   DISALLOW_COPY_AND_ASSIGN(EventHandler);
 };
 
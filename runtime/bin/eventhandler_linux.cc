@@ -16,6 +16,7 @@
 #include <stdio.h>  // NOLINT
 #include <string.h>  // NOLINT
 #include <sys/epoll.h>  // NOLINT
+#include <sys/mman.h>  // NOLINT
 #include <sys/stat.h>  // NOLINT
 #include <sys/timerfd.h>  // NOLINT
 #include <unistd.h>  // NOLINT
@@ -31,6 +32,70 @@
 namespace dart {
 namespace bin {
 
+// User data of the io_uring requests that are not for a descriptor. The user
+// data of polls and accepts is a generation count in the high 32 bits and
+// the file descriptor in the low bits, with kAcceptLowBit set for accepts.
+// The timeout has kTimeoutLowBits in the low bits. Reads and writes have
+// kBufferLowBits and the index of their buffer in the high bits.
+static const uint64_t kInterruptUserData = 1;
+static const uint64_t kIgnoreUserData = 2;
+static const uint32_t kTimeoutLowBits = 0xffffffff;
+static const uint32_t kBufferLowBits = 0xfffffffe;
+static const uint32_t kAcceptLowBit = 0x80000000;
+static const uint32_t kIOUringEntries = 256;
+
+// Each shard has 2MB of buffers for the reads and writes through io_uring.
+// A descriptor reads into one buffer at a time and the data of at most
+// kReadTokenCount reads is posted to Dart before it consumes some of it.
+static const intptr_t kNumReadBuffers = 64;
+static const intptr_t kNumWriteBuffers = 64;
+static const int kReadTokenCount = 8;
+
+
+static uint64_t BufferUserData(UringBuffer* buffer) {
+  return (static_cast<uint64_t>(buffer->index) << 32) | kBufferLowBits;
+}
+
+
+// Posts the data read for a socket as a Uint8List.
+static void PostData(Dart_Port port, uint8_t* data, intptr_t length) {
+  Dart_CObject message;
+  message.type = Dart_CObject_kTypedData;
+  message.value.as_typed_data.type = Dart_TypedData_kUint8;
+  message.value.as_typed_data.length = length;
+  message.value.as_typed_data.values = data;
+  Dart_PostCObject(port, &message);
+}
+
+
+// Posts a [kind, value] list, or a [kind, errno, message] list for the
+// errors.
+static void PostCompletion(Dart_Port port, CompletionKind kind,
+                           int32_t value) {
+  Dart_CObject kind_object;
+  kind_object.type = Dart_CObject_kInt32;
+  kind_object.value.as_int32 = kind;
+  Dart_CObject value_object;
+  value_object.type = Dart_CObject_kInt32;
+  value_object.value.as_int32 = value;
+  Dart_CObject message_object;
+  const int kBufferSize = 1024;
+  char error_buf[kBufferSize];
+  Dart_CObject* values[3] = { &kind_object, &value_object, &message_object };
+  intptr_t length = 2;
+  if ((kind == kReadErrorCompletion) || (kind == kWriteErrorCompletion)) {
+    message_object.type = Dart_CObject_kString;
+    message_object.value.as_string =
+        Utils::StrError(value, error_buf, kBufferSize);
+    length = 3;
+  }
+  Dart_CObject message;
+  message.type = Dart_CObject_kArray;
+  message.value.as_array.length = length;
+  message.value.as_array.values = values;
+  Dart_PostCObject(port, &message);
+}
+
 intptr_t DescriptorInfo::GetPollEvents() {
   // Do not ask for EPOLLERR and EPOLLHUP explicitly as they are
   // triggered anyway.
@@ -79,8 +144,24 @@ static void AddToEpollInstance(intptr_t epoll_fd_, DescriptorInfo* di) {
 }
 
 
-EventHandlerImplementation::EventHandlerImplementation()
-    : socket_map_(&HashMap::SamePointerValue, 16) {
+EventHandlerShard::EventHandlerShard(EventHandlerImplementation* owner)
+    : owner_(owner),
+      socket_map_(&HashMap::SamePointerValue, 16),
+      epoll_fd_(-1),
+      timer_fd_(-1),
+      uring_(NULL),
+      next_user_data_generation_(0),
+      timeout_user_data_(0),
+      timeout_dirty_(false),
+      buffer_memory_(NULL),
+      buffers_(NULL),
+      free_read_buffers_(NULL),
+      first_read_waiter_(NULL),
+      last_read_waiter_(NULL),
+      free_write_buffers_(NULL),
+      num_descriptors_(0),
+      num_events_(0),
+      num_messages_(0) {
   intptr_t result;
   result = NO_RETRY_EXPECTED(pipe(interrupt_fds_));
   if (result != 0) {
@@ -90,6 +171,16 @@ EventHandlerImplementation::EventHandlerImplementation()
   FDUtils::SetCloseOnExec(interrupt_fds_[0]);
   FDUtils::SetCloseOnExec(interrupt_fds_[1]);
   shutdown_ = false;
+  if (EventHandler::use_io_uring()) {
+    // Falls back to epoll if io_uring is not supported.
+    uring_ = IOUring::Create(kIOUringEntries);
+  }
+  if (uring_ != NULL) {
+    // io_uring replaces both the epoll instance and the timerfd.
+    uring_->PollAdd(interrupt_fds_[0], EPOLLIN, kInterruptUserData, false);
+    AllocateBuffers();
+    return;
+  }
   // The initial size passed to epoll_create is ignore on newer (>=
   // 2.6.8) Linux versions
   static const int kEpollInitialSize = 64;
@@ -127,16 +218,31 @@ EventHandlerImplementation::EventHandlerImplementation()
 }
 
 
-EventHandlerImplementation::~EventHandlerImplementation() {
-  VOID_TEMP_FAILURE_RETRY(close(epoll_fd_));
-  VOID_TEMP_FAILURE_RETRY(close(timer_fd_));
+EventHandlerShard::~EventHandlerShard() {
+  // Deleting the io_uring instance first also cancels its requests.
+  delete uring_;
+  if (buffer_memory_ != NULL) {
+    delete[] buffers_;
+    munmap(buffer_memory_,
+           (kNumReadBuffers + kNumWriteBuffers) * kUringBufferSize);
+  }
+  if (epoll_fd_ != -1) {
+    VOID_TEMP_FAILURE_RETRY(close(epoll_fd_));
+  }
+  if (timer_fd_ != -1) {
+    VOID_TEMP_FAILURE_RETRY(close(timer_fd_));
+  }
   VOID_TEMP_FAILURE_RETRY(close(interrupt_fds_[0]));
   VOID_TEMP_FAILURE_RETRY(close(interrupt_fds_[1]));
 }
 
 
-void EventHandlerImplementation::UpdateEpollInstance(intptr_t old_mask,
-                                                     DescriptorInfo *di) {
+void EventHandlerShard::UpdateEpollInstance(intptr_t old_mask,
+                                            DescriptorInfo *di) {
+  if (uring_ != NULL) {
+    UpdateIOUringPoll(old_mask, di);
+    return;
+  }
   intptr_t new_mask = di->Mask();
   if ((old_mask != 0) && (new_mask == 0)) {
     RemoveFromEpollInstance(epoll_fd_, di);
@@ -150,7 +256,7 @@ void EventHandlerImplementation::UpdateEpollInstance(intptr_t old_mask,
 }
 
 
-DescriptorInfo* EventHandlerImplementation::GetDescriptorInfo(
+DescriptorInfo* EventHandlerShard::GetDescriptorInfo(
     intptr_t fd, bool is_listening) {
   ASSERT(fd >= 0);
   HashMap::Entry* entry = socket_map_.Lookup(
@@ -166,15 +272,16 @@ DescriptorInfo* EventHandlerImplementation::GetDescriptorInfo(
       di = new DescriptorInfoSingle(fd);
     }
     entry->value = di;
+    num_descriptors_++;
   }
   ASSERT(fd == di->fd());
   return di;
 }
 
 
-void EventHandlerImplementation::WakeupHandler(intptr_t id,
-                                               Dart_Port dart_port,
-                                               int64_t data) {
+void EventHandlerShard::WakeupHandler(intptr_t id,
+                                      Dart_Port dart_port,
+                                      int64_t data) {
   InterruptMessage msg;
   msg.id = id;
   msg.dart_port = dart_port;
@@ -194,14 +301,22 @@ void EventHandlerImplementation::WakeupHandler(intptr_t id,
 }
 
 
-void EventHandlerImplementation::HandleInterruptFd() {
+void EventHandlerShard::HandleInterruptFd() {
   const intptr_t MAX_MESSAGES = kInterruptMessageSize;
   InterruptMessage msg[MAX_MESSAGES];
   ssize_t bytes = TEMP_FAILURE_RETRY_NO_SIGNAL_BLOCKER(
       read(interrupt_fds_[0], msg, MAX_MESSAGES * kInterruptMessageSize));
+  if (bytes > 0) {
+    num_messages_ += bytes / kInterruptMessageSize;
+  }
   for (ssize_t i = 0; i < bytes / kInterruptMessageSize; i++) {
     if (msg[i].id == kTimerId) {
       timeout_queue_.UpdateTimeout(msg[i].dart_port, msg[i].data);
+      if (uring_ != NULL) {
+        // Reprogrammed once before the next wait.
+        timeout_dirty_ = true;
+        continue;
+      }
       struct itimerspec it;
       memset(&it, 0, sizeof(it));
       if (timeout_queue_.HasTimeout()) {
@@ -218,14 +333,24 @@ void EventHandlerImplementation::HandleInterruptFd() {
 
       DescriptorInfo* di = GetDescriptorInfo(
           msg[i].id, IS_LISTENING_SOCKET(msg[i].data));
+      if ((uring_ != NULL) && IS_TCP_SOCKET(msg[i].data) &&
+          !di->uses_completions_) {
+        di->uses_completions_ = true;
+        di->read_tokens_ = kReadTokenCount;
+      }
       if (IS_COMMAND(msg[i].data, kShutdownReadCommand)) {
         ASSERT(!di->IsListeningSocket());
         // Close the socket for reading.
         VOID_NO_RETRY_EXPECTED(shutdown(di->fd(), SHUT_RD));
       } else if (IS_COMMAND(msg[i].data, kShutdownWriteCommand)) {
         ASSERT(!di->IsListeningSocket());
-        // Close the socket for writing.
-        VOID_NO_RETRY_EXPECTED(shutdown(di->fd(), SHUT_WR));
+        if (di->first_write_ != NULL) {
+          // Done once the queued writes are, see FinishWrites.
+          di->shutdown_write_pending_ = true;
+        } else {
+          // Close the socket for writing.
+          VOID_NO_RETRY_EXPECTED(shutdown(di->fd(), SHUT_WR));
+        }
       } else if (IS_COMMAND(msg[i].data, kCloseCommand)) {
         // Close the socket and free system resources and move on to next
         // message.
@@ -247,17 +372,11 @@ void EventHandlerImplementation::HandleInterruptFd() {
 
           if (registry->CloseSafe(fd)) {
             ASSERT(new_mask == 0);
-            socket_map_.Remove(GetHashmapKeyFromFd(fd),
-                               GetHashmapHashFromFd(fd));
-            di->Close();
-            delete di;
+            RemoveDescriptor(di);
           }
         } else {
           ASSERT(new_mask == 0);
-          socket_map_.Remove(
-              GetHashmapKeyFromFd(fd), GetHashmapHashFromFd(fd));
-          di->Close();
-          delete di;
+          RemoveDescriptor(di);
         }
 
         DartUtils::PostInt32(port, 1 << kDestroyedEvent);
@@ -266,6 +385,10 @@ void EventHandlerImplementation::HandleInterruptFd() {
         intptr_t old_mask = di->Mask();
         di->ReturnTokens(msg[i].dart_port, count);
         UpdateEpollInstance(old_mask, di);
+        if (di->uses_completions_) {
+          StartRead(di);
+          PostAccepted(di);
+        }
       } else if (IS_COMMAND(msg[i].data, kSetEventMaskCommand)) {
         // `events` can only have kInEvent/kOutEvent flags set.
         intptr_t events = msg[i].data & EVENT_MASK;
@@ -274,6 +397,35 @@ void EventHandlerImplementation::HandleInterruptFd() {
         intptr_t old_mask = di->Mask();
         di->SetPortAndMask(msg[i].dart_port, msg[i].data & EVENT_MASK);
         UpdateEpollInstance(old_mask, di);
+        if (di->uses_completions_) {
+          StartRead(di);
+          PostAccepted(di);
+        }
+      } else if (IS_COMMAND(msg[i].data, kReturnReadTokenCommand)) {
+        ASSERT(di->uses_completions_);
+        di->read_tokens_ += TOKEN_COUNT(msg[i].data);
+        ASSERT(di->read_tokens_ <= kReadTokenCount);
+        StartRead(di);
+      } else if (IS_COMMAND(msg[i].data, kWriteCommand)) {
+        ASSERT(di->uses_completions_);
+        UringBuffer* buffer = &buffers_[TOKEN_COUNT(msg[i].data)];
+        ASSERT(buffer->index >= kNumReadBuffers);
+        if (di->write_failed_) {
+          // Dart writes itself after a write failed, this one was queued
+          // before it knew.
+          ReturnWriteBuffer(buffer);
+        } else {
+          buffer->di = di;
+          buffer->next = NULL;
+          if (di->last_write_ == NULL) {
+            di->first_write_ = buffer;
+            di->last_write_ = buffer;
+            StartWrite(di, false);
+          } else {
+            di->last_write_->next = buffer;
+            di->last_write_ = buffer;
+          }
+        }
       } else {
         UNREACHABLE();
       }
@@ -315,8 +467,8 @@ static void PrintEventMask(intptr_t fd, intptr_t events) {
 #endif
 
 
-intptr_t EventHandlerImplementation::GetPollEvents(intptr_t events,
-                                                   DescriptorInfo* di) {
+intptr_t EventHandlerShard::GetPollEvents(intptr_t events,
+                                          DescriptorInfo* di) {
 #ifdef DEBUG_POLL
   PrintEventMask(di->fd(), events);
 #endif
@@ -338,8 +490,42 @@ intptr_t EventHandlerImplementation::GetPollEvents(intptr_t events,
 }
 
 
-void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
-                                              int size) {
+void EventHandlerShard::HandleDescriptorEvents(DescriptorInfo* di,
+                                               intptr_t events) {
+  intptr_t event_mask = GetPollEvents(events, di);
+
+  if ((event_mask & (1 << kErrorEvent)) != 0) {
+    di->NotifyAllDartPorts(event_mask);
+  }
+  event_mask &= ~(1 << kErrorEvent);
+
+  if (di->uses_completions_) {
+    // Instead of being notified, Dart gets the data read, the end of the
+    // stream or the accepted sockets.
+    if (di->IsListeningSocket()) {
+      if ((event_mask & (1 << kInEvent)) != 0) {
+        StartAccept(di);
+      }
+    } else if ((event_mask & (1 << kInEvent | 1 << kCloseEvent)) != 0) {
+      di->readable_ = true;
+      StartRead(di);
+    }
+    event_mask &= ~(1 << kInEvent | 1 << kCloseEvent);
+  }
+
+  if (event_mask != 0) {
+    intptr_t old_mask = di->Mask();
+    Dart_Port port = di->NextNotifyDartPort(event_mask);
+    ASSERT(port != 0);
+    UpdateEpollInstance(old_mask, di);
+    DartUtils::PostInt32(port, event_mask);
+    num_events_++;
+  }
+}
+
+
+void EventHandlerShard::HandleEvents(struct epoll_event* events,
+                                     int size) {
   bool interrupt_seen = false;
   for (int i = 0; i < size; i++) {
     if (events[i].data.ptr == NULL) {
@@ -351,24 +537,12 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
       if (timeout_queue_.HasTimeout()) {
         DartUtils::PostNull(timeout_queue_.CurrentPort());
         timeout_queue_.RemoveCurrent();
+        num_events_++;
       }
     } else {
       DescriptorInfo* di =
           reinterpret_cast<DescriptorInfo*>(events[i].data.ptr);
-      intptr_t event_mask = GetPollEvents(events[i].events, di);
-
-      if ((event_mask & (1 << kErrorEvent)) != 0) {
-        di->NotifyAllDartPorts(event_mask);
-      }
-      event_mask &= ~(1 << kErrorEvent);
-
-      if (event_mask != 0) {
-        intptr_t old_mask = di->Mask();
-        Dart_Port port = di->NextNotifyDartPort(event_mask);
-        ASSERT(port != 0);
-        UpdateEpollInstance(old_mask, di);
-        DartUtils::PostInt32(port, event_mask);
-      }
+      HandleDescriptorEvents(di, events[i].events);
     }
   }
   if (interrupt_seen) {
@@ -379,14 +553,18 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
 }
 
 
-void EventHandlerImplementation::Poll(uword args) {
+void EventHandlerShard::Poll(uword args) {
   ThreadSignalBlocker signal_blocker(SIGPROF);
   static const intptr_t kMaxEvents = 16;
   struct epoll_event events[kMaxEvents];
-  EventHandler* handler = reinterpret_cast<EventHandler*>(args);
-  EventHandlerImplementation* handler_impl = &handler->delegate_;
+  EventHandlerShard* handler_impl = reinterpret_cast<EventHandlerShard*>(args);
   ASSERT(handler_impl != NULL);
 
+  if (handler_impl->uring_ != NULL) {
+    handler_impl->PollIOUring();
+    handler_impl->owner_->NotifyShardShutdownDone();
+    return;
+  }
   while (!handler_impl->shutdown_) {
     intptr_t result = TEMP_FAILURE_RETRY_NO_SIGNAL_BLOCKER(
         epoll_wait(handler_impl->epoll_fd_, events, kMaxEvents, -1));
@@ -399,42 +577,581 @@ void EventHandlerImplementation::Poll(uword args) {
       handler_impl->HandleEvents(events, result);
     }
   }
-  handler->NotifyShutdownDone();
+  handler_impl->owner_->NotifyShardShutdownDone();
 }
 
 
-void EventHandlerImplementation::Start(EventHandler* handler) {
-  int result = Thread::Start(&EventHandlerImplementation::Poll,
-                             reinterpret_cast<uword>(handler));
-  if (result != 0) {
-    FATAL1("Failed to start event handler thread %d", result);
+uint64_t EventHandlerShard::NextUserData(uint32_t low_bits) {
+  // A new generation for every request tells completions of a request that
+  // was removed apart from the ones of its replacement.
+  next_user_data_generation_++;
+  if (next_user_data_generation_ == 0) {
+    next_user_data_generation_ = 1;
   }
+  return (static_cast<uint64_t>(next_user_data_generation_) << 32) | low_bits;
 }
 
 
-void EventHandlerImplementation::Shutdown() {
-  SendData(kShutdownId, 0, 0);
+void EventHandlerShard::UpdateIOUringPoll(intptr_t old_mask,
+                                          DescriptorInfo* di) {
+  intptr_t new_mask = di->Mask();
+  if ((di->poll_user_data() != 0) && (new_mask != old_mask)) {
+    uring_->PollRemove(di->poll_user_data(), kIgnoreUserData);
+    di->set_poll_user_data(0);
+  }
+  if ((new_mask != 0) && (di->poll_user_data() == 0) &&
+      (di->accept_user_data_ == 0) && (di->accepted_fd_ == -1)) {
+    // Like with epoll, listening sockets are level triggered: their poll is
+    // one shot and armed again after every completion, or after the accept
+    // it started and the connection it accepted was taken.
+    uint64_t user_data = NextUserData(di->fd());
+    uring_->PollAdd(di->fd(),
+                    EPOLLRDHUP | di->GetPollEvents(),
+                    user_data,
+                    !di->IsListeningSocket());
+    di->set_poll_user_data(user_data);
+  }
 }
 
 
-void EventHandlerImplementation::SendData(intptr_t id,
-                                          Dart_Port dart_port,
-                                          int64_t data) {
+void EventHandlerShard::UpdateIOUringTimeout() {
+  if (timeout_user_data_ != 0) {
+    uring_->TimeoutRemove(timeout_user_data_, kIgnoreUserData);
+    timeout_user_data_ = 0;
+  }
+  if (timeout_queue_.HasTimeout()) {
+    timeout_user_data_ = NextUserData(kTimeoutLowBits);
+    uring_->TimeoutAt(timeout_queue_.CurrentTimeout(), timeout_user_data_);
+  }
+  timeout_dirty_ = false;
+}
+
+
+void EventHandlerShard::AllocateBuffers() {
+  const intptr_t num_buffers = kNumReadBuffers + kNumWriteBuffers;
+  void* memory = mmap(NULL, num_buffers * kUringBufferSize,
+                      PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1, 0);
+  if (memory == MAP_FAILED) {
+    FATAL1("Failed allocating io_uring buffers: %i", errno);
+  }
+  buffer_memory_ = reinterpret_cast<uint8_t*>(memory);
+  // Without the registration, e.g. because of RLIMIT_MEMLOCK, the kernel
+  // maps the buffers for every request.
+  uring_->RegisterBuffers(buffer_memory_, num_buffers * kUringBufferSize);
+  buffers_ = new UringBuffer[num_buffers];
+  for (intptr_t i = num_buffers - 1; i >= 0; i--) {
+    UringBuffer* buffer = &buffers_[i];
+    buffer->data = buffer_memory_ + i * kUringBufferSize;
+    buffer->index = i;
+    buffer->length = 0;
+    buffer->offset = 0;
+    buffer->port = ILLEGAL_PORT;
+    buffer->di = NULL;
+    if (i < kNumReadBuffers) {
+      buffer->next = free_read_buffers_;
+      free_read_buffers_ = buffer;
+    } else {
+      buffer->next = free_write_buffers_;
+      free_write_buffers_ = buffer;
+    }
+  }
+}
+
+
+// Reads are started when a poll reported the socket readable, one at a
+// time, and only while Dart has read tokens and listens for reads. The
+// data is posted to Dart like the read events would be.
+void EventHandlerShard::StartRead(DescriptorInfo* di) {
+  if (!di->readable_ ||
+      di->read_closed_ ||
+      (di->read_buffer_ != NULL) ||
+      di->waiting_for_read_buffer_ ||
+      (di->read_tokens_ <= 0) ||
+      ((di->Mask() & (1 << kInEvent)) == 0)) {
+    return;
+  }
+  UringBuffer* buffer = free_read_buffers_;
+  if (buffer == NULL) {
+    // Started again by ReturnReadBuffer.
+    di->waiting_for_read_buffer_ = true;
+    di->next_read_waiter_ = NULL;
+    if (last_read_waiter_ == NULL) {
+      first_read_waiter_ = di;
+    } else {
+      last_read_waiter_->next_read_waiter_ = di;
+    }
+    last_read_waiter_ = di;
+    return;
+  }
+  free_read_buffers_ = buffer->next;
+  buffer->next = NULL;
+  buffer->di = di;
+  di->read_buffer_ = buffer;
+  di->readable_ = false;
+  uring_->Read(di->fd(), buffer->data, kUringBufferSize,
+               BufferUserData(buffer));
+}
+
+
+void EventHandlerShard::HandleReadCompletion(UringBuffer* buffer,
+                                             int32_t result) {
+  DescriptorInfo* di = buffer->di;
+  if (di == NULL) {
+    // The descriptor was closed while reading.
+    ReturnReadBuffer(buffer);
+    return;
+  }
+  ASSERT(di->read_buffer_ == buffer);
+  di->read_buffer_ = NULL;
+  if ((result == -EAGAIN) || (result == -EINTR)) {
+    // Read again on the next poll event, or right away if interrupted.
+    if (result == -EINTR) {
+      di->readable_ = true;
+    }
+    ReturnReadBuffer(buffer);
+    StartRead(di);
+    return;
+  }
+  intptr_t old_mask = di->Mask();
+  Dart_Port port = di->NextNotifyDartPort(1 << kInEvent);
+  ASSERT(port != 0);
+  if (result > 0) {
+    // The data is copied by Dart_PostCObject.
+    PostData(port, buffer->data, result);
+    di->read_tokens_--;
+    if (result == kUringBufferSize) {
+      // There is probably more to read, the poll might not report it.
+      di->readable_ = true;
+    }
+  } else if (result == 0) {
+    di->read_closed_ = true;
+    DartUtils::PostInt32(port, 1 << kCloseEvent);
+  } else {
+    di->read_closed_ = true;
+    PostCompletion(port, kReadErrorCompletion, -result);
+  }
+  num_events_++;
+  ReturnReadBuffer(buffer);
+  UpdateEpollInstance(old_mask, di);
+  StartRead(di);
+}
+
+
+void EventHandlerShard::ReturnReadBuffer(UringBuffer* buffer) {
+  buffer->di = NULL;
+  buffer->next = free_read_buffers_;
+  free_read_buffers_ = buffer;
+  while ((free_read_buffers_ != NULL) && (first_read_waiter_ != NULL)) {
+    DescriptorInfo* di = first_read_waiter_;
+    first_read_waiter_ = di->next_read_waiter_;
+    if (first_read_waiter_ == NULL) {
+      last_read_waiter_ = NULL;
+    }
+    di->next_read_waiter_ = NULL;
+    di->waiting_for_read_buffer_ = false;
+    StartRead(di);
+  }
+}
+
+
+UringBuffer* EventHandlerShard::TakeWriteBuffer() {
+  MutexLocker locker(&write_buffers_mutex_);
+  UringBuffer* buffer = free_write_buffers_;
+  if (buffer != NULL) {
+    free_write_buffers_ = buffer->next;
+    buffer->next = NULL;
+  }
+  return buffer;
+}
+
+
+void EventHandlerShard::ReturnWriteBuffer(UringBuffer* buffer) {
+  buffer->di = NULL;
+  MutexLocker locker(&write_buffers_mutex_);
+  buffer->next = free_write_buffers_;
+  free_write_buffers_ = buffer;
+}
+
+
+void EventHandlerShard::QueueWrite(intptr_t fd,
+                                   Dart_Port dart_port,
+                                   UringBuffer* buffer,
+                                   intptr_t length) {
+  ASSERT((length > 0) && (length <= kUringBufferSize));
+  buffer->length = length;
+  buffer->offset = 0;
+  buffer->port = dart_port;
+  // The buffer is only used by the shard thread once it has read the
+  // message from the interrupt pipe.
+  SendData(fd, dart_port,
+           (1 << kWriteCommand) | (1 << kTcpSocket) | buffer->index);
+}
+
+
+void EventHandlerShard::StartWrite(DescriptorInfo* di, bool wait_writable) {
+  UringBuffer* buffer = di->first_write_;
+  ASSERT(buffer != NULL);
+  if (wait_writable) {
+    uring_->WaitWritable(di->fd(), kIgnoreUserData);
+  }
+  uring_->Write(di->fd(),
+                buffer->data + buffer->offset,
+                buffer->length - buffer->offset,
+                BufferUserData(buffer));
+}
+
+
+void EventHandlerShard::HandleWriteCompletion(UringBuffer* buffer,
+                                              int32_t result) {
+  DescriptorInfo* di = buffer->di;
+  if (di == NULL) {
+    // The socket was closed while writing.
+    ReturnWriteBuffer(buffer);
+    return;
+  }
+  ASSERT(di->first_write_ == buffer);
+  if ((result == -EAGAIN) || (result == -EINTR) ||
+      ((result >= 0) && (buffer->offset + result < buffer->length))) {
+    // Write the rest once the socket is writable again.
+    if (result > 0) {
+      buffer->offset += result;
+    }
+    StartWrite(di, result != -EINTR);
+    return;
+  }
+  if (result > 0) {
+    di->first_write_ = buffer->next;
+    if (di->first_write_ == NULL) {
+      di->last_write_ = NULL;
+    }
+    PostCompletion(buffer->port, kWriteCompletion, buffer->length);
+    ReturnWriteBuffer(buffer);
+  } else {
+    // Dart writes itself from now on and reports the error.
+    PostCompletion(buffer->port, kWriteErrorCompletion, -result);
+    di->write_failed_ = true;
+    while (di->first_write_ != NULL) {
+      UringBuffer* next = di->first_write_->next;
+      ReturnWriteBuffer(di->first_write_);
+      di->first_write_ = next;
+    }
+    di->last_write_ = NULL;
+  }
+  num_events_++;
+  if (di->first_write_ != NULL) {
+    StartWrite(di, false);
+  } else {
+    FinishWrites(di);
+  }
+}
+
+
+// Does what Dart asked for while the writes were queued.
+void EventHandlerShard::FinishWrites(DescriptorInfo* di) {
+  ASSERT(di->first_write_ == NULL);
+  if (di->shutdown_write_pending_) {
+    di->shutdown_write_pending_ = false;
+    VOID_NO_RETRY_EXPECTED(shutdown(di->fd(), SHUT_WR));
+  }
+}
+
+
+// Listening sockets accept one connection at a time. Their poll is armed
+// again once the accept completes.
+void EventHandlerShard::StartAccept(DescriptorInfo* di) {
+  ASSERT(di->IsListeningSocket());
+  if (di->accept_user_data_ != 0) {
+    return;
+  }
+  di->accept_user_data_ = NextUserData(kAcceptLowBit | di->fd());
+  uring_->Accept(di->fd(), di->accept_user_data_);
+}
+
+
+void EventHandlerShard::HandleAcceptCompletion(uint64_t user_data,
+                                               int32_t result) {
+  intptr_t fd = static_cast<uint32_t>(user_data) & ~kAcceptLowBit;
+  HashMap::Entry* entry = socket_map_.Lookup(
+      GetHashmapKeyFromFd(fd), GetHashmapHashFromFd(fd), false);
+  DescriptorInfo* di = (entry == NULL)
+      ? NULL
+      : reinterpret_cast<DescriptorInfo*>(entry->value);
+  if ((di == NULL) || (di->accept_user_data_ != user_data)) {
+    // The accept was canceled with its descriptor, but might have accepted
+    // a connection already.
+    if (result >= 0) {
+      VOID_TEMP_FAILURE_RETRY(close(result));
+    }
+    return;
+  }
+  di->accept_user_data_ = 0;
+  if (result >= 0) {
+    di->accepted_fd_ = result;
+    PostAccepted(di);
+  } else {
+    // Errors, e.g. EAGAIN when another process accepted the connection, are
+    // ignored like when accepting from Dart.
+    UpdateIOUringPoll(di->Mask(), di);
+  }
+}
+
+
+// Posts the accepted connection to an isolate that listens and has tokens.
+// Another one might take it if the isolate that was polling stopped
+// listening since. If none is ready, the connection is kept until one is
+// and nothing else is accepted meanwhile.
+void EventHandlerShard::PostAccepted(DescriptorInfo* di) {
+  if (di->accepted_fd_ == -1) {
+    return;
+  }
+  intptr_t old_mask = di->Mask();
+  Dart_Port port = di->NextNotifyDartPort(1 << kInEvent);
+  if (port == 0) {
+    return;
+  }
+  PostCompletion(port, kAcceptCompletion, di->accepted_fd_);
+  di->accepted_fd_ = -1;
+  num_events_++;
+  UpdateIOUringPoll(old_mask, di);
+}
+
+
+void EventHandlerShard::CancelCompletions(DescriptorInfo* di) {
+  di->read_closed_ = true;
+  if (di->read_buffer_ != NULL) {
+    // The buffer is returned when the read completes.
+    di->read_buffer_->di = NULL;
+    uring_->Cancel(BufferUserData(di->read_buffer_), kIgnoreUserData);
+    di->read_buffer_ = NULL;
+  }
+  if (di->waiting_for_read_buffer_) {
+    DescriptorInfo* previous = NULL;
+    DescriptorInfo* current = first_read_waiter_;
+    while (current != di) {
+      previous = current;
+      current = current->next_read_waiter_;
+    }
+    if (previous == NULL) {
+      first_read_waiter_ = di->next_read_waiter_;
+    } else {
+      previous->next_read_waiter_ = di->next_read_waiter_;
+    }
+    if (last_read_waiter_ == di) {
+      last_read_waiter_ = previous;
+    }
+    di->next_read_waiter_ = NULL;
+    di->waiting_for_read_buffer_ = false;
+  }
+  if (di->accept_user_data_ != 0) {
+    uring_->Cancel(di->accept_user_data_, kIgnoreUserData);
+    di->accept_user_data_ = 0;
+  }
+  if (di->accepted_fd_ != -1) {
+    VOID_TEMP_FAILURE_RETRY(close(di->accepted_fd_));
+    di->accepted_fd_ = -1;
+  }
+  if (di->first_write_ != NULL) {
+    // The queued writes are dropped, Dart waits for them before closing
+    // unless the socket is destroyed. Shutting the socket down makes the
+    // write in progress, or the poll it waits for, fail instead of waiting
+    // for the peer. Its buffer is returned when it completes.
+    di->first_write_->di = NULL;
+    UringBuffer* buffer = di->first_write_->next;
+    while (buffer != NULL) {
+      UringBuffer* next = buffer->next;
+      ReturnWriteBuffer(buffer);
+      buffer = next;
+    }
+    di->first_write_ = NULL;
+    di->last_write_ = NULL;
+    di->shutdown_write_pending_ = false;
+    VOID_NO_RETRY_EXPECTED(shutdown(di->fd(), SHUT_WR));
+  }
+}
+
+
+void EventHandlerShard::RemoveDescriptor(DescriptorInfo* di) {
+  if (di->uses_completions_) {
+    CancelCompletions(di);
+  }
+  ASSERT(di->first_write_ == NULL);
+  socket_map_.Remove(GetHashmapKeyFromFd(di->fd()),
+                     GetHashmapHashFromFd(di->fd()));
+  num_descriptors_--;
+  di->Close();
+  delete di;
+}
+
+
+void EventHandlerShard::HandleCompletions() {
+  bool interrupt_seen = false;
+  uint64_t user_data;
+  int32_t result;
+  bool more;
+  while (uring_->NextCompletion(&user_data, &result, &more)) {
+    if (user_data == kInterruptUserData) {
+      interrupt_seen = true;
+    } else if (user_data == kIgnoreUserData) {
+      // Completion of a remove request.
+    } else if (static_cast<uint32_t>(user_data) == kBufferLowBits) {
+      UringBuffer* buffer = &buffers_[user_data >> 32];
+      if (buffer->index < kNumReadBuffers) {
+        HandleReadCompletion(buffer, result);
+      } else {
+        HandleWriteCompletion(buffer, result);
+      }
+    } else if (static_cast<uint32_t>(user_data) == kTimeoutLowBits) {
+      // Completions of removed timeouts are ignored.
+      if (user_data == timeout_user_data_) {
+        timeout_user_data_ = 0;
+        timeout_dirty_ = true;
+        if ((result == -ETIME) && timeout_queue_.HasTimeout()) {
+          DartUtils::PostNull(timeout_queue_.CurrentPort());
+          timeout_queue_.RemoveCurrent();
+          num_events_++;
+        }
+      }
+    } else if ((static_cast<uint32_t>(user_data) & kAcceptLowBit) != 0) {
+      HandleAcceptCompletion(user_data, result);
+    } else {
+      intptr_t fd = static_cast<uint32_t>(user_data);
+      HashMap::Entry* entry = socket_map_.Lookup(
+          GetHashmapKeyFromFd(fd), GetHashmapHashFromFd(fd), false);
+      DescriptorInfo* di = (entry == NULL)
+          ? NULL
+          : reinterpret_cast<DescriptorInfo*>(entry->value);
+      if ((di == NULL) || (di->poll_user_data() != user_data)) {
+        // The poll was removed, possibly with the descriptor.
+        continue;
+      }
+      if (!more) {
+        di->set_poll_user_data(0);
+      }
+      if (result < 0) {
+        // The descriptor cannot be polled, e.g. /dev/null. Like when epoll
+        // does not accept it, mark it as closed and do not poll it again.
+        di->NotifyAllDartPorts(1 << kCloseEvent);
+      } else {
+        HandleDescriptorEvents(di, result);
+        UpdateIOUringPoll(di->Mask(), di);
+      }
+    }
+  }
+  if (interrupt_seen) {
+    // Handle after socket events, so we avoid closing a socket before we handle
+    // the current events.
+    HandleInterruptFd();
+    uring_->PollAdd(interrupt_fds_[0], EPOLLIN, kInterruptUserData, false);
+  }
+}
+
+
+void EventHandlerShard::PollIOUring() {
+  while (!shutdown_) {
+    if (timeout_dirty_) {
+      UpdateIOUringTimeout();
+    }
+    // Submits the requests queued while handling the previous completions
+    // in the same system call.
+    if (!uring_->SubmitAndWait()) {
+      perror("Poll failed");
+    }
+    HandleCompletions();
+  }
+}
+
+
+void EventHandlerShard::Start() {
+  int result = Thread::Start(&EventHandlerShard::Poll,
+                             reinterpret_cast<uword>(this));
+  if (result != 0) {
+    FATAL1("Failed to start event handler thread %d", result);
+  }
+}
+
+
+void EventHandlerShard::SendData(intptr_t id,
+                                 Dart_Port dart_port,
+                                 int64_t data) {
   WakeupHandler(id, dart_port, data);
 }
 
 
-void* EventHandlerImplementation::GetHashmapKeyFromFd(intptr_t fd) {
+void* EventHandlerShard::GetHashmapKeyFromFd(intptr_t fd) {
   // The hashmap does not support keys with value 0.
   return reinterpret_cast<void*>(fd + 1);
 }
 
 
-uint32_t EventHandlerImplementation::GetHashmapHashFromFd(intptr_t fd) {
+uint32_t EventHandlerShard::GetHashmapHashFromFd(intptr_t fd) {
   // The hashmap does not support keys with value 0.
   return dart::Utils::WordHash(fd + 1);
 }
 
+
+EventHandlerImplementation::EventHandlerImplementation()
+    : handler_(NULL),
+      shards_(NULL),
+      num_shards_(EventHandler::num_threads()),
+      num_running_shards_(0) {
+  ASSERT(num_shards_ >= 1);
+  shards_ = new EventHandlerShard*[num_shards_];
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    shards_[i] = new EventHandlerShard(this);
+  }
+}
+
+
+EventHandlerImplementation::~EventHandlerImplementation() {
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    delete shards_[i];
+  }
+  delete[] shards_;
+}
+
+
+void EventHandlerImplementation::Start(EventHandler* handler) {
+  handler_ = handler;
+  num_running_shards_ = num_shards_;
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    shards_[i]->Start();
+  }
+}
+
+
+void EventHandlerImplementation::Shutdown() {
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    shards_[i]->SendData(kShutdownId, 0, 0);
+  }
+}
+
+
+void EventHandlerImplementation::NotifyShardShutdownDone() {
+  bool done;
+  {
+    MutexLocker locker(&shutdown_mutex_);
+    num_running_shards_--;
+    done = (num_running_shards_ == 0);
+  }
+  if (done) {
+    handler_->NotifyShutdownDone();
+  }
+}
+
+
+void EventHandlerImplementation::SendData(intptr_t id,
+                                          Dart_Port dart_port,
+                                          int64_t data) {
+  // Descriptors are assigned to shards by file descriptor rather than by
+  // isolate, because a listening socket can be shared by several isolates.
+  // Timers are assigned by port, so that the updates of a timer go to the
+  // shard that has it in its queue.
+  ASSERT(id != kShutdownId);
+  uint64_t key = (id == kTimerId) ? static_cast<uint64_t>(dart_port) : id;
+  shards_[key % num_shards_]->SendData(id, dart_port, data);
+}
+
 }  // namespace bin
 }  // namespace dart
 
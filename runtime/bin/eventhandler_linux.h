@@ -14,6 +14,8 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "bin/io_uring_linux.h"
+#include "bin/thread.h"
 #include "platform/hashmap.h"
 #include "platform/signal_blocker.h"
 
@@ -21,20 +23,92 @@
 namespace dart {
 namespace bin {
 
+class DescriptorInfo;
+
+// A buffer of the reads and writes an event handler shard does through
+// io_uring for TCP sockets.
+struct UringBuffer {
+  uint8_t* data;
+  intptr_t index;
+  // The number of bytes to write and the number written so far.
+  intptr_t length;
+  intptr_t offset;
+  // The port to post write completions to.
+  Dart_Port port;
+  // The descriptor the buffer is read into or written from, or NULL if it
+  // is free or the descriptor was closed while it was in use.
+  DescriptorInfo* di;
+  // The next free buffer or the next queued write.
+  UringBuffer* next;
+};
+
+
 class DescriptorInfo : public DescriptorInfoBase {
  public:
-  explicit DescriptorInfo(intptr_t fd) : DescriptorInfoBase(fd) { }
+  explicit DescriptorInfo(intptr_t fd)
+      : DescriptorInfoBase(fd),
+        poll_user_data_(0),
+        uses_completions_(false),
+        read_tokens_(0),
+        readable_(false),
+        read_closed_(false),
+        read_buffer_(NULL),
+        waiting_for_read_buffer_(false),
+        next_read_waiter_(NULL),
+        first_write_(NULL),
+        last_write_(NULL),
+        write_failed_(false),
+        shutdown_write_pending_(false),
+        accept_user_data_(0),
+        accepted_fd_(-1) { }
 
   virtual ~DescriptorInfo() { }
 
   intptr_t GetPollEvents();
 
+  // The user data of the io_uring poll request armed for this descriptor,
+  // or 0 if there is none.
+  uint64_t poll_user_data() const { return poll_user_data_; }
+  void set_poll_user_data(uint64_t value) { poll_user_data_ = value; }
+
   virtual void Close() {
     VOID_TEMP_FAILURE_RETRY(close(fd_));
     fd_ = -1;
   }
 
  private:
+  friend class EventHandlerShard;
+
+  uint64_t poll_user_data_;
+
+  // For TCP sockets, the io_uring backend reads, writes and accepts itself
+  // and posts the results, see EventHandlerShard::StartRead.
+  bool uses_completions_;
+
+  // Reads are only started while Dart has consumed enough of the data
+  // posted, it returns read tokens for that.
+  int read_tokens_;
+  // Set when a poll reported data or the end of the stream that was not
+  // read yet.
+  bool readable_;
+  bool read_closed_;
+  UringBuffer* read_buffer_;
+  bool waiting_for_read_buffer_;
+  DescriptorInfo* next_read_waiter_;
+
+  // Writes are done one at a time in the order they are queued.
+  UringBuffer* first_write_;
+  UringBuffer* last_write_;
+  bool write_failed_;
+  // Shutting down waits for the queued writes. Closing drops them, see
+  // EventHandlerShard::CancelCompletions.
+  bool shutdown_write_pending_;
+
+  // The user data of the accept in progress, or 0.
+  uint64_t accept_user_data_;
+  // A connection accepted while no isolate was ready to take it, or -1.
+  intptr_t accepted_fd_;
+
   DISALLOW_COPY_AND_ASSIGN(DescriptorInfo);
 };
 
@@ -63,10 +137,15 @@ class DescriptorInfoMultiple
 };
 
 
-class EventHandlerImplementation {
+class EventHandlerImplementation;
+
+// One event handler thread with its own epoll instance (or io_uring
+// instance), timeout queue and interrupt pipe. Every descriptor and timer
+// is owned by exactly one shard.
+class EventHandlerShard {
  public:
-  EventHandlerImplementation();
-  ~EventHandlerImplementation();
+  explicit EventHandlerShard(EventHandlerImplementation* owner);
+  ~EventHandlerShard();
 
   void UpdateEpollInstance(intptr_t old_mask, DescriptorInfo *di);
 
@@ -74,12 +153,56 @@ class EventHandlerImplementation {
   // descriptor. Creates a new one if one is not found.
   DescriptorInfo* GetDescriptorInfo(intptr_t fd, bool is_listening);
   void SendData(intptr_t id, Dart_Port dart_port, int64_t data);
-  void Start(EventHandler* handler);
-  void Shutdown();
+  void Start();
+
+  // Whether the shard does the reads, writes and accepts of TCP sockets
+  // through io_uring.
+  bool uses_completions() const { return uring_ != NULL; }
+
+  // Queued writes are copied by the isolates into a write buffer taken from
+  // the shard of the socket, at most kUringBufferSize bytes each. Returns NULL
+  // if there is no free buffer.
+  UringBuffer* TakeWriteBuffer();
+  void ReturnWriteBuffer(UringBuffer* buffer);
+  void QueueWrite(intptr_t fd, Dart_Port dart_port, UringBuffer* buffer,
+                  intptr_t length);
+
+  // Keep in sync with _NativeSocket.QUEUED_WRITE_SIZE in socket_patch.dart.
+  static const intptr_t kUringBufferSize = 16 * KB;
+
+  // Load of the shard. These are read by other threads without
+  // synchronization and are only approximate.
+  intptr_t num_descriptors() const { return num_descriptors_; }
+  int64_t num_events() const { return num_events_; }
+  int64_t num_messages() const { return num_messages_; }
 
  private:
   void HandleEvents(struct epoll_event* events, int size);
+  void HandleDescriptorEvents(DescriptorInfo* di, intptr_t events);
   static void Poll(uword args);
+
+  // The io_uring backend, used instead of epoll and the timerfd if uring_
+  // is not NULL.
+  void UpdateIOUringPoll(intptr_t old_mask, DescriptorInfo* di);
+  void UpdateIOUringTimeout();
+  void HandleCompletions();
+  void PollIOUring();
+  uint64_t NextUserData(uint32_t low_bits);
+
+  // Reads, writes and accepts through io_uring, see
+  // DescriptorInfo::uses_completions_.
+  void AllocateBuffers();
+  void StartRead(DescriptorInfo* di);
+  void HandleReadCompletion(UringBuffer* buffer, int32_t result);
+  void ReturnReadBuffer(UringBuffer* buffer);
+  void StartWrite(DescriptorInfo* di, bool wait_writable);
+  void HandleWriteCompletion(UringBuffer* buffer, int32_t result);
+  void FinishWrites(DescriptorInfo* di);
+  void StartAccept(DescriptorInfo* di);
+  void HandleAcceptCompletion(uint64_t user_data, int32_t result);
+  void PostAccepted(DescriptorInfo* di);
+  void CancelCompletions(DescriptorInfo* di);
+  void RemoveDescriptor(DescriptorInfo* di);
   void WakeupHandler(intptr_t id, Dart_Port dart_port, int64_t data);
   void HandleInterruptFd();
   void SetPort(intptr_t fd, Dart_Port dart_port, intptr_t mask);
@@ -87,12 +210,68 @@ class EventHandlerImplementation {
   static void* GetHashmapKeyFromFd(intptr_t fd);
   static uint32_t GetHashmapHashFromFd(intptr_t fd);
 
+  EventHandlerImplementation* owner_;
   HashMap socket_map_;
   TimeoutQueue timeout_queue_;
   bool shutdown_;
   int interrupt_fds_[2];
   int epoll_fd_;
   int timer_fd_;
+  IOUring* uring_;
+  uint32_t next_user_data_generation_;
+  uint64_t timeout_user_data_;
+  bool timeout_dirty_;
+
+  // The buffers of the reads and writes through io_uring, all in one
+  // registered memory area. The read buffers are only used by the shard
+  // thread, the write buffers are taken by the isolates.
+  uint8_t* buffer_memory_;
+  UringBuffer* buffers_;
+  UringBuffer* free_read_buffers_;
+  DescriptorInfo* first_read_waiter_;
+  DescriptorInfo* last_read_waiter_;
+  Mutex write_buffers_mutex_;
+  UringBuffer* free_write_buffers_;
+
+  intptr_t num_descriptors_;
+  int64_t num_events_;
+  int64_t num_messages_;
+
+  DISALLOW_COPY_AND_ASSIGN(EventHandlerShard);
+};
+
+
+class EventHandlerImplementation {
+ public:
+  EventHandlerImplementation();
+  ~EventHandlerImplementation();
+
+  void SendData(intptr_t id, Dart_Port dart_port, int64_t data);
+  void Start(EventHandler* handler);
+  void Shutdown();
+
+  // The shard that owns the descriptor.
+  EventHandlerShard* DescriptorShard(intptr_t fd) const {
+    return shards_[fd % num_shards_];
+  }
+
+  intptr_t num_shards() const { return num_shards_; }
+  EventHandlerShard* shard(intptr_t index) const {
+    ASSERT((index >= 0) && (index < num_shards_));
+    return shards_[index];
+  }
+
+ private:
+  friend class EventHandlerShard;
+
+  // Called by each shard when its thread exits.
+  void NotifyShardShutdownDone();
+
+  EventHandler* handler_;
+  EventHandlerShard** shards_;
+  intptr_t num_shards_;
+  Mutex shutdown_mutex_;
+  intptr_t num_running_shards_;
 
   DISALLOW_COPY_AND_ASSIGN(EventHandlerImplementation);
 };
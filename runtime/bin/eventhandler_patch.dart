@@ -12,5 +12,16 @@ patch class _EventHandler {
 
   static int _timerMillisecondClock()
       native "EventHandler_TimerMillisecondClock";
+
+  static List<int> _shardStatistics()
+      native "EventHandler_ShardStatistics";
+
+  static int _queueWrite(Object sender,
+                         SendPort sendPort,
+                         List buffers,
+                         List<int> starts,
+                         List<int> ends,
+                         int maxWrites)
+      native "EventHandler_QueueWrite";
 }
 
@@ -13,6 +13,10 @@
 namespace dart {
 namespace bin {
 
+bool EventHandler::use_io_uring_ = false;
+intptr_t EventHandler::num_threads_ = 1;
+
+
 void EventHandler::Start() {
 }
 
@@ -33,6 +37,18 @@ void FUNCTION_NAME(EventHandler_TimerMillisecondClock)(
         "EventHandler is not supported on this platform"));
 }
 
+
+void FUNCTION_NAME(EventHandler_ShardStatistics)(Dart_NativeArguments args) {
+  Dart_ThrowException(DartUtils::NewInternalError(
+        "EventHandler is not supported on this platform"));
+}
+
+
+void FUNCTION_NAME(EventHandler_QueueWrite)(Dart_NativeArguments args) {
+  Dart_ThrowException(DartUtils::NewInternalError(
+        "EventHandler is not supported on this platform"));
+}
+
 }  // namespace bin
 }  // namespace dart
 
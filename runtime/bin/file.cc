@@ -15,6 +15,8 @@
 #include "include/dart_api.h"
 #include "include/dart_tools_api.h"
 
+#include "platform/utils.h"
+
 namespace dart {
 namespace bin {
 
@@ -157,6 +159,35 @@ void FUNCTION_NAME(File_WriteByte)(Dart_NativeArguments args) {
 }
 
 
+// Returns the bytes read into an external array of length bytes, as a view
+// if the read was short.
+static Dart_Handle ReadResult(Dart_Handle external_array,
+                              int64_t length,
+                              int64_t bytes_read) {
+  if (bytes_read < 0) {
+    return DartUtils::NewDartOSError();
+  }
+  if (bytes_read == length) {
+    return external_array;
+  }
+  const int kNumArgs = 3;
+  Dart_Handle dart_args[kNumArgs];
+  dart_args[0] = external_array;
+  dart_args[1] = Dart_NewInteger(0);
+  dart_args[2] = Dart_NewInteger(bytes_read);
+  // TODO(sgjesse): Cache the _makeUint8ListView function somewhere.
+  Dart_Handle io_lib =
+      Dart_LookupLibrary(DartUtils::NewString("dart:io"));
+  if (Dart_IsError(io_lib)) {
+    Dart_PropagateError(io_lib);
+  }
+  return Dart_Invoke(io_lib,
+                     DartUtils::NewString("_makeUint8ListView"),
+                     kNumArgs,
+                     dart_args);
+}
+
+
 void FUNCTION_NAME(File_Read)(Dart_NativeArguments args) {
   File* file = GetFile(args);
   ASSERT(file != NULL);
@@ -166,31 +197,26 @@ void FUNCTION_NAME(File_Read)(Dart_NativeArguments args) {
     uint8_t* buffer = NULL;
     Dart_Handle external_array = IOBuffer::Allocate(length, &buffer);
     int64_t bytes_read = file->Read(reinterpret_cast<void*>(buffer), length);
-    if (bytes_read < 0) {
-      Dart_SetReturnValue(args, DartUtils::NewDartOSError());
-    } else {
-      if (bytes_read < length) {
-        const int kNumArgs = 3;
-        Dart_Handle dart_args[kNumArgs];
-        dart_args[0] = external_array;
-        dart_args[1] = Dart_NewInteger(0);
-        dart_args[2] = Dart_NewInteger(bytes_read);
-        // TODO(sgjesse): Cache the _makeUint8ListView function somewhere.
-        Dart_Handle io_lib =
-            Dart_LookupLibrary(DartUtils::NewString("dart:io"));
-        if (Dart_IsError(io_lib)) {
-          Dart_PropagateError(io_lib);
-        }
-        Dart_Handle array_view =
-            Dart_Invoke(io_lib,
-                        DartUtils::NewString("_makeUint8ListView"),
-                        kNumArgs,
-                        dart_args);
-        Dart_SetReturnValue(args, array_view);
-      } else {
-        Dart_SetReturnValue(args, external_array);
-      }
-    }
+    Dart_SetReturnValue(args, ReadResult(external_array, length, bytes_read));
+  } else {
+    OSError os_error(-1, "Invalid argument", OSError::kUnknown);
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+  }
+}
+
+
+void FUNCTION_NAME(File_ReadAt)(Dart_NativeArguments args) {
+  File* file = GetFile(args);
+  ASSERT(file != NULL);
+  int64_t position = 0;
+  int64_t length = 0;
+  if (DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 1), &position) &&
+      DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 2), &length)) {
+    uint8_t* buffer = NULL;
+    Dart_Handle external_array = IOBuffer::Allocate(length, &buffer);
+    int64_t bytes_read =
+        file->ReadAt(reinterpret_cast<void*>(buffer), length, position);
+    Dart_SetReturnValue(args, ReadResult(external_array, length, bytes_read));
   } else {
     OSError os_error(-1, "Invalid argument", OSError::kUnknown);
     Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
@@ -233,7 +259,9 @@ void FUNCTION_NAME(File_ReadInto)(Dart_NativeArguments args) {
 }
 
 
-void FUNCTION_NAME(File_WriteFrom)(Dart_NativeArguments args) {
+// Writes the bytes from start to end of the typed data argument 1 to the
+// file, at position or at the file position if position is -1.
+static void WriteFrom(Dart_NativeArguments args, int64_t position) {
   File* file = GetFile(args);
   ASSERT(file != NULL);
 
@@ -265,7 +293,12 @@ void FUNCTION_NAME(File_WriteFrom)(Dart_NativeArguments args) {
   ASSERT(buffer != NULL);
 
   // Write all the data out into the file.
-  bool success = file->WriteFully(buffer, length);
+  bool success;
+  if (position == -1) {
+    success = file->WriteFully(buffer, length);
+  } else {
+    success = file->WriteAtFully(buffer, length, position);
+  }
 
   // Release the direct pointer acquired above.
   result = Dart_TypedDataReleaseData(buffer_obj);
@@ -281,6 +314,23 @@ void FUNCTION_NAME(File_WriteFrom)(Dart_NativeArguments args) {
 }
 
 
+void FUNCTION_NAME(File_WriteFrom)(Dart_NativeArguments args) {
+  WriteFrom(args, -1);
+}
+
+
+void FUNCTION_NAME(File_WriteFromAt)(Dart_NativeArguments args) {
+  int64_t position = 0;
+  if (!DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 4), &position) ||
+      (position < 0)) {
+    OSError os_error(-1, "Invalid argument", OSError::kUnknown);
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+    return;
+  }
+  WriteFrom(args, position);
+}
+
+
 void FUNCTION_NAME(File_Position)(Dart_NativeArguments args) {
   File* file = GetFile(args);
   ASSERT(file != NULL);
@@ -398,6 +448,74 @@ void FUNCTION_NAME(File_Lock)(Dart_NativeArguments args) {
 }
 
 
+// Whether start to end, where an end of -1 is the end of the file, is a
+// range that can be mapped.
+static bool IsValidMapRange(int64_t start, int64_t end) {
+  return (start >= 0) && ((end == -1) || (end >= start));
+}
+
+
+// Clamps the end of a valid range to the length of the file. Returns false
+// if the length of the file cannot be determined.
+static bool GetMapRange(File* file, int64_t start, int64_t* end) {
+  ASSERT(IsValidMapRange(start, *end));
+  int64_t length = file->Length();
+  if (length < 0) {
+    return false;
+  }
+  if ((*end == -1) || (*end > length)) {
+    *end = length;
+  }
+  if (*end < start) {
+    *end = start;
+  }
+  return true;
+}
+
+
+void FUNCTION_NAME(File_Map)(Dart_NativeArguments args) {
+  File* file = GetFile(args);
+  ASSERT(file != NULL);
+  int64_t start;
+  int64_t end;
+  int64_t advice;
+  if (DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 1), &start) &&
+      DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 2), &end) &&
+      DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 3), &advice) &&
+      (advice >= File::kMapNormal) && (advice <= File::kMapAdviceMax) &&
+      IsValidMapRange(start, end)) {
+    if (!GetMapRange(file, start, &end)) {
+      Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+      return;
+    }
+    if (end == start) {
+      // Empty ranges cannot be mapped.
+      Dart_SetReturnValue(args, Dart_Null());
+      return;
+    }
+    MappedMemory* mapping = file->Map(
+        start, end - start, static_cast<File::MapAdvice>(advice));
+    if (mapping == NULL) {
+      Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+      return;
+    }
+    Dart_Handle result = Dart_NewExternalTypedData(
+        Dart_TypedData_kUint8, mapping->address(), mapping->length());
+    if (Dart_IsError(result)) {
+      delete mapping;
+      Dart_PropagateError(result);
+    }
+    // The mapped pages are in the page cache, not in the heap, so they are
+    // not reported as external allocation.
+    Dart_NewWeakPersistentHandle(result, mapping, 0, MappedMemory::Finalizer);
+    Dart_SetReturnValue(args, result);
+    return;
+  }
+  OSError os_error(-1, "Invalid argument", OSError::kUnknown);
+  Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+}
+
+
 void FUNCTION_NAME(File_Create)(Dart_NativeArguments args) {
   const char* str =
       DartUtils::GetStringValue(Dart_GetNativeArgument(args, 0));
@@ -1039,48 +1157,65 @@ static int SizeInBytes(Dart_TypedData_Type type) {
 }
 
 
-CObject* File::WriteFromRequest(const CObjectArray& request) {
-  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
-    File* file = CObjectToFilePointer(request[0]);
-    RefCntReleaseScope<File> rs(file);
-    if ((request.Length() == 4) &&
-        (request[1]->IsTypedData() || request[1]->IsArray()) &&
-        request[2]->IsInt32OrInt64() &&
-        request[3]->IsInt32OrInt64()) {
-      if (!file->IsClosed()) {
-        int64_t start = CObjectInt32OrInt64ToInt64(request[2]);
-        int64_t end = CObjectInt32OrInt64ToInt64(request[3]);
-        int64_t length = end - start;
-        uint8_t* buffer_start;
-        if (request[1]->IsTypedData()) {
-          CObjectTypedData typed_data(request[1]);
-          start = start * SizeInBytes(typed_data.Type());
-          length = length * SizeInBytes(typed_data.Type());
-          buffer_start = typed_data.Buffer() + start;
-        } else {
-          CObjectArray array(request[1]);
-          buffer_start = Dart_ScopeAllocate(length);
-          for (int i = 0; i < length; i++) {
-            if (array[i + start]->IsInt32OrInt64()) {
-              int64_t value = CObjectInt32OrInt64ToInt64(array[i + start]);
-              buffer_start[i] = static_cast<uint8_t>(value & 0xFF);
-            } else {
-              // Unsupported type.
-              return CObject::IllegalArgumentError();
-            }
+// Writes the bytes from request[2] to request[3] of the list request[1] to
+// the file, at position or at the file position if position is -1.
+static CObject* WriteFromRequestBuffer(File* file,
+                                       const CObjectArray& request,
+                                       int64_t position) {
+  if ((request[1]->IsTypedData() || request[1]->IsArray()) &&
+      request[2]->IsInt32OrInt64() &&
+      request[3]->IsInt32OrInt64()) {
+    if (!file->IsClosed()) {
+      int64_t start = CObjectInt32OrInt64ToInt64(request[2]);
+      int64_t end = CObjectInt32OrInt64ToInt64(request[3]);
+      int64_t length = end - start;
+      uint8_t* buffer_start;
+      if (request[1]->IsTypedData()) {
+        CObjectTypedData typed_data(request[1]);
+        start = start * SizeInBytes(typed_data.Type());
+        length = length * SizeInBytes(typed_data.Type());
+        buffer_start = typed_data.Buffer() + start;
+      } else {
+        CObjectArray array(request[1]);
+        buffer_start = Dart_ScopeAllocate(length);
+        for (int i = 0; i < length; i++) {
+          if (array[i + start]->IsInt32OrInt64()) {
+            int64_t value = CObjectInt32OrInt64ToInt64(array[i + start]);
+            buffer_start[i] = static_cast<uint8_t>(value & 0xFF);
+          } else {
+            // Unsupported type.
+            return CObject::IllegalArgumentError();
           }
-          start = 0;
         }
-        bool success =
+        start = 0;
+      }
+      bool success;
+      if (position == -1) {
+        success =
             file->WriteFully(reinterpret_cast<void*>(buffer_start), length);
-        if (success) {
-          return new CObjectInt64(CObject::NewInt64(length));
-        } else {
-          return CObject::NewOSError();
-        }
       } else {
-        return CObject::FileClosedError();
+        success = file->WriteAtFully(
+            reinterpret_cast<void*>(buffer_start), length, position);
       }
+      if (success) {
+        return new CObjectInt64(CObject::NewInt64(length));
+      } else {
+        return CObject::NewOSError();
+      }
+    } else {
+      return CObject::FileClosedError();
+    }
+  }
+  return CObject::IllegalArgumentError();
+}
+
+
+CObject* File::WriteFromRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if (request.Length() == 4) {
+      return WriteFromRequestBuffer(file, request, -1);
     } else {
       return CObject::IllegalArgumentError();
     }
@@ -1232,6 +1367,215 @@ CObject* File::LockRequest(const CObjectArray& request) {
   return CObject::IllegalArgumentError();
 }
 
+
+CObject* File::MapRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if ((request.Length() == 4) &&
+        request[1]->IsInt32OrInt64() &&
+        request[2]->IsInt32OrInt64() &&
+        request[3]->IsInt32OrInt64()) {
+      if (!file->IsClosed()) {
+        int64_t start = CObjectInt32OrInt64ToInt64(request[1]);
+        int64_t end = CObjectInt32OrInt64ToInt64(request[2]);
+        int64_t advice = CObjectInt32OrInt64ToInt64(request[3]);
+        if ((advice < kMapNormal) || (advice > kMapAdviceMax) ||
+            !IsValidMapRange(start, end)) {
+          return CObject::IllegalArgumentError();
+        }
+        if (!GetMapRange(file, start, &end)) {
+          return CObject::NewOSError();
+        }
+        MappedMemory* mapping = NULL;
+        if (end > start) {
+          mapping =
+              file->Map(start, end - start, static_cast<MapAdvice>(advice));
+          if (mapping == NULL) {
+            return CObject::NewOSError();
+          }
+        }
+        CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+        result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+        if (mapping == NULL) {
+          // Empty ranges cannot be mapped.
+          result->SetAt(1, CObject::Null());
+        } else {
+          result->SetAt(1, new CObjectExternalUint8Array(
+              CObject::NewExternalUint8Array(mapping->length(),
+                                             mapping->address(),
+                                             mapping,
+                                             MappedMemory::Finalizer)));
+        }
+        return result;
+      } else {
+        return CObject::FileClosedError();
+      }
+    } else {
+      return CObject::IllegalArgumentError();
+    }
+  }
+  return CObject::IllegalArgumentError();
+}
+
+
+
+CObject* File::ReadAtRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if ((request.Length() == 3) &&
+        request[1]->IsInt32OrInt64() &&
+        request[2]->IsInt32OrInt64()) {
+      if (!file->IsClosed()) {
+        int64_t position = CObjectInt32OrInt64ToInt64(request[1]);
+        int64_t length = CObjectInt32OrInt64ToInt64(request[2]);
+        Dart_CObject* io_buffer = CObject::NewIOBuffer(length);
+        ASSERT(io_buffer != NULL);
+        uint8_t* data = io_buffer->value.as_external_typed_data.data;
+        int64_t bytes_read = file->ReadAt(data, length, position);
+        if (bytes_read >= 0) {
+          CObjectExternalUint8Array* external_array =
+              new CObjectExternalUint8Array(io_buffer);
+          external_array->SetLength(bytes_read);
+          CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+          result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+          result->SetAt(1, external_array);
+          return result;
+        } else {
+          CObject::FreeIOBufferData(io_buffer);
+          return CObject::NewOSError();
+        }
+      } else {
+        return CObject::FileClosedError();
+      }
+    } else {
+      return CObject::IllegalArgumentError();
+    }
+  }
+  return CObject::IllegalArgumentError();
+}
+
+
+CObject* File::WriteAtRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if ((request.Length() == 5) && request[4]->IsInt32OrInt64()) {
+      int64_t position = CObjectInt32OrInt64ToInt64(request[4]);
+      if (position >= 0) {
+        return WriteFromRequestBuffer(file, request, position);
+      }
+    }
+    return CObject::IllegalArgumentError();
+  }
+  return CObject::IllegalArgumentError();
+}
+
+
+/*
+ * Reads several ranges of a file in one request. request[1] is a list of
+ * positions and lengths. The result is a list with one list of bytes for
+ * each range, which is shorter than requested at the end of the file.
+ */
+CObject* File::ReadBatchRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if ((request.Length() == 2) && request[1]->IsArray()) {
+      CObjectArray ranges(request[1]);
+      if ((ranges.Length() % 2) != 0) {
+        return CObject::IllegalArgumentError();
+      }
+      for (intptr_t i = 0; i < ranges.Length(); i++) {
+        if (!ranges[i]->IsInt32OrInt64() ||
+            (CObjectInt32OrInt64ToInt64(ranges[i]) < 0)) {
+          return CObject::IllegalArgumentError();
+        }
+      }
+      if (file->IsClosed()) {
+        return CObject::FileClosedError();
+      }
+      intptr_t count = ranges.Length() / 2;
+      CObjectArray* buffers = new CObjectArray(CObject::NewArray(count));
+      for (intptr_t i = 0; i < count; i++) {
+        int64_t position = CObjectInt32OrInt64ToInt64(ranges[2 * i]);
+        int64_t length = CObjectInt32OrInt64ToInt64(ranges[2 * i + 1]);
+        Dart_CObject* io_buffer = CObject::NewIOBuffer(length);
+        ASSERT(io_buffer != NULL);
+        uint8_t* data = io_buffer->value.as_external_typed_data.data;
+        int64_t bytes_read = file->ReadAt(data, length, position);
+        if (bytes_read < 0) {
+          // Capture the error before the buffers are freed.
+          CObject* error = CObject::NewOSError();
+          CObject::FreeIOBufferData(io_buffer);
+          for (intptr_t j = 0; j < i; j++) {
+            CObject::FreeIOBufferData((*buffers)[j]->AsApiCObject());
+          }
+          return error;
+        }
+        CObjectExternalUint8Array* external_array =
+            new CObjectExternalUint8Array(io_buffer);
+        external_array->SetLength(bytes_read);
+        buffers->SetAt(i, external_array);
+      }
+      CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+      result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+      result->SetAt(1, buffers);
+      return result;
+    } else {
+      return CObject::IllegalArgumentError();
+    }
+  }
+  return CObject::IllegalArgumentError();
+}
+
+// Reads a range of the file and discards the data so that it is in the page
+// cache when it is later sent with Socket::SendFile on the isolate thread.
+// Reading rather than touching a mapping avoids a SIGBUS if the file is
+// truncated. Returns the number of bytes read, which is less than requested
+// only at the end of the file.
+CObject* File::PrefetchRequest(const CObjectArray& request) {
+  if ((request.Length() >= 1) && request[0]->IsIntptr()) {
+    File* file = CObjectToFilePointer(request[0]);
+    RefCntReleaseScope<File> rs(file);
+    if ((request.Length() == 3) &&
+        request[1]->IsInt32OrInt64() &&
+        request[2]->IsInt32OrInt64()) {
+      int64_t position = CObjectInt32OrInt64ToInt64(request[1]);
+      int64_t length = CObjectInt32OrInt64ToInt64(request[2]);
+      if ((position < 0) || (length < 0)) {
+        return CObject::IllegalArgumentError();
+      }
+      if (file->IsClosed()) {
+        return CObject::FileClosedError();
+      }
+      const int64_t kScratchSize = 64 * KB;
+      uint8_t* scratch = reinterpret_cast<uint8_t*>(malloc(kScratchSize));
+      int64_t total = 0;
+      while (total < length) {
+        int64_t bytes_read = file->ReadAt(
+            scratch, Utils::Minimum(length - total, kScratchSize),
+            position + total);
+        if (bytes_read < 0) {
+          CObject* error = CObject::NewOSError();
+          free(scratch);
+          return error;
+        }
+        if (bytes_read == 0) {
+          break;
+        }
+        total += bytes_read;
+      }
+      free(scratch);
+      return new CObjectInt64(CObject::NewInt64(total));
+    } else {
+      return CObject::IllegalArgumentError();
+    }
+  }
+  return CObject::IllegalArgumentError();
+}
+
 }  // namespace bin
 }  // namespace dart
 
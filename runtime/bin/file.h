@@ -21,6 +21,39 @@ namespace bin {
 // Forward declaration.
 class FileHandle;
 
+// A copy-on-write mapping of a range of a file. Writes to the mapped memory
+// are never written back to the file. The mapping stays valid after the
+// file is closed and is unmapped when the MappedMemory is deleted.
+class MappedMemory {
+ public:
+  ~MappedMemory();
+
+  // The address and length of the mapped range of the file.
+  uint8_t* address() const { return base_ + offset_; }
+  intptr_t length() const { return length_ - offset_; }
+
+  // Finalizer for external typed data backed by a MappedMemory peer.
+  static void Finalizer(void* isolate_callback_data,
+                        Dart_WeakPersistentHandle handle,
+                        void* peer) {
+    delete reinterpret_cast<MappedMemory*>(peer);
+  }
+
+ private:
+  MappedMemory(uint8_t* base, intptr_t length, intptr_t offset)
+      : base_(base), length_(length), offset_(offset) {}
+
+  // The start of the mapping is rounded down to a page boundary, so
+  // the mapped range starts offset_ bytes into it.
+  uint8_t* base_;
+  intptr_t length_;
+  intptr_t offset_;
+
+  friend class File;
+  DISALLOW_COPY_AND_ASSIGN(MappedMemory);
+};
+
+
 class File : public ReferenceCounted<File> {
  public:
   enum FileOpenMode {
@@ -84,10 +117,24 @@ class File : public ReferenceCounted<File> {
     kLockMax = 2
   };
 
+  // These values have to be kept in sync with the order of the
+  // FileMapAdvice enum in sdk/lib/io/file.dart.
+  enum MapAdvice {
+    kMapNormal = 0,
+    kMapSequential = 1,
+    kMapRandom = 2,
+    kMapWillNeed = 3,
+    kMapAdviceMax = 3
+  };
+
   intptr_t GetFD();
 
   void* MapExecutable(intptr_t* num_bytes);
 
+  // Maps num_bytes of the file from position into memory and passes the
+  // advice on to the operating system. Returns NULL on error.
+  MappedMemory* Map(int64_t position, int64_t num_bytes, MapAdvice advice);
+
   // Read/Write attempt to transfer num_bytes to/from buffer. It returns
   // the number of bytes read/written.
   int64_t Read(void* buffer, int64_t num_bytes);
@@ -103,6 +150,15 @@ class File : public ReferenceCounted<File> {
     return WriteFully(&byte, 1);
   }
 
+  // ReadAt/WriteAt transfer num_bytes to/from buffer at position in the
+  // file without changing the file position. They return the number of
+  // bytes read/written, or a negative value on error.
+  int64_t ReadAt(void* buffer, int64_t num_bytes, int64_t position);
+  int64_t WriteAt(const void* buffer, int64_t num_bytes, int64_t position);
+
+  // Like WriteFully, but at position in the file.
+  bool WriteAtFully(const void* buffer, int64_t num_bytes, int64_t position);
+
   // Get the length of the file. Returns a negative value if the length cannot
   // be determined (e.g. not seekable device).
   int64_t Length();
@@ -210,6 +266,11 @@ class File : public ReferenceCounted<File> {
   static CObject* IdenticalRequest(const CObjectArray& request);
   static CObject* StatRequest(const CObjectArray& request);
   static CObject* LockRequest(const CObjectArray& request);
+  static CObject* MapRequest(const CObjectArray& request);
+  static CObject* ReadAtRequest(const CObjectArray& request);
+  static CObject* WriteAtRequest(const CObjectArray& request);
+  static CObject* ReadBatchRequest(const CObjectArray& request);
+  static CObject* PrefetchRequest(const CObjectArray& request);
 
  private:
   explicit File(FileHandle* handle) :
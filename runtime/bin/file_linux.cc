@@ -90,6 +90,42 @@ void* File::MapExecutable(intptr_t* len) {
   return addr;
 }
 
+MappedMemory* File::Map(int64_t position,
+                        int64_t num_bytes,
+                        MapAdvice advice) {
+  ASSERT(handle_->fd() >= 0);
+  ASSERT((position >= 0) && (num_bytes > 0));
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  int64_t offset = position % page_size;
+  int64_t length = offset + num_bytes;
+  if (length > kIntptrMax) {
+    errno = ENOMEM;
+    return NULL;
+  }
+  // A private writable mapping lets Dart code write to the typed data
+  // without touching the file; the pages are only copied when written.
+  void* address = mmap64(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                         handle_->fd(), position - offset);
+  if (address == MAP_FAILED) {
+    return NULL;
+  }
+  static const int kAdvice[] = {
+    MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED
+  };
+  ASSERT((advice >= 0) && (advice <= kMapAdviceMax));
+  if (advice != kMapNormal) {
+    // The advice is only a hint, so failures are ignored.
+    NO_RETRY_EXPECTED(madvise(address, length, kAdvice[advice]));
+  }
+  return new MappedMemory(reinterpret_cast<uint8_t*>(address), length, offset);
+}
+
+
+MappedMemory::~MappedMemory() {
+  VOID_NO_RETRY_EXPECTED(munmap(base_, length_));
+}
+
+
 
 int64_t File::Read(void* buffer, int64_t num_bytes) {
   ASSERT(handle_->fd() >= 0);
@@ -102,6 +138,22 @@ int64_t File::Write(const void* buffer, int64_t num_bytes) {
   return TEMP_FAILURE_RETRY(write(handle_->fd(), buffer, num_bytes));
 }
 
+int64_t File::ReadAt(void* buffer, int64_t num_bytes, int64_t position) {
+  ASSERT(handle_->fd() >= 0);
+  return TEMP_FAILURE_RETRY(
+      pread64(handle_->fd(), buffer, num_bytes, position));
+}
+
+
+int64_t File::WriteAt(const void* buffer,
+                      int64_t num_bytes,
+                      int64_t position) {
+  ASSERT(handle_->fd() >= 0);
+  return TEMP_FAILURE_RETRY(
+      pwrite64(handle_->fd(), buffer, num_bytes, position));
+}
+
+
 
 int64_t File::Position() {
   ASSERT(handle_->fd() >= 0);
@@ -44,12 +44,16 @@ class _RandomAccessFileOpsImpl extends NativeFieldWrapperClass1
   readInto(List<int> buffer, int start, int end) native "File_ReadInto";
   writeByte(int value) native "File_WriteByte";
   writeFrom(List<int> buffer, int start, int end) native "File_WriteFrom";
+  readAt(int position, int bytes) native "File_ReadAt";
+  writeFromAt(List<int> buffer, int start, int end, int position)
+      native "File_WriteFromAt";
   position() native "File_Position";
   setPosition(int position) native "File_SetPosition";
   truncate(int length) native "File_Truncate";
   length() native "File_Length";
   flush() native "File_Flush";
   lock(int lock, int start, int end) native "File_Lock";
+  map(int start, int end, int advice) native "File_Map";
 }
 
 
@@ -84,6 +84,24 @@ bool File::WriteFully(const void* buffer, int64_t num_bytes) {
 }
 
 
+bool File::WriteAtFully(const void* buffer,
+                        int64_t num_bytes,
+                        int64_t position) {
+  int64_t remaining = num_bytes;
+  const char* current_buffer = reinterpret_cast<const char*>(buffer);
+  while (remaining > 0) {
+    int64_t bytes_written = WriteAt(current_buffer, remaining, position);
+    if (bytes_written < 0) {
+      return false;
+    }
+    remaining -= bytes_written;
+    current_buffer += bytes_written;
+    position += bytes_written;
+  }
+  return true;
+}
+
+
 File::FileOpenMode File::DartModeToFileMode(DartFileOpenMode mode) {
   ASSERT((mode == File::kDartRead) ||
          (mode == File::kDartWrite) ||
@@ -59,5 +59,22 @@ TEST_CASE(FilePosition) {
   file->Release();
 }
 
+
+TEST_CASE(FileMap) {
+  const char* kFilename = GetFileName("runtime/bin/file_test.cc");
+  File* file = File::Open(kFilename, File::kRead);
+  EXPECT(file != NULL);
+  MappedMemory* mapping = file->Map(3, 10, File::kMapSequential);
+  EXPECT(mapping != NULL);
+  // The mapping outlives the file.
+  file->Release();
+  EXPECT_EQ(10, mapping->length());
+  EXPECT(memcmp("Copyright ", mapping->address(), 10) == 0);
+  // Writes only change the mapped memory.
+  mapping->address()[0] = 'c';
+  EXPECT_EQ('c', mapping->address()[0]);
+  delete mapping;
+}
+
 }  // namespace bin
 }  // namespace dart
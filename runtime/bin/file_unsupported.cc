@@ -120,6 +120,24 @@ void FUNCTION_NAME(File_Lock)(Dart_NativeArguments args) {
 }
 
 
+void FUNCTION_NAME(File_ReadAt)(Dart_NativeArguments args) {
+  Dart_ThrowException(DartUtils::NewInternalError(
+        "File is not supported on this platform"));
+}
+
+
+void FUNCTION_NAME(File_WriteFromAt)(Dart_NativeArguments args) {
+  Dart_ThrowException(DartUtils::NewInternalError(
+        "File is not supported on this platform"));
+}
+
+
+void FUNCTION_NAME(File_Map)(Dart_NativeArguments args) {
+  Dart_ThrowException(DartUtils::NewInternalError(
+        "File is not supported on this platform"));
+}
+
+
 void FUNCTION_NAME(File_Create)(Dart_NativeArguments args) {
   Dart_ThrowException(DartUtils::NewInternalError(
         "File is not supported on this platform"));
@@ -78,6 +78,48 @@ void* File::MapExecutable(intptr_t* len) {
   return NULL;
 }
 
+MappedMemory* File::Map(int64_t position,
+                        int64_t num_bytes,
+                        MapAdvice advice) {
+  ASSERT(handle_->fd() >= 0);
+  ASSERT((position >= 0) && (num_bytes > 0));
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  // Views must start at a multiple of the allocation granularity.
+  int64_t offset = position % info.dwAllocationGranularity;
+  int64_t length = offset + num_bytes;
+  if (length > kIntptrMax) {
+    SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+    return NULL;
+  }
+  HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(handle_->fd()));
+  HANDLE mapping = CreateFileMappingW(handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  if (mapping == NULL) {
+    return NULL;
+  }
+  // A copy-on-write view lets Dart code write to the typed data without
+  // touching the file. The view keeps the mapping object alive.
+  uint64_t start = position - offset;
+  void* address = MapViewOfFile(mapping,
+                                FILE_MAP_COPY,
+                                static_cast<DWORD>(start >> 32),
+                                static_cast<DWORD>(start & 0xFFFFFFFF),
+                                length);
+  CloseHandle(mapping);
+  if (address == NULL) {
+    return NULL;
+  }
+  // Windows has no access pattern hints for views, so the advice is
+  // ignored.
+  return new MappedMemory(reinterpret_cast<uint8_t*>(address), length, offset);
+}
+
+
+MappedMemory::~MappedMemory() {
+  UnmapViewOfFile(base_);
+}
+
+
 
 int64_t File::Read(void* buffer, int64_t num_bytes) {
   ASSERT(handle_->fd() >= 0);
@@ -90,6 +132,38 @@ int64_t File::Write(const void* buffer, int64_t num_bytes) {
   return write(handle_->fd(), buffer, num_bytes);
 }
 
+// Windows has no pread and pwrite, and reads and writes at an offset move
+// the file pointer as well, so it is restored afterwards.
+int64_t File::ReadAt(void* buffer, int64_t num_bytes, int64_t position) {
+  ASSERT(handle_->fd() >= 0);
+  int64_t current = Position();
+  if ((current < 0) || !SetPosition(position)) {
+    return -1;
+  }
+  int64_t result = Read(buffer, num_bytes);
+  if (!SetPosition(current)) {
+    return -1;
+  }
+  return result;
+}
+
+
+int64_t File::WriteAt(const void* buffer,
+                      int64_t num_bytes,
+                      int64_t position) {
+  ASSERT(handle_->fd() >= 0);
+  int64_t current = Position();
+  if ((current < 0) || !SetPosition(position)) {
+    return -1;
+  }
+  int64_t result = Write(buffer, num_bytes);
+  if (!SetPosition(current)) {
+    return -1;
+  }
+  return result;
+}
+
+
 
 int64_t File::Position() {
   ASSERT(handle_->fd() >= 0);
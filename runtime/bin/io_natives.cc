@@ -33,6 +33,8 @@ namespace bin {
   V(Directory_SetAsyncDirectoryListerPointer, 2)                               \
   V(EventHandler_SendData, 3)                                                  \
   V(EventHandler_TimerMillisecondClock, 0)                                     \
+  V(EventHandler_ShardStatistics, 0)                                           \
+  V(EventHandler_QueueWrite, 6)                                                \
   V(File_GetPointer, 1)                                                        \
   V(File_SetPointer, 2)                                                        \
   V(File_Open, 2)                                                              \
@@ -52,6 +54,9 @@ namespace bin {
   V(File_LastModified, 1)                                                      \
   V(File_Flush, 1)                                                             \
   V(File_Lock, 4)                                                              \
+  V(File_Map, 4)                                                               \
+  V(File_ReadAt, 3)                                                            \
+  V(File_WriteFromAt, 5)                                                       \
   V(File_Create, 1)                                                            \
   V(File_CreateLink, 2)                                                        \
   V(File_LinkTarget, 1)                                                        \
@@ -122,9 +127,11 @@ namespace bin {
   V(Socket_CreateBindConnect, 4)                                               \
   V(Socket_CreateBindDatagram, 4)                                              \
   V(Socket_Available, 1)                                                       \
-  V(Socket_Read, 2)                                                            \
+  V(Socket_ReadInto, 4)                                                        \
   V(Socket_RecvFrom, 1)                                                        \
   V(Socket_WriteList, 4)                                                       \
+  V(Socket_WriteV, 4)                                                          \
+  V(Socket_SendFile, 4)                                                        \
   V(Socket_SendTo, 6)                                                          \
   V(Socket_GetPort, 1)                                                         \
   V(Socket_GetRemotePeer, 1)                                                   \
@@ -56,7 +56,12 @@ namespace bin {
   V(Directory, ListNext, 36)                                                   \
   V(Directory, ListStop, 37)                                                   \
   V(Directory, Rename, 38)                                                     \
-  V(SSLFilter, ProcessFilter, 39)
+  V(SSLFilter, ProcessFilter, 39)                                              \
+  V(File, Map, 40)                                                             \
+  V(File, ReadAt, 41)                                                          \
+  V(File, WriteAt, 42)                                                         \
+  V(File, ReadBatch, 43)                                                       \
+  V(File, Prefetch, 44)
 
 #define DECLARE_REQUEST(type, method, id)                                      \
   k##type##method##Request = id,
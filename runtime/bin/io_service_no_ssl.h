@@ -57,7 +57,12 @@ namespace bin {
   V(Directory, ListStart, 35)                                                  \
   V(Directory, ListNext, 36)                                                   \
   V(Directory, ListStop, 37)                                                   \
-  V(Directory, Rename, 38)
+  V(Directory, Rename, 38)                                                     \
+  V(File, Map, 40)                                                             \
+  V(File, ReadAt, 41)                                                          \
+  V(File, WriteAt, 42)                                                         \
+  V(File, ReadBatch, 43)                                                       \
+  V(File, Prefetch, 44)
 
 #define DECLARE_REQUEST(type, method, id)                                      \
   k##type##method##Request = id,
@@ -0,0 +1,497 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#if !defined(DART_IO_DISABLED)
+
+#include "platform/globals.h"
+#if defined(TARGET_OS_LINUX)
+
+#include "bin/io_uring_linux.h"
+
+#include <errno.h>  // NOLINT
+#include <poll.h>  // NOLINT
+#include <stdlib.h>  // NOLINT
+#include <string.h>  // NOLINT
+#include <sys/mman.h>  // NOLINT
+#include <sys/socket.h>  // NOLINT
+#include <sys/syscall.h>  // NOLINT
+#include <sys/uio.h>  // NOLINT
+#include <unistd.h>  // NOLINT
+
+#if defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>  // NOLINT
+#endif
+
+#include "bin/fdutils.h"
+#include "bin/utils.h"
+#include "platform/assert.h"
+#include "platform/signal_blocker.h"
+
+// Multishot poll and IORING_FEAT_RSRC_TAGS, used to detect it at runtime,
+// were both added in Linux 5.13.
+#if defined(__NR_io_uring_setup) && defined(IORING_POLL_ADD_MULTI) &&          \
+    defined(IORING_FEAT_RSRC_TAGS)
+#define HAS_IO_URING 1
+#endif
+
+namespace dart {
+namespace bin {
+
+#if defined(HAS_IO_URING)
+
+IOUring* IOUring::Create(uint32_t entries) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = NO_RETRY_EXPECTED(syscall(__NR_io_uring_setup, entries, &params));
+  if (fd < 0) {
+    // ENOSYS if the kernel has no io_uring, EPERM if it is disabled.
+    return NULL;
+  }
+  FDUtils::SetCloseOnExec(fd);
+  IOUring* uring = new IOUring(fd);
+  const uint32_t kRequiredFeatures =
+      IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_RSRC_TAGS;
+  if (((params.features & kRequiredFeatures) != kRequiredFeatures) ||
+      !uring->Map(params)) {
+    delete uring;
+    return NULL;
+  }
+  return uring;
+}
+
+
+IOUring::IOUring(int fd)
+    : fd_(fd),
+      ring_(MAP_FAILED),
+      ring_size_(0),
+      sqes_(NULL),
+      sqes_size_(0),
+      sq_head_(NULL),
+      sq_tail_(NULL),
+      sq_mask_(0),
+      sq_entries_(0),
+      sq_pending_tail_(0),
+      cq_head_(NULL),
+      cq_tail_(NULL),
+      cq_mask_(0),
+      cqes_(NULL),
+      saved_completions_(NULL),
+      saved_completions_capacity_(0),
+      num_saved_completions_(0),
+      next_saved_completion_(0),
+      buffers_(NULL),
+      buffers_size_(0),
+      num_pending_timeouts_(0) {}
+
+
+IOUring::~IOUring() {
+  free(saved_completions_);
+  if (sqes_ != NULL) {
+    munmap(sqes_, sqes_size_);
+  }
+  if (ring_ != MAP_FAILED) {
+    munmap(ring_, ring_size_);
+  }
+  VOID_TEMP_FAILURE_RETRY(close(fd_));
+}
+
+
+bool IOUring::Map(const struct io_uring_params& params) {
+  // With IORING_FEAT_SINGLE_MMAP the submission and completion rings share
+  // one mapping.
+  intptr_t sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  intptr_t cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  ring_size_ = (sq_size > cq_size) ? sq_size : cq_size;
+  ring_ = mmap(NULL, ring_size_, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+  if (ring_ == MAP_FAILED) {
+    return false;
+  }
+  sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  void* sqes = mmap(NULL, sqes_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return false;
+  }
+  sqes_ = reinterpret_cast<struct io_uring_sqe*>(sqes);
+
+  uint8_t* ring = reinterpret_cast<uint8_t*>(ring_);
+  sq_head_ = reinterpret_cast<uint32_t*>(ring + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<uint32_t*>(ring + params.sq_off.tail);
+  sq_mask_ = *reinterpret_cast<uint32_t*>(ring + params.sq_off.ring_mask);
+  sq_entries_ = params.sq_entries;
+  sq_pending_tail_ = *sq_tail_;
+  // Entries are always submitted in ring order, so the indirection array
+  // is the identity.
+  uint32_t* array = reinterpret_cast<uint32_t*>(ring + params.sq_off.array);
+  for (uint32_t i = 0; i < sq_entries_; i++) {
+    array[i] = i;
+  }
+  cq_head_ = reinterpret_cast<uint32_t*>(ring + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<uint32_t*>(ring + params.cq_off.tail);
+  cq_mask_ = *reinterpret_cast<uint32_t*>(ring + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<struct io_uring_cqe*>(ring + params.cq_off.cqes);
+  return true;
+}
+
+
+bool IOUring::RegisterBuffers(void* memory, intptr_t size) {
+  ASSERT(buffers_ == NULL);
+  struct iovec iov;
+  iov.iov_base = memory;
+  iov.iov_len = size;
+  // A single buffer: requests use buffer index 0 and any address in it.
+  int result = TEMP_FAILURE_RETRY(
+      syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, &iov, 1));
+  if (result != 0) {
+    return false;
+  }
+  buffers_ = reinterpret_cast<uint8_t*>(memory);
+  buffers_size_ = size;
+  return true;
+}
+
+
+bool IOUring::Enter(uint32_t min_complete) {
+  // Also passes the requests an earlier call left in the ring.
+  __atomic_store_n(sq_tail_, sq_pending_tail_, __ATOMIC_RELEASE);
+  while (true) {
+    uint32_t to_submit =
+        sq_pending_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if ((to_submit == 0) && (min_complete == 0)) {
+      return true;
+    }
+    // EINTR is retried. If the kernel submitted some of the requests and
+    // was interrupted while waiting, it returns their number.
+    intptr_t result = TEMP_FAILURE_RETRY_NO_SIGNAL_BLOCKER(
+        syscall(__NR_io_uring_enter, fd_, to_submit, min_complete,
+                (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0, NULL, 0));
+    if (result == static_cast<intptr_t>(to_submit)) {
+      return true;
+    }
+    if (result >= 0) {
+      // The kernel stopped submitting early, the rest is passed again.
+      continue;
+    }
+    if ((errno != EBUSY) && (errno != EAGAIN)) {
+      return false;
+    }
+    // EBUSY if the completion ring is full and the kernel holds completions
+    // it could not post yet, EAGAIN if it is out of memory for requests.
+    // Both clear once completions are reaped, so move them out of the ring
+    // and do not wait for more since there is something to handle now.
+    if (!SaveCompletions()) {
+      TimerUtils::Sleep(1);
+    }
+    min_complete = 0;
+  }
+}
+
+
+bool IOUring::SaveCompletions() {
+  uint32_t head = *cq_head_;
+  uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  if (head == tail) {
+    return false;
+  }
+  intptr_t count = tail - head;
+  if (num_saved_completions_ + count > saved_completions_capacity_) {
+    intptr_t capacity = saved_completions_capacity_ * 2;
+    if (capacity < num_saved_completions_ + count) {
+      capacity = num_saved_completions_ + count;
+    }
+    saved_completions_ = reinterpret_cast<Completion*>(
+        realloc(saved_completions_, capacity * sizeof(Completion)));
+    if (saved_completions_ == NULL) {
+      FATAL("Out of memory");
+    }
+    saved_completions_capacity_ = capacity;
+  }
+  for (; head != tail; head++) {
+    struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+    Completion* completion = &saved_completions_[num_saved_completions_++];
+    completion->user_data = cqe->user_data;
+    completion->result = cqe->res;
+    completion->flags = cqe->flags;
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  return true;
+}
+
+
+void IOUring::SubmitPending() {
+  // Passes the queued requests to the kernel without waiting for
+  // completions. Only fails on a bad request or a lost completion.
+  if (!Enter(0)) {
+    FATAL1("io_uring_enter failed: %d", errno);
+  }
+  num_pending_timeouts_ = 0;
+}
+
+
+void IOUring::ReserveSqes(uint32_t count) {
+  ASSERT(count <= sq_entries_);
+  uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  if (sq_entries_ - (sq_pending_tail_ - head) < count) {
+    // The submission ring is full.
+    SubmitPending();
+    head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    ASSERT(sq_pending_tail_ == head);
+  }
+}
+
+
+struct io_uring_sqe* IOUring::NextSqe() {
+  ReserveSqes(1);
+  struct io_uring_sqe* sqe = &sqes_[sq_pending_tail_ & sq_mask_];
+  sq_pending_tail_++;
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+
+void IOUring::PollAdd(int fd, uint32_t events, uint64_t user_data,
+                      bool multishot) {
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events = events;
+  if (multishot) {
+    sqe->len = IORING_POLL_ADD_MULTI;
+  }
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::PollRemove(uint64_t target_user_data, uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = target_user_data;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::Read(int fd, void* buffer, uint32_t length,
+                   uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  if (buffers_ != NULL) {
+    ASSERT((reinterpret_cast<uint8_t*>(buffer) >= buffers_) &&
+           (reinterpret_cast<uint8_t*>(buffer) + length <=
+            buffers_ + buffers_size_));
+    sqe->opcode = IORING_OP_READ_FIXED;
+  } else {
+    sqe->opcode = IORING_OP_READ;
+  }
+  // Streams have no position, the offset is ignored.
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(buffer);
+  sqe->len = length;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::Write(int fd, const void* buffer, uint32_t length,
+                    uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  if (buffers_ != NULL) {
+    ASSERT((reinterpret_cast<const uint8_t*>(buffer) >= buffers_) &&
+           (reinterpret_cast<const uint8_t*>(buffer) + length <=
+            buffers_ + buffers_size_));
+    sqe->opcode = IORING_OP_WRITE_FIXED;
+  } else {
+    sqe->opcode = IORING_OP_WRITE;
+  }
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(buffer);
+  sqe->len = length;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::WaitWritable(int fd, uint64_t user_data) {
+  // A link does not span submissions, the linked request must be queued
+  // before the ring is submitted again.
+  ReserveSqes(2);
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events = POLLOUT;
+  sqe->flags = IOSQE_IO_LINK;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::Accept(int fd, uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->fd = fd;
+  sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::Cancel(uint64_t target_user_data, uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = target_user_data;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::TimeoutAt(int64_t millis, uint64_t user_data) {
+  if (num_pending_timeouts_ == kMaxPendingTimeouts) {
+    // The kernel copies timeouts when they are submitted.
+    SubmitPending();
+  }
+  struct io_uring_sqe* sqe = NextSqe();
+  int64_t* timeout = pending_timeouts_[num_pending_timeouts_++];
+  timeout[0] = millis / 1000;
+  timeout[1] = (millis % 1000) * 1000000;
+  sqe->opcode = IORING_OP_TIMEOUT;
+  sqe->fd = -1;
+  sqe->addr = reinterpret_cast<uint64_t>(timeout);
+  sqe->len = 1;
+  sqe->timeout_flags = IORING_TIMEOUT_ABS;
+  sqe->user_data = user_data;
+}
+
+
+void IOUring::TimeoutRemove(uint64_t target_user_data, uint64_t user_data) {
+  struct io_uring_sqe* sqe = NextSqe();
+  sqe->opcode = IORING_OP_TIMEOUT_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = target_user_data;
+  sqe->user_data = user_data;
+}
+
+
+bool IOUring::SubmitAndWait() {
+  // Completions saved while submitting are pending already.
+  uint32_t min_complete =
+      (next_saved_completion_ < num_saved_completions_) ? 0 : 1;
+  if (!Enter(min_complete)) {
+    return false;
+  }
+  num_pending_timeouts_ = 0;
+  return true;
+}
+
+
+bool IOUring::NextCompletion(uint64_t* user_data,
+                             int32_t* result,
+                             bool* more) {
+  if (next_saved_completion_ < num_saved_completions_) {
+    // Saved completions are older than the ones in the ring.
+    Completion* completion = &saved_completions_[next_saved_completion_++];
+    *user_data = completion->user_data;
+    *result = completion->result;
+    *more = (completion->flags & IORING_CQE_F_MORE) != 0;
+    if (next_saved_completion_ == num_saved_completions_) {
+      next_saved_completion_ = 0;
+      num_saved_completions_ = 0;
+    }
+    return true;
+  }
+  uint32_t head = *cq_head_;
+  if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+  struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+  *user_data = cqe->user_data;
+  *result = cqe->res;
+  *more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+  __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+#else  // defined(HAS_IO_URING)
+
+IOUring* IOUring::Create(uint32_t entries) {
+  return NULL;
+}
+
+
+IOUring::~IOUring() {
+  UNREACHABLE();
+}
+
+
+bool IOUring::RegisterBuffers(void* memory, intptr_t size) {
+  UNREACHABLE();
+  return false;
+}
+
+
+void IOUring::PollAdd(int fd, uint32_t events, uint64_t user_data,
+                      bool multishot) {
+  UNREACHABLE();
+}
+
+
+void IOUring::PollRemove(uint64_t target_user_data, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::Read(int fd, void* buffer, uint32_t length,
+                   uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::Write(int fd, const void* buffer, uint32_t length,
+                    uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::WaitWritable(int fd, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::Accept(int fd, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::Cancel(uint64_t target_user_data, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::TimeoutAt(int64_t millis, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+void IOUring::TimeoutRemove(uint64_t target_user_data, uint64_t user_data) {
+  UNREACHABLE();
+}
+
+
+bool IOUring::SubmitAndWait() {
+  UNREACHABLE();
+  return false;
+}
+
+
+bool IOUring::NextCompletion(uint64_t* user_data,
+                             int32_t* result,
+                             bool* more) {
+  UNREACHABLE();
+  return false;
+}
+
+#endif  // defined(HAS_IO_URING)
+
+}  // namespace bin
+}  // namespace dart
+
+#endif  // defined(TARGET_OS_LINUX)
+
+#endif  // !defined(DART_IO_DISABLED)
@@ -0,0 +1,132 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef BIN_IO_URING_LINUX_H_
+#define BIN_IO_URING_LINUX_H_
+
+#include "platform/globals.h"
+
+struct io_uring_params;
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace dart {
+namespace bin {
+
+// A minimal io_uring instance, see io_uring(7). Requests are queued in the
+// submission ring and only passed to the kernel by SubmitAndWait, so that
+// all the requests of one event loop iteration cost a single system call.
+// Not thread safe, an instance is owned by the event handler thread.
+class IOUring {
+ public:
+  // Returns NULL if the kernel or the headers the VM was built with do not
+  // support io_uring with multishot poll (Linux 5.13).
+  static IOUring* Create(uint32_t entries);
+  ~IOUring();
+
+  // Registers the memory of the buffers passed to Read and Write, so that
+  // the kernel does not map it for every request. Returns false if it could
+  // not be registered, e.g. because of RLIMIT_MEMLOCK. The memory must stay
+  // valid until the instance is deleted.
+  bool RegisterBuffers(void* memory, intptr_t size);
+
+  // Polls the file descriptor for the epoll style events. A multishot poll
+  // stays armed and, like EPOLLET, completes on every new event.
+  void PollAdd(int fd, uint32_t events, uint64_t user_data, bool multishot);
+  void PollRemove(uint64_t target_user_data, uint64_t user_data);
+
+  // Reads or writes at most length bytes of a stream. The result is the
+  // number of bytes transferred or -errno. The buffer must stay valid until
+  // the request completes and be in the registered memory if there is one.
+  void Read(int fd, void* buffer, uint32_t length, uint64_t user_data);
+  void Write(int fd, const void* buffer, uint32_t length, uint64_t user_data);
+
+  // Makes the next queued request start only once the descriptor polls
+  // writable. The poll completes separately, with user_data. If it fails,
+  // the next request completes with -ECANCELED.
+  void WaitWritable(int fd, uint64_t user_data);
+
+  // Accepts a connection of a listening socket. The result is the new
+  // non blocking, close on exec descriptor or -errno.
+  void Accept(int fd, uint64_t user_data);
+
+  // Cancels a read, write or accept. It completes with -ECANCELED, unless
+  // it completed already.
+  void Cancel(uint64_t target_user_data, uint64_t user_data);
+
+  // Completes with -ETIME when the CLOCK_MONOTONIC time in milliseconds is
+  // reached.
+  void TimeoutAt(int64_t millis, uint64_t user_data);
+  void TimeoutRemove(uint64_t target_user_data, uint64_t user_data);
+
+  // Submits the queued requests and waits for at least one completion.
+  // Returns false with errno set if the system call failed.
+  bool SubmitAndWait();
+
+  // Pops the next completion. Returns false if there are none. more is set
+  // if the request stays armed and completes again, see PollAdd.
+  bool NextCompletion(uint64_t* user_data, int32_t* result, bool* more);
+
+ private:
+  struct Completion {
+    uint64_t user_data;
+    int32_t result;
+    uint32_t flags;
+  };
+
+  explicit IOUring(int fd);
+
+  bool Map(const struct io_uring_params& params);
+  void ReserveSqes(uint32_t count);
+  struct io_uring_sqe* NextSqe();
+  void SubmitPending();
+  bool Enter(uint32_t min_complete);
+  bool SaveCompletions();
+
+  const int fd_;
+
+  void* ring_;
+  intptr_t ring_size_;
+  struct io_uring_sqe* sqes_;
+  intptr_t sqes_size_;
+
+  // Submission ring.
+  uint32_t* sq_head_;
+  uint32_t* sq_tail_;
+  uint32_t sq_mask_;
+  uint32_t sq_entries_;
+  // Tail of the requests queued but not submitted yet.
+  uint32_t sq_pending_tail_;
+
+  // Completion ring.
+  uint32_t* cq_head_;
+  uint32_t* cq_tail_;
+  uint32_t cq_mask_;
+  struct io_uring_cqe* cqes_;
+
+  // Completions moved out of the completion ring to let the kernel flush
+  // the ones it could not post, see SaveCompletions. They are returned by
+  // NextCompletion before the ones in the ring.
+  Completion* saved_completions_;
+  intptr_t saved_completions_capacity_;
+  intptr_t num_saved_completions_;
+  intptr_t next_saved_completion_;
+
+  // Start and size of the registered buffer memory, or NULL.
+  uint8_t* buffers_;
+  intptr_t buffers_size_;
+
+  // Timeouts are read by the kernel when they are submitted, they must stay
+  // valid until then. Each is laid out as a struct __kernel_timespec.
+  static const intptr_t kMaxPendingTimeouts = 4;
+  int64_t pending_timeouts_[kMaxPendingTimeouts][2];
+  intptr_t num_pending_timeouts_;
+
+  DISALLOW_COPY_AND_ASSIGN(IOUring);
+};
+
+}  // namespace bin
+}  // namespace dart
+
+#endif  // BIN_IO_URING_LINUX_H_
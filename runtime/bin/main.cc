@@ -425,6 +425,31 @@ static bool ProcessTraceLoadingOption(const char* arg,
 }
 
 
+static bool ProcessIOUringOption(const char* arg,
+                                 CommandLineOptions* vm_options) {
+  if (*arg != '\0') {
+    return false;
+  }
+  EventHandler::set_use_io_uring(true);
+  return true;
+}
+
+
+static bool ProcessEventHandlerThreadsOption(const char* arg,
+                                             CommandLineOptions* vm_options) {
+  ASSERT(arg != NULL);
+  char* end;
+  intptr_t threads = strtol(arg, &end, 10);
+  if ((*arg == '\0') || (*end != '\0') || (threads < 1)) {
+    Log::PrintErr("Invalid --event-handler-threads value '%s', "
+                  "expected a positive number\n", arg);
+    return false;
+  }
+  EventHandler::set_num_threads(threads);
+  return true;
+}
+
+
 
 static bool ProcessShutdownOption(const char* arg,
                                   CommandLineOptions* vm_options) {
@@ -477,6 +502,8 @@ static struct {
   { "--run-app-snapshot=", ProcessRunAppSnapshotOption },
   { "--use-blobs", ProcessUseBlobsOption },
   { "--trace-loading", ProcessTraceLoadingOption },
+  { "--io-uring", ProcessIOUringOption },
+  { "--event-handler-threads=", ProcessEventHandlerThreadsOption },
   { NULL, NULL }
 };
 
@@ -901,6 +928,14 @@ static void PrintUsage() {
 "--trace-loading\n"
 "  enables tracing of library and script loading\n"
 "\n"
+"--io-uring\n"
+"  uses io_uring instead of epoll to wait for socket events and timers\n"
+"  (Linux 5.13 or later, falls back to epoll elsewhere)\n"
+"\n"
+"--event-handler-threads=<n>\n"
+"  spreads sockets and timers over n event handler threads (Linux only,\n"
+"  default 1)\n"
+"\n"
 "--enable-vm-service[=<port>[/<bind-address>]]\n"
 "  enables the VM service and listens on specified port for connections\n"
 "  (default port number is 8181, default bind address is 127.0.0.1).\n"
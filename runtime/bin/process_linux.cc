@@ -12,6 +12,7 @@
 #include <errno.h>  // NOLINT
 #include <fcntl.h>  // NOLINT
 #include <poll.h>  // NOLINT
+#include <signal.h>  // NOLINT
 #include <stdio.h>  // NOLINT
 #include <stdlib.h>  // NOLINT
 #include <string.h>  // NOLINT
@@ -66,8 +67,9 @@ class ProcessInfo {
 // started from Dart.
 class ProcessInfoList {
  public:
+  // The caller must hold mutex(), so that the process can be started and
+  // added before the exit code handler looks up its pid.
   static void AddProcess(pid_t pid, intptr_t fd) {
-    MutexLocker locker(mutex_);
     ProcessInfo* info = new ProcessInfo(pid, fd);
     info->set_next(active_processes_);
     active_processes_ = info;
@@ -106,6 +108,9 @@ class ProcessInfoList {
     }
   }
 
+
+  static Mutex* mutex() { return mutex_; }
+
  private:
   // Linked list of ProcessInfo objects for all active processes
   // started from Dart code.
@@ -293,6 +298,8 @@ class ProcessStarter {
       }
       program_environment_[environment_length] = NULL;
     }
+    exec_paths_ = NULL;
+    shell_arguments_ = NULL;
   }
 
 
@@ -303,6 +310,14 @@ class ProcessStarter {
       return err;
     }
 
+    // Processes that are not detached are started with vfork. Detached
+    // processes are started through intermediate processes that start a new
+    // session and fork again, which a vfork child cannot do, so they are
+    // still started with fork.
+    if (mode_ == kNormal) {
+      return SpawnProcess();
+    }
+
     // Fork to create the new process.
     pid_t pid = TEMP_FAILURE_RETRY(fork());
     if (pid < 0) {
@@ -318,17 +333,7 @@ class ProcessStarter {
     // Be sure to listen for exit-codes, now we have a child-process.
     ExitCodeHandler::ProcessStarted();
 
-    // Register the child process if not detached.
-    if (mode_ == kNormal) {
-      err = RegisterProcess(pid);
-      if (err != 0) {
-        return err;
-      }
-    }
-
-    // Notify child process to start. This is done to delay the call to exec
-    // until the process is registered above, and we are ready to receive the
-    // exit code.
+    // Notify child process to start.
     char msg = '1';
     int bytes_written =
         FDUtils::WriteToBlocking(read_in_[1], &msg, sizeof(msg));
@@ -339,14 +344,78 @@ class ProcessStarter {
     // Read the result of executing the child process.
     VOID_TEMP_FAILURE_RETRY(close(exec_control_[1]));
     exec_control_[1] = -1;
-    if (mode_ == kNormal) {
-      err = ReadExecResult();
-    } else {
-      err = ReadDetachedExecResult(&pid);
+    err = ReadDetachedExecResult(&pid);
+    VOID_TEMP_FAILURE_RETRY(close(exec_control_[0]));
+    exec_control_[0] = -1;
+    return FinishStart(pid, err);
+  }
+
+ private:
+  // Starts a process that is not detached with vfork. Unlike fork, vfork
+  // does not copy the page tables of the parent, so starting a process does
+  // not get slower as the Dart heap grows. The child runs in the memory of
+  // the parent until it calls exec, while the calling thread is suspended.
+  // Everything the child needs is therefore prepared up front, and the child
+  // only makes system calls before it execs or exits.
+  int SpawnProcess() {
+    int event_fds[2];
+    int result = TEMP_FAILURE_RETRY(pipe2(event_fds, O_CLOEXEC));
+    if (result < 0) {
+      return CleanupAndReturnError();
+    }
+    char** environment =
+        (program_environment_ != NULL) ? program_environment_ : environ;
+    ResolveExecPaths(environment);
+
+    // Block all signals, so that no signal handler of the parent runs in the
+    // child before the child has reset them.
+    sigset_t all_signals;
+    sigset_t old_mask;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_SETMASK, &all_signals, &old_mask);
+    pid_t pid;
+    int vfork_errno;
+    {
+      // The child does not wait for the parent before calling exec. Hold the
+      // lock on the process list until the child is added, so that the exit
+      // code handler cannot reap the child before its pid is known.
+      MutexLocker locker(ProcessInfoList::mutex());
+      pid = vfork();
+      vfork_errno = errno;
+      if (pid == 0) {
+        // This runs in the new process.
+        ExecSpawnedProcess(environment, &old_mask);
+      } else if (pid > 0) {
+        ProcessInfoList::AddProcess(pid, event_fds[1]);
+      }
     }
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+    if (pid < 0) {
+      VOID_TEMP_FAILURE_RETRY(close(event_fds[0]));
+      VOID_TEMP_FAILURE_RETRY(close(event_fds[1]));
+      errno = vfork_errno;
+      return CleanupAndReturnError();
+    }
+
+    // This runs in the original process once the child has called exec or
+    // exited.
+
+    // Be sure to listen for exit-codes, now we have a child-process.
+    ExitCodeHandler::ProcessStarted();
+    *exit_event_ = event_fds[0];
+    FDUtils::SetNonBlocking(event_fds[0]);
+
+    // Read the result of executing the child process.
+    VOID_TEMP_FAILURE_RETRY(close(exec_control_[1]));
+    exec_control_[1] = -1;
+    int err = ReadSpawnExecResult();
     VOID_TEMP_FAILURE_RETRY(close(exec_control_[0]));
     exec_control_[0] = -1;
+    return FinishStart(pid, err);
+  }
 
+
+  int FinishStart(pid_t pid, int err) {
     // Return error code if any failures.
     if (err != 0) {
       if (mode_ == kNormal) {
@@ -389,7 +458,7 @@ class ProcessStarter {
     return 0;
   }
 
- private:
+
   int CreatePipes() {
     int result;
     result = TEMP_FAILURE_RETRY(pipe2(exec_control_, O_CLOEXEC));
@@ -429,40 +498,140 @@ class ProcessStarter {
       perror("Failed receiving notification message");
       exit(1);
     }
-    if (mode_ == kNormal) {
-      ExecProcess();
+    ExecDetachedProcess();
+  }
+
+
+  // Fills exec_paths_ with the paths execvp would try for path_, searching
+  // the PATH of the environment the process is started with, and prepares
+  // shell_arguments_ for running scripts that are not executables.
+  void ResolveExecPaths(char** environment) {
+    const char* search_path = NULL;
+    for (intptr_t i = 0; environment[i] != NULL; i++) {
+      if (strncmp(environment[i], "PATH=", 5) == 0) {
+        search_path = environment[i] + 5;
+        break;
+      }
+    }
+    if (search_path == NULL) {
+      // Same default as execvp.
+      search_path = "/bin:/usr/bin";
+    }
+
+    intptr_t count = 1;
+    if ((path_[0] != '\0') && (strchr(path_, '/') == NULL)) {
+      for (const char* p = search_path; *p != '\0'; p++) {
+        if (*p == ':') {
+          count++;
+        }
+      }
+    }
+    exec_paths_ = reinterpret_cast<char**>(
+        Dart_ScopeAllocate((count + 1) * sizeof(*exec_paths_)));
+    if (path_[0] == '\0') {
+      exec_paths_[0] = NULL;
+    } else if (strchr(path_, '/') != NULL) {
+      exec_paths_[0] = const_cast<char*>(path_);
+      exec_paths_[1] = NULL;
     } else {
-      ExecDetachedProcess();
+      intptr_t path_length = strlen(path_);
+      const char* start = search_path;
+      for (intptr_t i = 0; i < count; i++) {
+        const char* end = strchr(start, ':');
+        if (end == NULL) {
+          end = start + strlen(start);
+        }
+        if (end == start) {
+          // An empty element is the current directory.
+          exec_paths_[i] = const_cast<char*>(path_);
+        } else {
+          intptr_t length = end - start;
+          char* exec_path = DartUtils::ScopedCString(length + path_length + 2);
+          memmove(exec_path, start, length);
+          exec_path[length] = '/';
+          memmove(exec_path + length + 1, path_, path_length + 1);
+          exec_paths_[i] = exec_path;
+        }
+        start = end + 1;
+      }
+      exec_paths_[count] = NULL;
+    }
+
+    intptr_t arguments_length = 0;
+    while (program_arguments_[arguments_length] != NULL) {
+      arguments_length++;
+    }
+    shell_arguments_ = reinterpret_cast<char**>(Dart_ScopeAllocate(
+        (arguments_length + 2) * sizeof(*shell_arguments_)));
+    shell_arguments_[0] = const_cast<char*>("/bin/sh");
+    shell_arguments_[1] = NULL;
+    for (intptr_t i = 1; i <= arguments_length; i++) {
+      shell_arguments_[i + 1] = program_arguments_[i];
     }
   }
 
 
-  void ExecProcess() {
+  // This runs in the child created by vfork, in the memory of the parent.
+  // It must not return, allocate or take locks, and it only writes to
+  // shell_arguments_, which the parent does not use.
+  void ExecSpawnedProcess(char** environment, const sigset_t* mask) {
     if (TEMP_FAILURE_RETRY(dup2(write_out_[0], STDIN_FILENO)) == -1) {
-      ReportChildError();
+      ReportSpawnError();
     }
 
     if (TEMP_FAILURE_RETRY(dup2(read_in_[1], STDOUT_FILENO)) == -1) {
-      ReportChildError();
+      ReportSpawnError();
     }
 
     if (TEMP_FAILURE_RETRY(dup2(read_err_[1], STDERR_FILENO)) == -1) {
-      ReportChildError();
+      ReportSpawnError();
     }
 
     if (working_directory_ != NULL &&
         TEMP_FAILURE_RETRY(chdir(working_directory_)) == -1) {
-      ReportChildError();
+      ReportSpawnError();
     }
 
-    if (program_environment_ != NULL) {
-      environ = program_environment_;
+    // Reset the signal handlers of the parent before unblocking signals.
+    struct sigaction default_action;
+    memset(&default_action, 0, sizeof(default_action));
+    default_action.sa_handler = SIG_DFL;
+    sigemptyset(&default_action.sa_mask);
+    for (int sig = 1; sig < NSIG; sig++) {
+      struct sigaction action;
+      if ((sigaction(sig, NULL, &action) == 0) &&
+          (action.sa_handler != SIG_DFL) &&
+          (action.sa_handler != SIG_IGN)) {
+        sigaction(sig, &default_action, NULL);
+      }
     }
-
-    VOID_TEMP_FAILURE_RETRY(
-        execvp(path_, const_cast<char* const*>(program_arguments_)));
-
-    ReportChildError();
+    pthread_sigmask(SIG_SETMASK, mask, NULL);
+
+    // Try the paths in the same way as execvp.
+    bool access_denied = false;
+    errno = ENOENT;
+    for (intptr_t i = 0; exec_paths_[i] != NULL; i++) {
+      VOID_TEMP_FAILURE_RETRY(
+          execve(exec_paths_[i], program_arguments_, environment));
+      if (errno == ENOEXEC) {
+        // Run files that are not executables as shell scripts.
+        shell_arguments_[1] = exec_paths_[i];
+        VOID_TEMP_FAILURE_RETRY(
+            execve(shell_arguments_[0], shell_arguments_, environment));
+        ReportSpawnError();
+      }
+      if (errno == EACCES) {
+        access_denied = true;
+      } else if ((errno != ENOENT) && (errno != ENOTDIR) &&
+                 (errno != ESTALE) && (errno != ENODEV) &&
+                 (errno != ETIMEDOUT)) {
+        ReportSpawnError();
+      }
+    }
+    if (access_denied) {
+      errno = EACCES;
+    }
+    ReportSpawnError();
   }
 
 
@@ -524,31 +693,17 @@ class ProcessStarter {
   }
 
 
-  int RegisterProcess(pid_t pid) {
-    int result;
-    int event_fds[2];
-    result = TEMP_FAILURE_RETRY(pipe2(event_fds, O_CLOEXEC));
-    if (result < 0) {
-      return CleanupAndReturnError();
-    }
-
-    ProcessInfoList::AddProcess(pid, event_fds[1]);
-    *exit_event_ = event_fds[0];
-    FDUtils::SetNonBlocking(event_fds[0]);
-    return 0;
-  }
-
-
-  int ReadExecResult() {
+  int ReadSpawnExecResult() {
     int child_errno;
     int bytes_read = -1;
     // Read exec result from child. If no data is returned the exec was
     // successful and the exec call closed the pipe. Otherwise the errno
-    // is written to the pipe.
+    // is written to the pipe, and the error message is created here.
     bytes_read = FDUtils::ReadFromBlocking(
         exec_control_[0], &child_errno, sizeof(child_errno));
     if (bytes_read == sizeof(child_errno)) {
-      ReadChildError();
+      errno = child_errno;
+      SetChildOsErrorMessage();
       return child_errno;
     } else if (bytes_read == -1) {
       return errno;
@@ -684,6 +839,17 @@ class ProcessStarter {
   }
 
 
+  void ReportSpawnError() {
+    // In the case of failure in a child created by vfork only write the
+    // errno, as creating the message is not safe in the child, and exit
+    // without running exit handlers of the parent.
+    int child_errno = errno;
+    VOID_TEMP_FAILURE_RETRY(
+        write(exec_control_[1], &child_errno, sizeof(child_errno)));
+    _exit(1);
+  }
+
+
   void ReportPid(int pid) {
     // In the case of starting a detached process the actual pid of that process
     // is communicated using the exec control pipe.
@@ -733,6 +899,8 @@ class ProcessStarter {
 
   char** program_arguments_;
   char** program_environment_;
+  char** exec_paths_;
+  char** shell_arguments_;
 
   const char* path_;
   const char* working_directory_;
@@ -7,6 +7,7 @@
 #include "bin/socket.h"
 
 #include "bin/dartutils.h"
+#include "bin/file.h"
 #include "bin/io_buffer.h"
 #include "bin/isolate_data.h"
 #include "bin/lockers.h"
@@ -26,6 +27,21 @@ static const int kSocketIdNativeField = 0;
 
 ListeningSocketRegistry *globalTcpListeningSocketRegistry = NULL;
 
+#if defined(TARGET_OS_LINUX) || defined(TARGET_OS_ANDROID)
+// Only Linux balances the incoming connections between the sockets
+// listening on the same address with SO_REUSEPORT.
+static const bool kReusePortSupported = true;
+#else
+static const bool kReusePortSupported = false;
+#endif
+
+
+bool ListeningSocketRegistry::UseReusePort() {
+  static bool use_reuse_port =
+      kReusePortSupported && Dart_IsVMFlagSet("shared_sockets_reuse_port");
+  return use_reuse_port;
+}
+
 
 void ListeningSocketRegistry::Initialize() {
   ASSERT(globalTcpListeningSocketRegistry == NULL);
@@ -84,6 +100,14 @@ Dart_Handle ListeningSocketRegistry::CreateBindListen(Dart_Handle socket_object,
         return DartUtils::NewDartOSError(&os_error);
       }
 
+      if (UseReusePort()) {
+        // Every socket of the group has its own file descriptor, so that the
+        // kernel balances the connections between them instead of waking up
+        // all the isolates accepting on one file descriptor.
+        return CreateBindListenReusePort(
+            socket_object, addr, backlog, v6_only, first_os_socket);
+      }
+
       // This socket creation is the exact same as the one which originally
       // created the socket. We therefore increment the refcount and reuse
       // the file descriptor.
@@ -97,7 +121,8 @@ Dart_Handle ListeningSocketRegistry::CreateBindListen(Dart_Handle socket_object,
   }
 
   // There is no socket listening on that (address, port), so we create new one.
-  intptr_t socketfd = ServerSocket::CreateBindListen(addr, backlog, v6_only);
+  intptr_t socketfd = ServerSocket::CreateBindListen(
+      addr, backlog, v6_only, shared && UseReusePort());
   if (socketfd == -5) {
     OSError os_error(-1, "Invalid host", OSError::kUnknown);
     return DartUtils::NewDartOSError(&os_error);
@@ -127,6 +152,39 @@ Dart_Handle ListeningSocketRegistry::CreateBindListen(Dart_Handle socket_object,
 }
 
 
+Dart_Handle ListeningSocketRegistry::CreateBindListenReusePort(
+    Dart_Handle socket_object,
+    RawAddr addr,
+    intptr_t backlog,
+    bool v6_only,
+    OSSocket* first_os_socket) {
+  ASSERT(!mutex_->TryLock());
+  intptr_t socketfd = ServerSocket::CreateBindListen(
+      addr, backlog, v6_only, true);
+  if (socketfd < 0) {
+    OSError error;
+    return DartUtils::NewDartOSError(&error);
+  }
+  if (!ServerSocket::StartAccept(socketfd)) {
+    OSError os_error(-1, "Failed to start accept", OSError::kUnknown);
+    return DartUtils::NewDartOSError(&os_error);
+  }
+
+  // The new socket joins the group of sockets listening on the port. Each
+  // one is closed on its own by CloseSafe, and the group accepts new members
+  // as long as one of them is left.
+  OSSocket *os_socket =
+      new OSSocket(addr, first_os_socket->port, v6_only, true, socketfd);
+  os_socket->ref_count = 1;
+  os_socket->next = first_os_socket;
+  sockets_by_port_[os_socket->port] = os_socket;
+  sockets_by_fd_[socketfd] = os_socket;
+
+  Socket::SetSocketIdNativeField(socket_object, socketfd);
+  return Dart_True();
+}
+
+
 bool ListeningSocketRegistry::CloseSafe(intptr_t socketfd) {
   ASSERT(!mutex_->TryLock());
 
@@ -267,43 +325,44 @@ void FUNCTION_NAME(Socket_Available)(Dart_NativeArguments args) {
 }
 
 
-void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
+void FUNCTION_NAME(Socket_ReadInto)(Dart_NativeArguments args) {
   static bool short_socket_reads = Dart_IsVMFlagSet("short_socket_read");
   intptr_t socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
-  int64_t length = 0;
-  if (DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 1), &length)) {
-    if (short_socket_reads) {
-      length = (length + 1) / 2;
-    }
-    uint8_t* buffer = NULL;
-    Dart_Handle result = IOBuffer::Allocate(length, &buffer);
-    if (Dart_IsError(result)) {
-      Dart_PropagateError(result);
-    }
-    ASSERT(buffer != NULL);
-    intptr_t bytes_read = Socket::Read(socket, buffer, length);
-    if (bytes_read == length) {
-      Dart_SetReturnValue(args, result);
-    } else if (bytes_read > 0) {
-      uint8_t* new_buffer = NULL;
-      Dart_Handle new_result = IOBuffer::Allocate(bytes_read, &new_buffer);
-      if (Dart_IsError(new_result)) {
-        Dart_PropagateError(new_result);
-      }
-      ASSERT(new_buffer != NULL);
-      memmove(new_buffer, buffer, bytes_read);
-      Dart_SetReturnValue(args, new_result);
-    } else if (bytes_read == 0) {
-      // On MacOS when reading from a tty Ctrl-D will result in reading one
-      // less byte then reported as available.
-      Dart_SetReturnValue(args, Dart_Null());
-    } else {
-      ASSERT(bytes_read == -1);
-      Dart_SetReturnValue(args, DartUtils::NewDartOSError());
-    }
+  Dart_Handle buffer_obj = Dart_GetNativeArgument(args, 1);
+  ASSERT(Dart_IsTypedData(buffer_obj));
+  intptr_t offset =
+      DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  intptr_t length =
+      DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 3));
+  if (short_socket_reads) {
+    length = (length + 1) / 2;
+  }
+  Dart_TypedData_Type type;
+  uint8_t* buffer = NULL;
+  intptr_t len;
+  Dart_Handle result = Dart_TypedDataAcquireData(
+      buffer_obj, &type, reinterpret_cast<void**>(&buffer), &len);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT(type == Dart_TypedData_kUint8);
+  ASSERT((offset + length) <= len);
+  buffer += offset;
+  intptr_t bytes_read = Socket::Read(socket, buffer, length);
+  if (bytes_read > 0) {
+    Dart_TypedDataReleaseData(buffer_obj);
+    Dart_SetReturnValue(args, Dart_NewInteger(bytes_read));
+  } else if (bytes_read == 0) {
+    Dart_TypedDataReleaseData(buffer_obj);
+    // On MacOS when reading from a tty Ctrl-D will result in reading one
+    // less byte then reported as available.
+    Dart_SetReturnValue(args, Dart_Null());
   } else {
-    OSError os_error(-1, "Invalid argument", OSError::kUnknown);
+    ASSERT(bytes_read == -1);
+    // Extract OSError before we release data, as it may override the error.
+    OSError os_error;
+    Dart_TypedDataReleaseData(buffer_obj);
     Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
   }
 }
@@ -429,6 +488,151 @@ void FUNCTION_NAME(Socket_WriteList)(Dart_NativeArguments args) {
 }
 
 
+static void ReleaseWriteVBuffers(Dart_Handle* buffers,
+                                 intptr_t* first_occurrence,
+                                 intptr_t count) {
+  for (intptr_t i = 0; i < count; i++) {
+    if (first_occurrence[i] == i) {
+      Dart_TypedDataReleaseData(buffers[i]);
+    }
+  }
+}
+
+
+void FUNCTION_NAME(Socket_WriteV)(Dart_NativeArguments args) {
+  static bool short_socket_writes = Dart_IsVMFlagSet("short_socket_write");
+  intptr_t socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  Dart_Handle buffers_obj = Dart_GetNativeArgument(args, 1);
+  Dart_Handle starts_obj = Dart_GetNativeArgument(args, 2);
+  Dart_Handle ends_obj = Dart_GetNativeArgument(args, 3);
+  ASSERT(Dart_IsList(buffers_obj));
+  intptr_t count = 0;
+  Dart_Handle result = Dart_ListLength(buffers_obj, &count);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT((count > 0) && (count <= Socket::kMaxWriteVectors));
+
+  // Look up all the arguments before acquiring any data, no Dart API calls
+  // are allowed while data is acquired. A buffer may be passed more than
+  // once, but can only be acquired once.
+  Dart_Handle buffers[Socket::kMaxWriteVectors];
+  intptr_t starts[Socket::kMaxWriteVectors];
+  intptr_t ends[Socket::kMaxWriteVectors];
+  intptr_t first_occurrence[Socket::kMaxWriteVectors];
+  for (intptr_t i = 0; i < count; i++) {
+    buffers[i] = Dart_ListGetAt(buffers_obj, i);
+    if (Dart_IsError(buffers[i])) {
+      Dart_PropagateError(buffers[i]);
+    }
+    starts[i] = DartUtils::GetIntptrValue(Dart_ListGetAt(starts_obj, i));
+    ends[i] = DartUtils::GetIntptrValue(Dart_ListGetAt(ends_obj, i));
+    first_occurrence[i] = i;
+    for (intptr_t j = 0; j < i; j++) {
+      if (Dart_IdentityEquals(buffers[i], buffers[j])) {
+        first_occurrence[i] = j;
+        break;
+      }
+    }
+  }
+
+  SocketIOVector vectors[Socket::kMaxWriteVectors];
+  uint8_t* data[Socket::kMaxWriteVectors];
+  intptr_t total_bytes = 0;
+  for (intptr_t i = 0; i < count; i++) {
+    if (first_occurrence[i] == i) {
+      Dart_TypedData_Type type;
+      intptr_t len;
+      result = Dart_TypedDataAcquireData(
+          buffers[i], &type, reinterpret_cast<void**>(&data[i]), &len);
+      if (Dart_IsError(result)) {
+        ReleaseWriteVBuffers(buffers, first_occurrence, i);
+        Dart_PropagateError(result);
+      }
+      ASSERT(ends[i] <= len);
+    } else {
+      data[i] = data[first_occurrence[i]];
+    }
+    ASSERT(starts[i] <= ends[i]);
+    vectors[i].buffer = data[i] + starts[i];
+    vectors[i].num_bytes = ends[i] - starts[i];
+    total_bytes += vectors[i].num_bytes;
+  }
+
+  intptr_t write_count = count;
+  bool short_write = false;
+  if (short_socket_writes && (total_bytes > 1)) {
+    // Only write the first half of the data.
+    short_write = true;
+    intptr_t remaining = (total_bytes + 1) / 2;
+    intptr_t i = 0;
+    while (vectors[i].num_bytes < remaining) {
+      remaining -= vectors[i].num_bytes;
+      i++;
+    }
+    vectors[i].num_bytes = remaining;
+    write_count = i + 1;
+  }
+  intptr_t bytes_written = Socket::WriteV(socket, vectors, write_count);
+  if (bytes_written >= 0) {
+    ReleaseWriteVBuffers(buffers, first_occurrence, count);
+    if (short_write) {
+      // If the write was forced 'short', indicate by returning the negative
+      // number of bytes. A forced short write may not trigger a write event.
+      Dart_SetReturnValue(args, Dart_NewInteger(-bytes_written));
+    } else {
+      Dart_SetReturnValue(args, Dart_NewInteger(bytes_written));
+    }
+  } else {
+    // Extract OSError before we release data, as it may override the error.
+    OSError os_error;
+    ReleaseWriteVBuffers(buffers, first_occurrence, count);
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+  }
+}
+
+
+// The native field of _RandomAccessFileOpsImpl holding the File pointer.
+static const int kFileNativeFieldIndex = 0;
+
+/*
+ * Sends up to args[3] bytes of the file behind the random access file ops
+ * args[1] from position args[2] to the socket args[0]. Returns the number
+ * of bytes sent, 0 at the end of the file, or null if the socket is not
+ * ready for writing.
+ */
+void FUNCTION_NAME(Socket_SendFile)(Dart_NativeArguments args) {
+  static bool short_socket_writes = Dart_IsVMFlagSet("short_socket_write");
+  intptr_t socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  File* file;
+  ThrowIfError(Dart_GetNativeInstanceField(
+      Dart_GetNativeArgument(args, 1),
+      kFileNativeFieldIndex,
+      reinterpret_cast<intptr_t*>(&file)));
+  if (file == NULL) {
+    Dart_ThrowException(DartUtils::NewInternalError("File is closed"));
+  }
+  int64_t offset = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 2), 0, kMaxInt64);
+  int64_t length = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 3), 0, kMaxInt64);
+  if (short_socket_writes) {
+    length = (length + 1) / 2;
+  }
+  int64_t bytes_sent =
+      Socket::SendFile(socket, file->GetFD(), offset, length);
+  if (bytes_sent >= 0) {
+    Dart_SetReturnValue(args, Dart_NewInteger(bytes_sent));
+  } else if (bytes_sent == Socket::kTemporaryFailure) {
+    Dart_SetReturnValue(args, Dart_Null());
+  } else {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+  }
+}
+
+
 void FUNCTION_NAME(Socket_SendTo)(Dart_NativeArguments args) {
   intptr_t socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -250,8 +250,19 @@ class AddressList {
 };
 
 
+// A buffer of a gather write, see Socket::WriteV.
+struct SocketIOVector {
+  const void* buffer;
+  intptr_t num_bytes;
+};
+
+
 class Socket {
  public:
+  // Maximum number of buffers of a gather write. Not more than IOV_MAX on
+  // any platform.
+  static const intptr_t kMaxWriteVectors = 64;
+
   enum SocketRequest {
     kLookupRequest = 0,
     kListInterfacesRequest = 1,
@@ -262,6 +273,20 @@ class Socket {
   static intptr_t Available(intptr_t fd);
   static intptr_t Read(intptr_t fd, void* buffer, intptr_t num_bytes);
   static intptr_t Write(intptr_t fd, const void* buffer, intptr_t num_bytes);
+  // Writes the buffers in order with a single gather write where supported.
+  // Returns the number of bytes written, which may end in any buffer.
+  static intptr_t WriteV(intptr_t fd,
+                         const SocketIOVector* vectors,
+                         intptr_t count);
+  // Sends up to num_bytes of the file file_fd from offset without copying
+  // them through user space where supported. Returns the number of bytes
+  // sent, 0 at the end of the file, kTemporaryFailure if the socket is not
+  // ready for writing, or -1 on error. The file position is not changed.
+  static const intptr_t kTemporaryFailure = -2;
+  static int64_t SendFile(intptr_t fd,
+                          intptr_t file_fd,
+                          int64_t offset,
+                          int64_t num_bytes);
   // Send data on a socket. The port to send to is specified in the port
   // component of the passed RawAddr structure. The RawAddr structure is only
   // used for datagram sockets.
@@ -352,9 +377,14 @@ class ServerSocket {
   //
   //   -1: system error (errno set)
   //   -5: invalid bindAddress
+  //
+  // If reuse_port is true the socket is created with SO_REUSEPORT, so that
+  // more sockets can listen on the same address. Only supported on Linux and
+  // Android.
   static intptr_t CreateBindListen(const RawAddr& addr,
                                    intptr_t backlog,
-                                   bool v6_only = false);
+                                   bool v6_only = false,
+                                   bool reuse_port = false);
 
   // Start accepting on a newly created listening socket. If it was unable to
   // start accepting incoming sockets, the fd is invalidated.
@@ -421,7 +451,19 @@ class ListeningSocketRegistry {
 
   Mutex *mutex() { return mutex_; }
 
+  // Whether each shared socket gets its own file descriptor listening with
+  // SO_REUSEPORT instead of sharing one, see --shared_sockets_reuse_port.
+  // Always false on platforms where the kernel does not balance the
+  // connections between such sockets.
+  static bool UseReusePort();
+
  private:
+  Dart_Handle CreateBindListenReusePort(Dart_Handle socket_object,
+                                        RawAddr addr,
+                                        intptr_t backlog,
+                                        bool v6_only,
+                                        OSSocket* first_os_socket);
+
   OSSocket *findOSSocketWithAddress(OSSocket *current, const RawAddr& addr) {
     while (current != NULL) {
       if (SocketAddress::AreAddressesEqual(current->address, addr)) {
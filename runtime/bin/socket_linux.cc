@@ -12,18 +12,22 @@
 
 #include <errno.h>  // NOLINT
 #include <ifaddrs.h>  // NOLINT
+#include <limits.h>  // NOLINT
 #include <net/if.h>  // NOLINT
 #include <netinet/tcp.h>  // NOLINT
 #include <stdio.h>  // NOLINT
 #include <stdlib.h>  // NOLINT
 #include <string.h>  // NOLINT
+#include <sys/sendfile.h>  // NOLINT
 #include <sys/stat.h>  // NOLINT
+#include <sys/uio.h>  // NOLINT
 #include <unistd.h>  // NOLINT
 
 #include "bin/fdutils.h"
 #include "bin/file.h"
 #include "bin/thread.h"
 #include "platform/signal_blocker.h"
+#include "platform/utils.h"
 
 namespace dart {
 namespace bin {
@@ -147,6 +151,46 @@ intptr_t Socket::Write(intptr_t fd, const void* buffer, intptr_t num_bytes) {
 }
 
 
+intptr_t Socket::WriteV(intptr_t fd,
+                        const SocketIOVector* vectors,
+                        intptr_t count) {
+  ASSERT(fd >= 0);
+  ASSERT((count > 0) && (count <= kMaxWriteVectors) && (count <= IOV_MAX));
+  struct iovec iov[kMaxWriteVectors];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(vectors[i].buffer);
+    iov[i].iov_len = vectors[i].num_bytes;
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+
+int64_t Socket::SendFile(intptr_t fd,
+                         intptr_t file_fd,
+                         int64_t offset,
+                         int64_t num_bytes) {
+  ASSERT(fd >= 0);
+  ASSERT(offset >= 0);
+  // A single sendfile transfers at most 0x7ffff000 bytes.
+  const int64_t kMaxSendFileBytes = 0x7ffff000;
+  off64_t file_offset = offset;
+  ssize_t sent = TEMP_FAILURE_RETRY(sendfile64(
+      fd, file_fd, &file_offset, Utils::Minimum(num_bytes, kMaxSendFileBytes)));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sent == -1) && (errno == EWOULDBLOCK)) {
+    return kTemporaryFailure;
+  }
+  return sent;
+}
+
+
 intptr_t Socket::SendTo(
     intptr_t fd, const void* buffer, intptr_t num_bytes, const RawAddr& addr) {
   ASSERT(fd >= 0);
@@ -384,7 +428,8 @@ AddressList<InterfaceSocketAddress>* Socket::ListInterfaces(
 
 intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
                                         intptr_t backlog,
-                                        bool v6_only) {
+                                        bool v6_only,
+                                        bool reuse_port) {
   intptr_t fd;
 
   fd = NO_RETRY_EXPECTED(
@@ -397,6 +442,11 @@ intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
   VOID_NO_RETRY_EXPECTED(
       setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval)));
 
+  if (reuse_port) {
+    VOID_NO_RETRY_EXPECTED(
+        setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &optval, sizeof(optval)));
+  }
+
   if (addr.ss.ss_family == AF_INET6) {
     optval = v6_only ? 1 : 0;
     VOID_NO_RETRY_EXPECTED(
@@ -414,7 +464,7 @@ intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
       (Socket::GetPort(fd) == 65535)) {
     // Don't close the socket until we have created a new socket, ensuring
     // that we do not get the bad port number again.
-    intptr_t new_fd = CreateBindListen(addr, backlog, v6_only);
+    intptr_t new_fd = CreateBindListen(addr, backlog, v6_only, reuse_port);
     int err = errno;
     VOID_TEMP_FAILURE_RETRY(close(fd));
     errno = err;
@@ -12,12 +12,14 @@
 
 #include <errno.h>  // NOLINT
 #include <ifaddrs.h>  // NOLINT
+#include <limits.h>  // NOLINT
 #include <net/if.h>  // NOLINT
 #include <netinet/tcp.h>  // NOLINT
 #include <stdio.h>  // NOLINT
 #include <stdlib.h>  // NOLINT
 #include <string.h>  // NOLINT
 #include <sys/stat.h>  // NOLINT
+#include <sys/uio.h>  // NOLINT
 #include <unistd.h>  // NOLINT
 
 #include "bin/fdutils.h"
@@ -149,6 +151,48 @@ intptr_t Socket::Write(intptr_t fd, const void* buffer, intptr_t num_bytes) {
 }
 
 
+intptr_t Socket::WriteV(intptr_t fd,
+                        const SocketIOVector* vectors,
+                        intptr_t count) {
+  ASSERT(fd >= 0);
+  ASSERT((count > 0) && (count <= kMaxWriteVectors) && (count <= IOV_MAX));
+  struct iovec iov[kMaxWriteVectors];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(vectors[i].buffer);
+    iov[i].iov_len = vectors[i].num_bytes;
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+
+int64_t Socket::SendFile(intptr_t fd,
+                         intptr_t file_fd,
+                         int64_t offset,
+                         int64_t num_bytes) {
+  ASSERT(fd >= 0);
+  ASSERT(offset >= 0);
+  off_t length = num_bytes;
+  int result = TEMP_FAILURE_RETRY(
+      sendfile(file_fd, fd, offset, &length, NULL, 0));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if (result == -1) {
+    if (errno != EWOULDBLOCK) {
+      return -1;
+    }
+    // A partial transfer fails with EAGAIN and sets the length sent.
+    return (length > 0) ? length : kTemporaryFailure;
+  }
+  return length;
+}
+
+
 intptr_t Socket::SendTo(
     intptr_t fd, const void* buffer, intptr_t num_bytes, const RawAddr& addr) {
   ASSERT(fd >= 0);
@@ -380,7 +424,10 @@ AddressList<InterfaceSocketAddress>* Socket::ListInterfaces(
 
 intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
                                         intptr_t backlog,
-                                        bool v6_only) {
+                                        bool v6_only,
+                                        bool reuse_port) {
+  // SO_REUSEPORT is only used on Linux and Android.
+  ASSERT(!reuse_port);
   intptr_t fd;
 
   fd = TEMP_FAILURE_RETRY(socket(addr.ss.ss_family, SOCK_STREAM, 0));
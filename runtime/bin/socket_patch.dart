@@ -252,8 +252,11 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   // of tokens returned.
   static const int RETURN_TOKEN_COMMAND = 11;
   static const int SET_EVENT_MASK_COMMAND = 12;
+  // The lower bits of RETURN_READ_TOKEN_COMMAND messages contains the number
+  // of chunks of received data consumed.
+  static const int RETURN_READ_TOKEN_COMMAND = 13;
   static const int FIRST_COMMAND = CLOSE_COMMAND;
-  static const int LAST_COMMAND = SET_EVENT_MASK_COMMAND;
+  static const int LAST_COMMAND = RETURN_READ_TOKEN_COMMAND;
 
   // Type flag send to the eventhandler providing additional
   // information on the type of the file descriptor.
@@ -274,6 +277,14 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   static const int TYPE_PROTOCOL_MASK =
       TYPE_TCP_SOCKET | TYPE_UDP_SOCKET | TYPE_INTERNAL_SOCKET;
 
+  // Kinds of the list messages received when the eventhandler reads,
+  // writes and accepts for a TCP socket itself. The data read is received
+  // as a Uint8List. Keep in sync with CompletionKind in eventhandler.h.
+  static const int ACCEPT_COMPLETION = 0;
+  static const int WRITE_COMPLETION = 1;
+  static const int READ_ERROR_COMPLETION = 2;
+  static const int WRITE_ERROR_COMPLETION = 3;
+
 
   // Native port messages.
   static const HOST_NAME_LOOKUP = 0;
@@ -284,8 +295,21 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   static const int PROTOCOL_IPV4 = 1 << 0;
   static const int PROTOCOL_IPV6 = 1 << 1;
 
+  // Keep in sync with Socket::kMaxWriteVectors in socket.h.
+  static const int MAX_WRITE_BUFFERS = 64;
+
   static const int NORMAL_TOKEN_BATCH_SIZE = 8;
   static const int LISTENING_TOKEN_BATCH_SIZE = 2;
+  static const int READ_TOKEN_BATCH_SIZE = 4;
+
+  // The number of writes queued with the eventhandler at a time, and the
+  // most data in each. Keep in sync with
+  // EventHandlerShard::kUringBufferSize in eventhandler_linux.h.
+  static const int MAX_QUEUED_WRITES = 8;
+  static const int QUEUED_WRITE_SIZE = 16 * 1024;
+
+  // How long close waits for the queued writes before it drops them.
+  static const Duration _CLOSE_WRITES_TIMEOUT = const Duration(seconds: 5);
 
   static const Duration _RETRY_DURATION = const Duration(milliseconds: 250);
   static const Duration _RETRY_DURATION_LOOPBACK =
@@ -317,6 +341,20 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
 
   int tokens = 0;
 
+  // The data read by the eventhandler that was not consumed yet.
+  ListQueue<Uint8List> receivedData;
+  int receivedOffset = 0;
+  int readTokens = 0;
+
+  // Whether writes are queued with the eventhandler, see queueWrite.
+  bool queueWrites = true;
+  int queuedWrites = 0;
+  // Set while close waits for the queued writes.
+  Timer closeWritesTimer;
+
+  // The connections accepted by the eventhandler that were not taken yet.
+  ListQueue<int> acceptedFds;
+
   bool sendReadEvents = false;
   bool readEventIssued = false;
 
@@ -577,7 +615,18 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     if (isClosing || isClosed) return null;
     len = min(available, len == null ? available : len);
     if (len == 0) return null;
-    var result = nativeRead(len);
+    var result;
+    if (receivedData != null) {
+      result = readReceivedData(len);
+    } else {
+      // Read straight into the result. len is at most the number of bytes
+      // available, so only a short read needs a copy.
+      var buffer = new Uint8List(len);
+      result = nativeReadInto(buffer, 0, len);
+      if (result is int) {
+        result = (result == len) ? buffer : buffer.sublist(0, result);
+      }
+    }
     if (result is OSError) {
       reportError(result, "Read failed");
       return null;
@@ -598,6 +647,42 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     return result;
   }
 
+  // Takes len bytes of the data read by the eventhandler. The eventhandler
+  // reads more once chunks of it are consumed.
+  Uint8List readReceivedData(int len) {
+    assert(len <= available);
+    var data = receivedData.first;
+    if (receivedOffset == 0 && data.length == len) {
+      receivedData.removeFirst();
+      returnReadToken();
+      return data;
+    }
+    var result = new Uint8List(len);
+    int offset = 0;
+    while (offset < len) {
+      data = receivedData.first;
+      int bytes = min(len - offset, data.length - receivedOffset);
+      result.setRange(offset, offset + bytes, data, receivedOffset);
+      offset += bytes;
+      receivedOffset += bytes;
+      if (receivedOffset == data.length) {
+        receivedData.removeFirst();
+        receivedOffset = 0;
+        returnReadToken();
+      }
+    }
+    return result;
+  }
+
+  void returnReadToken() {
+    readTokens++;
+    // Return in batches.
+    if (readTokens == READ_TOKEN_BATCH_SIZE && !isClosing && !isClosed) {
+      sendToEventHandler((1 << RETURN_READ_TOKEN_COMMAND) | readTokens);
+      readTokens = 0;
+    }
+  }
+
   Datagram receive() {
     if (isClosing || isClosed) return null;
     var result = nativeRecvFrom();
@@ -646,8 +731,13 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     if (bytes == 0) return 0;
     _BufferAndStart bufferAndStart =
         _ensureFastAndSerializableByteData(buffer, offset, offset + bytes);
-    var result =
-        nativeWrite(bufferAndStart.buffer, bufferAndStart.start, bytes);
+    var result = queueWrite([bufferAndStart.buffer],
+                            [bufferAndStart.start],
+                            [bufferAndStart.start + bytes]);
+    if (result == null) {
+      result =
+          nativeWrite(bufferAndStart.buffer, bufferAndStart.start, bytes);
+    }
     if (result is OSError) {
       scheduleMicrotask(() => reportError(result, "Write failed"));
       result = 0;
@@ -668,6 +758,104 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     return result;
   }
 
+  // Writes the buffers, the first one from [offset], with one gather write.
+  // Only the first [MAX_WRITE_BUFFERS] buffers are written. Returns the
+  // number of bytes written.
+  int writeList(List<List<int>> buffers, int offset) {
+    if (isClosing || isClosed) return 0;
+    int count = min(buffers.length, MAX_WRITE_BUFFERS);
+    var nativeBuffers = new List(count);
+    var starts = new List<int>(count);
+    var ends = new List<int>(count);
+    int bytes = 0;
+    for (int i = 0; i < count; i++) {
+      var buffer = buffers[i];
+      if (buffer is! List) throw new ArgumentError();
+      int start = (i == 0) ? offset : 0;
+      int length = buffer.length - start;
+      _BufferAndStart bufferAndStart =
+          _ensureFastAndSerializableByteData(buffer, start, buffer.length);
+      nativeBuffers[i] = bufferAndStart.buffer;
+      starts[i] = bufferAndStart.start;
+      ends[i] = bufferAndStart.start + length;
+      bytes += length;
+    }
+    if (bytes == 0) return 0;
+    var result = queueWrite(nativeBuffers, starts, ends);
+    if (result == null) result = nativeWriteV(nativeBuffers, starts, ends);
+    if (result is OSError) {
+      scheduleMicrotask(() => reportError(result, "Write failed"));
+      result = 0;
+    }
+    // A negative result is a forced short write, see write.
+    if (result >= 0 && result < bytes) {
+      writeAvailable = false;
+    }
+    if (result < 0) result = -result;
+    // TODO(ricow): Remove when we track internal and pipe uses.
+    assert(resourceInfo != null || isPipe || isInternal);
+    if (resourceInfo != null) {
+      resourceInfo.addWrite(result);
+    }
+    return result;
+  }
+
+  // Queues the data between [starts] and [ends] of [buffers] to be written
+  // by the eventhandler, which does that for TCP sockets on Linux with
+  // --io-uring. The data is copied, in writes of up to [QUEUED_WRITE_SIZE]
+  // bytes while fewer than [MAX_QUEUED_WRITES] are queued. Returns the
+  // number of bytes queued, 0 if no more can be queued until a write
+  // completes, or null if the data must be written directly.
+  int queueWrite(List buffers, List<int> starts, List<int> ends) {
+    if (!isTcp || !queueWrites) return null;
+    if (queuedWrites == MAX_QUEUED_WRITES) return 0;
+    connectToEventHandler();
+    var result = _EventHandler._queueWrite(
+        this, eventPort.sendPort, buffers, starts, ends,
+        MAX_QUEUED_WRITES - queuedWrites);
+    if (result == null) {
+      queueWrites = false;
+    } else if (result > 0) {
+      // Only the last write is not full.
+      queuedWrites += (result + QUEUED_WRITE_SIZE - 1) ~/ QUEUED_WRITE_SIZE;
+    } else if (queuedWrites == 0) {
+      // All write buffers are in use. Nothing is queued for this socket,
+      // so it can write directly without reordering the data.
+      result = null;
+    }
+    return result;
+  }
+
+  // Sends up to [bytes] bytes of [file] from [position] without reading
+  // them into Dart. Returns the number of bytes sent, 0 at the end of the
+  // file, or null if the socket is not ready for writing.
+  int sendFile(_RandomAccessFile file, int position, int bytes) {
+    if (isClosing || isClosed) throw new SocketException.closed();
+    // The next range may be prefetched while this one is sent, so only a
+    // closed file is an error.
+    if (file.closed) throw new FileSystemException("File closed", file.path);
+    if (queuedWrites > 0) {
+      // Sent once the queued writes are done.
+      writeAvailable = false;
+      return null;
+    }
+    var result = nativeSendFile(file._ops, position, bytes);
+    if (result is OSError) {
+      throw new SocketException("Write failed", osError: result);
+    }
+    if (result == null) {
+      writeAvailable = false;
+      return null;
+    }
+    file._resourceInfo.addRead(result);
+    // TODO(ricow): Remove when we track internal and pipe uses.
+    assert(resourceInfo != null || isPipe || isInternal);
+    if (resourceInfo != null) {
+      resourceInfo.addWrite(result);
+    }
+    return result;
+  }
+
   int send(List<int> buffer, int offset, int bytes,
            InternetAddress address, int port) {
     if (isClosing || isClosed) return 0;
@@ -697,7 +885,11 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     tokens++;
     returnTokens(LISTENING_TOKEN_BATCH_SIZE);
     var socket = new _NativeSocket.normal();
-    if (nativeAccept(socket) != true) return null;
+    if (acceptedFds != null && acceptedFds.isNotEmpty) {
+      socket.nativeSetSocketId(acceptedFds.removeFirst());
+    } else if (nativeAccept(socket) != true) {
+      return null;
+    }
     socket.localPort = localPort;
     socket.localAddress = address;
     setupResourceInfo(socket);
@@ -785,7 +977,12 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   }
 
   // Multiplexes socket events to the socket handlers.
-  void multiplex(int events) {
+  void multiplex(message) {
+    if (message is! int) {
+      multiplexCompletion(message);
+      return;
+    }
+    int events = message;
     for (int i = FIRST_EVENT; i <= LAST_EVENT; i++) {
       if (((events & (1 << i)) != 0)) {
         if ((i == CLOSED_EVENT || i == READ_EVENT) && isClosedRead) continue;
@@ -848,6 +1045,75 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
   }
 
+  // Handles the data read and the completions of the writes and accepts
+  // the eventhandler does for the socket, see queueWrite.
+  void multiplexCompletion(message) {
+    if (message is Uint8List) {
+      // The data is dropped if it is not read anymore.
+      if (!isClosing && !isClosed && !isClosedRead) {
+        if (receivedData == null) receivedData = new ListQueue<Uint8List>();
+        receivedData.add(message);
+        available += message.length;
+        issueReadEvent();
+      }
+    } else {
+      List completion = message;
+      switch (completion[0]) {
+        case ACCEPT_COMPLETION:
+          assert(isListening);
+          if (isClosing || isClosed) {
+            closeAccepted(completion[1]);
+          } else {
+            if (acceptedFds == null) acceptedFds = new ListQueue<int>();
+            acceptedFds.add(completion[1]);
+            available++;
+            var handler = eventHandlers[READ_EVENT];
+            if (handler != null) handler();
+          }
+          // The tokens are returned by accept.
+          return;
+        case WRITE_COMPLETION:
+          queuedWrites--;
+          if (!isClosing && !isClosed) {
+            writeAvailable = true;
+            issueWriteEvent(delayed: false);
+          } else if (queuedWrites == 0 && closeWritesTimer != null) {
+            sendClose();
+          }
+          // Write completions do not take tokens.
+          return;
+        case WRITE_ERROR_COMPLETION:
+          // The other queued writes were dropped, write directly from now
+          // on.
+          queuedWrites = 0;
+          queueWrites = false;
+          if (!isClosing && !isClosed) {
+            reportError(new OSError(completion[2], completion[1]),
+                        "Write failed");
+          } else if (closeWritesTimer != null) {
+            sendClose();
+          }
+          return;
+        case READ_ERROR_COMPLETION:
+          if (!isClosing && !isClosed) {
+            reportError(new OSError(completion[2], completion[1]),
+                        "Read failed");
+          }
+          break;
+      }
+    }
+    tokens++;
+    returnTokens(NORMAL_TOKEN_BATCH_SIZE);
+  }
+
+  // Closes a connection accepted by the eventhandler that is not taken.
+  static void closeAccepted(int fd) {
+    var socket = new _NativeSocket.normal();
+    socket.nativeSetSocketId(fd);
+    setupResourceInfo(socket);
+    socket.close();
+  }
+
   void returnTokens(int tokenBatchSize) {
     if (!isClosing && !isClosed) {
       assert(eventPort != null);
@@ -882,14 +1148,36 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
   }
 
-  Future close() {
+  // Closes the socket. The eventhandler drops the writes still queued when
+  // it closes the socket, so unless [destroy] is set, the data written
+  // before is first given some time to be sent, like the data written to
+  // the socket directly is sent after it is closed.
+  Future close({bool destroy: false}) {
     if (!isClosing && !isClosed) {
-      sendToEventHandler(1 << CLOSE_COMMAND);
+      if (queuedWrites > 0 && !destroy) {
+        closeWritesTimer = new Timer(_CLOSE_WRITES_TIMEOUT, sendClose);
+      } else {
+        sendToEventHandler(1 << CLOSE_COMMAND);
+      }
       isClosing = true;
+      if (acceptedFds != null) {
+        while (acceptedFds.isNotEmpty) {
+          closeAccepted(acceptedFds.removeFirst());
+        }
+      }
+    } else if (destroy && closeWritesTimer != null) {
+      sendClose();
     }
     return closeCompleter.future;
   }
 
+  // Sends the close command that waited for the queued writes.
+  void sendClose() {
+    sendToEventHandler(1 << CLOSE_COMMAND);
+    closeWritesTimer.cancel();
+    closeWritesTimer = null;
+  }
+
   void shutdown(SocketDirection direction) {
     if (!isClosing && !isClosed) {
       switch (direction) {
@@ -931,8 +1219,10 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   }
 
   void sendToEventHandler(int data) {
-    int fullData = (typeFlags & TYPE_TYPE_MASK) | data;
-    assert(!isClosing);
+    // The TCP flag lets the eventhandler read, write and accept for the
+    // socket itself, see queueWrite.
+    int fullData = (typeFlags & (TYPE_TYPE_MASK | TYPE_TCP_SOCKET)) | data;
+    assert(!isClosing || closeWritesTimer != null);
     connectToEventHandler();
     _EventHandler._sendData(this, eventPort.sendPort, fullData);
   }
@@ -947,11 +1237,34 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
                         _SocketResourceInfo.getOpenSockets);
       registerExtension('ext.dart.io.getSocketByID',
                         _SocketResourceInfo.getSocketInfoMapByID);
+      registerExtension('ext.dart.io.getEventHandlerShards',
+                        getEventHandlerShards);
 
       connectedResourceHandler = true;
     }
   }
 
+  static Future<ServiceExtensionResponse> getEventHandlerShards(
+      function, params) {
+    assert(function == 'ext.dart.io.getEventHandlerShards');
+    var statistics = _EventHandler._shardStatistics();
+    var shards = [];
+    if (statistics != null) {
+      for (int i = 0; i < statistics.length; i += 3) {
+        shards.add({
+          'type': '_eventHandlerShard',
+          'index': i ~/ 3,
+          'descriptors': statistics[i],
+          'events': statistics[i + 1],
+          'messages': statistics[i + 2]
+        });
+      }
+    }
+    var data = {'type': '_eventhandlershards', 'data': shards};
+    return new Future.value(
+        new ServiceExtensionResponse.result(JSON.encode(data)));
+  }
+
   void disconnectFromEventHandler() {
     assert(eventPort != null);
     eventPort.close();
@@ -1063,10 +1376,15 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
 
   void nativeSetSocketId(int id) native "Socket_SetSocketId";
   nativeAvailable() native "Socket_Available";
-  nativeRead(int len) native "Socket_Read";
+  nativeReadInto(Uint8List buffer, int offset, int len)
+      native "Socket_ReadInto";
   nativeRecvFrom() native "Socket_RecvFrom";
   nativeWrite(List<int> buffer, int offset, int bytes)
       native "Socket_WriteList";
+  nativeWriteV(List buffers, List<int> starts, List<int> ends)
+      native "Socket_WriteV";
+  nativeSendFile(_RandomAccessFileOps file, int position, int bytes)
+      native "Socket_SendFile";
   nativeSendTo(List<int> buffer, int offset, int bytes,
                List<int> address, int port)
       native "Socket_SendTo";
@@ -1411,29 +1729,49 @@ patch class Socket {
 class _SocketStreamConsumer extends StreamConsumer<List<int>> {
   StreamSubscription subscription;
   final _Socket socket;
-  int offset;
-  List<int> buffer;
+  // The data not written yet, the first buffer from [offset]. Data added in
+  // the same turn of the event loop is written with one gather write.
+  final List<List<int>> buffers = <List<int>>[];
+  int offset = 0;
   bool paused = false;
+  bool writeScheduled = false;
+  bool doneWhenWritten = false;
   Completer streamCompleter;
 
+  // Files streamed with File.openRead are sent with sendfile from [file]
+  // instead of being read through the stream. Each chunk is first read into
+  // the page cache on the IO service so that sendfile does not block the
+  // isolate on the disk; the next chunk is read while the current one is
+  // sent.
+  static const int SEND_FILE_CHUNK_SIZE = 1024 * 1024;
+  bool sendingFile = false;
+  RandomAccessFile file;
+  int filePosition;
+  int fileEnd;
+  int prefetchedEnd;
+  bool prefetching = false;
+  bool prefetchedAll = false;
+  bool waitingForPrefetch = false;
+
   _SocketStreamConsumer(this.socket);
 
   Future<Socket> addStream(Stream<List<int>> stream) {
     socket._ensureRawSocketSubscription();
     streamCompleter = new Completer<Socket>();
-    if (socket._raw != null) {
+    if (socket._raw != null && canSendFile(stream)) {
+      sendFileStream(stream);
+    } else if (socket._raw != null) {
       subscription = stream.listen(
           (data) {
-            assert(!paused);
-            assert(buffer == null);
-            buffer = data;
-            offset = 0;
-            try {
-              write();
-            } catch (e) {
-              socket.destroy();
-              stop();
-              done(e);
+            buffers.add(data);
+            if (buffers.length >= _NativeSocket.MAX_WRITE_BUFFERS &&
+                !paused) {
+              paused = true;
+              subscription.pause();
+            }
+            if (!writeScheduled) {
+              writeScheduled = true;
+              scheduleMicrotask(scheduledWrite);
             }
           },
           onError: (error, [stackTrace]) {
@@ -1441,7 +1779,11 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
             done(error, stackTrace);
           },
           onDone: () {
-            done();
+            if (buffers.isEmpty) {
+              done();
+            } else {
+              doneWhenWritten = true;
+            }
           },
           cancelOnError: true);
     }
@@ -1453,27 +1795,173 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
     return new Future.value(socket);
   }
 
+  // The file must not have been listened to already. Secure sockets
+  // encrypt the data in Dart and Windows sockets have no sendfile.
+  bool canSendFile(Stream stream) {
+    return stream is _FileStream &&
+        stream._path != null &&
+        stream._controller == null &&
+        socket._raw is _RawSocket &&
+        !Platform.isWindows;
+  }
+
+  void sendFileStream(_FileStream stream) {
+    sendingFile = true;
+    filePosition = stream._position;
+    fileEnd = stream._end;
+    prefetchedEnd = filePosition;
+    prefetching = false;
+    prefetchedAll = false;
+    waitingForPrefetch = false;
+    new File(stream._path).open().then((openedFile) {
+      if (!sendingFile) {
+        openedFile.close();
+        return;
+      }
+      file = openedFile;
+      if (filePosition < 0) {
+        throw new RangeError("Bad start position: $filePosition");
+      }
+      if (fileEnd != null && fileEnd < filePosition) {
+        throw new RangeError("Bad end position: $fileEnd");
+      }
+      writeFile();
+    }).catchError((error, stackTrace) {
+      socket.destroy();
+      stop();
+      done(error, stackTrace);
+    });
+  }
+
+  void writeFile() {
+    if (filePosition == prefetchedEnd) {
+      if (!prefetchedAll) {
+        // Continued when the next chunk has been read.
+        waitingForPrefetch = true;
+        prefetch();
+        return;
+      }
+      // At the end of the file.
+      var openedFile = file;
+      sendingFile = false;
+      file = null;
+      openedFile.close().then((_) => done(), onError: done);
+      return;
+    }
+    int sent;
+    try {
+      sent = socket._sendFile(file, filePosition, prefetchedEnd - filePosition);
+    } catch (e, s) {
+      socket.destroy();
+      stop();
+      done(e, s);
+      return;
+    }
+    if (sent == 0) {
+      // The file was truncated after it was read.
+      prefetchedEnd = filePosition;
+      prefetchedAll = true;
+    } else if (sent != null) {
+      filePosition += sent;
+      prefetch();
+    }
+    socket._enableWriteEvent();
+  }
+
+  void prefetch() {
+    if (prefetching || prefetchedAll) return;
+    int bytes = SEND_FILE_CHUNK_SIZE;
+    if (fileEnd != null) bytes = min(bytes, fileEnd - prefetchedEnd);
+    if (bytes == 0) {
+      prefetchedAll = true;
+      if (waitingForPrefetch) {
+        waitingForPrefetch = false;
+        writeFile();
+      }
+      return;
+    }
+    prefetching = true;
+    var prefetchFile = file;
+    prefetchFile._prefetch(prefetchedEnd, bytes).then((read) {
+      if (!identical(file, prefetchFile)) {
+        // The send was stopped while the chunk was read.
+        prefetchFile.close();
+        return;
+      }
+      prefetching = false;
+      prefetchedEnd += read;
+      if (read < bytes) prefetchedAll = true;
+      if (waitingForPrefetch) {
+        waitingForPrefetch = false;
+        writeFile();
+      }
+    }, onError: (error, stackTrace) {
+      if (!identical(file, prefetchFile)) {
+        prefetchFile.close();
+        return;
+      }
+      prefetching = false;
+      socket.destroy();
+      stop();
+      done(error, stackTrace);
+    });
+  }
+
+  void closeFile() {
+    sendingFile = false;
+    if (file != null) {
+      // A pending prefetch closes the file when it completes.
+      if (!prefetching) file.close();
+      prefetching = false;
+      file = null;
+    }
+  }
+
+  void scheduledWrite() {
+    writeScheduled = false;
+    try {
+      write();
+    } catch (e) {
+      socket.destroy();
+      stop();
+      done(e);
+    }
+  }
+
   void write() {
-    if (subscription == null) return;
-    assert(buffer != null);
+    if (file != null) {
+      writeFile();
+      return;
+    }
+    if (subscription == null || buffers.isEmpty) return;
     // Write as much as possible.
-    offset += socket._write(buffer, offset, buffer.length - offset);
-    if (offset < buffer.length) {
+    int written = socket._writeList(buffers, offset);
+    int count = 0;
+    while (count < buffers.length &&
+           written >= buffers[count].length - offset) {
+      written -= buffers[count].length - offset;
+      offset = 0;
+      count++;
+    }
+    buffers.removeRange(0, count);
+    offset += written;
+    if (buffers.isNotEmpty) {
       if (!paused) {
         paused = true;
         subscription.pause();
       }
       socket._enableWriteEvent();
-    } else {
-      buffer = null;
-      if (paused) {
-        paused = false;
-        subscription.resume();
-      }
+    } else if (doneWhenWritten) {
+      doneWhenWritten = false;
+      done();
+    } else if (paused) {
+      paused = false;
+      subscription.resume();
     }
   }
 
   void done([error, stackTrace]) {
+    if (sendingFile) closeFile();
     if (streamCompleter != null) {
       if (error != null) {
         streamCompleter.completeError(error, stackTrace);
@@ -1485,10 +1973,17 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
   }
 
   void stop() {
+    if (sendingFile) {
+      closeFile();
+      socket._disableWriteEvent();
+    }
     if (subscription == null) return;
     subscription.cancel();
     subscription = null;
+    buffers.clear();
+    offset = 0;
     paused = false;
+    doneWhenWritten = false;
     socket._disableWriteEvent();
   }
 }
@@ -1605,7 +2100,7 @@ class _Socket extends Stream<List<int>> implements Socket {
     _detachReady = new Completer();
     _sink.close();
     return _detachReady.future.then((_) {
-      assert(_consumer.buffer == null);
+      assert(_consumer.buffers.isEmpty);
       var raw = _raw;
       _raw = null;
       return [raw, _subscription];
@@ -1628,7 +2123,12 @@ class _Socket extends Stream<List<int>> implements Socket {
     var tmp = _raw;
     _raw = null;
     _closed = true;
-    tmp.close();
+    if (tmp is _RawSocket) {
+      // Does not wait for the writes queued with the eventhandler.
+      tmp._socket.close(destroy: true);
+    } else {
+      tmp.close();
+    }
   }
 
   void _onSubscriptionStateChange() {
@@ -1685,8 +2185,28 @@ class _Socket extends Stream<List<int>> implements Socket {
     _consumer.done(error, stackTrace);
   }
 
-  int _write(List<int> data, int offset, int length) =>
-      _raw.write(data, offset, length);
+  int _writeList(List<List<int>> buffers, int offset) {
+    if (_raw is _RawSocket) {
+      _RawSocket raw = _raw;
+      return raw._socket.writeList(buffers, offset);
+    }
+    // Other raw sockets, like secure sockets, write one buffer at a time.
+    int written = 0;
+    for (var buffer in buffers) {
+      int length = buffer.length - offset;
+      int result = _raw.write(buffer, offset, length);
+      written += result;
+      if (result < length) break;
+      offset = 0;
+    }
+    return written;
+  }
+
+  int _sendFile(_RandomAccessFile file, int position, int bytes) {
+    _RawSocket raw = _raw;
+    if (raw == null) throw new SocketException.closed();
+    return raw._socket.sendFile(file, position, bytes);
+  }
 
   void _enableWriteEvent() {
     _raw.writeEventsEnabled = true;
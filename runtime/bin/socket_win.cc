@@ -97,6 +97,38 @@ intptr_t Socket::Write(intptr_t fd, const void* buffer, intptr_t num_bytes) {
 }
 
 
+intptr_t Socket::WriteV(intptr_t fd,
+                        const SocketIOVector* vectors,
+                        intptr_t count) {
+  // There is no gather write on the overlapped socket handles, write the
+  // buffers one at a time until one is not completely written.
+  Handle* handle = reinterpret_cast<Handle*>(fd);
+  intptr_t total_written = 0;
+  for (intptr_t i = 0; i < count; i++) {
+    intptr_t written = handle->Write(vectors[i].buffer, vectors[i].num_bytes);
+    if (written < 0) {
+      return (total_written > 0) ? total_written : written;
+    }
+    total_written += written;
+    if (written < vectors[i].num_bytes) {
+      break;
+    }
+  }
+  return total_written;
+}
+
+
+int64_t Socket::SendFile(intptr_t fd,
+                         intptr_t file_fd,
+                         int64_t offset,
+                         int64_t num_bytes) {
+  // TransmitFile needs an overlapped operation on the socket handle, which
+  // the Dart side does not use on Windows.
+  SetLastError(ERROR_NOT_SUPPORTED);
+  return -1;
+}
+
+
 intptr_t Socket::SendTo(
     intptr_t fd, const void* buffer, intptr_t num_bytes, const RawAddr& addr) {
   Handle* handle = reinterpret_cast<Handle*>(fd);
@@ -475,7 +507,10 @@ AddressList<InterfaceSocketAddress>* Socket::ListInterfaces(
 
 intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
                                         intptr_t backlog,
-                                        bool v6_only) {
+                                        bool v6_only,
+                                        bool reuse_port) {
+  // SO_REUSEPORT is only used on Linux and Android.
+  ASSERT(!reuse_port);
   SOCKET s = socket(addr.ss.ss_family, SOCK_STREAM, IPPROTO_TCP);
   if (s == INVALID_SOCKET) {
     return -1;
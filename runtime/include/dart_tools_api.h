@@ -1067,4 +1067,27 @@ DART_EXPORT void Dart_SetEmbedderTimelineCallbacks(
     Dart_EmbedderTimelineStartRecording start_recording,
     Dart_EmbedderTimelineStopRecording stop_recording);
 
+/*
+ * ============
+ * CPU Profiler
+ * ============
+ */
+
+/**
+ * Get the CPU profile of the current isolate in the pprof protocol buffer
+ * format (https://github.com/google/pprof). Frames of native code are
+ * symbolized when the VM samples native stacks (--profile_vm).
+ *
+ * The profile is passed to the consumer in chunks as it is encoded.
+ *
+ * Requires there to be a current isolate.
+ *
+ * \param consumer A Dart_StreamConsumer.
+ * \param user_data User data passed into consumer.
+ *
+ * \return True if a stream was output.
+ */
+DART_EXPORT bool Dart_GetCpuProfilePprof(Dart_StreamConsumer consumer,
+                                         void* user_data);
+
 #endif  // INCLUDE_DART_TOOLS_API_H_
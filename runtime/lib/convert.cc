@@ -0,0 +1,41 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/bootstrap_natives.h"
+
+#include "vm/json_decoder.h"
+#include "vm/json_encoder.h"
+#include "vm/native_entry.h"
+#include "vm/object.h"
+
+namespace dart {
+
+DEFINE_NATIVE_ENTRY(JsonDecoder_parse, 2) {
+  const Instance& input = Instance::CheckedHandle(zone,
+                                                  arguments->NativeArgAt(0));
+  const Instance& fallback = Instance::CheckedHandle(zone,
+                                                     arguments->NativeArgAt(1));
+  const Object& result = Object::Handle(zone,
+                                        JSONDecoder::Decode(thread, input));
+  if (result.raw() == Object::sentinel().raw()) {
+    // Not decodable natively, let the Dart implementation decode the input
+    // or report the error.
+    return fallback.raw();
+  }
+  return result.raw();
+}
+
+
+DEFINE_NATIVE_ENTRY(JsonEncoder_encode, 4) {
+  const Instance& object = Instance::CheckedHandle(zone,
+                                                   arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(GrowableObjectArray, seen,
+                               arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Instance, encode_other,
+                               arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Bool, utf8, arguments->NativeArgAt(3));
+  return JSONEncoder::Encode(thread, object, seen, encode_other, utf8.value());
+}
+
+}  // namespace dart
@@ -3,10 +3,15 @@
 // BSD-style license that can be found in the LICENSE file.
 
 import "dart:_internal" show POWERS_OF_TEN;
+import "dart:typed_data" show Uint8List;
 
 // JSON conversion.
 
 patch _parseJson(String json, reviver(var key, var value)) {
+  if (reviver == null) {
+    var result = _parseJsonNative(json, _jsonNativeFallback);
+    if (!identical(result, _jsonNativeFallback)) return result;
+  }
   _BuildJsonListener listener;
   if (reviver == null) {
     listener = new _BuildJsonListener();
@@ -41,6 +46,62 @@ patch class Utf8Decoder {
   }
 }
 
+patch class JsonEncoder {
+  // Allow intercepting of JSON encoding without indentation.
+  /* patch */
+  static String _convertIntercepted(
+      Object object, toEncodable(object), String indent) {
+    if (indent != null) return null;  // Pretty printing is done in Dart.
+    return new _JsonNativeEncoder(toEncodable).encode(object, false);
+  }
+}
+
+patch class JsonUtf8Encoder {
+  // Allow intercepting of JSON encoding without indentation.
+  /* patch */
+  static List<int> _convertIntercepted(
+      Object object, toEncodable(object), List<int> indent) {
+    if (indent != null) return null;  // Pretty printing is done in Dart.
+    return new _JsonNativeEncoder(toEncodable).encode(object, true);
+  }
+}
+
+/**
+ * Encodes JSON values natively.
+ *
+ * Objects that are not encoded by the native encoder, e.g. objects which are
+ * passed to [_toEncodable], are written by a [_JsonStringStringifier] sharing
+ * the list of objects being traversed with the native encoder, so errors are
+ * reported as by the Dart implementation.
+ */
+class _JsonNativeEncoder {
+  final StringBuffer _buffer;
+  final _JsonStringStringifier _stringifier;
+
+  factory _JsonNativeEncoder(toEncodable(object)) {
+    StringBuffer buffer = new StringBuffer();
+    return new _JsonNativeEncoder._(
+        buffer, new _JsonStringStringifier(buffer, toEncodable));
+  }
+
+  _JsonNativeEncoder._(this._buffer, this._stringifier);
+
+  /** Returns a [String], or a [Uint8List] holding UTF-8 if [utf8] is true. */
+  encode(Object object, bool utf8) =>
+      _encode(object, _stringifier._seen, _encodeOther, utf8);
+
+  // Called by the native encoder.
+  String _encodeOther(object) {
+    _stringifier.writeObject(object);
+    String result = _buffer.toString();
+    _buffer.clear();
+    return result;
+  }
+
+  static _encode(object, List seen, String encodeOther(object), bool utf8)
+      native "JsonEncoder_encode";
+}
+
 class _JsonUtf8Decoder extends Converter<List<int>, Object> {
   final _Reviver _reviver;
   final bool _allowMalformed;
@@ -48,6 +109,10 @@ class _JsonUtf8Decoder extends Converter<List<int>, Object> {
   _JsonUtf8Decoder(this._reviver, this._allowMalformed);
 
   Object convert(List<int> input) {
+    if (_reviver == null && input is Uint8List) {
+      var result = _parseJsonNative(input, _jsonNativeFallback);
+      if (!identical(result, _jsonNativeFallback)) return result;
+    }
     var parser = _JsonUtf8DecoderSink._createParser(_reviver, _allowMalformed);
     parser.chunk = input;
     parser.chunkEnd = input.length;
@@ -62,6 +127,22 @@ class _JsonUtf8Decoder extends Converter<List<int>, Object> {
 
 //// Implementation ///////////////////////////////////////////////////////////
 
+/**
+ * Decodes a one-byte string or a [Uint8List] of UTF-8 in the VM.
+ *
+ * Returns [fallback] if the input is not handled by the native decoder,
+ * e.g. because it is malformed or contains integers that do not fit in 64
+ * bits. The input must then be decoded by the Dart implementation, which
+ * also produces the error messages.
+ */
+_parseJsonNative(input, fallback) native "JsonDecoder_parse";
+
+class _JsonNativeFallback {
+  const _JsonNativeFallback();
+}
+
+const _jsonNativeFallback = const _JsonNativeFallback();
+
 // Simple API for JSON parsing.
 
 /**
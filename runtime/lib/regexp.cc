@@ -87,6 +87,9 @@ DEFINE_NATIVE_ENTRY(RegExp_ExecuteMatch, 3) {
   ASSERT(!regexp.IsNull());
   GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
   GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
+  // Cons strings are flattened by _RegExp._match, as the matchers are
+  // specialized on the string representation.
+  ASSERT(!subject.IsConsString());
 
   if (FLAG_interpret_irregexp || FLAG_precompiled_runtime) {
     return BytecodeRegExpMacroAssembler::Interpret(regexp, subject, start_index,
@@ -140,7 +140,7 @@ class _RegExp implements RegExp {
 
   Match firstMatch(String str) {
     if (str is! String) throw new ArgumentError(str);
-    List match = _ExecuteMatch(str, 0);
+    List match = _match(str, 0);
     if (match == null) {
       return null;
     }
@@ -164,7 +164,7 @@ class _RegExp implements RegExp {
     }
     // Inefficient check that searches for a later match too.
     // Change this when possible.
-    List<int> list = _ExecuteMatch(string, start);
+    List<int> list = _match(string, start);
     if (list == null) return null;
     if (list[0] != start) return null;
     return new _RegExpMatch(this, string, list);
@@ -172,13 +172,13 @@ class _RegExp implements RegExp {
 
   bool hasMatch(String str) {
     if (str is! String) throw new ArgumentError(str);
-    List match = _ExecuteMatch(str, 0);
+    List match = _match(str, 0);
     return (match == null) ? false : true;
   }
 
   String stringMatch(String str) {
     if (str is! String) throw new ArgumentError(str);
-    List match = _ExecuteMatch(str, 0);
+    List match = _match(str, 0);
     if (match == null) {
       return null;
     }
@@ -238,6 +238,16 @@ class _RegExp implements RegExp {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   ];
 
+  // The matchers are specialized on the string representation, so cons
+  // strings are flattened before matching.
+  List _match(String str, int start) {
+    if (str is _ConsString) {
+      _ConsString cons = str;
+      return _ExecuteMatch(cons._flatten(), start);
+    }
+    return _ExecuteMatch(str, start);
+  }
+
   List _ExecuteMatch(String str, int start_index)
       native "RegExp_ExecuteMatch";
 }
@@ -265,7 +275,7 @@ class _AllMatchesIterator implements Iterator<Match> {
   bool moveNext() {
     if (_re == null) return false;  // Cleared after a failed match.
     if (_nextIndex <= _str.length) {
-      var match = _re._ExecuteMatch(_str, _nextIndex);
+      var match = _re._match(_str, _nextIndex);
       if (match != null) {
         _current = new _RegExpMatch(_re, _str, match);
         _nextIndex = _current.end;
@@ -499,7 +499,8 @@ DEFINE_NATIVE_ENTRY(TwoByteString_allocateFromTwoByteList, 3) {
 DEFINE_NATIVE_ENTRY(String_getHashCode, 1) {
   const String& receiver = String::CheckedHandle(zone,
                                                  arguments->NativeArgAt(0));
-  intptr_t hash_val = receiver.Hash();
+  intptr_t hash_val = receiver.IsConsString() ? ConsString::Hash(receiver)
+                                              : receiver.Hash();
   ASSERT(hash_val > 0);
   ASSERT(Smi::IsValid(hash_val));
   return Smi::New(hash_val);
@@ -517,6 +518,11 @@ static uint16_t StringValueAt(const String& str, const Integer& index) {
   if (index.IsSmi()) {
     const intptr_t index_value = Smi::Cast(index).Value();
     if ((0 <= index_value) && (index_value < str.Length())) {
+      if (str.IsConsString()) {
+        // Flatten on the first indexed access so that the following ones
+        // do not walk the tree.
+        return String::Handle(ConsString::Flatten(str)).CharAt(index_value);
+      }
       return str.CharAt(index_value);
     }
   }
@@ -546,11 +552,28 @@ DEFINE_NATIVE_ENTRY(String_codeUnitAt, 2) {
 }
 
 
+// Concatenates 'first' and 'second'. Long results are represented as cons
+// strings which are only copied when first indexed or hashed, so that
+// building a string by repeated concatenation takes linear time.
+static RawString* LazyConcat(const String& first, const String& second) {
+  if ((first.Length() + second.Length()) < ConsString::kMinLength) {
+    return String::Concat(first, second);
+  }
+  if (second.Length() == 0) {
+    return first.raw();
+  }
+  if (first.Length() == 0) {
+    return second.raw();
+  }
+  return ConsString::New(first, second);
+}
+
+
 DEFINE_NATIVE_ENTRY(String_concat, 2) {
   const String& receiver = String::CheckedHandle(zone,
                                                  arguments->NativeArgAt(0));
   GET_NON_NULL_NATIVE_ARGUMENT(String, b, arguments->NativeArgAt(1));
-  return String::Concat(receiver, b);
+  return LazyConcat(receiver, b);
 }
 
 
@@ -602,10 +625,34 @@ DEFINE_NATIVE_ENTRY(String_concatRange, 3) {
     ASSERT(elem.IsString());
   }
 #endif
+  if ((end_ix - start_ix) >= 2) {
+    // Appending to a long string, as done when interpolating into an
+    // accumulator in a loop, keeps the long string as the first half of a
+    // cons string instead of copying it.
+    String& first = String::Handle(zone);
+    first ^= strings.At(start_ix);
+    if (first.Length() >= ConsString::kMinLength) {
+      String& rest = String::Handle(zone);
+      if ((end_ix - start_ix) == 2) {
+        rest ^= strings.At(start_ix + 1);
+      } else {
+        rest = String::ConcatAllRange(strings, start_ix + 1, end_ix,
+                                      Heap::kNew);
+      }
+      return LazyConcat(first, rest);
+    }
+  }
   return String::ConcatAllRange(strings, start_ix, end_ix, Heap::kNew);
 }
 
 
+DEFINE_NATIVE_ENTRY(ConsString_flatten, 1) {
+  const String& receiver = String::CheckedHandle(zone,
+                                                 arguments->NativeArgAt(0));
+  return ConsString::Flatten(receiver);
+}
+
+
 DEFINE_NATIVE_ENTRY(StringBuffer_createStringFromUint16Array, 3) {
   GET_NON_NULL_NATIVE_ARGUMENT(TypedData, codeUnits, arguments->NativeArgAt(0));
   GET_NON_NULL_NATIVE_ARGUMENT(Smi, length, arguments->NativeArgAt(1));
@@ -1288,6 +1288,129 @@ class _ExternalTwoByteString extends _StringBase implements String {
 }
 
 
+// The lazy concatenation of two strings created by '+' and interpolation
+// when the result is long. The characters are copied into a flat string on
+// the first operation that needs them, and the operations are forwarded to
+// that flat string. Concatenating to a cons string does not flatten it.
+class _ConsString extends _StringBase implements String {
+  factory _ConsString._uninstantiable() {
+    throw new UnsupportedError(
+        "_ConsString can only be allocated by the VM");
+  }
+
+  String _flatten() native "ConsString_flatten";
+
+  int get hashCode native "String_getHashCode";
+
+  // Indexing flattens the string, after which the flat string is indexed
+  // directly instead of looking up every character in the tree.
+  int codeUnitAt(int index) => _flatten().codeUnitAt(index);
+
+  String operator [](int index) => _flatten()[index];
+
+  bool _isWhitespace(int codeUnit) {
+    return _StringBase._isTwoByteWhitespace(codeUnit);
+  }
+
+  bool operator ==(Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+    return _flatten() == other;
+  }
+
+  int compareTo(String other) => _flatten().compareTo(other);
+
+  bool endsWith(String other) => _flatten().endsWith(other);
+
+  bool startsWith(Pattern pattern, [int index = 0]) {
+    return _flatten().startsWith(pattern, index);
+  }
+
+  int indexOf(Pattern pattern, [int start = 0]) {
+    return _flatten().indexOf(pattern, start);
+  }
+
+  int lastIndexOf(Pattern pattern, [int start = null]) {
+    return _flatten().lastIndexOf(pattern, start);
+  }
+
+  bool contains(Pattern pattern, [int startIndex = 0]) {
+    return _flatten().contains(pattern, startIndex);
+  }
+
+  String substring(int startIndex, [int endIndex]) {
+    return _flatten().substring(startIndex, endIndex);
+  }
+
+  String _substringUnchecked(int startIndex, int endIndex) {
+    _StringBase flat = _flatten();
+    return flat._substringUnchecked(startIndex, endIndex);
+  }
+
+  String trim() => _flatten().trim();
+
+  String trimLeft() => _flatten().trimLeft();
+
+  String trimRight() => _flatten().trimRight();
+
+  String operator *(int times) => _flatten() * times;
+
+  String padLeft(int width, [String padding = ' ']) {
+    return _flatten().padLeft(width, padding);
+  }
+
+  String padRight(int width, [String padding = ' ']) {
+    return _flatten().padRight(width, padding);
+  }
+
+  String replaceFirst(Pattern pattern,
+                      String replacement,
+                      [int startIndex = 0]) {
+    return _flatten().replaceFirst(pattern, replacement, startIndex);
+  }
+
+  String replaceFirstMapped(Pattern pattern, String replace(Match match),
+                            [int startIndex = 0]) {
+    return _flatten().replaceFirstMapped(pattern, replace, startIndex);
+  }
+
+  String replaceRange(int start, int end, String replacement) {
+    return _flatten().replaceRange(start, end, replacement);
+  }
+
+  String replaceAll(Pattern pattern, String replacement) {
+    return _flatten().replaceAll(pattern, replacement);
+  }
+
+  String replaceAllMapped(Pattern pattern, String replace(Match match)) {
+    return _flatten().replaceAllMapped(pattern, replace);
+  }
+
+  String splitMapJoin(Pattern pattern,
+                      {String onMatch(Match match),
+                       String onNonMatch(String nonMatch)}) {
+    return _flatten().splitMapJoin(pattern,
+                                   onMatch: onMatch,
+                                   onNonMatch: onNonMatch);
+  }
+
+  Iterable<Match> allMatches(String string, [int start = 0]) {
+    return _flatten().allMatches(string, start);
+  }
+
+  Match matchAsPrefix(String string, [int start = 0]) {
+    return _flatten().matchAsPrefix(string, start);
+  }
+
+  List<String> split(Pattern pattern) => _flatten().split(pattern);
+
+  String toUpperCase() => _flatten().toUpperCase();
+
+  String toLowerCase() => _flatten().toLowerCase();
+}
+
+
 class _StringMatch implements Match {
   const _StringMatch(int this.start,
                      String this.input,
@@ -840,6 +840,7 @@ var tests = [
     expect(result['_usageCounter'], isPositive);
     expect(result['_optimizedCallSiteCount'], isZero);
     expect(result['_deoptimizations'], isZero);
+    expect(result['_deoptReasons'], isEmpty);
   },
 
   // invalid function.
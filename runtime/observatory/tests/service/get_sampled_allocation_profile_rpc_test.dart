@@ -0,0 +1,87 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+// VMOptions=--error_on_bad_type --error_on_bad_override --allocation_sample_interval=1024
+
+import 'package:observatory/service_io.dart';
+import 'package:unittest/unittest.dart';
+
+import 'test_helper.dart';
+
+class Sampled {
+  var a, b, c, d;
+}
+
+var retained;
+
+allocateSampled() {
+  retained = new List.generate(10000, (_) => new Sampled());
+}
+
+Map findSampledMember(Map result) {
+  for (var member in result['members']) {
+    if (member['class']['name'] == 'Sampled') {
+      return member;
+    }
+  }
+  return null;
+}
+
+var tests = [
+  (Isolate isolate) async {
+    var result = await isolate.invokeRpcNoUpgrade(
+        '_getSampledAllocationProfile', {});
+    expect(result['type'], equals('_AllocationSamples'));
+    expect(result['samplingInterval'], equals(1024));
+    expect(result['sampleCount'], isPositive);
+    var member = findSampledMember(result);
+    expect(member, isNotNull);
+    expect(member['samples'], isPositive);
+    expect(member['bytes'], isPositive);
+    var stack = member['stack'].map((function) => function['name']);
+    expect(stack, contains('allocateSampled'));
+  },
+
+  (Isolate isolate) async {
+    // The samples are live until the objects are collected.
+    var result = await isolate.invokeRpcNoUpgrade(
+        '_getSampledAllocationProfile', {'collectGarbage': 'true'});
+    var member = findSampledMember(result);
+    expect(member['liveSamples'], equals(member['samples']));
+    expect(member['liveBytes'], equals(member['bytes']));
+  },
+
+  (Isolate isolate) async {
+    var result = await isolate.invokeRpcNoUpgrade(
+        '_setAllocationSampleInterval', {'interval': '0'});
+    expect(result['type'], equals('Success'));
+    result = await isolate.invokeRpcNoUpgrade(
+        '_getSampledAllocationProfile', {});
+    expect(result['type'], equals('_AllocationSamples'));
+    expect(result['samplingInterval'], equals(0));
+    expect(result['sampleCount'], equals(0));
+    expect(result['members'], isEmpty);
+
+    result = await isolate.invokeRpcNoUpgrade(
+        '_setAllocationSampleInterval', {'interval': '4096'});
+    expect(result['type'], equals('Success'));
+    result = await isolate.invokeRpcNoUpgrade(
+        '_getSampledAllocationProfile', {});
+    expect(result['samplingInterval'], equals(4096));
+  },
+
+  (Isolate isolate) async {
+    bool caughtException;
+    try {
+      await isolate.invokeRpcNoUpgrade(
+          '_setAllocationSampleInterval', {'interval': 'banana'});
+      expect(false, isTrue, reason:'Unreachable');
+    } on ServerRpcException catch (e) {
+      caughtException = true;
+      expect(e.code, equals(ServerRpcException.kInvalidParams));
+    }
+    expect(caughtException, isTrue);
+  },
+];
+
+main(args) async => runIsolateTests(args, tests, testeeBefore: allocateSampled);
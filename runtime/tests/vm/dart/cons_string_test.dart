@@ -0,0 +1,146 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+// VMOptions=--optimization_counter_threshold=10 --no-background-compilation
+
+// Test that long strings built by concatenation, which the VM represents
+// lazily, behave like the same strings built in one piece. Every operation
+// is tested both as the first one on a new string and after others.
+
+import "package:expect/expect.dart";
+
+const String chunk = "abcdefghijklmnopqrstuvwxyz0123456789";
+const String twoByteChunk = "\u{1F600}é€ xyz";
+
+// Builds a string of 'count' chunks by appending to an accumulator.
+String build(String piece, int count) {
+  var result = "";
+  for (int i = 0; i < count; i++) {
+    result = result + piece;
+  }
+  return result;
+}
+
+// Builds the same string by interpolating into an accumulator.
+String buildInterpolated(String piece, int count) {
+  var result = "";
+  for (int i = 0; i < count; i++) {
+    result = "$result$piece";
+  }
+  return result;
+}
+
+// The same string without concatenations.
+String flat(String piece, int count) {
+  var codeUnits = [];
+  for (int i = 0; i < count; i++) {
+    codeUnits.addAll(piece.codeUnits);
+  }
+  return new String.fromCharCodes(codeUnits);
+}
+
+testEquality(String piece, int count) {
+  var expected = flat(piece, count);
+  Expect.isTrue(build(piece, count) == expected);
+  Expect.isTrue(expected == build(piece, count));
+  Expect.isTrue(build(piece, count) == buildInterpolated(piece, count));
+  Expect.isFalse(build(piece, count) == build(piece, count + 1));
+  Expect.isFalse(build(piece, count) == "${build(piece, count - 1)}!$piece");
+  Expect.equals(0, build(piece, count).compareTo(expected));
+}
+
+testHashCode(String piece, int count) {
+  var expected = flat(piece, count);
+  Expect.equals(expected.hashCode, build(piece, count).hashCode);
+  Expect.equals(expected.hashCode, buildInterpolated(piece, count).hashCode);
+  var str = build(piece, count);
+  str.codeUnitAt(0);
+  Expect.equals(expected.hashCode, str.hashCode);
+  Expect.equals(expected.hashCode, str.hashCode);
+}
+
+testMapKey(String piece, int count) {
+  var map = {};
+  map[build(piece, count)] = 1;
+  map[buildInterpolated(piece, count + 1)] = 2;
+  Expect.equals(2, map.length);
+  Expect.equals(1, map[flat(piece, count)]);
+  Expect.equals(2, map[flat(piece, count + 1)]);
+  Expect.equals(1, map[buildInterpolated(piece, count)]);
+  Expect.isTrue(map.containsKey(build(piece, count + 1)));
+  Expect.isFalse(map.containsKey(build(piece, count + 2)));
+  map[flat(piece, count)] = 3;
+  Expect.equals(2, map.length);
+  Expect.equals(3, map[build(piece, count)]);
+  var set = new Set.from([build(piece, count), flat(piece, count)]);
+  Expect.equals(1, set.length);
+}
+
+testRegExp(String piece, int count) {
+  var str = build(piece, count) + "<end>";
+  Expect.isTrue(new RegExp(r"<end>$").hasMatch(str));
+  Expect.equals(count, piece.allMatches(build(piece, count)).length);
+  var match = new RegExp(r"z(0+)1").firstMatch(build(chunk, count));
+  Expect.equals(25, match.start);
+  Expect.equals("0", match[1]);
+  Expect.equals(count,
+      new RegExp(r"xyz").allMatches(buildInterpolated(piece, count)).length);
+  Expect.equals(flat(piece, count).replaceAll("x", "-"),
+                build(piece, count).replaceAll(new RegExp("x"), "-"));
+}
+
+testCodeUnitAt(String piece, int count) {
+  var expected = flat(piece, count);
+  var str = build(piece, count);
+  Expect.equals(expected.length, str.length);
+  for (int i = 0; i < str.length; i++) {
+    Expect.equals(expected.codeUnitAt(i), str.codeUnitAt(i));
+    Expect.equals(expected[i], str[i]);
+  }
+  Expect.listEquals(expected.codeUnits, build(piece, count).codeUnits);
+  Expect.listEquals(expected.runes.toList(),
+                    buildInterpolated(piece, count).runes.toList());
+  Expect.throws(() => build(piece, count).codeUnitAt(str.length),
+                (e) => e is RangeError);
+  Expect.throws(() => build(piece, count)[-1], (e) => e is RangeError);
+}
+
+testSubstring(String piece, int count) {
+  var expected = flat(piece, count);
+  var length = expected.length;
+  Expect.equals(expected.substring(1), build(piece, count).substring(1));
+  Expect.equals(expected.substring(length ~/ 3, length - 2),
+                build(piece, count).substring(length ~/ 3, length - 2));
+  Expect.equals(piece, build(piece, count).substring(0, piece.length));
+  Expect.equals(piece, buildInterpolated(piece, count)
+                           .substring(length - piece.length));
+  Expect.equals("", build(piece, count).substring(length));
+}
+
+testInterpolation(String piece, int count) {
+  var expected = flat(piece, count);
+  var str = build(piece, count);
+  Expect.equals("<$expected>", "<$str>");
+  Expect.equals("$expected$expected", "$str$str");
+  Expect.equals(expected + expected, str + str);
+  Expect.equals("${expected.length}: $expected", "${str.length}: $str");
+  Expect.equals(expected, build(piece, count).toString());
+  Expect.equals(expected, [build(piece, count)].join());
+  Expect.equals("$expected,$expected", [str, str].join(","));
+}
+
+main() {
+  for (int i = 0; i < 20; i++) {
+    for (var piece in [chunk, twoByteChunk]) {
+      for (int count in [1, 2, 5, 40]) {
+        testEquality(piece, count);
+        testHashCode(piece, count);
+        testMapKey(piece, count);
+        testRegExp(piece, count);
+        testCodeUnitAt(piece, count);
+        testSubstring(piece, count);
+        testInterpolation(piece, count);
+      }
+    }
+  }
+}
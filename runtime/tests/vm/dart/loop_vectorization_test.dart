@@ -0,0 +1,148 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+// VMOptions=--loop-vectorization --optimization_counter_threshold=10 --no-background-compilation
+
+// Test that vectorized loops over typed data compute the same results as
+// their scalar counterparts, including the iterations left for the scalar
+// epilogue and loops which fail bounds checks. Which of these loops are
+// vectorized is checked by loop_vectorization_trace_test.dart.
+
+import "package:expect/expect.dart";
+import 'dart:typed_data';
+
+addFloat32(Float32List a, Float32List b, Float32List c) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = b[i] + c[i];
+  }
+}
+
+halveFloat32(Float32List a, Float32List b) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = b[i] * 0.5;
+  }
+}
+
+// Not vectorized: s is not known to be exactly representable as a float32,
+// so multiplying in single precision could round differently.
+mulFloat32(Float32List a, Float32List b, double s) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = b[i] * s;
+  }
+}
+
+axpyFloat64(Float64List a, Float64List x, Float64List y, double s) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = x[i] * s + y[i] / 2.0 - 1.0;
+  }
+}
+
+copyUint8(Uint8List a, Uint8List b, int end) {
+  for (int i = 0; i < end; i++) {
+    a[i] = b[i];
+  }
+}
+
+fillInt32(Int32List a, int value) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = value;
+  }
+}
+
+fillFloat64(Float64List a, double value) {
+  for (int i = 0; i < a.length; i++) {
+    a[i] = value;
+  }
+}
+
+double roundToFloat32(double value) {
+  var list = new Float32List(1);
+  list[0] = value;
+  return list[0];
+}
+
+testFloat32(int length) {
+  var a = new Float32List(length);
+  var b = new Float32List(length);
+  var c = new Float32List(length);
+  for (int i = 0; i < length; i++) {
+    b[i] = i / 3;
+    c[i] = i * 0.7;
+  }
+  addFloat32(a, b, c);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(roundToFloat32(b[i] + c[i]), a[i]);
+  }
+  halveFloat32(a, b);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(b[i] * 0.5, a[i]);
+  }
+  mulFloat32(a, b, 0.1);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(roundToFloat32(b[i] * 0.1), a[i]);
+  }
+}
+
+testFloat64(int length) {
+  var a = new Float64List(length);
+  var x = new Float64List(length);
+  var y = new Float64List(length);
+  for (int i = 0; i < length; i++) {
+    x[i] = i / 7;
+    y[i] = -i * 1.3;
+  }
+  axpyFloat64(a, x, y, 2.5);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(x[i] * 2.5 + y[i] / 2.0 - 1.0, a[i]);
+  }
+  fillFloat64(a, -0.0);
+  for (int i = 0; i < length; i++) {
+    Expect.isTrue(a[i] == 0.0 && a[i].isNegative);
+  }
+}
+
+testCopy(int length) {
+  var a = new Uint8List(length);
+  var b = new Uint8List(length);
+  for (int i = 0; i < length; i++) {
+    b[i] = i * 31;
+  }
+  copyUint8(a, b, length - 3);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(i < length - 3 ? b[i] : 0, a[i]);
+  }
+}
+
+testFill(int length) {
+  var a = new Int32List(length);
+  fillInt32(a, -42);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(-42, a[i]);
+  }
+}
+
+testRangeError() {
+  var a = new Uint8List(40);
+  var b = new Uint8List(20);
+  for (int i = 0; i < b.length; i++) {
+    b[i] = i + 1;
+  }
+  Expect.throws(() => copyUint8(a, b, 40), (e) => e is RangeError);
+  // Elements before the failing index must have been copied.
+  for (int i = 0; i < 20; i++) {
+    Expect.equals(i + 1, a[i]);
+  }
+  Expect.equals(0, a[20]);
+}
+
+main() {
+  for (int i = 0; i < 20; i++) {
+    for (int length in [0, 1, 3, 4, 5, 17, 64, 67]) {
+      testFloat32(length);
+      testFloat64(length);
+      testCopy(length);
+      testFill(length);
+    }
+  }
+  testRangeError();
+}
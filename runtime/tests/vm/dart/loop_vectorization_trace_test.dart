@@ -0,0 +1,53 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Test that the loops in loop_vectorization_test.dart which are expected to
+// be vectorized are, by running it with --trace-loop-vectorization. Inlining
+// is disabled so that every loop is reported under its own function name.
+
+import "dart:io";
+import "package:expect/expect.dart";
+
+// Function name to number of lanes of its vectorized loop.
+const expectedLoops = const {
+  "addFloat32": 4,
+  "halveFloat32": 4,
+  "axpyFloat64": 2,
+  "copyUint8": 16,
+  "fillInt32": 4,
+  "fillFloat64": 2,
+};
+
+main() {
+  var result = Process.runSync(Platform.executable, [
+    "--loop-vectorization",
+    "--trace-loop-vectorization",
+    "--optimization_counter_threshold=10",
+    "--no-background-compilation",
+    "--no-use-inlining",
+    Platform.script.resolve("loop_vectorization_test.dart").toFilePath()
+  ]);
+  print("=== stdout ===\n ${result.stdout}");
+  print("=== stderr ===\n ${result.stderr}");
+  Expect.equals(0, result.exitCode);
+
+  var vectorized = {};
+  var pattern = new RegExp(r"Vectorizing loop B\d+ in (\S+) \((\d+) lanes\)");
+  for (var match in pattern.allMatches(result.stdout)) {
+    // Fully qualified names end in _<function name>.
+    var name = match[1].substring(match[1].lastIndexOf("_") + 1);
+    vectorized[name] = int.parse(match[2]);
+  }
+
+  // Vector loads and stores are only implemented on x64 and ia32.
+  if (Platform.version.endsWith('_x64"') ||
+      Platform.version.endsWith('_ia32"')) {
+    expectedLoops.forEach((name, lanes) {
+      Expect.equals(lanes, vectorized[name], name);
+    });
+    Expect.isFalse(vectorized.containsKey("mulFloat32"));
+  } else {
+    Expect.isTrue(vectorized.isEmpty);
+  }
+}
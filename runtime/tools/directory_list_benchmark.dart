@@ -0,0 +1,56 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures recursive listing of a directory tree with the sync and async
+// directory APIs:
+//
+// dart directory_list_benchmark.dart [directories] [files per directory]
+// dart directory_list_benchmark.dart --path <existing directory>
+
+import 'dart:async';
+import 'dart:io';
+
+const int DEFAULT_DIRECTORIES = 100;
+const int DEFAULT_FILES = 1000;
+
+void createTree(Directory root, int directories, int files) {
+  for (int i = 0; i < directories; i++) {
+    var dir = new Directory('${root.path}/dir$i')..createSync();
+    for (int j = 0; j < files; j++) {
+      new File('${dir.path}/file$j').createSync();
+    }
+  }
+}
+
+Future measure(String name, Future<int> run()) async {
+  var stopwatch = new Stopwatch()..start();
+  int entries = await run();
+  stopwatch.stop();
+  int micros = stopwatch.elapsedMicroseconds;
+  print('$name(RunTime): ${micros / entries} us.');
+  print('$entries entries in ${micros ~/ 1000} ms');
+}
+
+Future listTree(Directory root) async {
+  await measure('DirectoryListSync',
+                () async => root.listSync(recursive: true).length);
+  await measure('DirectoryList',
+                () => root.list(recursive: true).length);
+}
+
+main(List<String> args) async {
+  if (args.length == 2 && args[0] == '--path') {
+    await listTree(new Directory(args[1]));
+    return;
+  }
+  int directories = args.length > 0 ? int.parse(args[0]) : DEFAULT_DIRECTORIES;
+  int files = args.length > 1 ? int.parse(args[1]) : DEFAULT_FILES;
+  var temp = Directory.systemTemp.createTempSync('dart_directory_list');
+  try {
+    createTree(temp, directories, files);
+    await listTree(temp);
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures random page reads from a file with the async file API, reading
+// each page with setPosition and read, with readAt, and with readBatch:
+//
+// dart file_read_at_benchmark.dart [pages] [reads] [batch size]
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:math';
+import 'dart:typed_data';
+
+const int PAGE_SIZE = 4096;
+const int DEFAULT_PAGES = 16384;
+const int DEFAULT_READS = 50000;
+const int DEFAULT_BATCH_SIZE = 16;
+
+Future seekAndRead(RandomAccessFile file, List<int> pages) async {
+  for (int page in pages) {
+    await file.setPosition(page * PAGE_SIZE);
+    await file.read(PAGE_SIZE);
+  }
+}
+
+Future readAt(RandomAccessFile file, List<int> pages) async {
+  for (int page in pages) {
+    await file.readAt(page * PAGE_SIZE, PAGE_SIZE);
+  }
+}
+
+Future readBatch(RandomAccessFile file, List<int> pages, int batchSize) async {
+  var lengths = new List<int>.filled(batchSize, PAGE_SIZE);
+  for (int i = 0; i < pages.length; i += batchSize) {
+    var positions = pages
+        .sublist(i, min(i + batchSize, pages.length))
+        .map((page) => page * PAGE_SIZE)
+        .toList();
+    await file.readBatch(positions, lengths.sublist(0, positions.length));
+  }
+}
+
+Future measure(String name, int reads, Future run()) async {
+  var stopwatch = new Stopwatch()..start();
+  await run();
+  stopwatch.stop();
+  int micros = stopwatch.elapsedMicroseconds;
+  print('$name(RunTime): ${micros / reads} us.');
+}
+
+main(List<String> args) async {
+  int pageCount = args.length > 0 ? int.parse(args[0]) : DEFAULT_PAGES;
+  int reads = args.length > 1 ? int.parse(args[1]) : DEFAULT_READS;
+  int batchSize = args.length > 2 ? int.parse(args[2]) : DEFAULT_BATCH_SIZE;
+
+  var temp = Directory.systemTemp.createTempSync('dart_file_read_at');
+  try {
+    var path = '${temp.path}/pages';
+    var sink = new File(path).openSync(mode: FileMode.WRITE);
+    var page = new Uint8List(PAGE_SIZE);
+    for (int i = 0; i < pageCount; i++) {
+      page[0] = i & 0xff;
+      sink.writeFromSync(page);
+    }
+    sink.closeSync();
+
+    var random = new Random(0);
+    var pages = new List<int>.generate(reads, (_) => random.nextInt(pageCount));
+    var file = await new File(path).open();
+    await measure('FileSeekAndRead', reads, () => seekAndRead(file, pages));
+    await measure('FileReadAt', reads, () => readAt(file, pages));
+    await measure('FileReadBatch', reads,
+                  () => readBatch(file, pages, batchSize));
+    await file.close();
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures the latency of starting a process and waiting for it to exit,
+// as the Dart heap grows:
+//
+// dart --old_gen_heap_size=8192 process_start_benchmark.dart [runs] [MB...]
+//
+// The heap is grown to each of the given sizes in turn before measuring.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+const int DEFAULT_RUNS = 200;
+const List<int> DEFAULT_HEAP_SIZES = const [0, 256, 1024, 4096];
+const int MB = 1024 * 1024;
+
+// Keeps the memory allocated for the heap alive.
+final List<List<int>> heap = [];
+
+void growHeap(int megabytes) {
+  while (heap.length < megabytes) {
+    // Touch every page, so that it is mapped in the process.
+    var chunk = new Uint8List(MB);
+    for (int i = 0; i < MB; i += 4096) {
+      chunk[i] = 1;
+    }
+    heap.add(chunk);
+  }
+}
+
+Future measure(int megabytes, int runs) async {
+  var executable = Platform.isWindows ? 'cmd.exe' : 'true';
+  var arguments = Platform.isWindows ? ['/C', 'exit'] : [];
+  var stopwatch = new Stopwatch()..start();
+  for (int i = 0; i < runs; i++) {
+    var result = await Process.run(executable, arguments);
+    if (result.exitCode != 0) {
+      throw 'Process exited with ${result.exitCode}';
+    }
+  }
+  stopwatch.stop();
+  print('ProcessStart${megabytes}MB(RunTime): '
+        '${stopwatch.elapsedMicroseconds / runs} us.');
+}
+
+main(List<String> args) async {
+  int runs = args.length > 0 ? int.parse(args[0]) : DEFAULT_RUNS;
+  var heapSizes = args.length > 1
+      ? args.skip(1).map(int.parse).toList()
+      : DEFAULT_HEAP_SIZES;
+  for (int megabytes in heapSizes) {
+    growHeap(megabytes);
+    await measure(megabytes, runs);
+  }
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures the throughput of isolates accepting connections on a shared
+// server socket, and how the connections are spread between them:
+//
+// dart socket_accept_benchmark.dart [isolates] [connections]
+// dart --shared_sockets_reuse_port socket_accept_benchmark.dart ...
+//
+// The second form gives each isolate its own SO_REUSEPORT listening socket.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:isolate';
+
+const int DEFAULT_ISOLATES = 4;
+const int DEFAULT_CONNECTIONS = 20000;
+
+// Number of connections the client keeps in flight.
+const int CONCURRENCY = 64;
+
+final InternetAddress HOST = InternetAddress.LOOPBACK_IP_V4;
+
+// Accepts and closes connections until it gets a message, then replies with
+// the number of connections it accepted.
+acceptor(List args) async {
+  int port = args[0];
+  SendPort reply = args[1];
+  var server = await ServerSocket.bind(HOST, port, shared: true);
+  int accepted = 0;
+  server.listen((socket) {
+    accepted++;
+    socket.destroy();
+  });
+  var control = new ReceivePort();
+  reply.send(control.sendPort);
+  await control.first;
+  await server.close();
+  reply.send(accepted);
+}
+
+Future connectLoop(int port, List<int> remaining) async {
+  while (remaining[0] > 0) {
+    remaining[0]--;
+    var socket = await Socket.connect(HOST, port);
+    // The acceptor closes the connection as soon as it is accepted.
+    await socket.drain();
+    socket.destroy();
+  }
+}
+
+main(List<String> args) async {
+  int isolates = args.length > 0 ? int.parse(args[0]) : DEFAULT_ISOLATES;
+  int connections =
+      args.length > 1 ? int.parse(args[1]) : DEFAULT_CONNECTIONS;
+
+  // Reserve a port the acceptors can all bind. It is closed before any
+  // connection is made, so that it does not get a share of them.
+  var reserved = await ServerSocket.bind(HOST, 0, shared: true);
+  int port = reserved.port;
+  var controls = [];
+  var replies = [];
+  for (int i = 0; i < isolates; i++) {
+    var reply = new ReceivePort();
+    var messages = new StreamIterator(reply);
+    await Isolate.spawn(acceptor, [port, reply.sendPort]);
+    await messages.moveNext();
+    controls.add(messages.current);
+    replies.add(messages);
+  }
+  await reserved.close();
+
+  var stopwatch = new Stopwatch()..start();
+  var remaining = [connections];
+  await Future.wait(
+      new List.generate(CONCURRENCY, (_) => connectLoop(port, remaining)));
+  stopwatch.stop();
+
+  var accepted = [];
+  for (int i = 0; i < isolates; i++) {
+    controls[i].send(null);
+    await replies[i].moveNext();
+    accepted.add(replies[i].current);
+    await replies[i].cancel();
+  }
+
+  int micros = stopwatch.elapsedMicroseconds;
+  print('SocketAccept(RunTime): ${micros / connections} us.');
+  print('$connections connections in ${micros ~/ 1000} ms, '
+        '${(connections * 1000000 / micros).round()} connections/s');
+  print('Accepted per isolate: ${accepted.join(', ')}');
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures reading data over a loopback connection with RawSocket.read, for
+// a range of read lengths:
+//
+// dart socket_read_benchmark.dart [megabytes]
+// dart --verbose_gc socket_read_benchmark.dart [megabytes]
+//
+// Every read allocates a single list holding the bytes read; a second list
+// and a copy are only needed for a short read. The second form shows the
+// scavenges caused by these allocations.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+const int DEFAULT_MEGABYTES = 256;
+const int WRITE_SIZE = 64 * 1024;
+
+final InternetAddress HOST = InternetAddress.LOOPBACK_IP_V4;
+
+// Writes 'total' bytes to every connection and closes it.
+Future<RawServerSocket> startServer(int total) async {
+  var server = await RawServerSocket.bind(HOST, 0);
+  var data = new Uint8List(WRITE_SIZE);
+  server.listen((client) {
+    int written = 0;
+    client.listen((event) {
+      if (event == RawSocketEvent.WRITE) {
+        while (written < total) {
+          int count = total - written;
+          if (count > WRITE_SIZE) count = WRITE_SIZE;
+          int bytes = client.write(data, 0, count);
+          written += bytes;
+          if (bytes < count) {
+            client.writeEventsEnabled = true;
+            return;
+          }
+        }
+        client.shutdown(SocketDirection.SEND);
+      } else if (event == RawSocketEvent.READ_CLOSED) {
+        client.close();
+      }
+    });
+  });
+  return server;
+}
+
+Future measure(int port, int total, int length) async {
+  var completer = new Completer();
+  var stopwatch = new Stopwatch()..start();
+  int received = 0;
+  int reads = 0;
+  var socket = await RawSocket.connect(HOST, port);
+  socket.listen((event) {
+    if (event == RawSocketEvent.READ) {
+      var bytes = socket.read(length);
+      if (bytes != null) {
+        reads++;
+        received += bytes.length;
+      }
+    } else if (event == RawSocketEvent.READ_CLOSED) {
+      socket.close();
+      completer.complete();
+    }
+  });
+  await completer.future;
+  stopwatch.stop();
+  if (received != total) {
+    throw 'Received $received bytes, expected $total';
+  }
+  int micros = stopwatch.elapsedMicroseconds;
+  var name = 'SocketRead${length == null ? 'Available' : length}';
+  print('$name(RunTime): ${micros / reads} us.');
+  print('  $reads reads, ${(total / micros).toStringAsFixed(1)} MB/s');
+}
+
+main(List<String> args) async {
+  int megabytes = args.length > 0 ? int.parse(args[0]) : DEFAULT_MEGABYTES;
+  int total = megabytes * 1024 * 1024;
+  var server = await startServer(total);
+  for (var length in [1024, 16 * 1024, 64 * 1024, null]) {
+    await measure(server.port, total, length);
+  }
+  await server.close();
+}
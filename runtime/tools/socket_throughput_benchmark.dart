@@ -0,0 +1,73 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Compares the throughput of TCP sockets over loopback with the epoll and
+// the io_uring eventhandler on Linux, by running itself with and without
+// --io-uring:
+//
+// dart socket_throughput_benchmark.dart [megabytes] [write size]
+//
+// With --run it only measures the eventhandler of the current VM.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+const int DEFAULT_MEGABYTES = 1024;
+const int DEFAULT_WRITE_SIZE = 256 * 1024;
+
+Future<int> measure(int megabytes, int writeSize) async {
+  var server = await ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, 0);
+  var received = new Completer<int>();
+  server.listen((socket) {
+    int bytes = 0;
+    socket.listen((data) => bytes += data.length,
+                  onDone: () {
+                    socket.destroy();
+                    received.complete(bytes);
+                  });
+  });
+  var socket = await Socket.connect(InternetAddress.LOOPBACK_IP_V4,
+                                    server.port);
+  var data = new Uint8List(writeSize);
+  int total = megabytes * 1024 * 1024;
+  var stopwatch = new Stopwatch()..start();
+  for (int sent = 0; sent < total; sent += writeSize) {
+    socket.add(data);
+    await socket.flush();
+  }
+  await socket.close();
+  int bytes = await received.future;
+  stopwatch.stop();
+  await server.close();
+  if (bytes < total) throw "Received $bytes of $total bytes";
+  return stopwatch.elapsedMicroseconds;
+}
+
+Future run(String name, int megabytes, int writeSize) async {
+  int micros = await measure(megabytes, writeSize);
+  print('$name(RunTime): ${micros / megabytes} us.');
+  print('${(megabytes * 1000000 / micros).toStringAsFixed(1)} MB/s');
+}
+
+main(List<String> args) async {
+  bool child = args.isNotEmpty && args[0] == '--run';
+  if (child) args = args.sublist(1);
+  int megabytes = args.length > 0 ? int.parse(args[0]) : DEFAULT_MEGABYTES;
+  int writeSize = args.length > 1 ? int.parse(args[1]) : DEFAULT_WRITE_SIZE;
+  if (child) {
+    await run('SocketThroughput', megabytes, writeSize);
+    return;
+  }
+  var script = Platform.script.toFilePath();
+  for (var flags in [[], ['--io-uring']]) {
+    var result = await Process.run(
+        Platform.executable,
+        []..addAll(flags)
+          ..addAll([script, '--run', '$megabytes', '$writeSize']));
+    print(flags.isEmpty ? 'epoll:' : 'io_uring:');
+    stdout.write(result.stdout);
+    stderr.write(result.stderr);
+  }
+}
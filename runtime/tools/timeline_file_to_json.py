@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+# Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+# for details. All rights reserved. Use of this source code is governed by a
+# BSD-style license that can be found in the LICENSE file.
+#
+# This python script converts a timeline file written by the VM with
+# --timeline_file (see TimelineEventFileRecorder in runtime/vm/timeline.h)
+# into the trace-event JSON format understood by chrome://tracing.
+
+import json
+import sys
+from optparse import OptionParser
+
+MAGIC = b'DARTTL01'
+
+STRING_RECORD = 1
+EVENT_RECORD = 2
+THREAD_NAME_RECORD = 3
+
+HAS_THREAD_CPU_TIME = 1 << 0
+PRE_SERIALIZED_JSON = 1 << 1
+
+# Keep in sync with TimelineEvent::EventType.
+BEGIN = 1
+END = 2
+DURATION = 3
+INSTANT = 4
+ASYNC_BEGIN = 5
+ASYNC_INSTANT = 6
+ASYNC_END = 7
+COUNTER = 8
+METADATA = 9
+
+PHASES = {
+  BEGIN: 'B',
+  END: 'E',
+  DURATION: 'X',
+  INSTANT: 'i',
+  ASYNC_BEGIN: 'b',
+  ASYNC_INSTANT: 'n',
+  ASYNC_END: 'e',
+  COUNTER: 'C',
+  METADATA: 'M',
+}
+
+
+class Reader(object):
+  def __init__(self, data):
+    self.data = bytearray(data)
+    self.position = 0
+
+  def done(self):
+    return self.position >= len(self.data)
+
+  def byte(self):
+    value = self.data[self.position]
+    self.position += 1
+    return value
+
+  def unsigned(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.byte()
+      result |= (byte & 0x7f) << shift
+      shift += 7
+      if (byte & 0x80) == 0:
+        return result
+
+  def signed(self):
+    value = self.unsigned()
+    return (value >> 1) ^ -(value & 1)
+
+  def string(self):
+    length = self.unsigned()
+    value = self.data[self.position:self.position + length]
+    self.position += length
+    return value.decode('utf-8', 'replace')
+
+
+def convert(data):
+  if data[:len(MAGIC)] != MAGIC:
+    raise Exception('Not a Dart timeline file')
+  reader = Reader(data[len(MAGIC):])
+  pid = reader.unsigned()
+  strings = {}
+  events = []
+  timestamp = 0
+  while not reader.done():
+    record = reader.unsigned()
+    if record == STRING_RECORD:
+      string_id = reader.unsigned()
+      strings[string_id] = reader.string()
+    elif record == THREAD_NAME_RECORD:
+      tid = reader.unsigned()
+      name = strings[reader.unsigned()]
+      events.append({
+        'name': 'thread_name',
+        'ph': 'M',
+        'pid': pid,
+        'tid': tid,
+        'args': {'name': '%s (%d)' % (name, tid)},
+      })
+    elif record == EVENT_RECORD:
+      type_and_flags = reader.byte()
+      event_type = type_and_flags & 0xf
+      flags = type_and_flags >> 4
+      event = {
+        'name': strings[reader.unsigned()],
+        'cat': strings[reader.unsigned()],
+        'tid': reader.unsigned(),
+        'pid': pid,
+      }
+      isolate = reader.unsigned()
+      timestamp += reader.signed()
+      event['ts'] = timestamp
+      if flags & HAS_THREAD_CPU_TIME:
+        event['tts'] = reader.unsigned()
+      event['ph'] = PHASES[event_type]
+      if event_type == DURATION:
+        event['dur'] = reader.unsigned()
+        if flags & HAS_THREAD_CPU_TIME:
+          event['tdur'] = reader.unsigned()
+      elif event_type in (ASYNC_BEGIN, ASYNC_INSTANT, ASYNC_END):
+        event['id'] = '%x' % reader.unsigned()
+      elif event_type == INSTANT:
+        event['s'] = 'p'
+      args = {}
+      for i in range(reader.unsigned()):
+        name = strings[reader.unsigned()]
+        args[name] = reader.string()
+      if flags & PRE_SERIALIZED_JSON:
+        events.append(json.loads(list(args.values())[0]))
+        continue
+      if isolate != 0:
+        args['isolateNumber'] = str(isolate)
+      event['args'] = args
+      events.append(event)
+    else:
+      raise Exception('Unknown record %d at offset %d' %
+                      (record, reader.position))
+  return events
+
+
+def main():
+  parser = OptionParser(usage='%prog <timeline file> <output json file>')
+  (options, args) = parser.parse_args()
+  if len(args) != 2:
+    parser.print_help()
+    return 1
+  with open(args[0], 'rb') as input_file:
+    events = convert(input_file.read())
+  with open(args[1], 'w') as output_file:
+    json.dump(events, output_file)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,263 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/allocation_sampler.h"
+
+#include <math.h>
+
+#include "vm/dart_api_state.h"
+#include "vm/flags.h"
+#include "vm/heap.h"
+#include "vm/isolate.h"
+#include "vm/json_stream.h"
+#include "vm/object.h"
+#include "vm/stack_frame.h"
+#include "vm/visitor.h"
+
+namespace dart {
+
+DEFINE_FLAG(int, allocation_sample_interval, 0,
+            "Sample heap allocations on average every this many bytes. "
+            "0 disables allocation sampling.");
+
+
+AllocationSampler::AllocationSampler(Isolate* isolate, intptr_t interval)
+    : isolate_(isolate),
+      interval_(interval),
+      random_(),
+      samples_(reinterpret_cast<Sample*>(
+          calloc(kMaxSamples, sizeof(Sample)))),
+      num_samples_(0),
+      cursor_(0) {
+  ASSERT(interval > 0);
+  ScheduleNextSample();
+}
+
+
+AllocationSampler::~AllocationSampler() {
+  isolate_->heap()->new_space()->ClearSamplePoint();
+  for (intptr_t i = 0; i < num_samples_; i++) {
+    FreeHandle(&samples_[i]);
+  }
+  free(samples_);
+}
+
+
+intptr_t AllocationSampler::NextSampleInterval() {
+  // Draw the distance to the next sample from an exponential distribution
+  // with the given mean. The uniform value is in (0, 1].
+  const double uniform =
+      (static_cast<double>(random_.NextUInt32()) + 1.0) / 4294967296.0;
+  const double bytes = -log(uniform) * interval_;
+  // Bound the distance so that a sample point stays within reach.
+  const double kMaxBytes = 64.0 * interval_;
+  const intptr_t result = static_cast<intptr_t>(
+      (bytes < kMaxBytes) ? bytes : kMaxBytes);
+  return Utils::RoundUp(result + 1, kObjectAlignment);
+}
+
+
+void AllocationSampler::ScheduleNextSample() {
+  isolate_->heap()->new_space()->SetSamplePoint(NextSampleInterval());
+}
+
+
+bool AllocationSampler::ShouldSample(RawObject* object, intptr_t size) {
+  Scavenger* new_space = isolate_->heap()->new_space();
+  if (new_space->HasPendingSample()) {
+    if (new_space->TakePendingSample(RawObject::ToAddr(object))) {
+      // This allocation crossed the new space sample point.
+      return true;
+    }
+    // The allocation that crossed the sample point was not made through
+    // Object::Allocate. Do not charge its sample to this one.
+    ScheduleNextSample();
+  }
+  if (object->IsNewObject() || !new_space->HasSamplePoint()) {
+    // Accounted for by the new space allocation top, or a sample is being
+    // taken.
+    return false;
+  }
+  // Old space allocations do not move the new space allocation top.
+  const intptr_t bytes_until_sample = new_space->BytesUntilSamplePoint();
+  if (size < bytes_until_sample) {
+    new_space->SetSamplePoint(bytes_until_sample - size);
+    return false;
+  }
+  new_space->ClearSamplePoint();
+  return true;
+}
+
+
+void AllocationSampler::SampleAllocation(Thread* thread,
+                                         RawObject* object,
+                                         intptr_t cid,
+                                         intptr_t size) {
+  ASSERT(thread->IsMutatorThread());
+  ASSERT(!isolate_->heap()->new_space()->HasSamplePoint());
+  NoSafepointScope no_safepoint;
+  Sample* sample = &samples_[cursor_];
+  FreeHandle(sample);
+  sample->cid = cid;
+  sample->size = size;
+  sample->depth = 0;
+  if (thread->top_exit_frame_info() != 0) {
+    DartFrameIterator frames(thread);
+    StackFrame* frame = frames.NextFrame();
+    while ((frame != NULL) && (sample->depth < kMaxStackDepth)) {
+      sample->stack[sample->depth++] = frame->LookupDartFunction();
+      frame = frames.NextFrame();
+    }
+  }
+  const Object& handle = Object::Handle(thread->zone(), object);
+  sample->handle = FinalizablePersistentHandle::New(
+      isolate_, handle, sample, SampleFinalizer, 0);
+  cursor_ = (cursor_ + 1) % kMaxSamples;
+  if (num_samples_ < kMaxSamples) {
+    num_samples_++;
+  }
+
+  ScheduleNextSample();
+}
+
+
+void AllocationSampler::SampleFinalizer(void* isolate_callback_data,
+                                        Dart_WeakPersistentHandle handle,
+                                        void* peer) {
+  // The handle is freed after the finalizer returns.
+  Sample* sample = reinterpret_cast<Sample*>(peer);
+  sample->handle = NULL;
+}
+
+
+void AllocationSampler::FreeHandle(Sample* sample) {
+  if (sample->handle == NULL) {
+    return;
+  }
+  sample->handle->EnsureFreeExternal(isolate_);
+  isolate_->api_state()->weak_persistent_handles().FreeHandle(sample->handle);
+  sample->handle = NULL;
+}
+
+
+double AllocationSampler::SampleWeight(intptr_t size) const {
+  // Objects are sampled with probability 1 - exp(-size / interval).
+  const double size_in_intervals = static_cast<double>(size) / interval_;
+  return size / (1.0 - exp(-size_in_intervals));
+}
+
+
+// The samples of one class allocated from one stack.
+struct AllocationSiteStats : public ZoneAllocated {
+  intptr_t first_sample;
+  intptr_t samples;
+  intptr_t live_samples;
+  double bytes;
+  double live_bytes;
+
+  static int CompareBytes(AllocationSiteStats* const* a,
+                          AllocationSiteStats* const* b) {
+    // Largest first.
+    if ((*a)->bytes > (*b)->bytes) {
+      return -1;
+    } else if ((*a)->bytes < (*b)->bytes) {
+      return 1;
+    } else {
+      return 0;
+    }
+  }
+};
+
+
+static bool SameStack(intptr_t depth_a, RawFunction* const* stack_a,
+                      intptr_t depth_b, RawFunction* const* stack_b) {
+  if (depth_a != depth_b) {
+    return false;
+  }
+  for (intptr_t i = 0; i < depth_a; i++) {
+    if (stack_a[i] != stack_b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+void AllocationSampler::PrintJSON(JSONStream* js) {
+  Zone* zone = Thread::Current()->zone();
+
+  // Aggregate the samples by class and stack. The number of distinct
+  // allocation sites is usually small.
+  ZoneGrowableArray<AllocationSiteStats*>* sites =
+      new(zone) ZoneGrowableArray<AllocationSiteStats*>();
+  for (intptr_t i = 0; i < num_samples_; i++) {
+    const Sample& sample = samples_[i];
+    AllocationSiteStats* site = NULL;
+    for (intptr_t j = 0; j < sites->length(); j++) {
+      AllocationSiteStats* candidate = sites->At(j);
+      const Sample& other = samples_[candidate->first_sample];
+      if ((other.cid == sample.cid) &&
+          SameStack(sample.depth, sample.stack, other.depth, other.stack)) {
+        site = candidate;
+        break;
+      }
+    }
+    if (site == NULL) {
+      site = new(zone) AllocationSiteStats();
+      site->first_sample = i;
+      site->samples = 0;
+      site->live_samples = 0;
+      site->bytes = 0.0;
+      site->live_bytes = 0.0;
+      sites->Add(site);
+    }
+    const double weight = SampleWeight(sample.size);
+    site->samples++;
+    site->bytes += weight;
+    if (sample.handle != NULL) {
+      site->live_samples++;
+      site->live_bytes += weight;
+    }
+  }
+  sites->Sort(AllocationSiteStats::CompareBytes);
+
+  JSONObject obj(js);
+  obj.AddProperty("type", "_AllocationSamples");
+  obj.AddProperty("samplingInterval", interval_);
+  obj.AddProperty("sampleCount", num_samples_);
+  JSONArray members(&obj, "members");
+  Class& cls = Class::Handle(zone);
+  Function& function = Function::Handle(zone);
+  for (intptr_t i = 0; i < sites->length(); i++) {
+    AllocationSiteStats* site = sites->At(i);
+    JSONObject member(&members);
+    const Sample& sample = samples_[site->first_sample];
+    cls = isolate_->class_table()->At(sample.cid);
+    member.AddProperty("class", cls);
+    {
+      JSONArray functions(&member, "stack");
+      for (intptr_t j = 0; j < sample.depth; j++) {
+        function = sample.stack[j];
+        functions.AddValue(function);
+      }
+    }
+    member.AddProperty("samples", site->samples);
+    member.AddProperty("liveSamples", site->live_samples);
+    member.AddProperty64("bytes", static_cast<int64_t>(site->bytes));
+    member.AddProperty64("liveBytes", static_cast<int64_t>(site->live_bytes));
+  }
+}
+
+
+void AllocationSampler::VisitObjectPointers(ObjectPointerVisitor* visitor) {
+  for (intptr_t i = 0; i < num_samples_; i++) {
+    Sample* sample = &samples_[i];
+    if (sample->depth > 0) {
+      RawObject** first = reinterpret_cast<RawObject**>(&sample->stack[0]);
+      visitor->VisitPointers(first, first + sample->depth - 1);
+    }
+  }
+}
+
+}  // namespace dart
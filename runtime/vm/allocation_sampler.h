@@ -0,0 +1,100 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef VM_ALLOCATION_SAMPLER_H_
+#define VM_ALLOCATION_SAMPLER_H_
+
+#include "include/dart_api.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+#include "vm/random.h"
+
+namespace dart {
+
+class FinalizablePersistentHandle;
+class Isolate;
+class JSONStream;
+class ObjectPointerVisitor;
+class RawFunction;
+class RawObject;
+class Thread;
+
+// Samples the heap allocations of an isolate with a Poisson process: on
+// average one allocation is sampled every 'interval' bytes, and an object of
+// size s is sampled with probability 1 - exp(-s / interval).
+//
+// New space allocations are sampled by lowering the limit of inline
+// allocation to the next sample point (see Scavenger::SetSamplePoint), so
+// allocations that do not cross a sample point run at full speed. Old space
+// allocations of the mutator go through Object::Allocate and move the sample
+// point closer.
+//
+// A sample records the class and size of the object, the Dart functions on
+// the stack when it was allocated and, through a weak persistent handle,
+// whether the object is still alive. An object is known to be dead once a
+// garbage collection found it unreachable.
+class AllocationSampler {
+ public:
+  static const intptr_t kMaxSamples = 4096;
+  static const intptr_t kMaxStackDepth = 32;
+
+  AllocationSampler(Isolate* isolate, intptr_t interval);
+  ~AllocationSampler();
+
+  intptr_t interval() const { return interval_; }
+  intptr_t num_samples() const { return num_samples_; }
+
+  // Called by Object::Allocate for objects allocated by the mutator. Returns
+  // true if the object must be passed to SampleAllocation.
+  bool ShouldSample(RawObject* object, intptr_t size);
+  // Does not allocate in the Dart heap, the object may not be fully
+  // initialized yet.
+  void SampleAllocation(Thread* thread,
+                        RawObject* object,
+                        intptr_t cid,
+                        intptr_t size);
+
+  // Prints the samples aggregated by class and allocation stack, with the
+  // number of bytes they stand for.
+  void PrintJSON(JSONStream* js);
+
+  void VisitObjectPointers(ObjectPointerVisitor* visitor);
+
+  // Sets the new space sample point for the next sample.
+  void ScheduleNextSample();
+
+ private:
+  struct Sample {
+    intptr_t cid;
+    intptr_t size;
+    // NULL once the object has been collected.
+    FinalizablePersistentHandle* handle;
+    intptr_t depth;
+    RawFunction* stack[kMaxStackDepth];
+  };
+
+  static void SampleFinalizer(void* isolate_callback_data,
+                              Dart_WeakPersistentHandle handle,
+                              void* peer);
+
+  intptr_t NextSampleInterval();
+  void FreeHandle(Sample* sample);
+
+  // Number of bytes a sample of an object of 'size' bytes stands for.
+  double SampleWeight(intptr_t size) const;
+
+  Isolate* isolate_;
+  const intptr_t interval_;
+  Random random_;
+
+  Sample* samples_;
+  intptr_t num_samples_;
+  intptr_t cursor_;
+
+  DISALLOW_COPY_AND_ASSIGN(AllocationSampler);
+};
+
+}  // namespace dart
+
+#endif  // VM_ALLOCATION_SAMPLER_H_
@@ -0,0 +1,84 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/assert.h"
+#include "vm/allocation_sampler.h"
+#include "vm/dart_api_impl.h"
+#include "vm/globals.h"
+#include "vm/heap.h"
+#include "vm/json_stream.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+#ifndef PRODUCT
+
+static const char* kAllocatingScript =
+    "class Leaf {\n"
+    "  var a, b, c, d;\n"
+    "}\n"
+    "var retained;\n"
+    "allocateLeaves(n) {\n"
+    "  var result = new List(n);\n"
+    "  for (var i = 0; i < n; i++) {\n"
+    "    result[i] = new Leaf();\n"
+    "  }\n"
+    "  return result;\n"
+    "}\n"
+    "retain() {\n"
+    "  retained = allocateLeaves(10000);\n"
+    "}\n"
+    "release() {\n"
+    "  retained = null;\n"
+    "}\n";
+
+
+TEST_CASE(AllocationSampler_SamplesAndLiveness) {
+  Dart_Handle lib = TestCase::LoadTestScript(kAllocatingScript, NULL);
+  EXPECT_VALID(lib);
+  Isolate* isolate = thread->isolate();
+  {
+    TransitionNativeToVM transition(thread);
+    isolate->SetAllocationSampleInterval(1 * KB);
+  }
+  AllocationSampler* sampler = isolate->allocation_sampler();
+  ASSERT(sampler != NULL);
+  EXPECT_EQ(1 * KB, sampler->interval());
+  EXPECT_EQ(0, sampler->num_samples());
+
+  // About 10000 * 6 words are allocated, so some samples must be taken.
+  EXPECT_VALID(Dart_Invoke(lib, NewString("retain"), 0, NULL));
+  EXPECT(sampler->num_samples() > 0);
+  {
+    TransitionNativeToVM transition(thread);
+    isolate->heap()->CollectAllGarbage();
+    JSONStream js;
+    sampler->PrintJSON(&js);
+    const char* json = js.ToCString();
+    EXPECT_SUBSTRING("\"type\":\"_AllocationSamples\"", json);
+    EXPECT_SUBSTRING("\"samplingInterval\":1024", json);
+    EXPECT_SUBSTRING("\"name\":\"Leaf\"", json);
+    EXPECT_SUBSTRING("\"name\":\"allocateLeaves\"", json);
+  }
+
+  // Once the leaves are unreachable their samples are no longer live.
+  EXPECT_VALID(Dart_Invoke(lib, NewString("release"), 0, NULL));
+  {
+    TransitionNativeToVM transition(thread);
+    isolate->heap()->CollectAllGarbage();
+    JSONStream js;
+    sampler->PrintJSON(&js);
+    const char* json = js.ToCString();
+    EXPECT_SUBSTRING("\"name\":\"Leaf\"", json);
+    EXPECT_SUBSTRING("\"liveSamples\":0,", json);
+
+    isolate->SetAllocationSampleInterval(0);
+    EXPECT(isolate->allocation_sampler() == NULL);
+    EXPECT(!isolate->heap()->new_space()->HasSamplePoint());
+  }
+}
+
+#endif  // !PRODUCT
+
+}  // namespace dart
@@ -13,6 +13,7 @@
 
 #include "vm/compiler_stats.h"
 #include "vm/dart_api_impl.h"
+#include "vm/profiler.h"
 #include "vm/stack_frame.h"
 #include "vm/unit_test.h"
 
@@ -20,6 +21,8 @@ using dart::bin::File;
 
 namespace dart {
 
+DECLARE_FLAG(bool, loop_vectorization);
+
 Benchmark* Benchmark::first_ = NULL;
 Benchmark* Benchmark::tail_ = NULL;
 const char* Benchmark::executable_ = NULL;
@@ -729,4 +732,550 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+
+//
+// Measure element-wise loops over typed data with and without
+// loop vectorization.
+//
+static const char* kTypedDataLoopsScript =
+    "import 'dart:typed_data';\n"
+    "addFloat32(Float32List a, Float32List b, Float32List c) {\n"
+    "  for (int i = 0; i < a.length; i++) {\n"
+    "    a[i] = b[i] + c[i];\n"
+    "  }\n"
+    "}\n"
+    "scaleFloat64(Float64List a, Float64List b, double s) {\n"
+    "  for (int i = 0; i < a.length; i++) {\n"
+    "    a[i] = b[i] * s;\n"
+    "  }\n"
+    "}\n"
+    "copyUint8(Uint8List a, Uint8List b) {\n"
+    "  for (int i = 0; i < a.length; i++) {\n"
+    "    a[i] = b[i];\n"
+    "  }\n"
+    "}\n"
+    "const int kLength = 4099;\n"
+    "final f32a = new Float32List(kLength);\n"
+    "final f32b = new Float32List(kLength);\n"
+    "final f32c = new Float32List(kLength);\n"
+    "final f64a = new Float64List(kLength);\n"
+    "final f64b = new Float64List(kLength);\n"
+    "final u8a = new Uint8List(kLength);\n"
+    "final u8b = new Uint8List(kLength);\n"
+    "benchmark(int count) {\n"
+    "  for (int i = 0; i < count; i++) {\n"
+    "    addFloat32(f32a, f32b, f32c);\n"
+    "    scaleFloat64(f64a, f64b, 1.5);\n"
+    "    copyUint8(u8a, u8b);\n"
+    "  }\n"
+    "}\n";
+
+
+static void RunTypedDataLoops(Benchmark* benchmark, bool vectorize) {
+  const bool saved_loop_vectorization = FLAG_loop_vectorization;
+  FLAG_loop_vectorization = vectorize;
+  Dart_Handle lib = TestCase::LoadTestScript(kTypedDataLoopsScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  // Warm up so that the loops get optimized.
+  args[0] = Dart_NewInteger(1000);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  const intptr_t kLoopCount = 10000;
+  args[0] = Dart_NewInteger(kLoopCount);
+  Timer timer(true, "Typed data loops benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+  FLAG_loop_vectorization = saved_loop_vectorization;
+}
+
+
+BENCHMARK(TypedDataLoops) {
+  RunTypedDataLoops(benchmark, false);
+}
+
+
+BENCHMARK(TypedDataLoopsVectorized) {
+  RunTypedDataLoops(benchmark, true);
+}
+
+
+//
+// Measure calls of medium sized methods from a hot loop.
+//
+BENCHMARK(HotCallSites) {
+  const char* kScript =
+      "class Vec {\n"
+      "  final double x, y, z;\n"
+      "  Vec(this.x, this.y, this.z);\n"
+      "  Vec cross(Vec o) {\n"
+      "    return new Vec(y * o.z - z * o.y,\n"
+      "                   z * o.x - x * o.z,\n"
+      "                   x * o.y - y * o.x);\n"
+      "  }\n"
+      "  double dot(Vec o) => x * o.x + y * o.y + z * o.z;\n"
+      "  Vec normalize() {\n"
+      "    final len = dot(this);\n"
+      "    if (len == 0.0) return this;\n"
+      "    return new Vec(x / len, y / len, z / len);\n"
+      "  }\n"
+      "}\n"
+      "double step(Vec a, Vec b) {\n"
+      "  final c = a.cross(b).normalize();\n"
+      "  final d = c.cross(a).normalize();\n"
+      "  return d.dot(b) + c.dot(a);\n"
+      "}\n"
+      "benchmark(int count) {\n"
+      "  var a = new Vec(1.0, 2.0, 3.0);\n"
+      "  var b = new Vec(0.5, -1.0, 0.25);\n"
+      "  var sum = 0.0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    sum += step(a, b);\n"
+      "  }\n"
+      "  return sum;\n"
+      "}\n";
+  Dart_Handle lib = TestCase::LoadTestScript(kScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  // Warm up so that the hot functions get optimized.
+  args[0] = Dart_NewInteger(10000);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(1000000);
+  Timer timer(true, "Hot call sites benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+//
+// Measure 'is' checks against classes and interfaces of a large hierarchy.
+//
+BENCHMARK(InstanceOfLargeHierarchy) {
+  // 32 classes implementing I and extending one of two bases.
+  TextBuffer script(4096);
+  script.Printf("abstract class I {}\n"
+                "class Base0 {}\n"
+                "class Base1 extends Base0 {}\n");
+  const intptr_t kNumClasses = 32;
+  for (intptr_t i = 0; i < kNumClasses; i++) {
+    script.Printf("class C%" Pd " extends Base%" Pd " implements I {}\n",
+                  i, i % 2);
+  }
+  script.Printf("final objects = [");
+  for (intptr_t i = 0; i < kNumClasses; i++) {
+    script.Printf("new C%" Pd "(), ", i);
+  }
+  script.Printf("];\n"
+                "test(o) => (o is I ? 1 : 0) + (o is Base0 ? 1 : 0);\n"
+                "benchmark(int count) {\n"
+                "  var sum = 0;\n"
+                "  for (int i = 0; i < count; i++) {\n"
+                "    for (var o in objects) sum += test(o);\n"
+                "  }\n"
+                "  return sum;\n"
+                "}\n");
+  Dart_Handle lib = TestCase::LoadTestScript(script.buf(), NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  // Warm up so that the type test caches get populated.
+  args[0] = Dart_NewInteger(1000);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(100000);
+  Timer timer(true, "InstanceOf large hierarchy benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+//
+// Measure decoding of UTF-8 payloads into strings.
+//
+static void RunUtf8Decode(Benchmark* benchmark, const char* record) {
+  // Build a payload of about 64KB resembling a JSON request body.
+  TextBuffer payload(64 * KB);
+  payload.AddString("[");
+  while (payload.length() < 64 * KB) {
+    payload.AddString(record);
+    payload.AddString(",");
+  }
+  payload.AddString("{}]");
+  const uint8_t* utf8 = reinterpret_cast<const uint8_t*>(payload.buf());
+  const intptr_t length = payload.length();
+  const intptr_t kLoopCount = 1000;
+  Timer timer(true, "UTF-8 decoding benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    Dart_EnterScope();
+    EXPECT_VALID(Dart_NewStringFromUTF8(utf8, length));
+    Dart_ExitScope();
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+BENCHMARK(Utf8DecodeAscii) {
+  RunUtf8Decode(benchmark,
+      "{\"id\":12345,\"name\":\"Jane Doe\",\"email\":\"jane@example.com\","
+      "\"tags\":[\"alpha\",\"beta\",\"gamma\"],\"active\":true}");
+}
+
+
+BENCHMARK(Utf8DecodeMixed) {
+  RunUtf8Decode(benchmark,
+      "{\"id\":12345,\"name\":\"J\xC3\xBCrgen M\xC3\xBCller\","
+      "\"city\":\"\xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0\","
+      "\"note\":\"\xE6\x9D\xB1\xE4\xBA\xAC \xF0\x9F\x98\x80\","
+      "\"active\":true}");
+}
+
+
+//
+// Measure building a long string by repeated concatenation.
+//
+BENCHMARK(StringConcatLoop) {
+  const char* kScript =
+      "benchmark(int count) {\n"
+      "  var hash = 0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    var s = '';\n"
+      "    for (int j = 0; j < 1000; j++) {\n"
+      "      s = s + 'line $j of the generated report\\n';\n"
+      "    }\n"
+      "    hash ^= s.hashCode ^ s.codeUnitAt(s.length ~/ 2);\n"
+      "  }\n"
+      "  return hash;\n"
+      "}\n";
+  Dart_Handle lib = TestCase::LoadTestScript(kScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  args[0] = Dart_NewInteger(10);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(100);
+  Timer timer(true, "String concatenation loop benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+//
+// Measure decoding of JSON documents into maps and lists.
+//
+static void RunJsonDecode(Benchmark* benchmark, const char* decode) {
+  TextBuffer script(4096);
+  script.Printf(
+      "import 'dart:convert';\n"
+      "import 'dart:typed_data';\n"
+      "String makePayload() {\n"
+      "  var records = [];\n"
+      "  for (int i = 0; i < 500; i++) {\n"
+      "    records.add({'id': i, 'name': 'user $i', 'score': i / 7,\n"
+      "                 'email': 'user$i@example.com', 'active': i.isEven,\n"
+      "                 'tags': ['alpha', 'beta', 'gamma\\u00e9'],\n"
+      "                 'address': {'city': 'Aarhus', 'zip': '8000'}});\n"
+      "  }\n"
+      "  return JSON.encode(records);\n"
+      "}\n"
+      "final String payload = makePayload();\n"
+      "final Uint8List bytes = new Uint8List.fromList(UTF8.encode(payload));\n"
+      "final utf8Decoder = UTF8.decoder.fuse(JSON.decoder);\n"
+      "decodeChunked(String json) {\n"
+      "  var result;\n"
+      "  var sink = JSON.decoder.startChunkedConversion(\n"
+      "      new ChunkedConversionSink.withCallback((r) => result = r[0]));\n"
+      "  sink.add(json);\n"
+      "  sink.close();\n"
+      "  return result;\n"
+      "}\n"
+      "benchmark(int count) {\n"
+      "  var sum = 0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    sum += %s.length;\n"
+      "  }\n"
+      "  return sum;\n"
+      "}\n", decode);
+  Dart_Handle lib = TestCase::LoadTestScript(script.buf(), NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  args[0] = Dart_NewInteger(10);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(200);
+  Timer timer(true, "JSON decoding benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+BENCHMARK(JsonDecodeString) {
+  RunJsonDecode(benchmark, "JSON.decode(payload)");
+}
+
+
+BENCHMARK(JsonDecodeUtf8) {
+  RunJsonDecode(benchmark, "utf8Decoder.convert(bytes)");
+}
+
+
+// The chunked decoder always uses the Dart implementation.
+BENCHMARK(JsonDecodeDartParser) {
+  RunJsonDecode(benchmark, "decodeChunked(payload)");
+}
+
+
+static void RunJsonEncode(Benchmark* benchmark, const char* encode) {
+  TextBuffer script(4096);
+  script.Printf(
+      "import 'dart:convert';\n"
+      "makeRecords() {\n"
+      "  var records = [];\n"
+      "  for (int i = 0; i < 500; i++) {\n"
+      "    records.add({'id': i, 'name': 'user $i', 'score': i / 7,\n"
+      "                 'email': 'user$i@example.com', 'active': i.isEven,\n"
+      "                 'tags': ['alpha', 'beta', 'gamma\\u00e9'],\n"
+      "                 'note': 'line \\\\ with \\\"quotes\\\"\\n',\n"
+      "                 'address': {'city': 'Aarhus', 'zip': '8000'}});\n"
+      "  }\n"
+      "  return records;\n"
+      "}\n"
+      "final records = makeRecords();\n"
+      "final utf8Encoder = new JsonUtf8Encoder();\n"
+      "encodeChunked(object) {\n"
+      "  var result;\n"
+      "  var sink = JSON.encoder.startChunkedConversion(\n"
+      "      new StringConversionSink.withCallback((s) => result = s));\n"
+      "  sink.add(object);\n"
+      "  sink.close();\n"
+      "  return result;\n"
+      "}\n"
+      "benchmark(int count) {\n"
+      "  var sum = 0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    sum += %s.length;\n"
+      "  }\n"
+      "  return sum;\n"
+      "}\n", encode);
+  Dart_Handle lib = TestCase::LoadTestScript(script.buf(), NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  args[0] = Dart_NewInteger(10);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(200);
+  Timer timer(true, "JSON encoding benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+BENCHMARK(JsonEncodeString) {
+  RunJsonEncode(benchmark, "JSON.encode(records)");
+}
+
+
+BENCHMARK(JsonEncodeUtf8) {
+  RunJsonEncode(benchmark, "utf8Encoder.convert(records)");
+}
+
+
+// The chunked encoder always uses the Dart implementation.
+BENCHMARK(JsonEncodeDartStringifier) {
+  RunJsonEncode(benchmark, "encodeChunked(records)");
+}
+
+
+static void RunDoubleConversion(Benchmark* benchmark, const char* convert) {
+  TextBuffer script(2048);
+  script.Printf(
+      "makeDoubles() {\n"
+      "  var doubles = [];\n"
+      "  for (int i = 1; i <= 1000; i++) {\n"
+      "    doubles.add(i / 7);\n"
+      "    doubles.add(i * 1.1e200);\n"
+      "    doubles.add(1 / (i * 3e100));\n"
+      "  }\n"
+      "  return doubles;\n"
+      "}\n"
+      "final doubles = makeDoubles();\n"
+      "final strings = doubles.map((d) => d.toStringAsExponential(16))\n"
+      "    .toList();\n"
+      "benchmark(int count) {\n"
+      "  var sum = 0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    for (int j = 0; j < doubles.length; j++) {\n"
+      "      sum += %s;\n"
+      "    }\n"
+      "  }\n"
+      "  return sum;\n"
+      "}\n", convert);
+  Dart_Handle lib = TestCase::LoadTestScript(script.buf(), NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  args[0] = Dart_NewInteger(10);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  args[0] = Dart_NewInteger(100);
+  Timer timer(true, "Double conversion benchmark");
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+BENCHMARK(DoubleToString) {
+  RunDoubleConversion(benchmark, "doubles[j].toString().length");
+}
+
+
+// Parses 17 digit strings, which are not handled by the Dart fast path.
+BENCHMARK(DoubleParse) {
+  RunDoubleConversion(benchmark, "double.parse(strings[j]).sign");
+}
+
+
+#ifndef PRODUCT
+
+struct SampleWriterParams {
+  SampleBuffer* sample_buffer;
+  intptr_t samples_per_thread;
+  Monitor* monitor;
+  intptr_t running;
+};
+
+
+static void SampleWriterMain(uword parameter) {
+  SampleWriterParams* params = reinterpret_cast<SampleWriterParams*>(parameter);
+  SampleBlock* block = NULL;
+  const int64_t timestamp = OS::GetCurrentMonotonicMicros();
+  const ThreadId tid = OSThread::Current()->trace_id();
+  for (intptr_t i = 0; i < params->samples_per_thread; i++) {
+    Sample* sample = params->sample_buffer->ReserveSample(&block);
+    if (sample == NULL) {
+      continue;
+    }
+    sample->Init(NULL, timestamp, tid);
+    sample->SetAt(0, i + 1);
+  }
+  if (block != NULL) {
+    SampleBuffer::ReleaseBlock(block);
+  }
+  MonitorLocker ml(params->monitor);
+  params->running--;
+  ml.Notify();
+}
+
+
+// Measures the cost of writing profiler samples from many threads at once,
+// as done by the thread interrupter when sampling every thread at 1 kHz.
+BENCHMARK(ProfilerSampleWriters) {
+  const intptr_t kNumThreads = 8;
+  SampleWriterParams params;
+  params.sample_buffer = new SampleBuffer();
+  params.samples_per_thread = 1000000;
+  params.monitor = new Monitor();
+  params.running = kNumThreads;
+  Timer timer(true, "Profiler sample writers benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < kNumThreads; i++) {
+    int result = OSThread::Start("ProfilerSampleWriter",
+                                 SampleWriterMain,
+                                 reinterpret_cast<uword>(&params));
+    EXPECT_EQ(0, result);
+  }
+  {
+    MonitorLocker ml(params.monitor);
+    while (params.running > 0) {
+      ml.Wait();
+    }
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+  delete params.monitor;
+  delete params.sample_buffer;
+}
+
+
+//
+// Measure the overhead of allocation sampling on an allocation heavy loop,
+// without sampling and with the sample interval used by the tools.
+//
+static void RunAllocationSampling(Benchmark* benchmark,
+                                  Thread* thread,
+                                  intptr_t interval,
+                                  const char* name) {
+  const char* kScript =
+      "class Node {\n"
+      "  var next, value;\n"
+      "  Node(this.next, this.value);\n"
+      "}\n"
+      "benchmark(int count) {\n"
+      "  var length = 0;\n"
+      "  for (int i = 0; i < count; i++) {\n"
+      "    var list = null;\n"
+      "    for (int j = 0; j < 1000; j++) {\n"
+      "      list = new Node(list, [j]);\n"
+      "    }\n"
+      "    length += list.value.length;\n"
+      "  }\n"
+      "  return length;\n"
+      "}\n";
+  Dart_Handle lib = TestCase::LoadTestScript(kScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[1];
+  args[0] = Dart_NewInteger(100);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  {
+    TransitionNativeToVM transition(thread);
+    thread->isolate()->SetAllocationSampleInterval(interval);
+  }
+  args[0] = Dart_NewInteger(10000);
+  Timer timer(true, name);
+  timer.Start();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("benchmark"), 1, args));
+  timer.Stop();
+  {
+    TransitionNativeToVM transition(thread);
+    thread->isolate()->SetAllocationSampleInterval(0);
+  }
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+
+BENCHMARK(AllocationSamplingOff) {
+  RunAllocationSampling(benchmark, thread, 0, "Allocation sampling off");
+}
+
+
+BENCHMARK(AllocationSampling512KB) {
+  RunAllocationSampling(benchmark, thread, 512 * KB,
+                        "Allocation sampling every 512KB");
+}
+
+
+BENCHMARK(AllocationSampling4KB) {
+  RunAllocationSampling(benchmark, thread, 4 * KB,
+                        "Allocation sampling every 4KB");
+}
+
+#endif  // !PRODUCT
+
 }  // namespace dart
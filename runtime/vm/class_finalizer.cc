@@ -210,6 +210,8 @@ void ClassFinalizer::VerifyBootstrapClasses() {
   ASSERT(ExternalOneByteString::InstanceSize() == cls.instance_size());
   cls = object_store->external_two_byte_string_class();
   ASSERT(ExternalTwoByteString::InstanceSize() == cls.instance_size());
+  cls = object_store->cons_string_class();
+  ASSERT(ConsString::InstanceSize() == cls.instance_size());
   cls = object_store->double_class();
   ASSERT(Double::InstanceSize() == cls.instance_size());
   cls = object_store->bool_class();
@@ -2971,6 +2973,7 @@ void ClassFinalizer::ResolveSuperTypeAndInterfaces(
       case kTwoByteStringCid:
       case kExternalOneByteStringCid:
       case kExternalTwoByteStringCid:
+      case kConsStringCid:
       case kBoolCid:
       case kNullCid:
       case kArrayCid:
@@ -372,28 +372,14 @@ static void UpdateTypeTestCache(
          instance_type_arguments.IsCanonical());
   ASSERT(instantiator_type_arguments.IsNull() ||
          instantiator_type_arguments.IsCanonical());
-  Object& last_instance_class_id_or_function = Object::Handle();
-  TypeArguments& last_instance_type_arguments = TypeArguments::Handle();
-  TypeArguments& last_instantiator_type_arguments = TypeArguments::Handle();
-  Bool& last_result = Bool::Handle();
-  for (intptr_t i = 0; i < len; ++i) {
-    new_cache.GetCheck(
-        i,
-        &last_instance_class_id_or_function,
-        &last_instance_type_arguments,
-        &last_instantiator_type_arguments,
-        &last_result);
-    if ((last_instance_class_id_or_function.raw() ==
-         instance_class_id_or_function.raw()) &&
-        (last_instance_type_arguments.raw() == instance_type_arguments.raw()) &&
-        (last_instantiator_type_arguments.raw() ==
-         instantiator_type_arguments.raw())) {
-      OS::PrintErr("  Error in test cache %p ix: %" Pd ",", new_cache.raw(), i);
-      PrintTypeCheck(" duplicate cache entry", instance, type,
-          instantiator_type_arguments, result);
-      UNREACHABLE();
-      return;
-    }
+  if (new_cache.HasCheck(instance_class_id_or_function,
+                         instance_type_arguments,
+                         instantiator_type_arguments)) {
+    OS::PrintErr("  Error in test cache %p,", new_cache.raw());
+    PrintTypeCheck(" duplicate cache entry", instance, type,
+        instantiator_type_arguments, result);
+    UNREACHABLE();
+    return;
   }
 #endif
   new_cache.AddCheck(instance_class_id_or_function,
@@ -1349,6 +1335,14 @@ DEFINE_RUNTIME_ENTRY(StackOverflow, 0) {
         function.is_intrinsic()) {
       return;
     }
+    // Functions which keep deoptimizing collect more feedback first, see
+    // OptimizeInvokedFunction.
+    const intptr_t backoff = function.optimization_backoff();
+    if (backoff > 0) {
+      function.set_optimization_backoff(backoff - 1);
+      function.set_usage_counter(0);
+      return;
+    }
 
     // The unoptimized code is on the stack and should never be detached from
     // the function at this point.
@@ -1416,6 +1410,19 @@ DEFINE_RUNTIME_ENTRY(OptimizeInvokedFunction, 1) {
   ASSERT(!function.IsNull());
   ASSERT(function.HasCode());
 
+  const intptr_t backoff = function.optimization_backoff();
+  if ((backoff > 0) && Compiler::CanOptimizeFunction(thread, function)) {
+    // The function keeps deoptimizing, collect more feedback first.
+    if (FLAG_trace_optimization) {
+      THR_Print("Delaying reoptimization of '%s' (backoff %" Pd ")\n",
+                function.ToFullyQualifiedCString(), backoff);
+    }
+    function.set_optimization_backoff(backoff - 1);
+    function.set_usage_counter(0);
+    arguments.SetReturn(Code::Handle(zone, function.CurrentCode()));
+    return;
+  }
+
   if (Compiler::CanOptimizeFunction(thread, function)) {
     if (FLAG_background_compilation) {
       Field& field = Field::Handle(zone, isolate->GetDeoptimizingBoxedField());
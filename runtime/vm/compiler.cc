@@ -29,6 +29,7 @@
 #include "vm/il_printer.h"
 #include "vm/jit_optimizer.h"
 #include "vm/longjump.h"
+#include "vm/loop_vectorizer.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/os.h"
@@ -53,8 +54,17 @@ DEFINE_FLAG(bool, constant_propagation, true,
     "Do conditional constant propagation/unreachable code elimination.");
 DEFINE_FLAG(int, max_deoptimization_counter_threshold, 16,
     "How many times we allow deoptimization before we disallow optimization.");
+DEFINE_FLAG(int, deoptimization_backoff_threshold, 4,
+    "Every deoptimization of a function beyond this count requires another "
+    "optimization_counter_threshold invocations before reoptimization "
+    "(-1 disables the backoff).");
+DEFINE_FLAG(int, deoptimization_storm_threshold, 3,
+    "How many deoptimizations with the same reason we allow before the "
+    "speculation causing them is disabled for the function (at most 7).");
 DEFINE_FLAG(bool, loop_invariant_code_motion, true,
     "Do loop invariant code motion.");
+DEFINE_FLAG(bool, loop_vectorization, false,
+    "Vectorize simple loops over typed data using SIMD operations.");
 DEFINE_FLAG(charp, optimization_filter, NULL, "Optimize only named function");
 DEFINE_FLAG(bool, print_flow_graph, false, "Print the IR flow graph.");
 DEFINE_FLAG(bool, print_flow_graph_optimized, false,
@@ -991,6 +1001,17 @@ bool CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
           DEBUG_ASSERT(flow_graph->VerifyUseLists());
         }
 
+        if (FLAG_loop_vectorization) {
+          NOT_IN_PRODUCT(TimelineDurationScope tds2(thread(),
+                                                    compiler_timeline,
+                                                    "LoopVectorizer"));
+          // Uses the bounds information left by range analysis and must run
+          // while deoptimization environments are still attached.
+          LoopVectorizer vectorizer(flow_graph);
+          vectorizer.Optimize();
+          DEBUG_ASSERT(flow_graph->VerifyUseLists());
+        }
+
         // Recompute types after code movement was done to ensure correct
         // reaching types for hoisted values.
         FlowGraphTypePropagator::Propagate(flow_graph);
@@ -30,6 +30,7 @@
 #include "vm/port.h"
 #include "vm/precompiler.h"
 #include "vm/profiler.h"
+#include "vm/profiler_service.h"
 #include "vm/resolver.h"
 #include "vm/reusable_handles.h"
 #include "vm/service_event.h"
@@ -2427,7 +2428,8 @@ DART_EXPORT Dart_Handle Dart_StringToCString(Dart_Handle object,
   if (cstr == NULL) {
     RETURN_NULL_ERROR(cstr);
   }
-  const String& str_obj = Api::UnwrapStringHandle(Z, object);
+  const String& str_obj = String::Handle(Z,
+      ConsString::FlattenIfCons(Api::UnwrapStringHandle(Z, object)));
   if (str_obj.IsNull()) {
     RETURN_TYPE_ERROR(Z, object, String);
   }
@@ -2455,7 +2457,8 @@ DART_EXPORT Dart_Handle Dart_StringToUTF8(Dart_Handle str,
   if (length == NULL) {
     RETURN_NULL_ERROR(length);
   }
-  const String& str_obj = Api::UnwrapStringHandle(Z, str);
+  const String& str_obj = String::Handle(Z,
+      ConsString::FlattenIfCons(Api::UnwrapStringHandle(Z, str)));
   if (str_obj.IsNull()) {
     RETURN_TYPE_ERROR(Z, str, String);
   }
@@ -2481,7 +2484,8 @@ DART_EXPORT Dart_Handle Dart_StringToLatin1(Dart_Handle str,
   if (length == NULL) {
     RETURN_NULL_ERROR(length);
   }
-  const String& str_obj = Api::UnwrapStringHandle(Z, str);
+  const String& str_obj = String::Handle(Z,
+      ConsString::FlattenIfCons(Api::UnwrapStringHandle(Z, str)));
   if (str_obj.IsNull() || !str_obj.IsOneByteString()) {
     RETURN_TYPE_ERROR(Z, str, String);
   }
@@ -2503,7 +2507,8 @@ DART_EXPORT Dart_Handle Dart_StringToUTF16(Dart_Handle str,
                                            intptr_t* length) {
   API_TIMELINE_DURATION;
   DARTSCOPE(Thread::Current());
-  const String& str_obj = Api::UnwrapStringHandle(Z, str);
+  const String& str_obj = String::Handle(Z,
+      ConsString::FlattenIfCons(Api::UnwrapStringHandle(Z, str)));
   if (str_obj.IsNull()) {
     RETURN_TYPE_ERROR(Z, str, String);
   }
@@ -6136,6 +6141,48 @@ DART_EXPORT void Dart_SetThreadName(const char* name) {
 }
 
 
+#ifndef PRODUCT
+struct PprofConsumer {
+  Dart_StreamConsumer consumer;
+  void* user_data;
+};
+
+
+static void PprofToConsumer(const uint8_t* data,
+                            intptr_t length,
+                            void* callback_data) {
+  PprofConsumer* pprof_consumer =
+      reinterpret_cast<PprofConsumer*>(callback_data);
+  DataStreamToConsumer(pprof_consumer->consumer,
+                       pprof_consumer->user_data,
+                       reinterpret_cast<const char*>(data),
+                       length,
+                       "pprof");
+}
+#endif  // !PRODUCT
+
+
+DART_EXPORT bool Dart_GetCpuProfilePprof(Dart_StreamConsumer consumer,
+                                         void* user_data) {
+#if defined(PRODUCT)
+  return false;
+#else  // defined(PRODUCT)
+  CHECK_ISOLATE(Isolate::Current());
+  if (consumer == NULL) {
+    return false;
+  }
+  Thread* T = Thread::Current();
+  TransitionNativeToVM transition(T);
+  PprofConsumer pprof_consumer = { consumer, user_data };
+  StartStreamToConsumer(consumer, user_data, "pprof");
+  const bool success = ProfilerService::WritePprof(
+      PprofToConsumer, &pprof_consumer, -1, -1);
+  FinishStreamToConsumer(consumer, user_data, "pprof");
+  return success;
+#endif  // defined(PRODUCT)
+}
+
+
 // The precompiler is included in dart_bootstrap and dart_noopt, and
 // excluded from dart and dart_precompiled_runtime.
 #if !defined(DART_PRECOMPILER)
@@ -4,6 +4,7 @@
 
 #include "vm/deferred_objects.h"
 
+#include "vm/code_generator.h"
 #include "vm/code_patcher.h"
 #include "vm/compiler.h"
 #include "vm/deopt_instructions.h"
@@ -12,6 +13,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, deoptimization_backoff_threshold);
+DECLARE_FLAG(int, deoptimization_storm_threshold);
 DECLARE_FLAG(bool, trace_deoptimization);
 DECLARE_FLAG(bool, trace_deoptimization_verbose);
 
@@ -155,6 +158,24 @@ void DeferredRetAddr::Materialize(DeoptContext* deopt_context) {
 }
 
 
+// Returns the optimization backoff of a function that was just deoptimized.
+// Every deoptimization beyond --deoptimization_backoff_threshold delays
+// reoptimization of the function by another --optimization_counter_threshold
+// invocations.
+static intptr_t OptimizationBackoffAfterDeoptimization(
+    const Function& function) {
+  if (FLAG_deoptimization_backoff_threshold < 0) {
+    return 0;
+  }
+  const intptr_t excess = function.deoptimization_counter() -
+      FLAG_deoptimization_backoff_threshold;
+  if (excess <= 0) {
+    return 0;
+  }
+  return Utils::Minimum(excess, Function::kMaxOptimizationBackoff);
+}
+
+
 void DeferredPcMarker::Materialize(DeoptContext* deopt_context) {
   Thread* thread = deopt_context->thread();
   Zone* zone = deopt_context->zone();
@@ -178,19 +199,32 @@ void DeferredPcMarker::Materialize(DeoptContext* deopt_context) {
         function.ToCString());
   }
 
-  // Increment the deoptimization counter. This effectively increments each
+  // Increment the deoptimization counters. This effectively increments each
   // function occurring in the optimized frame.
+  const ICData::DeoptReasonId reason = deopt_context->deopt_reason();
   if (deopt_context->deoptimizing_code()) {
     function.set_deoptimization_counter(function.deoptimization_counter() + 1);
+    function.IncrementDeoptReasonCount(reason);
   }
   if (FLAG_trace_deoptimization || FLAG_trace_deoptimization_verbose) {
-    THR_Print("Deoptimizing '%s' (count %d)\n",
+    THR_Print("Deoptimizing '%s' (count %d, %s count %" Pd ")\n",
         function.ToFullyQualifiedCString(),
-        function.deoptimization_counter());
+        function.deoptimization_counter(),
+        DeoptReasonToCString(reason),
+        function.DeoptReasonCount(reason));
+    if (function.DeoptReasonCount(reason) ==
+        FLAG_deoptimization_storm_threshold) {
+      THR_Print("Deoptimization storm in '%s' (%s)\n",
+          function.ToFullyQualifiedCString(),
+          DeoptReasonToCString(reason));
+    }
   }
   // Clear invocation counter so that hopefully the function gets reoptimized
-  // only after more feedback has been collected.
+  // only after more feedback has been collected. Functions which keep
+  // deoptimizing have to collect more feedback every time.
   function.set_usage_counter(0);
+  function.set_optimization_backoff(
+      OptimizationBackoffAfterDeoptimization(function));
   if (function.HasOptimizedCode()) {
     function.SwitchToUnoptimizedCode();
   }
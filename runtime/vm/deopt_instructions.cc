@@ -155,15 +155,19 @@ DeoptContext::~DeoptContext() {
           String::Handle(zone(), function.QualifiedScrubbedName());
       const char* reason = DeoptReasonToCString(deopt_reason());
       const int counter = function.deoptimization_counter();
+      const intptr_t reason_counter =
+          function.DeoptReasonCount(deopt_reason());
       TimelineEvent* timeline_event = compiler_stream->StartEvent();
       if (timeline_event != NULL) {
         timeline_event->Duration("Deoptimize",
                                  deopt_start_micros_,
                                  OS::GetCurrentMonotonicMicros());
-        timeline_event->SetNumArguments(3);
+        timeline_event->SetNumArguments(4);
         timeline_event->CopyArgument(0, "function", function_name.ToCString());
         timeline_event->CopyArgument(1, "reason", reason);
         timeline_event->FormatArgument(2, "deoptimizationCount", "%d", counter);
+        timeline_event->FormatArgument(
+            3, "reasonCount", "%" Pd "", reason_counter);
         timeline_event->Complete();
       }
     }
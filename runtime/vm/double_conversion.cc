@@ -7,6 +7,7 @@
 #include "third_party/double-conversion/src/double-conversion.h"
 
 #include "vm/exceptions.h"
+#include "vm/fast_double_conversion.h"
 #include "vm/globals.h"
 #include "vm/object.h"
 
@@ -16,6 +17,21 @@ static const char kDoubleToStringCommonExponentChar = 'e';
 static const char* kDoubleToStringCommonInfinitySymbol = "Infinity";
 static const char* kDoubleToStringCommonNaNSymbol = "NaN";
 
+// Writes the decimal digits of 'value' to 'buffer' and returns their number.
+static int WriteDigits(uint64_t value, char* buffer) {
+  char digits[20];
+  int length = 0;
+  do {
+    digits[length++] = '0' + static_cast<char>(value % 10);
+    value /= 10;
+  } while (value != 0);
+  for (int i = 0; i < length; i++) {
+    buffer[i] = digits[length - 1 - i];
+  }
+  return length;
+}
+
+
 void DoubleToCString(double d, char* buffer, int buffer_size) {
   static const int kDecimalLow = -6;
   static const int kDecimalHigh = 21;
@@ -31,25 +47,86 @@ void DoubleToCString(double d, char* buffer, int buffer_size) {
   // sign, at most three exponent digits, plus the \0.
   ASSERT(buffer_size >= 1 + 17 + 1 + 1 + 1 + 3 + 1);
 
-  static const int kConversionFlags =
-      double_conversion::DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN |
-      double_conversion::DoubleToStringConverter::EMIT_TRAILING_DECIMAL_POINT |
-     double_conversion::DoubleToStringConverter::EMIT_TRAILING_ZERO_AFTER_POINT;
-
-  const double_conversion::DoubleToStringConverter converter(
-      kConversionFlags,
-      kDoubleToStringCommonInfinitySymbol,
-      kDoubleToStringCommonNaNSymbol,
-      kDoubleToStringCommonExponentChar,
-      kDecimalLow,
-      kDecimalHigh,
-      0, 0);  // Last two values are ignored in shortest mode.
+  if (isnan(d)) {
+    strncpy(buffer, kDoubleToStringCommonNaNSymbol, buffer_size);
+    return;
+  }
+  char* current = buffer;
+  if (signbit(d)) {
+    *current++ = '-';
+    d = -d;
+  }
+  if (isinf(d)) {
+    strncpy(current, kDoubleToStringCommonInfinitySymbol,
+            buffer_size - (current - buffer));
+    return;
+  }
 
-  double_conversion::StringBuilder builder(buffer, buffer_size);
-  bool status = converter.ToShortest(d, &builder);
-  ASSERT(status);
-  char* result = builder.Finalize();
-  ASSERT(result == buffer);
+  // Produces the same output as the shortest mode of the double-conversion
+  // library with the flags EMIT_POSITIVE_EXPONENT_SIGN,
+  // EMIT_TRAILING_DECIMAL_POINT and EMIT_TRAILING_ZERO_AFTER_POINT.
+  uint64_t significand;
+  int exponent;
+  if (d == 0.0) {
+    significand = 0;
+    exponent = 0;
+  } else if ((d < 9007199254740992.0) && (d == floor(d))) {
+    // Integers below 2^53 are their own shortest representation.
+    significand = static_cast<uint64_t>(d);
+    exponent = 0;
+  } else {
+    FastDoubleConversion::ShortestDecimal(d, &significand, &exponent);
+  }
+  while ((significand != 0) && ((significand % 10) == 0)) {
+    significand /= 10;
+    exponent++;
+  }
+  char digits[20];
+  const int length = WriteDigits(significand, digits);
+  const int decimal_point = length + exponent;
+  if ((kDecimalLow < decimal_point) && (decimal_point <= kDecimalHigh)) {
+    if (decimal_point <= 0) {
+      *current++ = '0';
+      *current++ = '.';
+      for (int i = decimal_point; i < 0; i++) {
+        *current++ = '0';
+      }
+      memmove(current, digits, length);
+      current += length;
+    } else if (decimal_point >= length) {
+      memmove(current, digits, length);
+      current += length;
+      for (int i = length; i < decimal_point; i++) {
+        *current++ = '0';
+      }
+      *current++ = '.';
+      *current++ = '0';
+    } else {
+      memmove(current, digits, decimal_point);
+      current += decimal_point;
+      *current++ = '.';
+      memmove(current, &digits[decimal_point], length - decimal_point);
+      current += length - decimal_point;
+    }
+  } else {
+    *current++ = digits[0];
+    if (length > 1) {
+      *current++ = '.';
+      memmove(current, &digits[1], length - 1);
+      current += length - 1;
+    }
+    *current++ = kDoubleToStringCommonExponentChar;
+    int decimal_exponent = decimal_point - 1;
+    if (decimal_exponent < 0) {
+      *current++ = '-';
+      decimal_exponent = -decimal_exponent;
+    } else {
+      *current++ = '+';
+    }
+    current += WriteDigits(decimal_exponent, current);
+  }
+  ASSERT(current < buffer + buffer_size);
+  *current = '\0';
 }
 
 RawString* DoubleToStringAsFixed(double d, int fraction_digits) {
@@ -172,6 +249,10 @@ bool CStringToDouble(const char* str, intptr_t length, double* result) {
     return false;
   }
 
+  if (FastDoubleConversion::StringToDouble(str, length, result)) {
+    return true;
+  }
+
   double_conversion::StringToDoubleConverter converter(
     double_conversion::StringToDoubleConverter::NO_FLAGS,
     0.0,
@@ -0,0 +1,455 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/fast_double_conversion.h"
+
+#include "platform/utils.h"
+
+namespace dart {
+
+static const int kMantissaBits = 52;
+static const int kExponentBits = 11;
+static const int kExponentBias = 1023;
+static const uint64_t kMantissaMask =
+    (DART_UINT64_C(1) << kMantissaBits) - 1;
+static const int kPow5Bits = 125;
+
+
+// Returns the low 64 bits of the product and stores the high 64 bits in
+// 'high'.
+static inline uint64_t Multiply128(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(ARCH_IS_64_BIT) && defined(__SIZEOF_INT128__)
+  const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+  *high = static_cast<uint64_t>(product >> 64);
+  return static_cast<uint64_t>(product);
+#else
+  const uint64_t a_low = a & 0xffffffff;
+  const uint64_t a_high = a >> 32;
+  const uint64_t b_low = b & 0xffffffff;
+  const uint64_t b_high = b >> 32;
+  const uint64_t low_low = a_low * b_low;
+  const uint64_t low_high = a_low * b_high;
+  const uint64_t high_low = a_high * b_low;
+  const uint64_t high_high = a_high * b_high;
+  const uint64_t middle =
+      (low_low >> 32) + (low_high & 0xffffffff) + (high_low & 0xffffffff);
+  *high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+  return (middle << 32) | (low_low & 0xffffffff);
+#endif
+}
+
+
+static inline int CountLeadingZeros64(uint64_t x) {
+  ASSERT(x != 0);
+#if defined(ARCH_IS_64_BIT)
+  return Utils::CountLeadingZeros(static_cast<uword>(x));
+#else
+  const uint32_t high = static_cast<uint32_t>(x >> 32);
+  if (high != 0) {
+    return Utils::CountLeadingZeros(high);
+  }
+  return 32 + Utils::CountLeadingZeros(static_cast<uint32_t>(x));
+#endif
+}
+
+
+// Ryu, see Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018.
+
+// Returns ceil(log2(5^e)) for 1 <= e <= 3528, and 1 for e == 0.
+static inline int32_t Pow5Bits(int32_t e) {
+  return static_cast<int32_t>(((static_cast<uint32_t>(e) * 1217359) >> 19) + 1);
+}
+
+
+// Returns floor(log10(2^e)) for 0 <= e <= 1650.
+static inline int32_t Log10Pow2(int32_t e) {
+  return static_cast<int32_t>((static_cast<uint32_t>(e) * 78913) >> 18);
+}
+
+
+// Returns floor(log10(5^e)) for 0 <= e <= 2620.
+static inline int32_t Log10Pow5(int32_t e) {
+  return static_cast<int32_t>((static_cast<uint32_t>(e) * 732923) >> 20);
+}
+
+
+static inline bool MultipleOfPowerOf5(uint64_t value, int32_t p) {
+  int32_t count = 0;
+  while ((value % 5) == 0) {
+    value /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+
+static inline bool MultipleOfPowerOf2(uint64_t value, int32_t p) {
+  return (value & ((DART_UINT64_C(1) << p) - 1)) == 0;
+}
+
+
+// Returns (m * mul) >> j for the 128-bit number 'mul' and j >= 64.
+static inline uint64_t MulShift(uint64_t m, const uint64_t* mul, int32_t j) {
+  ASSERT(j >= 64);
+  uint64_t high0;
+  Multiply128(m, mul[0], &high0);
+  uint64_t high1;
+  const uint64_t low1 = Multiply128(m, mul[1], &high1);
+  const uint64_t sum = low1 + high0;
+  if (sum < high0) {
+    high1++;
+  }
+  const int32_t shift = j - 64;
+  if (shift == 0) {
+    return sum;
+  }
+  if (shift >= 64) {
+    return high1 >> (shift - 64);
+  }
+  return (high1 << (64 - shift)) | (sum >> shift);
+}
+
+
+void FastDoubleConversion::ShortestDecimal(double d,
+                                           uint64_t* digits,
+                                           int* exponent) {
+  const uint64_t bits = bit_cast<uint64_t>(d);
+  const uint64_t ieee_mantissa = bits & kMantissaMask;
+  const int32_t ieee_exponent = static_cast<int32_t>(bits >> kMantissaBits);
+  ASSERT((ieee_exponent >> kExponentBits) == 0);  // Positive.
+  ASSERT(ieee_exponent != (1 << kExponentBits) - 1);  // Finite.
+  ASSERT((ieee_exponent != 0) || (ieee_mantissa != 0));  // Not zero.
+
+  // The value is m2 * 2^e2, with two more bits of precision for the
+  // boundaries.
+  int32_t e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kExponentBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = ieee_exponent - kExponentBias - kMantissaBits - 2;
+    m2 = (DART_UINT64_C(1) << kMantissaBits) | ieee_mantissa;
+  }
+  // Round to even: the boundaries read back as 'd' if the mantissa is even.
+  const bool accept_bounds = (m2 & 1) == 0;
+
+  // The halfway points to the neighbouring doubles are mv - 1 - mm_shift
+  // and mv + 2. The lower one is closer at powers of two.
+  const uint64_t mv = 4 * m2;
+  const uint32_t mm_shift = ((ieee_mantissa != 0) || (ieee_exponent <= 1))
+      ? 1 : 0;
+
+  // Convert the interval to a decimal exponent e10.
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    const int32_t q = Log10Pow2(e2) - ((e2 > 3) ? 1 : 0);
+    e10 = q;
+    const int32_t k = kPow5Bits + Pow5Bits(q) - 1;
+    const int32_t i = -e2 + q + k;
+    const uint64_t* mul = kPow5InvSplit[q];
+    vr = MulShift(4 * m2, mul, i);
+    vp = MulShift(4 * m2 + 2, mul, i);
+    vm = MulShift(4 * m2 - 1 - mm_shift, mul, i);
+    if (q <= 21) {
+      // Only one of mp, mv and mm can be a multiple of 5, if any.
+      if ((mv % 5) == 0) {
+        vr_is_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = MultipleOfPowerOf5(mv - 1 - mm_shift, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+      }
+    }
+  } else {
+    const int32_t q = Log10Pow5(-e2) - ((-e2 > 1) ? 1 : 0);
+    e10 = q + e2;
+    const int32_t i = -e2 - q;
+    const int32_t k = Pow5Bits(i) - kPow5Bits;
+    const int32_t j = q - k;
+    const uint64_t* mul = kPow5Split[i];
+    vr = MulShift(4 * m2, mul, j);
+    vp = MulShift(4 * m2 + 2, mul, j);
+    vm = MulShift(4 * m2 - 1 - mm_shift, mul, j);
+    if (q <= 1) {
+      // mv has at least q trailing zero bits.
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        vp--;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Remove digits while the interval still contains a shorter number.
+  int32_t removed = 0;
+  uint64_t output;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    // The rare case where the exact values of the boundaries or of 'd'
+    // matter for the rounding.
+    uint32_t last_removed_digit = 0;
+    while ((vp / 10) > (vm / 10)) {
+      vm_is_trailing_zeros &= (vm % 10) == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<uint32_t>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    if (vm_is_trailing_zeros) {
+      while ((vm % 10) == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<uint32_t>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+      }
+    }
+    if (vr_is_trailing_zeros && (last_removed_digit == 5) && ((vr % 2) == 0)) {
+      // Round half to even.
+      last_removed_digit = 4;
+    }
+    const bool round_up =
+        ((vr == vm) && (!accept_bounds || !vm_is_trailing_zeros)) ||
+        (last_removed_digit >= 5);
+    output = vr + (round_up ? 1 : 0);
+  } else {
+    bool round_up = false;
+    if ((vp / 100) > (vm / 100)) {
+      // Remove two digits at a time first.
+      round_up = (vr % 100) >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while ((vp / 10) > (vm / 10)) {
+      round_up = (vr % 10) >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    output = vr + (((vr == vm) || round_up) ? 1 : 0);
+  }
+  *digits = output;
+  *exponent = e10 + removed;
+}
+
+
+// Eisel-Lemire, see Daniel Lemire, "Number Parsing at a Gigabyte per
+// Second", Software: Practice and Experience 51(8), 2021.
+bool FastDoubleConversion::EiselLemire(uint64_t w, int64_t q, double* result) {
+  ASSERT(w != 0);
+  if (q < kMinPow5Exponent) {
+    // w * 10^q < 2^64 * 10^-343 is below half of the smallest denormal.
+    *result = 0.0;
+    return true;
+  }
+  if (q > kMaxPow5Exponent) {
+    *result = kPosInfinity;
+    return true;
+  }
+  const int lz = CountLeadingZeros64(w);
+  w <<= lz;
+  // Approximate the normalized product of w and 5^q, which has the same
+  // significant bits as w * 10^q.
+  const uint64_t* pow5 = kPow5Significands[q - kMinPow5Exponent];
+  uint64_t high;
+  uint64_t low = Multiply128(w, pow5[1], &high);
+  // The 55 most significant bits are needed to round to 53 bits. If the
+  // bits below them are all ones, the truncated part of the power of five
+  // may carry into them.
+  const uint64_t kPrecisionMask = kMaxUint64 >> 55;
+  if ((high & kPrecisionMask) == kPrecisionMask) {
+    uint64_t second_high;
+    Multiply128(w, pow5[0], &second_high);
+    low += second_high;
+    if (second_high > low) {
+      high++;
+    }
+    if (((high & kPrecisionMask) == kPrecisionMask) && (low == kMaxUint64)) {
+      return false;
+    }
+  }
+  const int upper_bit = static_cast<int>(high >> 63);
+  const int shift = upper_bit + 64 - kMantissaBits - 3;
+  uint64_t mantissa = high >> shift;
+  // floor(q * log2(10)) + 63 is the binary exponent of the product.
+  int32_t power2 = static_cast<int32_t>(((217706 * q) >> 16) + 63) +
+      upper_bit - lz + kExponentBias;
+  if (power2 <= 0) {
+    // Denormal.
+    if ((-power2 + 1) >= 64) {
+      *result = 0.0;
+      return true;
+    }
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    // Rounding up may give the smallest normal number.
+    power2 = (mantissa < (DART_UINT64_C(1) << kMantissaBits)) ? 0 : 1;
+    *result = bit_cast<double>(
+        (mantissa & kMantissaMask) |
+        (static_cast<uint64_t>(power2) << kMantissaBits));
+    return true;
+  }
+  // Halfway cases round to even instead of up. They can only occur when
+  // the product is exact, which requires -4 <= q <= 23.
+  if ((low <= 1) && (q >= -4) && (q <= 23) && ((mantissa & 3) == 1) &&
+      ((mantissa << shift) == high)) {
+    mantissa &= ~DART_UINT64_C(1);
+  }
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >= (DART_UINT64_C(2) << kMantissaBits)) {
+    mantissa = DART_UINT64_C(1) << kMantissaBits;
+    power2++;
+  }
+  if (power2 >= (1 << kExponentBits) - 1) {
+    *result = kPosInfinity;
+    return true;
+  }
+  *result = bit_cast<double>(
+      (mantissa & kMantissaMask) |
+      (static_cast<uint64_t>(power2) << kMantissaBits));
+  return true;
+}
+
+
+// Doubles can represent the powers of ten up to 10^22 exactly.
+static const double kExactPowersOfTen[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+  1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// At most this many significant digits are read into a uint64_t.
+static const intptr_t kMaxSignificantDigits = 19;
+
+// Longer inputs are left to the slow path, so the decimal exponent cannot
+// overflow.
+static const intptr_t kMaxFastLength = 1 << 20;
+
+
+bool FastDoubleConversion::StringToDouble(const char* str,
+                                          intptr_t length,
+                                          double* result) {
+  if ((length == 0) || (length > kMaxFastLength)) {
+    return false;
+  }
+  const char* current = str;
+  const char* end = str + length;
+  bool negative = false;
+  if ((*current == '-') || (*current == '+')) {
+    negative = *current == '-';
+    current++;
+  }
+
+  // Read the digits into w * 10^q. Digits after the first 19 significant
+  // ones are dropped, which is recorded in 'truncated'.
+  uint64_t w = 0;
+  int64_t q = 0;
+  intptr_t num_digits = 0;
+  bool truncated = false;
+  const char* digits_start = current;
+  while ((current < end) && Utils::IsDecimalDigit(*current)) {
+    if (num_digits < kMaxSignificantDigits) {
+      w = (w * 10) + (*current - '0');
+      if (w != 0) {
+        num_digits++;
+      }
+    } else {
+      truncated |= *current != '0';
+      q++;
+    }
+    current++;
+  }
+  if (current == digits_start) {
+    return false;
+  }
+  if ((current < end) && (*current == '.')) {
+    current++;
+    const char* fraction_start = current;
+    while ((current < end) && Utils::IsDecimalDigit(*current)) {
+      if (num_digits < kMaxSignificantDigits) {
+        w = (w * 10) + (*current - '0');
+        if (w != 0) {
+          num_digits++;
+        }
+        q--;
+      } else {
+        truncated |= *current != '0';
+      }
+      current++;
+    }
+    if (current == fraction_start) {
+      return false;
+    }
+  }
+  if ((current < end) && ((*current == 'e') || (*current == 'E'))) {
+    current++;
+    bool negative_exponent = false;
+    if ((current < end) && ((*current == '-') || (*current == '+'))) {
+      negative_exponent = *current == '-';
+      current++;
+    }
+    const char* exponent_start = current;
+    int64_t exponent = 0;
+    while ((current < end) && Utils::IsDecimalDigit(*current)) {
+      if (exponent < kMaxFastLength) {
+        exponent = (exponent * 10) + (*current - '0');
+      }
+      current++;
+    }
+    if (current == exponent_start) {
+      return false;
+    }
+    q += negative_exponent ? -exponent : exponent;
+  }
+  if (current != end) {
+    return false;
+  }
+
+  double value;
+  if (w == 0) {
+    value = 0.0;
+#if !defined(HOST_ARCH_IA32)
+    // The x87 unit may round twice, so ia32 only uses Eisel-Lemire.
+  } else if (!truncated &&
+             (w <= (DART_UINT64_C(1) << 53)) &&
+             (q >= -22) && (q <= 22)) {
+    // Both w and 10^|q| are exact, so the single rounding of the
+    // multiplication or division gives the correctly rounded result.
+    value = static_cast<double>(w);
+    if (q < 0) {
+      value /= kExactPowersOfTen[-q];
+    } else {
+      value *= kExactPowersOfTen[q];
+    }
+#endif
+  } else {
+    if (!EiselLemire(w, q, &value)) {
+      return false;
+    }
+    if (truncated) {
+      // The exact value lies between w * 10^q and (w + 1) * 10^q.
+      double upper;
+      if (!EiselLemire(w + 1, q, &upper) || (upper != value)) {
+        return false;
+      }
+    }
+  }
+  *result = negative ? -value : value;
+  return true;
+}
+
+}  // namespace dart
@@ -0,0 +1,48 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef VM_FAST_DOUBLE_CONVERSION_H_
+#define VM_FAST_DOUBLE_CONVERSION_H_
+
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+// Conversions between doubles and decimal numbers used by the common cases
+// of double.toString and double.parse. The general case is handled by the
+// double-conversion library (see double_conversion.cc).
+class FastDoubleConversion : public AllStatic {
+ public:
+  // Computes the shortest decimal number digits * 10^exponent that reads
+  // back as 'd' with the Ryu algorithm. If several numbers of that length
+  // exist, the one closest to 'd' is returned. 'd' must be finite and
+  // positive.
+  static void ShortestDecimal(double d, uint64_t* digits, int* exponent);
+
+  // Parses a decimal number of the form [+-]digits[.digits][(e|E)[+-]digits]
+  // into the correctly rounded double with the Clinger fast path or the
+  // Eisel-Lemire algorithm. Returns false if 'str' has a different form or
+  // the algorithms cannot decide the rounding, in which case the caller must
+  // fall back to a general conversion.
+  static bool StringToDouble(const char* str, intptr_t length, double* result);
+
+ private:
+  // Tables of 128-bit numbers stored as {low, high} words, see
+  // fast_double_conversion_data.cc.
+  static const int kPow5InvSplitSize = 342;
+  static const uint64_t kPow5InvSplit[kPow5InvSplitSize][2];
+  static const int kPow5SplitSize = 326;
+  static const uint64_t kPow5Split[kPow5SplitSize][2];
+  static const int kMinPow5Exponent = -342;
+  static const int kMaxPow5Exponent = 308;
+  static const uint64_t
+      kPow5Significands[kMaxPow5Exponent - kMinPow5Exponent + 1][2];
+
+  static bool EiselLemire(uint64_t w, int64_t q, double* result);
+};
+
+}  // namespace dart
+
+#endif  // VM_FAST_DOUBLE_CONVERSION_H_
@@ -0,0 +1,1344 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/fast_double_conversion.h"
+
+namespace dart {
+
+// floor(2^(bitlength(5^q) - 1 + 125) / 5^q) + 1 for 0 <= q < 342.
+const uint64_t FastDoubleConversion::kPow5InvSplit[kPow5InvSplitSize][2] = {
+  { DART_UINT64_C(0x0000000000000001), DART_UINT64_C(0x2000000000000000) },
+  { DART_UINT64_C(0x999999999999999a), DART_UINT64_C(0x1999999999999999) },
+  { DART_UINT64_C(0x47ae147ae147ae15), DART_UINT64_C(0x147ae147ae147ae1) },
+  { DART_UINT64_C(0x6c8b4395810624de), DART_UINT64_C(0x10624dd2f1a9fbe7) },
+  { DART_UINT64_C(0x7a786c226809d496), DART_UINT64_C(0x1a36e2eb1c432ca5) },
+  { DART_UINT64_C(0x61f9f01b866e43ab), DART_UINT64_C(0x14f8b588e368f084) },
+  { DART_UINT64_C(0xb4c7f34938583622), DART_UINT64_C(0x10c6f7a0b5ed8d36) },
+  { DART_UINT64_C(0x87a6520ec08d236a), DART_UINT64_C(0x1ad7f29abcaf4857) },
+  { DART_UINT64_C(0x9fb841a566d74f88), DART_UINT64_C(0x15798ee2308c39df) },
+  { DART_UINT64_C(0xe62d01511f12a607), DART_UINT64_C(0x112e0be826d694b2) },
+  { DART_UINT64_C(0xd6ae6881cb5109a4), DART_UINT64_C(0x1b7cdfd9d7bdbab7) },
+  { DART_UINT64_C(0xdef1ed34a2a73aea), DART_UINT64_C(0x15fd7fe17964955f) },
+  { DART_UINT64_C(0x7f27f0f6e885c8bb), DART_UINT64_C(0x119799812dea1119) },
+  { DART_UINT64_C(0x650cb4be40d60df8), DART_UINT64_C(0x1c25c268497681c2) },
+  { DART_UINT64_C(0xea70909833de7193), DART_UINT64_C(0x16849b86a12b9b01) },
+  { DART_UINT64_C(0x21f3a6e0297ec143), DART_UINT64_C(0x1203af9ee756159b) },
+  { DART_UINT64_C(0x6985d7cd0f313537), DART_UINT64_C(0x1cd2b297d889bc2b) },
+  { DART_UINT64_C(0x2137dfd73f5a90f9), DART_UINT64_C(0x170ef54646d49689) },
+  { DART_UINT64_C(0xe75fe645cc4873fa), DART_UINT64_C(0x12725dd1d243aba0) },
+  { DART_UINT64_C(0xa5663d3c7a0d865d), DART_UINT64_C(0x1d83c94fb6d2ac34) },
+  { DART_UINT64_C(0x511e976394d79eb1), DART_UINT64_C(0x179ca10c9242235d) },
+  { DART_UINT64_C(0xda7edf82dd794bc1), DART_UINT64_C(0x12e3b40a0e9b4f7d) },
+  { DART_UINT64_C(0x2a6498d1625bac68), DART_UINT64_C(0x1e392010175ee596) },
+  { DART_UINT64_C(0xeeb6e0a781e2f053), DART_UINT64_C(0x182db34012b25144) },
+  { DART_UINT64_C(0x58924d52ce4f26a9), DART_UINT64_C(0x1357c299a88ea76a) },
+  { DART_UINT64_C(0x27507bb7b07ea441), DART_UINT64_C(0x1ef2d0f5da7dd8aa) },
+  { DART_UINT64_C(0x52a6c95fc0655034), DART_UINT64_C(0x18c240c4aecb13bb) },
+  { DART_UINT64_C(0x0eebd44c99eaa690), DART_UINT64_C(0x13ce9a36f23c0fc9) },
+  { DART_UINT64_C(0xb17953adc3110a80), DART_UINT64_C(0x1fb0f6be50601941) },
+  { DART_UINT64_C(0xc12ddc8b02740867), DART_UINT64_C(0x195a5efea6b34767) },
+  { DART_UINT64_C(0x3424b06f3529a052), DART_UINT64_C(0x14484bfeebc29f86) },
+  { DART_UINT64_C(0x901d59f290ee19db), DART_UINT64_C(0x1039d66589687f9e) },
+  { DART_UINT64_C(0x4cfbc31db4b0295f), DART_UINT64_C(0x19f623d5a8a73297) },
+  { DART_UINT64_C(0x3d9635b15d59bab2), DART_UINT64_C(0x14c4e977ba1f5bac) },
+  { DART_UINT64_C(0x97ab5e277de16228), DART_UINT64_C(0x109d8792fb4c4956) },
+  { DART_UINT64_C(0xf2abc9d8c9689d0d), DART_UINT64_C(0x1a95a5b7f87a0ef0) },
+  { DART_UINT64_C(0x5bbca17a3aba173e), DART_UINT64_C(0x154484932d2e725a) },
+  { DART_UINT64_C(0xafca1ac82efb45cb), DART_UINT64_C(0x11039d428a8b8eae) },
+  { DART_UINT64_C(0xb2dcf7a6b1920945), DART_UINT64_C(0x1b38fb9daa78e44a) },
+  { DART_UINT64_C(0xf57d92ebc141a104), DART_UINT64_C(0x15c72fb1552d836e) },
+  { DART_UINT64_C(0xc46475896767b403), DART_UINT64_C(0x116c262777579c58) },
+  { DART_UINT64_C(0x6d6d88dbd8a5ecd2), DART_UINT64_C(0x1be03d0bf225c6f4) },
+  { DART_UINT64_C(0x8abe071646eb23db), DART_UINT64_C(0x164cfda3281e38c3) },
+  { DART_UINT64_C(0x6efe6c11d255b649), DART_UINT64_C(0x11d7314f534b609c) },
+  { DART_UINT64_C(0xb197134fb6ef8a0e), DART_UINT64_C(0x1c8b821885456760) },
+  { DART_UINT64_C(0x27ac0f72f8bfa1a5), DART_UINT64_C(0x16d601ad376ab91a) },
+  { DART_UINT64_C(0xb95672c260994e1e), DART_UINT64_C(0x1244ce242c5560e1) },
+  { DART_UINT64_C(0xf5571e03cdc21695), DART_UINT64_C(0x1d3ae36d13bbce35) },
+  { DART_UINT64_C(0x2aac18030b01abab), DART_UINT64_C(0x17624f8a762fd82b) },
+  { DART_UINT64_C(0xbbbce0026f348956), DART_UINT64_C(0x12b50c6ec4f31355) },
+  { DART_UINT64_C(0x92c7ccd0b1eda889), DART_UINT64_C(0x1dee7a4ad4b81eef) },
+  { DART_UINT64_C(0xdbd30a408e57ba07), DART_UINT64_C(0x17f1fb6f10934bf2) },
+  { DART_UINT64_C(0x7ca8d50071dfc806), DART_UINT64_C(0x1327fc58da0f6ff5) },
+  { DART_UINT64_C(0xfaa7bb33e9660cd6), DART_UINT64_C(0x1ea6608e29b24cbb) },
+  { DART_UINT64_C(0x9552fc298784d711), DART_UINT64_C(0x18851a0b548ea3c9) },
+  { DART_UINT64_C(0xaaa8c9bad2d0ac0e), DART_UINT64_C(0x139dae6f76d88307) },
+  { DART_UINT64_C(0xdddadc5e1e1aace3), DART_UINT64_C(0x1f62b0b257c0d1a5) },
+  { DART_UINT64_C(0x7e48b04b4b488a4f), DART_UINT64_C(0x191bc08eac9a4151) },
+  { DART_UINT64_C(0xcb6d59d5d5d3a1d9), DART_UINT64_C(0x141633a556e1cdda) },
+  { DART_UINT64_C(0x3c577b1177dc817b), DART_UINT64_C(0x1011c2eaabe7d7e2) },
+  { DART_UINT64_C(0xc6f25e825960cf2a), DART_UINT64_C(0x19b604aaaca62636) },
+  { DART_UINT64_C(0x6bf518684780a5bb), DART_UINT64_C(0x14919d5556eb51c5) },
+  { DART_UINT64_C(0x232a79ed06008496), DART_UINT64_C(0x10747ddddf22a7d1) },
+  { DART_UINT64_C(0xd1dd8fe1a3340756), DART_UINT64_C(0x1a53fc9631d10c81) },
+  { DART_UINT64_C(0xa7e4731ae8f66c45), DART_UINT64_C(0x150ffd44f4a73d34) },
+  { DART_UINT64_C(0x531d28e253f8569e), DART_UINT64_C(0x10d9976a5d52975d) },
+  { DART_UINT64_C(0xeb61db03b98d5762), DART_UINT64_C(0x1af5bf109550f22e) },
+  { DART_UINT64_C(0xbc4e48cfc7a445e8), DART_UINT64_C(0x159165a6ddda5b58) },
+  { DART_UINT64_C(0x6371d3d96c836b20), DART_UINT64_C(0x11411e1f17e1e2ad) },
+  { DART_UINT64_C(0x9f1c8628ad9f11cd), DART_UINT64_C(0x1b9b6364f3030448) },
+  { DART_UINT64_C(0xe5b06b53be18db0b), DART_UINT64_C(0x1615e91d8f359d06) },
+  { DART_UINT64_C(0xeaf3890fcb4715a2), DART_UINT64_C(0x11ab20e472914a6b) },
+  { DART_UINT64_C(0x44b8db4c7871bc37), DART_UINT64_C(0x1c45016d841baa46) },
+  { DART_UINT64_C(0x03c715d6c6c1635f), DART_UINT64_C(0x169d9abe03495505) },
+  { DART_UINT64_C(0x3638de456bcde919), DART_UINT64_C(0x1217aefe69077737) },
+  { DART_UINT64_C(0x56c163a2461641c1), DART_UINT64_C(0x1cf2b1970e725858) },
+  { DART_UINT64_C(0xdf011c81d1ab67ce), DART_UINT64_C(0x17288e1271f51379) },
+  { DART_UINT64_C(0x7f3416ce4155eca5), DART_UINT64_C(0x1286d80ec190dc61) },
+  { DART_UINT64_C(0x6520247d3556476e), DART_UINT64_C(0x1da48ce468e7c702) },
+  { DART_UINT64_C(0xea801d30f7783925), DART_UINT64_C(0x17b6d71d20b96c01) },
+  { DART_UINT64_C(0xbb99b0f3f92cfa84), DART_UINT64_C(0x12f8ac174d612334) },
+  { DART_UINT64_C(0x5f5c4e532847f739), DART_UINT64_C(0x1e5aacf215683854) },
+  { DART_UINT64_C(0x7f7d0b75b9d32c2e), DART_UINT64_C(0x18488a5b44536043) },
+  { DART_UINT64_C(0x9930d5f7c7dc2358), DART_UINT64_C(0x136d3b7c36a919cf) },
+  { DART_UINT64_C(0x8eb4898c72f9d226), DART_UINT64_C(0x1f152bf9f10e8fb2) },
+  { DART_UINT64_C(0x722a07a38f2e41b8), DART_UINT64_C(0x18ddbcc7f40ba628) },
+  { DART_UINT64_C(0xc1bb394fa5be9afa), DART_UINT64_C(0x13e497065cd61e86) },
+  { DART_UINT64_C(0x9c5ec2190930f7f6), DART_UINT64_C(0x1fd424d6faf030d7) },
+  { DART_UINT64_C(0x49e56814075a5ff8), DART_UINT64_C(0x197683df2f268d79) },
+  { DART_UINT64_C(0x6e51201005e1e660), DART_UINT64_C(0x145ecfe5bf520ac7) },
+  { DART_UINT64_C(0xf1da800cd181851a), DART_UINT64_C(0x104bd984990e6f05) },
+  { DART_UINT64_C(0x4fc400148268d4f5), DART_UINT64_C(0x1a12f5a0f4e3e4d6) },
+  { DART_UINT64_C(0xd96999aa01ed772b), DART_UINT64_C(0x14dbf7b3f71cb711) },
+  { DART_UINT64_C(0xadee1488018ac5bc), DART_UINT64_C(0x10aff95cc5b09274) },
+  { DART_UINT64_C(0x497ceda668de092c), DART_UINT64_C(0x1ab328946f80ea54) },
+  { DART_UINT64_C(0x3aca57b853e4d424), DART_UINT64_C(0x155c2076bf9a5510) },
+  { DART_UINT64_C(0x623b7960431d7683), DART_UINT64_C(0x1116805effaeaa73) },
+  { DART_UINT64_C(0x9d2bf566d1c8bd9e), DART_UINT64_C(0x1b5733cb32b110b8) },
+  { DART_UINT64_C(0x7dbcc452416d647f), DART_UINT64_C(0x15df5ca28ef40d60) },
+  { DART_UINT64_C(0xcafd69db678ab6cc), DART_UINT64_C(0x117f7d4ed8c33de6) },
+  { DART_UINT64_C(0xab2f0fc572778adf), DART_UINT64_C(0x1bff2ee48e052fd7) },
+  { DART_UINT64_C(0x88f273045b92d580), DART_UINT64_C(0x1665bf1d3e6a8cac) },
+  { DART_UINT64_C(0xd3f528d049424466), DART_UINT64_C(0x11eaff4a98553d56) },
+  { DART_UINT64_C(0xb988414d4203a0a3), DART_UINT64_C(0x1cab3210f3bb9557) },
+  { DART_UINT64_C(0x6139cdd76802e6e9), DART_UINT64_C(0x16ef5b40c2fc7779) },
+  { DART_UINT64_C(0xe761717920025254), DART_UINT64_C(0x125915cd68c9f92d) },
+  { DART_UINT64_C(0xa568b58e999d5086), DART_UINT64_C(0x1d5b561574765b7c) },
+  { DART_UINT64_C(0x5120913ee14aa6d2), DART_UINT64_C(0x177c44ddf6c515fd) },
+  { DART_UINT64_C(0xa74d40ff1aa21f0e), DART_UINT64_C(0x12c9d0b1923744ca) },
+  { DART_UINT64_C(0x0baece64f769cb4a), DART_UINT64_C(0x1e0fb44f50586e11) },
+  { DART_UINT64_C(0x3c8bd850c5ee3c3b), DART_UINT64_C(0x180c903f7379f1a7) },
+  { DART_UINT64_C(0xca0979da37f1c9c9), DART_UINT64_C(0x133d4032c2c7f485) },
+  { DART_UINT64_C(0xa9a8c2f6bfe942db), DART_UINT64_C(0x1ec866b79e0cba6f) },
+  { DART_UINT64_C(0x2153cf2bccba9be3), DART_UINT64_C(0x18a0522c7e709526) },
+  { DART_UINT64_C(0x1aa9728970954982), DART_UINT64_C(0x13b374f06526ddb8) },
+  { DART_UINT64_C(0xf775840f1a88759d), DART_UINT64_C(0x1f8587e7083e2f8c) },
+  { DART_UINT64_C(0x5f9136727ba05e17), DART_UINT64_C(0x19379fec0698260a) },
+  { DART_UINT64_C(0x1940f85b9619e4df), DART_UINT64_C(0x142c7ff0054684d5) },
+  { DART_UINT64_C(0xe100c6afab47ea4c), DART_UINT64_C(0x1023998cd1053710) },
+  { DART_UINT64_C(0xce67a44c453fdd47), DART_UINT64_C(0x19d28f47b4d524e7) },
+  { DART_UINT64_C(0xd852e9d69dccb106), DART_UINT64_C(0x14a8729fc3ddb71f) },
+  { DART_UINT64_C(0x79dbee454b0a2738), DART_UINT64_C(0x1086c219697e2c19) },
+  { DART_UINT64_C(0x295fe3a211a9d859), DART_UINT64_C(0x1a71368f0f30468f) },
+  { DART_UINT64_C(0xbab31c81a7bb137a), DART_UINT64_C(0x15275ed8d8f36ba5) },
+  { DART_UINT64_C(0x6228e39aec95a92f), DART_UINT64_C(0x10ec4be0ad8f8951) },
+  { DART_UINT64_C(0x9d0e38f7e0ef7517), DART_UINT64_C(0x1b13ac9aaf4c0ee8) },
+  { DART_UINT64_C(0xb0d82d931a592a79), DART_UINT64_C(0x15a956e225d67253) },
+  { DART_UINT64_C(0x8d79be0f4847552e), DART_UINT64_C(0x11544581b7dec1dc) },
+  { DART_UINT64_C(0x158f967eda0bbb7c), DART_UINT64_C(0x1bba08cf8c979c94) },
+  { DART_UINT64_C(0x77a611ff14d62f97), DART_UINT64_C(0x162e6d72d6dfb076) },
+  { DART_UINT64_C(0xf951a7ff43de8c79), DART_UINT64_C(0x11bebdf578b2f391) },
+  { DART_UINT64_C(0xc21c3ffed2fdad8e), DART_UINT64_C(0x1c6463225ab7ec1c) },
+  { DART_UINT64_C(0x01b0333242648ad8), DART_UINT64_C(0x16b6b5b5155ff017) },
+  { DART_UINT64_C(0x0159c28e9b83a246), DART_UINT64_C(0x122bc490dde659ac) },
+  { DART_UINT64_C(0xcef604175f3903a3), DART_UINT64_C(0x1d12d41afca3c2ac) },
+  { DART_UINT64_C(0x725e69ac4c2d9c83), DART_UINT64_C(0x17424348ca1c9bbd) },
+  { DART_UINT64_C(0xf5185489d68ae39c), DART_UINT64_C(0x129b69070816e2fd) },
+  { DART_UINT64_C(0xee8d540fbdab05c6), DART_UINT64_C(0x1dc574d80cf16b2f) },
+  { DART_UINT64_C(0xbed77672fe226b05), DART_UINT64_C(0x17d12a4670c1228c) },
+  { DART_UINT64_C(0xff12c528cb4ebc04), DART_UINT64_C(0x130dbb6b8d674ed6) },
+  { DART_UINT64_C(0xcb513b74787df9a0), DART_UINT64_C(0x1e7c5f127bd87e24) },
+  { DART_UINT64_C(0x090dc929f9fe614d), DART_UINT64_C(0x18637f41fcad31b7) },
+  { DART_UINT64_C(0xa0d7d42194cb810a), DART_UINT64_C(0x1382cc34ca2427c5) },
+  { DART_UINT64_C(0x67bfb9cf5478ce77), DART_UINT64_C(0x1f37ad21436d0c6f) },
+  { DART_UINT64_C(0x1fcc94a5dd2d71f9), DART_UINT64_C(0x18f9574dcf8a7059) },
+  { DART_UINT64_C(0x7fd6dd517dbdf4c7), DART_UINT64_C(0x13faac3e3fa1f37a) },
+  { DART_UINT64_C(0xffbe2ee8c92fee0b), DART_UINT64_C(0x1ff779fd329cb8c3) },
+  { DART_UINT64_C(0x6631bf20a0f324d6), DART_UINT64_C(0x1992c7fdc216fa36) },
+  { DART_UINT64_C(0xb827cc1a1a5c1d78), DART_UINT64_C(0x14756ccb01abfb5e) },
+  { DART_UINT64_C(0x935309ae7b7ce460), DART_UINT64_C(0x105df0a267bcc918) },
+  { DART_UINT64_C(0x1eeb42b0c594a099), DART_UINT64_C(0x1a2fe76a3f9474f4) },
+  { DART_UINT64_C(0xe58902270476e6e1), DART_UINT64_C(0x14f31f8832dd2a5c) },
+  { DART_UINT64_C(0xb7a0ce859d2bebe7), DART_UINT64_C(0x10c27fa028b0eeb0) },
+  { DART_UINT64_C(0x59014a6f61dfdfd8), DART_UINT64_C(0x1ad0cc33744e4ab4) },
+  { DART_UINT64_C(0xe0cdd525e7e64cad), DART_UINT64_C(0x1573d68f903ea229) },
+  { DART_UINT64_C(0x4d7177518651d6f1), DART_UINT64_C(0x11297872d9cbb4ee) },
+  { DART_UINT64_C(0x7be8bee8d6e957e8), DART_UINT64_C(0x1b758d848fac54b0) },
+  { DART_UINT64_C(0xfcba3253df211320), DART_UINT64_C(0x15f7a46a0c89dd59) },
+  { DART_UINT64_C(0x63c8284318e74280), DART_UINT64_C(0x1192e9ee706e4aae) },
+  { DART_UINT64_C(0x060d0d3827d86a66), DART_UINT64_C(0x1c1e43171a4a1117) },
+  { DART_UINT64_C(0x6b3da42cecad21eb), DART_UINT64_C(0x167e9c127b6e7412) },
+  { DART_UINT64_C(0x88fe1cf0bd574e56), DART_UINT64_C(0x11fee341fc585cdb) },
+  { DART_UINT64_C(0x419694b462254a23), DART_UINT64_C(0x1ccb0536608d615f) },
+  { DART_UINT64_C(0x67abaa29e81dd4e9), DART_UINT64_C(0x1708d0f84d3de77f) },
+  { DART_UINT64_C(0xb95621bb2017dd87), DART_UINT64_C(0x126d73f9d764b932) },
+  { DART_UINT64_C(0xc223692b668c95a5), DART_UINT64_C(0x1d7becc2f23ac1ea) },
+  { DART_UINT64_C(0xce82ba891ed6de1d), DART_UINT64_C(0x179657025b6234bb) },
+  { DART_UINT64_C(0xa53562074bdf1818), DART_UINT64_C(0x12deac01e2b4f6fc) },
+  { DART_UINT64_C(0x3b889cd87964f359), DART_UINT64_C(0x1e3113363787f194) },
+  { DART_UINT64_C(0xfc6d4a46c783f5e1), DART_UINT64_C(0x18274291c6065adc) },
+  { DART_UINT64_C(0x30576e9f06032b1a), DART_UINT64_C(0x13529ba7d19eaf17) },
+  { DART_UINT64_C(0x1a257dcb3cd1de90), DART_UINT64_C(0x1eea92a61c311825) },
+  { DART_UINT64_C(0x481dfe3c30a7e540), DART_UINT64_C(0x18bba884e35a79b7) },
+  { DART_UINT64_C(0xd34b31c9c0865100), DART_UINT64_C(0x13c9539d82aec7c5) },
+  { DART_UINT64_C(0x5211e942cda3b4cd), DART_UINT64_C(0x1fa885c8d117a609) },
+  { DART_UINT64_C(0x74db21023e1c90a4), DART_UINT64_C(0x19539e3a40dfb807) },
+  { DART_UINT64_C(0xf715b401cb4a0d50), DART_UINT64_C(0x1442e4fb67196005) },
+  { DART_UINT64_C(0xf8de299b09080aa7), DART_UINT64_C(0x103583fc527ab337) },
+  { DART_UINT64_C(0x8e304291a80cddd7), DART_UINT64_C(0x19ef3993b72ab859) },
+  { DART_UINT64_C(0x3e8d020e200a4b13), DART_UINT64_C(0x14bf6142f8eef9e1) },
+  { DART_UINT64_C(0x653d9b3e80083c0f), DART_UINT64_C(0x10991a9bfa58c7e7) },
+  { DART_UINT64_C(0x6ec8f864000d2ce4), DART_UINT64_C(0x1a8e90f9908e0ca5) },
+  { DART_UINT64_C(0x8bd3f9e999a423ea), DART_UINT64_C(0x153eda614071a3b7) },
+  { DART_UINT64_C(0x3ca994bae1501cbb), DART_UINT64_C(0x10ff151a99f482f9) },
+  { DART_UINT64_C(0xc775bac49bb3612b), DART_UINT64_C(0x1b31bb5dc320d18e) },
+  { DART_UINT64_C(0xd2c4956a16291a89), DART_UINT64_C(0x15c162b168e70e0b) },
+  { DART_UINT64_C(0xdbd0778811ba7ba1), DART_UINT64_C(0x11678227871f3e6f) },
+  { DART_UINT64_C(0x2c80bf401c5d929b), DART_UINT64_C(0x1bd8d03f3e9863e6) },
+  { DART_UINT64_C(0xbd33cc3349e47549), DART_UINT64_C(0x16470cff6546b651) },
+  { DART_UINT64_C(0xca8fd68f6e505dd4), DART_UINT64_C(0x11d270cc51055ea7) },
+  { DART_UINT64_C(0x4419574be3b3c953), DART_UINT64_C(0x1c83e7ad4e6efdd9) },
+  { DART_UINT64_C(0x0347790982f63aa9), DART_UINT64_C(0x16cfec8aa52597e1) },
+  { DART_UINT64_C(0xcf6c60d468c4fbba), DART_UINT64_C(0x123ff06eea847980) },
+  { DART_UINT64_C(0xe57a34870e07f92a), DART_UINT64_C(0x1d331a4b10d3f59a) },
+  { DART_UINT64_C(0x512e906c0b399422), DART_UINT64_C(0x175c1508da432ae2) },
+  { DART_UINT64_C(0xda8ba6bcd5c7a9b5), DART_UINT64_C(0x12b010d3e1cf5581) },
+  { DART_UINT64_C(0x90df712e22d90f87), DART_UINT64_C(0x1de6815302e5559c) },
+  { DART_UINT64_C(0xda4c5a8b4f140c6c), DART_UINT64_C(0x17eb9aa8cf1dde16) },
+  { DART_UINT64_C(0xaea37ba2a5a9a38a), DART_UINT64_C(0x1322e220a5b17e78) },
+  { DART_UINT64_C(0x7dd25f6aa2a905a9), DART_UINT64_C(0x1e9e369aa2b59727) },
+  { DART_UINT64_C(0x97db7f888220d154), DART_UINT64_C(0x187e92154ef7ac1f) },
+  { DART_UINT64_C(0x797c6606ce80a777), DART_UINT64_C(0x139874ddd8c6234c) },
+  { DART_UINT64_C(0x8f2d700ae4010bf1), DART_UINT64_C(0x1f5a549627a36bad) },
+  { DART_UINT64_C(0x0c2459a25000d65a), DART_UINT64_C(0x191510781fb5efbe) },
+  { DART_UINT64_C(0x701d1481d99a4515), DART_UINT64_C(0x1410d9f9b2f7f2fe) },
+  { DART_UINT64_C(0xc017439b147b6a77), DART_UINT64_C(0x100d7b2e28c65bfe) },
+  { DART_UINT64_C(0xccf205c4ed9243f2), DART_UINT64_C(0x19af2b7d0e0a2cca) },
+  { DART_UINT64_C(0x0a5b37d0be0e9cc2), DART_UINT64_C(0x148c22ca71a1bd6f) },
+  { DART_UINT64_C(0x0848f973cb3ee3ce), DART_UINT64_C(0x10701bd527b4978c) },
+  { DART_UINT64_C(0xda0e5bec78649fb0), DART_UINT64_C(0x1a4cf9550c5425ac) },
+  { DART_UINT64_C(0x7b3eaff060507fc0), DART_UINT64_C(0x150a6110d6a9b7bd) },
+  { DART_UINT64_C(0x95cbbff380406633), DART_UINT64_C(0x10d51a73deee2c97) },
+  { DART_UINT64_C(0xefac665266cd7052), DART_UINT64_C(0x1aee90b964b04758) },
+  { DART_UINT64_C(0x2623850eb8a459db), DART_UINT64_C(0x158ba6fab6f36c47) },
+  { DART_UINT64_C(0x1e82d0d893b6ae49), DART_UINT64_C(0x113c85955f29236c) },
+  { DART_UINT64_C(0xfd9e1af41f8ab075), DART_UINT64_C(0x1b9408eefea838ac) },
+  { DART_UINT64_C(0x97b1af29b2d559f7), DART_UINT64_C(0x16100725988693bd) },
+  { DART_UINT64_C(0xac8e25baf5777b2c), DART_UINT64_C(0x11a66c1e139edc97) },
+  { DART_UINT64_C(0x7a7d092b2258c513), DART_UINT64_C(0x1c3d79c9b8fe2dbf) },
+  { DART_UINT64_C(0x61fda0ef4ead6a76), DART_UINT64_C(0x169794a160cb57cc) },
+  { DART_UINT64_C(0xe7fe1a590bbdeec5), DART_UINT64_C(0x1212dd4de7091309) },
+  { DART_UINT64_C(0xa6635d5b45fcb13a), DART_UINT64_C(0x1ceafbafd80e84dc) },
+  { DART_UINT64_C(0x851c4aaf6b308dc8), DART_UINT64_C(0x172262f3133ed0b0) },
+  { DART_UINT64_C(0xd0e36ef2bc26d7d4), DART_UINT64_C(0x1281e8c275cbda26) },
+  { DART_UINT64_C(0xb49f17eac6a48c86), DART_UINT64_C(0x1d9ca79d894629d7) },
+  { DART_UINT64_C(0x2a18dfef0550706b), DART_UINT64_C(0x17b08617a104ee46) },
+  { DART_UINT64_C(0x54e0b3259dd9f389), DART_UINT64_C(0x12f39e794d9d8b6b) },
+  { DART_UINT64_C(0x87cdeb6f62f65274), DART_UINT64_C(0x1e5297287c2f4578) },
+  { DART_UINT64_C(0xd30b22bf825ea85d), DART_UINT64_C(0x18421286c9bf6ac6) },
+  { DART_UINT64_C(0x0f3c1bcc684bb9e4), DART_UINT64_C(0x13680ed23aff889f) },
+  { DART_UINT64_C(0x18602c7a4079296d), DART_UINT64_C(0x1f0ce4839198da98) },
+  { DART_UINT64_C(0x46b356c833942124), DART_UINT64_C(0x18d71d360e13e213) },
+  { DART_UINT64_C(0x388f78a029434db6), DART_UINT64_C(0x13df4a91a4dcb4dc) },
+  { DART_UINT64_C(0x5a7f2766a86baf8a), DART_UINT64_C(0x1fcbaa82a1612160) },
+  { DART_UINT64_C(0x153285ebb9efbfa2), DART_UINT64_C(0x196fbb9bb44db44d) },
+  { DART_UINT64_C(0xaa8ed189618c994e), DART_UINT64_C(0x145962e2f6a4903d) },
+  { DART_UINT64_C(0xeed8a7a11ad6e10c), DART_UINT64_C(0x1047824f2bb6d9ca) },
+  { DART_UINT64_C(0x7e27729b5e249b45), DART_UINT64_C(0x1a0c03b1df8af611) },
+  { DART_UINT64_C(0xfe85f549181d4904), DART_UINT64_C(0x14d6695b193bf80d) },
+  { DART_UINT64_C(0xcb9e5dd4134aa0d0), DART_UINT64_C(0x10ab877c142ff9a4) },
+  { DART_UINT64_C(0xdf63c9535211014d), DART_UINT64_C(0x1aac0bf9b9e65c3a) },
+  { DART_UINT64_C(0x191ca10f74da6771), DART_UINT64_C(0x15566ffafb1eb02f) },
+  { DART_UINT64_C(0xadb080d92a4852c1), DART_UINT64_C(0x1111f32f2f4bc025) },
+  { DART_UINT64_C(0x15e7348eaa0d5134), DART_UINT64_C(0x1b4feb7eb212cd09) },
+  { DART_UINT64_C(0xab1f5d3eee710dc4), DART_UINT64_C(0x15d98932280f0a6d) },
+  { DART_UINT64_C(0xbc1917658b8da49d), DART_UINT64_C(0x117ad428200c0857) },
+  { DART_UINT64_C(0x2cf4f23c127c3a94), DART_UINT64_C(0x1bf7b9d9cce00d59) },
+  { DART_UINT64_C(0xf0c3f4fcdb969543), DART_UINT64_C(0x165fc7e170b33de0) },
+  { DART_UINT64_C(0x5a365d9716121103), DART_UINT64_C(0x11e6398126f5cb1a) },
+  { DART_UINT64_C(0x9056fc24f01ce804), DART_UINT64_C(0x1ca38f350b22de90) },
+  { DART_UINT64_C(0xd9df301d8ce3ecd0), DART_UINT64_C(0x16e93f5da2824ba6) },
+  { DART_UINT64_C(0xe17f59b13d8323da), DART_UINT64_C(0x125432b14ecea2eb) },
+  { DART_UINT64_C(0x68cbc2b52f38395c), DART_UINT64_C(0x1d53844ee47dd179) },
+  { DART_UINT64_C(0x53d6355dbf602de3), DART_UINT64_C(0x177603725064a794) },
+  { DART_UINT64_C(0xa9782ab165e68b1c), DART_UINT64_C(0x12c4cf8ea6b6ec76) },
+  { DART_UINT64_C(0x0f26aab56fd744fa), DART_UINT64_C(0x1e07b27dd78b13f1) },
+  { DART_UINT64_C(0x3f52222abfdf6a62), DART_UINT64_C(0x18062864ac6f4327) },
+  { DART_UINT64_C(0x65db4e88997f884e), DART_UINT64_C(0x1338205089f29c1f) },
+  { DART_UINT64_C(0x6fc54a7428cc0d4a), DART_UINT64_C(0x1ec033b40fea9365) },
+  { DART_UINT64_C(0x596aa1f68709a43b), DART_UINT64_C(0x1899c2f673220f84) },
+  { DART_UINT64_C(0xadeee7f86c07b696), DART_UINT64_C(0x13ae3591f5b4d936) },
+  { DART_UINT64_C(0x497e3ff3e00c5756), DART_UINT64_C(0x1f7d228322baf524) },
+  { DART_UINT64_C(0xd464fff64cd6ac45), DART_UINT64_C(0x1930e868e89590e9) },
+  { DART_UINT64_C(0x4383fff83d7889d1), DART_UINT64_C(0x14272053ed4473ee) },
+  { DART_UINT64_C(0xcf9cccc69793a174), DART_UINT64_C(0x101f4d0ff1038ff1) },
+  { DART_UINT64_C(0x7f6147a425b90252), DART_UINT64_C(0x19cbae7fe805b31c) },
+  { DART_UINT64_C(0xcc4dd2e9b7c7350f), DART_UINT64_C(0x14a2f1ffecd15c16) },
+  { DART_UINT64_C(0x3d0b0f215fd290d9), DART_UINT64_C(0x10825b3323dab012) },
+  { DART_UINT64_C(0x61ab4b689950e7c1), DART_UINT64_C(0x1a6a2b85062ab350) },
+  { DART_UINT64_C(0x4e22a2ba1440b967), DART_UINT64_C(0x1521bc6a6b555c40) },
+  { DART_UINT64_C(0x0b4ee894dd009453), DART_UINT64_C(0x10e7c9eebc4449cd) },
+  { DART_UINT64_C(0x1217da87c800ed51), DART_UINT64_C(0x1b0c764ac6d3a948) },
+  { DART_UINT64_C(0xdb46486ca000bdda), DART_UINT64_C(0x15a391d56bdc876c) },
+  { DART_UINT64_C(0x490506bd4ccd64af), DART_UINT64_C(0x114fa7ddefe39f8a) },
+  { DART_UINT64_C(0xa8080ac87ae23ab1), DART_UINT64_C(0x1bb2a62fe638ff43) },
+  { DART_UINT64_C(0x5339a239fbe82ef4), DART_UINT64_C(0x162884f31e93ff69) },
+  { DART_UINT64_C(0x75c7b4fb2fecf25d), DART_UINT64_C(0x11ba03f5b20fff87) },
+  { DART_UINT64_C(0x22d92191e647ea2e), DART_UINT64_C(0x1c5cd322b67fff3f) },
+  { DART_UINT64_C(0xb57a8141850654f2), DART_UINT64_C(0x16b0a8e891ffff65) },
+  { DART_UINT64_C(0xc4620101373843f5), DART_UINT64_C(0x1226ed86db3332b7) },
+  { DART_UINT64_C(0x3a366801f1f39fee), DART_UINT64_C(0x1d0b15a491eb8459) },
+  { DART_UINT64_C(0xfb5eb99b27f6198b), DART_UINT64_C(0x173c115074bc69e0) },
+  { DART_UINT64_C(0x2f7efae2865e7ad6), DART_UINT64_C(0x129674405d6387e7) },
+  { DART_UINT64_C(0xe597f7d0d6fd9156), DART_UINT64_C(0x1dbd86cd6238d971) },
+  { DART_UINT64_C(0x8479930d78cadaab), DART_UINT64_C(0x17cad23de82d7ac1) },
+  { DART_UINT64_C(0xd06142712d6f1556), DART_UINT64_C(0x1308a831868ac89a) },
+  { DART_UINT64_C(0x4d686a4eaf182222), DART_UINT64_C(0x1e74404f3daada91) },
+  { DART_UINT64_C(0xa453883ef279b4e8), DART_UINT64_C(0x185d003f6488aeda) },
+  { DART_UINT64_C(0xe9dc6cff28615d87), DART_UINT64_C(0x137d99cc506d58ae) },
+  { DART_UINT64_C(0xa960ae650d6895a4), DART_UINT64_C(0x1f2f5c7a1a488de4) },
+  { DART_UINT64_C(0xbab3beb73ded4483), DART_UINT64_C(0x18f2b061aea07183) },
+  { DART_UINT64_C(0x2ef6322c318a9d36), DART_UINT64_C(0x13f559e7bee6c136) },
+  { DART_UINT64_C(0xe4bd1d13827761f0), DART_UINT64_C(0x1feef63f97d79b89) },
+  { DART_UINT64_C(0x83ca7da9352c4e5a), DART_UINT64_C(0x198bf832dfdfafa1) },
+  { DART_UINT64_C(0x9ca1fe20f756a515), DART_UINT64_C(0x146ff9c24cb2f2e7) },
+  { DART_UINT64_C(0x4a1b31b3f9121daa), DART_UINT64_C(0x1059949b708f28b9) },
+  { DART_UINT64_C(0x435eb5ecc1b695dd), DART_UINT64_C(0x1a28edc580e50df5) },
+  { DART_UINT64_C(0x35e55e57015ede4a), DART_UINT64_C(0x14ed8b04671da4c4) },
+  { DART_UINT64_C(0xc4b77eac0118b1d5), DART_UINT64_C(0x10be08d0527e1d69) },
+  { DART_UINT64_C(0xa12597799b5ab622), DART_UINT64_C(0x1ac9a7b3b7302f0f) },
+  { DART_UINT64_C(0x4db7ac6149155e81), DART_UINT64_C(0x156e1fc2f8f358d9) },
+  { DART_UINT64_C(0xd7c6238107444b9b), DART_UINT64_C(0x1124e63593f5e0ad) },
+  { DART_UINT64_C(0x593d059b3ed3ac2b), DART_UINT64_C(0x1b6e3d2286563449) },
+  { DART_UINT64_C(0xe0fd9e15cbdc89bc), DART_UINT64_C(0x15f1ca820511c36d) },
+  { DART_UINT64_C(0xb3fe18116fe3a163), DART_UINT64_C(0x118e3b9b37416924) },
+  { DART_UINT64_C(0x866359b57fd29bd1), DART_UINT64_C(0x1c16c5c525357507) },
+  { DART_UINT64_C(0xd1e91491330ee30e), DART_UINT64_C(0x16789e3750f790d2) },
+  { DART_UINT64_C(0x74ba76da8f3f1c0b), DART_UINT64_C(0x11fa182c40c60d75) },
+  { DART_UINT64_C(0xedf72490e531c678), DART_UINT64_C(0x1cc359e067a348bb) },
+  { DART_UINT64_C(0x8b2c1d40b75b052d), DART_UINT64_C(0x1702ae4d1fb5d3c9) },
+  { DART_UINT64_C(0x6f567dcd5f7c0424), DART_UINT64_C(0x12688b70e62b0fd4) },
+  { DART_UINT64_C(0x7ef0c94898c66d06), DART_UINT64_C(0x1d74124e3d11b2ed) },
+  { DART_UINT64_C(0x98c0a106e09ebd9f), DART_UINT64_C(0x17900ea4fda7c257) },
+  { DART_UINT64_C(0x470080d24d4bcae6), DART_UINT64_C(0x12d9a550caec9b79) },
+  { DART_UINT64_C(0xd800ce1d487944a2), DART_UINT64_C(0x1e29088144adc58e) },
+  { DART_UINT64_C(0x1333d8176d2dd082), DART_UINT64_C(0x1820d39a9d57d13f) },
+  { DART_UINT64_C(0xa8f646792424a6ce), DART_UINT64_C(0x134d76154aaca765) },
+  { DART_UINT64_C(0x74bd3d8ea03aa47d), DART_UINT64_C(0x1ee25688777aa56f) },
+  { DART_UINT64_C(0x5d64313ee6955064), DART_UINT64_C(0x18b51206c5fbb78c) },
+  { DART_UINT64_C(0x4ab68dcbebaaa6b7), DART_UINT64_C(0x13c40e6bd1962c70) },
+  { DART_UINT64_C(0x1124161312aaa457), DART_UINT64_C(0x1fa01712e8f0471a) },
+  { DART_UINT64_C(0xda8344dc0eeee9df), DART_UINT64_C(0x194cdf4253f36c14) },
+  { DART_UINT64_C(0xe2029d7cd8bf2180), DART_UINT64_C(0x143d7f6843292343) },
+  { DART_UINT64_C(0x4e687dfd7a328133), DART_UINT64_C(0x103132b9cf541c36) },
+  { DART_UINT64_C(0x4a40c9959050ceb8), DART_UINT64_C(0x19e851294bb9c6bd) },
+  { DART_UINT64_C(0x0833d477a6a70bc6), DART_UINT64_C(0x14b9da876fc7d231) },
+  { DART_UINT64_C(0xa02976c61eec096b), DART_UINT64_C(0x1094aed2bfd30e8d) },
+  { DART_UINT64_C(0x004257a364acdbdf), DART_UINT64_C(0x1a877e1dffb81749) },
+  { DART_UINT64_C(0xcd01dfb5ea23e319), DART_UINT64_C(0x153931b1996012a0) },
+  { DART_UINT64_C(0x70ce4c91881cb5ae), DART_UINT64_C(0x10fa8e27ade6754d) },
+  { DART_UINT64_C(0x1ae3adb5a69455e2), DART_UINT64_C(0x1b2a7d0c4970bbaf) },
+  { DART_UINT64_C(0x7be957c4854377e8), DART_UINT64_C(0x15bb973d078d62f2) },
+  { DART_UINT64_C(0xc987796a0435f987), DART_UINT64_C(0x1162df64060ab58e) },
+  { DART_UINT64_C(0x75a58f1006bcc271), DART_UINT64_C(0x1bd1656cd67788e4) },
+  { DART_UINT64_C(0xf7b7a5a66bca3527), DART_UINT64_C(0x16411df0ab92d3e9) },
+  { DART_UINT64_C(0x5fc61e1ebca1c41f), DART_UINT64_C(0x11cdb18d560f0fee) },
+  { DART_UINT64_C(0xffa363646102d365), DART_UINT64_C(0x1c7c4f4889b1b316) },
+  { DART_UINT64_C(0x32e91c504d9bdc51), DART_UINT64_C(0x16c9d906d48e28df) },
+  { DART_UINT64_C(0x8f20e37371497d0e), DART_UINT64_C(0x123b140576d820b2) },
+  { DART_UINT64_C(0x7e9b0585820f2e7c), DART_UINT64_C(0x1d2b533bf159cdea) },
+  { DART_UINT64_C(0xcbaf379e01a5beca), DART_UINT64_C(0x1755dc2ff447d7ee) },
+  { DART_UINT64_C(0x0958f94b348498a1), DART_UINT64_C(0x12ab168cc36cacbf) },
+};
+
+// floor(5^i * 2^(125 - bitlength(5^i))) for 0 <= i < 326.
+const uint64_t FastDoubleConversion::kPow5Split[kPow5SplitSize][2] = {
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1000000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1400000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1900000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1f40000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1388000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x186a000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1e84800000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1312d00000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x17d7840000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1dcd650000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x12a05f2000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x174876e800000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1d1a94a200000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x12309ce540000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x16bcc41e90000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1c6bf52634000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x11c37937e0800000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x16345785d8a00000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1bc16d674ec80000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1158e460913d0000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x15af1d78b58c4000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1b1ae4d6e2ef5000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x10f0cf064dd59200) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x152d02c7e14af680) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x1a784379d99db420) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x108b2a2c28029094) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x14adf4b7320334b9) },
+  { DART_UINT64_C(0x4000000000000000), DART_UINT64_C(0x19d971e4fe8401e7) },
+  { DART_UINT64_C(0x8800000000000000), DART_UINT64_C(0x1027e72f1f128130) },
+  { DART_UINT64_C(0xaa00000000000000), DART_UINT64_C(0x1431e0fae6d7217c) },
+  { DART_UINT64_C(0xd480000000000000), DART_UINT64_C(0x193e5939a08ce9db) },
+  { DART_UINT64_C(0xc9a0000000000000), DART_UINT64_C(0x1f8def8808b02452) },
+  { DART_UINT64_C(0xbe04000000000000), DART_UINT64_C(0x13b8b5b5056e16b3) },
+  { DART_UINT64_C(0xad85000000000000), DART_UINT64_C(0x18a6e32246c99c60) },
+  { DART_UINT64_C(0xd8e6400000000000), DART_UINT64_C(0x1ed09bead87c0378) },
+  { DART_UINT64_C(0x878fe80000000000), DART_UINT64_C(0x13426172c74d822b) },
+  { DART_UINT64_C(0x6973e20000000000), DART_UINT64_C(0x1812f9cf7920e2b6) },
+  { DART_UINT64_C(0x03d0da8000000000), DART_UINT64_C(0x1e17b84357691b64) },
+  { DART_UINT64_C(0x8262889000000000), DART_UINT64_C(0x12ced32a16a1b11e) },
+  { DART_UINT64_C(0x22fb2ab400000000), DART_UINT64_C(0x178287f49c4a1d66) },
+  { DART_UINT64_C(0xabb9f56100000000), DART_UINT64_C(0x1d6329f1c35ca4bf) },
+  { DART_UINT64_C(0xcb54395ca0000000), DART_UINT64_C(0x125dfa371a19e6f7) },
+  { DART_UINT64_C(0xbe2947b3c8000000), DART_UINT64_C(0x16f578c4e0a060b5) },
+  { DART_UINT64_C(0x2db399a0ba000000), DART_UINT64_C(0x1cb2d6f618c878e3) },
+  { DART_UINT64_C(0xfc90400474400000), DART_UINT64_C(0x11efc659cf7d4b8d) },
+  { DART_UINT64_C(0x7bb4500591500000), DART_UINT64_C(0x166bb7f0435c9e71) },
+  { DART_UINT64_C(0xdaa16406f5a40000), DART_UINT64_C(0x1c06a5ec5433c60d) },
+  { DART_UINT64_C(0xa8a4de8459868000), DART_UINT64_C(0x118427b3b4a05bc8) },
+  { DART_UINT64_C(0xd2ce16256fe82000), DART_UINT64_C(0x15e531a0a1c872ba) },
+  { DART_UINT64_C(0x87819baecbe22800), DART_UINT64_C(0x1b5e7e08ca3a8f69) },
+  { DART_UINT64_C(0xf4b1014d3f6d5900), DART_UINT64_C(0x111b0ec57e6499a1) },
+  { DART_UINT64_C(0x71dd41a08f48af40), DART_UINT64_C(0x1561d276ddfdc00a) },
+  { DART_UINT64_C(0x0e549208b31adb10), DART_UINT64_C(0x1aba4714957d300d) },
+  { DART_UINT64_C(0x28f4db456ff0c8ea), DART_UINT64_C(0x10b46c6cdd6e3e08) },
+  { DART_UINT64_C(0x33321216cbecfb24), DART_UINT64_C(0x14e1878814c9cd8a) },
+  { DART_UINT64_C(0xbffe969c7ee839ed), DART_UINT64_C(0x1a19e96a19fc40ec) },
+  { DART_UINT64_C(0xf7ff1e21cf512434), DART_UINT64_C(0x105031e2503da893) },
+  { DART_UINT64_C(0xf5fee5aa43256d41), DART_UINT64_C(0x14643e5ae44d12b8) },
+  { DART_UINT64_C(0x337e9f14d3eec892), DART_UINT64_C(0x197d4df19d605767) },
+  { DART_UINT64_C(0x005e46da08ea7ab6), DART_UINT64_C(0x1fdca16e04b86d41) },
+  { DART_UINT64_C(0xa03aec4845928cb2), DART_UINT64_C(0x13e9e4e4c2f34448) },
+  { DART_UINT64_C(0xc849a75a56f72fde), DART_UINT64_C(0x18e45e1df3b0155a) },
+  { DART_UINT64_C(0x7a5c1130ecb4fbd6), DART_UINT64_C(0x1f1d75a5709c1ab1) },
+  { DART_UINT64_C(0xec798abe93f11d65), DART_UINT64_C(0x13726987666190ae) },
+  { DART_UINT64_C(0xa797ed6e38ed64bf), DART_UINT64_C(0x184f03e93ff9f4da) },
+  { DART_UINT64_C(0x517de8c9c728bdef), DART_UINT64_C(0x1e62c4e38ff87211) },
+  { DART_UINT64_C(0xd2eeb17e1c7976b5), DART_UINT64_C(0x12fdbb0e39fb474a) },
+  { DART_UINT64_C(0x87aa5ddda397d462), DART_UINT64_C(0x17bd29d1c87a191d) },
+  { DART_UINT64_C(0xe994f5550c7dc97b), DART_UINT64_C(0x1dac74463a989f64) },
+  { DART_UINT64_C(0x11fd195527ce9ded), DART_UINT64_C(0x128bc8abe49f639f) },
+  { DART_UINT64_C(0xd67c5faa71c24568), DART_UINT64_C(0x172ebad6ddc73c86) },
+  { DART_UINT64_C(0x8c1b77950e32d6c2), DART_UINT64_C(0x1cfa698c95390ba8) },
+  { DART_UINT64_C(0x57912abd28dfc639), DART_UINT64_C(0x121c81f7dd43a749) },
+  { DART_UINT64_C(0xad75756c7317b7c8), DART_UINT64_C(0x16a3a275d494911b) },
+  { DART_UINT64_C(0x98d2d2c78fdda5ba), DART_UINT64_C(0x1c4c8b1349b9b562) },
+  { DART_UINT64_C(0x9f83c3bcb9ea8794), DART_UINT64_C(0x11afd6ec0e14115d) },
+  { DART_UINT64_C(0x0764b4abe8652979), DART_UINT64_C(0x161bcca7119915b5) },
+  { DART_UINT64_C(0x493de1d6e27e73d7), DART_UINT64_C(0x1ba2bfd0d5ff5b22) },
+  { DART_UINT64_C(0x6dc6ad264d8f0866), DART_UINT64_C(0x1145b7e285bf98f5) },
+  { DART_UINT64_C(0xc938586fe0f2ca80), DART_UINT64_C(0x159725db272f7f32) },
+  { DART_UINT64_C(0x7b866e8bd92f7d20), DART_UINT64_C(0x1afcef51f0fb5eff) },
+  { DART_UINT64_C(0xad34051767bdae34), DART_UINT64_C(0x10de1593369d1b5f) },
+  { DART_UINT64_C(0x9881065d41ad19c1), DART_UINT64_C(0x15159af804446237) },
+  { DART_UINT64_C(0x7ea147f492186032), DART_UINT64_C(0x1a5b01b605557ac5) },
+  { DART_UINT64_C(0x6f24ccf8db4f3c1f), DART_UINT64_C(0x1078e111c3556cbb) },
+  { DART_UINT64_C(0x4aee003712230b27), DART_UINT64_C(0x14971956342ac7ea) },
+  { DART_UINT64_C(0xdda98044d6abcdf0), DART_UINT64_C(0x19bcdfabc13579e4) },
+  { DART_UINT64_C(0x0a89f02b062b60b6), DART_UINT64_C(0x10160bcb58c16c2f) },
+  { DART_UINT64_C(0xcd2c6c35c7b638e4), DART_UINT64_C(0x141b8ebe2ef1c73a) },
+  { DART_UINT64_C(0x8077874339a3c71d), DART_UINT64_C(0x1922726dbaae3909) },
+  { DART_UINT64_C(0xe0956914080cb8e4), DART_UINT64_C(0x1f6b0f092959c74b) },
+  { DART_UINT64_C(0x6c5d61ac8507f38e), DART_UINT64_C(0x13a2e965b9d81c8f) },
+  { DART_UINT64_C(0x4774ba17a649f072), DART_UINT64_C(0x188ba3bf284e23b3) },
+  { DART_UINT64_C(0x1951e89d8fdc6c8f), DART_UINT64_C(0x1eae8caef261aca0) },
+  { DART_UINT64_C(0x0fd3316279e9c3d9), DART_UINT64_C(0x132d17ed577d0be4) },
+  { DART_UINT64_C(0x13c7fdbb186434cf), DART_UINT64_C(0x17f85de8ad5c4edd) },
+  { DART_UINT64_C(0x58b9fd29de7d4203), DART_UINT64_C(0x1df67562d8b36294) },
+  { DART_UINT64_C(0xb7743e3a2b0e4942), DART_UINT64_C(0x12ba095dc7701d9c) },
+  { DART_UINT64_C(0xe5514dc8b5d1db92), DART_UINT64_C(0x17688bb5394c2503) },
+  { DART_UINT64_C(0xdea5a13ae3465277), DART_UINT64_C(0x1d42aea2879f2e44) },
+  { DART_UINT64_C(0x0b2784c4ce0bf38a), DART_UINT64_C(0x1249ad2594c37ceb) },
+  { DART_UINT64_C(0xcdf165f6018ef06d), DART_UINT64_C(0x16dc186ef9f45c25) },
+  { DART_UINT64_C(0x416dbf7381f2ac88), DART_UINT64_C(0x1c931e8ab871732f) },
+  { DART_UINT64_C(0x88e497a83137abd5), DART_UINT64_C(0x11dbf316b346e7fd) },
+  { DART_UINT64_C(0xeb1dbd923d8596ca), DART_UINT64_C(0x1652efdc6018a1fc) },
+  { DART_UINT64_C(0x25e52cf6cce6fc7d), DART_UINT64_C(0x1be7abd3781eca7c) },
+  { DART_UINT64_C(0x97af3c1a40105dce), DART_UINT64_C(0x1170cb642b133e8d) },
+  { DART_UINT64_C(0xfd9b0b20d0147542), DART_UINT64_C(0x15ccfe3d35d80e30) },
+  { DART_UINT64_C(0x3d01cde904199292), DART_UINT64_C(0x1b403dcc834e11bd) },
+  { DART_UINT64_C(0x462120b1a28ffb9b), DART_UINT64_C(0x1108269fd210cb16) },
+  { DART_UINT64_C(0xd7a968de0b33fa82), DART_UINT64_C(0x154a3047c694fddb) },
+  { DART_UINT64_C(0xcd93c3158e00f923), DART_UINT64_C(0x1a9cbc59b83a3d52) },
+  { DART_UINT64_C(0xc07c59ed78c09bb6), DART_UINT64_C(0x10a1f5b813246653) },
+  { DART_UINT64_C(0xb09b7068d6f0c2a3), DART_UINT64_C(0x14ca732617ed7fe8) },
+  { DART_UINT64_C(0xdcc24c830cacf34c), DART_UINT64_C(0x19fd0fef9de8dfe2) },
+  { DART_UINT64_C(0xc9f96fd1e7ec180f), DART_UINT64_C(0x103e29f5c2b18bed) },
+  { DART_UINT64_C(0x3c77cbc661e71e13), DART_UINT64_C(0x144db473335deee9) },
+  { DART_UINT64_C(0x8b95beb7fa60e598), DART_UINT64_C(0x1961219000356aa3) },
+  { DART_UINT64_C(0x6e7b2e65f8f91efe), DART_UINT64_C(0x1fb969f40042c54c) },
+  { DART_UINT64_C(0xc50cfcffbb9bb35f), DART_UINT64_C(0x13d3e2388029bb4f) },
+  { DART_UINT64_C(0xb6503c3faa82a037), DART_UINT64_C(0x18c8dac6a0342a23) },
+  { DART_UINT64_C(0xa3e44b4f95234844), DART_UINT64_C(0x1efb1178484134ac) },
+  { DART_UINT64_C(0xe66eaf11bd360d2b), DART_UINT64_C(0x135ceaeb2d28c0eb) },
+  { DART_UINT64_C(0xe00a5ad62c839075), DART_UINT64_C(0x183425a5f872f126) },
+  { DART_UINT64_C(0x980cf18bb7a47493), DART_UINT64_C(0x1e412f0f768fad70) },
+  { DART_UINT64_C(0x5f0816f752c6c8dc), DART_UINT64_C(0x12e8bd69aa19cc66) },
+  { DART_UINT64_C(0xf6ca1cb527787b13), DART_UINT64_C(0x17a2ecc414a03f7f) },
+  { DART_UINT64_C(0xf47ca3e2715699d7), DART_UINT64_C(0x1d8ba7f519c84f5f) },
+  { DART_UINT64_C(0xf8cde66d86d62026), DART_UINT64_C(0x127748f9301d319b) },
+  { DART_UINT64_C(0xf7016008e88ba830), DART_UINT64_C(0x17151b377c247e02) },
+  { DART_UINT64_C(0xb4c1b80b22ae923c), DART_UINT64_C(0x1cda62055b2d9d83) },
+  { DART_UINT64_C(0x50f91306f5ad1b65), DART_UINT64_C(0x12087d4358fc8272) },
+  { DART_UINT64_C(0xe53757c8b318623f), DART_UINT64_C(0x168a9c942f3ba30e) },
+  { DART_UINT64_C(0x9e852dbadfde7acf), DART_UINT64_C(0x1c2d43b93b0a8bd2) },
+  { DART_UINT64_C(0xa3133c94cbeb0cc1), DART_UINT64_C(0x119c4a53c4e69763) },
+  { DART_UINT64_C(0x8bd80bb9fee5cff1), DART_UINT64_C(0x16035ce8b6203d3c) },
+  { DART_UINT64_C(0xaece0ea87e9f43ee), DART_UINT64_C(0x1b843422e3a84c8b) },
+  { DART_UINT64_C(0x4d40c9294f238a75), DART_UINT64_C(0x1132a095ce492fd7) },
+  { DART_UINT64_C(0x2090fb73a2ec6d12), DART_UINT64_C(0x157f48bb41db7bcd) },
+  { DART_UINT64_C(0x68b53a508ba78856), DART_UINT64_C(0x1adf1aea12525ac0) },
+  { DART_UINT64_C(0x417144725748b536), DART_UINT64_C(0x10cb70d24b7378b8) },
+  { DART_UINT64_C(0x51cd958eed1ae283), DART_UINT64_C(0x14fe4d06de5056e6) },
+  { DART_UINT64_C(0xe640faf2a8619b24), DART_UINT64_C(0x1a3de04895e46c9f) },
+  { DART_UINT64_C(0xefe89cd7a93d00f7), DART_UINT64_C(0x1066ac2d5daec3e3) },
+  { DART_UINT64_C(0xebe2c40d938c4134), DART_UINT64_C(0x14805738b51a74dc) },
+  { DART_UINT64_C(0x26db7510f86f5181), DART_UINT64_C(0x19a06d06e2611214) },
+  { DART_UINT64_C(0x9849292a9b4592f1), DART_UINT64_C(0x100444244d7cab4c) },
+  { DART_UINT64_C(0xbe5b73754216f7ad), DART_UINT64_C(0x1405552d60dbd61f) },
+  { DART_UINT64_C(0xadf25052929cb598), DART_UINT64_C(0x1906aa78b912cba7) },
+  { DART_UINT64_C(0x996ee4673743e2ff), DART_UINT64_C(0x1f485516e7577e91) },
+  { DART_UINT64_C(0xffe54ec0828a6ddf), DART_UINT64_C(0x138d352e5096af1a) },
+  { DART_UINT64_C(0xbfdea270a32d0957), DART_UINT64_C(0x18708279e4bc5ae1) },
+  { DART_UINT64_C(0x2fd64b0ccbf84bad), DART_UINT64_C(0x1e8ca3185deb719a) },
+  { DART_UINT64_C(0x5de5eee7ff7b2f4c), DART_UINT64_C(0x1317e5ef3ab32700) },
+  { DART_UINT64_C(0x755f6aa1ff59fb1f), DART_UINT64_C(0x17dddf6b095ff0c0) },
+  { DART_UINT64_C(0x92b7454a7f3079e7), DART_UINT64_C(0x1dd55745cbb7ecf0) },
+  { DART_UINT64_C(0x5bb28b4e8f7e4c30), DART_UINT64_C(0x12a5568b9f52f416) },
+  { DART_UINT64_C(0xf29f2e22335ddf3c), DART_UINT64_C(0x174eac2e8727b11b) },
+  { DART_UINT64_C(0xef46f9aac035570b), DART_UINT64_C(0x1d22573a28f19d62) },
+  { DART_UINT64_C(0xd58c5c0ab8215667), DART_UINT64_C(0x123576845997025d) },
+  { DART_UINT64_C(0x4aef730d6629ac01), DART_UINT64_C(0x16c2d4256ffcc2f5) },
+  { DART_UINT64_C(0x9dab4fd0bfb41701), DART_UINT64_C(0x1c73892ecbfbf3b2) },
+  { DART_UINT64_C(0xa28b11e277d08e60), DART_UINT64_C(0x11c835bd3f7d784f) },
+  { DART_UINT64_C(0x8b2dd65b15c4b1f9), DART_UINT64_C(0x163a432c8f5cd663) },
+  { DART_UINT64_C(0x6df94bf1db35de77), DART_UINT64_C(0x1bc8d3f7b3340bfc) },
+  { DART_UINT64_C(0xc4bbcf772901ab0a), DART_UINT64_C(0x115d847ad000877d) },
+  { DART_UINT64_C(0x35eac354f34215cd), DART_UINT64_C(0x15b4e5998400a95d) },
+  { DART_UINT64_C(0x8365742a30129b40), DART_UINT64_C(0x1b221effe500d3b4) },
+  { DART_UINT64_C(0xd21f689a5e0ba108), DART_UINT64_C(0x10f5535fef208450) },
+  { DART_UINT64_C(0x06a742c0f58e894a), DART_UINT64_C(0x1532a837eae8a565) },
+  { DART_UINT64_C(0x4851137132f22b9d), DART_UINT64_C(0x1a7f5245e5a2cebe) },
+  { DART_UINT64_C(0xed32ac26bfd75b42), DART_UINT64_C(0x108f936baf85c136) },
+  { DART_UINT64_C(0xa87f57306fcd3212), DART_UINT64_C(0x14b378469b673184) },
+  { DART_UINT64_C(0xd29f2cfc8bc07e97), DART_UINT64_C(0x19e056584240fde5) },
+  { DART_UINT64_C(0xa3a37c1dd7584f1e), DART_UINT64_C(0x102c35f729689eaf) },
+  { DART_UINT64_C(0x8c8c5b254d2e62e6), DART_UINT64_C(0x14374374f3c2c65b) },
+  { DART_UINT64_C(0x6faf71eea079fb9f), DART_UINT64_C(0x1945145230b377f2) },
+  { DART_UINT64_C(0x0b9b4e6a48987a87), DART_UINT64_C(0x1f965966bce055ef) },
+  { DART_UINT64_C(0x674111026d5f4c94), DART_UINT64_C(0x13bdf7e0360c35b5) },
+  { DART_UINT64_C(0xc111554308b71fba), DART_UINT64_C(0x18ad75d8438f4322) },
+  { DART_UINT64_C(0x7155aa93cae4e7a8), DART_UINT64_C(0x1ed8d34e547313eb) },
+  { DART_UINT64_C(0x26d58a9c5ecf10c9), DART_UINT64_C(0x13478410f4c7ec73) },
+  { DART_UINT64_C(0xf08aed437682d4fb), DART_UINT64_C(0x1819651531f9e78f) },
+  { DART_UINT64_C(0xecada89454238a3a), DART_UINT64_C(0x1e1fbe5a7e786173) },
+  { DART_UINT64_C(0x73ec895cb4963664), DART_UINT64_C(0x12d3d6f88f0b3ce8) },
+  { DART_UINT64_C(0x90e7abb3e1bbc3fd), DART_UINT64_C(0x1788ccb6b2ce0c22) },
+  { DART_UINT64_C(0x352196a0da2ab4fd), DART_UINT64_C(0x1d6affe45f818f2b) },
+  { DART_UINT64_C(0x0134fe24885ab11e), DART_UINT64_C(0x1262dfeebbb0f97b) },
+  { DART_UINT64_C(0xc1823dadaa715d65), DART_UINT64_C(0x16fb97ea6a9d37d9) },
+  { DART_UINT64_C(0x31e2cd19150db4bf), DART_UINT64_C(0x1cba7de5054485d0) },
+  { DART_UINT64_C(0x1f2dc02fad2890f7), DART_UINT64_C(0x11f48eaf234ad3a2) },
+  { DART_UINT64_C(0xa6f9303b9872b535), DART_UINT64_C(0x1671b25aec1d888a) },
+  { DART_UINT64_C(0x50b77c4a7e8f6282), DART_UINT64_C(0x1c0e1ef1a724eaad) },
+  { DART_UINT64_C(0x5272adae8f199d91), DART_UINT64_C(0x1188d357087712ac) },
+  { DART_UINT64_C(0x670f591a32e004f6), DART_UINT64_C(0x15eb082cca94d757) },
+  { DART_UINT64_C(0x40d32f60bf980633), DART_UINT64_C(0x1b65ca37fd3a0d2d) },
+  { DART_UINT64_C(0x4883fd9c77bf03e0), DART_UINT64_C(0x111f9e62fe44483c) },
+  { DART_UINT64_C(0x5aa4fd0395aec4d8), DART_UINT64_C(0x156785fbbdd55a4b) },
+  { DART_UINT64_C(0x314e3c447b1a760e), DART_UINT64_C(0x1ac1677aad4ab0de) },
+  { DART_UINT64_C(0xded0e5aaccf089c9), DART_UINT64_C(0x10b8e0acac4eae8a) },
+  { DART_UINT64_C(0x96851f15802cac3b), DART_UINT64_C(0x14e718d7d7625a2d) },
+  { DART_UINT64_C(0xfc2666dae037d74a), DART_UINT64_C(0x1a20df0dcd3af0b8) },
+  { DART_UINT64_C(0x9d980048cc22e68e), DART_UINT64_C(0x10548b68a044d673) },
+  { DART_UINT64_C(0x84fe005aff2ba032), DART_UINT64_C(0x1469ae42c8560c10) },
+  { DART_UINT64_C(0xa63d8071bef6883e), DART_UINT64_C(0x198419d37a6b8f14) },
+  { DART_UINT64_C(0xcfcce08e2eb42a4e), DART_UINT64_C(0x1fe52048590672d9) },
+  { DART_UINT64_C(0x21e00c58dd309a70), DART_UINT64_C(0x13ef342d37a407c8) },
+  { DART_UINT64_C(0x2a580f6f147cc10d), DART_UINT64_C(0x18eb0138858d09ba) },
+  { DART_UINT64_C(0xb4ee134ad99bf150), DART_UINT64_C(0x1f25c186a6f04c28) },
+  { DART_UINT64_C(0x7114cc0ec80176d2), DART_UINT64_C(0x137798f428562f99) },
+  { DART_UINT64_C(0xcd59ff127a01d486), DART_UINT64_C(0x18557f31326bbb7f) },
+  { DART_UINT64_C(0xc0b07ed7188249a8), DART_UINT64_C(0x1e6adefd7f06aa5f) },
+  { DART_UINT64_C(0xd86e4f466f516e09), DART_UINT64_C(0x1302cb5e6f642a7b) },
+  { DART_UINT64_C(0xce89e3180b25c98b), DART_UINT64_C(0x17c37e360b3d351a) },
+  { DART_UINT64_C(0x822c5bde0def3bee), DART_UINT64_C(0x1db45dc38e0c8261) },
+  { DART_UINT64_C(0xf15bb96ac8b58575), DART_UINT64_C(0x1290ba9a38c7d17c) },
+  { DART_UINT64_C(0x2db2a7c57ae2e6d2), DART_UINT64_C(0x1734e940c6f9c5dc) },
+  { DART_UINT64_C(0x391f51b6d99ba086), DART_UINT64_C(0x1d022390f8b83753) },
+  { DART_UINT64_C(0x03b3931248014454), DART_UINT64_C(0x1221563a9b732294) },
+  { DART_UINT64_C(0x04a077d6da019569), DART_UINT64_C(0x16a9abc9424feb39) },
+  { DART_UINT64_C(0x45c895cc9081fac3), DART_UINT64_C(0x1c5416bb92e3e607) },
+  { DART_UINT64_C(0x8b9d5d9fda513cba), DART_UINT64_C(0x11b48e353bce6fc4) },
+  { DART_UINT64_C(0xae84b507d0e58be8), DART_UINT64_C(0x1621b1c28ac20bb5) },
+  { DART_UINT64_C(0x1a25e249c51eeee3), DART_UINT64_C(0x1baa1e332d728ea3) },
+  { DART_UINT64_C(0xf057ad6e1b33554d), DART_UINT64_C(0x114a52dffc679925) },
+  { DART_UINT64_C(0x6c6d98c9a2002aa1), DART_UINT64_C(0x159ce797fb817f6f) },
+  { DART_UINT64_C(0x4788fefc0a803549), DART_UINT64_C(0x1b04217dfa61df4b) },
+  { DART_UINT64_C(0x0cb59f5d8690214e), DART_UINT64_C(0x10e294eebc7d2b8f) },
+  { DART_UINT64_C(0xcfe30734e83429a1), DART_UINT64_C(0x151b3a2a6b9c7672) },
+  { DART_UINT64_C(0x83dbc9022241340a), DART_UINT64_C(0x1a6208b50683940f) },
+  { DART_UINT64_C(0xb2695da15568c086), DART_UINT64_C(0x107d457124123c89) },
+  { DART_UINT64_C(0x1f03b509aac2f0a7), DART_UINT64_C(0x149c96cd6d16cbac) },
+  { DART_UINT64_C(0x26c4a24c1573acd1), DART_UINT64_C(0x19c3bc80c85c7e97) },
+  { DART_UINT64_C(0x783ae56f8d684c03), DART_UINT64_C(0x101a55d07d39cf1e) },
+  { DART_UINT64_C(0x16499ecb70c25f03), DART_UINT64_C(0x1420eb449c8842e6) },
+  { DART_UINT64_C(0x9bdc067e4cf2f6c4), DART_UINT64_C(0x19292615c3aa539f) },
+  { DART_UINT64_C(0x82d3081de02fb476), DART_UINT64_C(0x1f736f9b3494e887) },
+  { DART_UINT64_C(0xb1c3e512ac1dd0c9), DART_UINT64_C(0x13a825c100dd1154) },
+  { DART_UINT64_C(0xde34de57572544fc), DART_UINT64_C(0x18922f31411455a9) },
+  { DART_UINT64_C(0x55c215ed2cee963b), DART_UINT64_C(0x1eb6bafd91596b14) },
+  { DART_UINT64_C(0xb5994db43c151de5), DART_UINT64_C(0x133234de7ad7e2ec) },
+  { DART_UINT64_C(0xe2ffa1214b1a655e), DART_UINT64_C(0x17fec216198ddba7) },
+  { DART_UINT64_C(0xdbbf89699de0feb6), DART_UINT64_C(0x1dfe729b9ff15291) },
+  { DART_UINT64_C(0x2957b5e202ac9f31), DART_UINT64_C(0x12bf07a143f6d39b) },
+  { DART_UINT64_C(0xf3ada35a8357c6fe), DART_UINT64_C(0x176ec98994f48881) },
+  { DART_UINT64_C(0x70990c31242db8bd), DART_UINT64_C(0x1d4a7bebfa31aaa2) },
+  { DART_UINT64_C(0x865fa79eb69c9376), DART_UINT64_C(0x124e8d737c5f0aa5) },
+  { DART_UINT64_C(0xe7f791866443b854), DART_UINT64_C(0x16e230d05b76cd4e) },
+  { DART_UINT64_C(0xa1f575e7fd54a669), DART_UINT64_C(0x1c9abd04725480a2) },
+  { DART_UINT64_C(0xa53969b0fe54e801), DART_UINT64_C(0x11e0b622c774d065) },
+  { DART_UINT64_C(0x0e87c41d3dea2202), DART_UINT64_C(0x1658e3ab7952047f) },
+  { DART_UINT64_C(0xd229b5248d64aa82), DART_UINT64_C(0x1bef1c9657a6859e) },
+  { DART_UINT64_C(0x435a1136d85eea91), DART_UINT64_C(0x117571ddf6c81383) },
+  { DART_UINT64_C(0x143095848e76a536), DART_UINT64_C(0x15d2ce55747a1864) },
+  { DART_UINT64_C(0x193cbae5b2144e83), DART_UINT64_C(0x1b4781ead1989e7d) },
+  { DART_UINT64_C(0x2fc5f4cf8f4cb112), DART_UINT64_C(0x110cb132c2ff630e) },
+  { DART_UINT64_C(0xbbb77203731fdd56), DART_UINT64_C(0x154fdd7f73bf3bd1) },
+  { DART_UINT64_C(0x2aa54e844fe7d4ac), DART_UINT64_C(0x1aa3d4df50af0ac6) },
+  { DART_UINT64_C(0xdaa75112b1f0e4eb), DART_UINT64_C(0x10a6650b926d66bb) },
+  { DART_UINT64_C(0xd15125575e6d1e26), DART_UINT64_C(0x14cffe4e7708c06a) },
+  { DART_UINT64_C(0x85a56ead360865b0), DART_UINT64_C(0x1a03fde214caf085) },
+  { DART_UINT64_C(0x7387652c41c53f8e), DART_UINT64_C(0x10427ead4cfed653) },
+  { DART_UINT64_C(0x50693e7752368f71), DART_UINT64_C(0x14531e58a03e8be8) },
+  { DART_UINT64_C(0x64838e1526c4334e), DART_UINT64_C(0x1967e5eec84e2ee2) },
+  { DART_UINT64_C(0xfda4719a70754022), DART_UINT64_C(0x1fc1df6a7a61ba9a) },
+  { DART_UINT64_C(0xde86c70086494815), DART_UINT64_C(0x13d92ba28c7d14a0) },
+  { DART_UINT64_C(0x162878c0a7db9a1a), DART_UINT64_C(0x18cf768b2f9c59c9) },
+  { DART_UINT64_C(0x5bb296f0d1d280a1), DART_UINT64_C(0x1f03542dfb83703b) },
+  { DART_UINT64_C(0x194f9e5683239064), DART_UINT64_C(0x1362149cbd322625) },
+  { DART_UINT64_C(0x5fa385ec23ec747e), DART_UINT64_C(0x183a99c3ec7eafae) },
+  { DART_UINT64_C(0xf78c67672ce7919d), DART_UINT64_C(0x1e494034e79e5b99) },
+  { DART_UINT64_C(0x3ab7c0a07c10bb02), DART_UINT64_C(0x12edc82110c2f940) },
+  { DART_UINT64_C(0x4965b0c89b14e9c3), DART_UINT64_C(0x17a93a2954f3b790) },
+  { DART_UINT64_C(0x5bbf1cfac1da2433), DART_UINT64_C(0x1d9388b3aa30a574) },
+  { DART_UINT64_C(0xb957721cb92856a0), DART_UINT64_C(0x127c35704a5e6768) },
+  { DART_UINT64_C(0xe7ad4ea3e7726c48), DART_UINT64_C(0x171b42cc5cf60142) },
+  { DART_UINT64_C(0xa198a24ce14f075a), DART_UINT64_C(0x1ce2137f74338193) },
+  { DART_UINT64_C(0x44ff65700cd16498), DART_UINT64_C(0x120d4c2fa8a030fc) },
+  { DART_UINT64_C(0x563f3ecc1005bdbe), DART_UINT64_C(0x16909f3b92c83d3b) },
+  { DART_UINT64_C(0x2bcf0e7f14072d2e), DART_UINT64_C(0x1c34c70a777a4c8a) },
+  { DART_UINT64_C(0x5b61690f6c847c3d), DART_UINT64_C(0x11a0fc668aac6fd6) },
+  { DART_UINT64_C(0xf239c35347a59b4c), DART_UINT64_C(0x16093b802d578bcb) },
+  { DART_UINT64_C(0xeec83428198f021f), DART_UINT64_C(0x1b8b8a6038ad6ebe) },
+  { DART_UINT64_C(0x553d20990ff96153), DART_UINT64_C(0x1137367c236c6537) },
+  { DART_UINT64_C(0x2a8c68bf53f7b9a8), DART_UINT64_C(0x1585041b2c477e85) },
+  { DART_UINT64_C(0x752f82ef28f5a812), DART_UINT64_C(0x1ae64521f7595e26) },
+  { DART_UINT64_C(0x093db1d57999890b), DART_UINT64_C(0x10cfeb353a97dad8) },
+  { DART_UINT64_C(0x0b8d1e4ad7ffeb4e), DART_UINT64_C(0x1503e602893dd18e) },
+  { DART_UINT64_C(0x8e7065dd8dffe622), DART_UINT64_C(0x1a44df832b8d45f1) },
+  { DART_UINT64_C(0xf9063faa78bfefd5), DART_UINT64_C(0x106b0bb1fb384bb6) },
+  { DART_UINT64_C(0xb747cf9516efebca), DART_UINT64_C(0x1485ce9e7a065ea4) },
+  { DART_UINT64_C(0xe519c37a5cabe6bd), DART_UINT64_C(0x19a742461887f64d) },
+  { DART_UINT64_C(0xaf301a2c79eb7036), DART_UINT64_C(0x1008896bcf54f9f0) },
+  { DART_UINT64_C(0xdafc20b798664c43), DART_UINT64_C(0x140aabc6c32a386c) },
+  { DART_UINT64_C(0x11bb28e57e7fdf54), DART_UINT64_C(0x190d56b873f4c688) },
+  { DART_UINT64_C(0x1629f31ede1fd72a), DART_UINT64_C(0x1f50ac6690f1f82a) },
+  { DART_UINT64_C(0x4dda37f34ad3e67a), DART_UINT64_C(0x13926bc01a973b1a) },
+  { DART_UINT64_C(0xe150c5f01d88e019), DART_UINT64_C(0x187706b0213d09e0) },
+  { DART_UINT64_C(0x19a4f76c24eb181f), DART_UINT64_C(0x1e94c85c298c4c59) },
+  { DART_UINT64_C(0xb0071aa39712ef13), DART_UINT64_C(0x131cfd3999f7afb7) },
+  { DART_UINT64_C(0x9c08e14c7cd7aad8), DART_UINT64_C(0x17e43c8800759ba5) },
+  { DART_UINT64_C(0x030b199f9c0d958e), DART_UINT64_C(0x1ddd4baa0093028f) },
+  { DART_UINT64_C(0x61e6f003c1887d79), DART_UINT64_C(0x12aa4f4a405be199) },
+  { DART_UINT64_C(0xba60ac04b1ea9cd7), DART_UINT64_C(0x1754e31cd072d9ff) },
+  { DART_UINT64_C(0xa8f8d705de65440d), DART_UINT64_C(0x1d2a1be4048f907f) },
+  { DART_UINT64_C(0xc99b8663aaff4a88), DART_UINT64_C(0x123a516e82d9ba4f) },
+  { DART_UINT64_C(0xbc0267fc95bf1d2a), DART_UINT64_C(0x16c8e5ca239028e3) },
+  { DART_UINT64_C(0xab0301fbbb2ee474), DART_UINT64_C(0x1c7b1f3cac74331c) },
+  { DART_UINT64_C(0xeae1e13d54fd4ec9), DART_UINT64_C(0x11ccf385ebc89ff1) },
+  { DART_UINT64_C(0x659a598caa3ca27b), DART_UINT64_C(0x1640306766bac7ee) },
+  { DART_UINT64_C(0xff00efefd4cbcb1a), DART_UINT64_C(0x1bd03c81406979e9) },
+  { DART_UINT64_C(0x3f6095f5e4ff5ef0), DART_UINT64_C(0x116225d0c841ec32) },
+  { DART_UINT64_C(0xcf38bb735e3f36ac), DART_UINT64_C(0x15baaf44fa52673e) },
+  { DART_UINT64_C(0x8306ea5035cf0457), DART_UINT64_C(0x1b295b1638e7010e) },
+  { DART_UINT64_C(0x11e4527221a162b6), DART_UINT64_C(0x10f9d8ede39060a9) },
+  { DART_UINT64_C(0x565d670eaa09bb64), DART_UINT64_C(0x15384f295c7478d3) },
+  { DART_UINT64_C(0x2bf4c0d2548c2a3d), DART_UINT64_C(0x1a8662f3b3919708) },
+  { DART_UINT64_C(0x1b78f88374d79a66), DART_UINT64_C(0x1093fdd8503afe65) },
+  { DART_UINT64_C(0x625736a4520d8100), DART_UINT64_C(0x14b8fd4e6449bdfe) },
+  { DART_UINT64_C(0xfaed044d6690e140), DART_UINT64_C(0x19e73ca1fd5c2d7d) },
+  { DART_UINT64_C(0xbcd422b0601a8cc8), DART_UINT64_C(0x103085e53e599c6e) },
+  { DART_UINT64_C(0x6c092b5c78212ffa), DART_UINT64_C(0x143ca75e8df0038a) },
+  { DART_UINT64_C(0x070b763396297bf8), DART_UINT64_C(0x194bd136316c046d) },
+  { DART_UINT64_C(0x48ce53c07bb3daf6), DART_UINT64_C(0x1f9ec583bdc70588) },
+  { DART_UINT64_C(0x2d80f4584d5068da), DART_UINT64_C(0x13c33b72569c6375) },
+  { DART_UINT64_C(0x78e1316e60a48310), DART_UINT64_C(0x18b40a4eec437c52) },
+};
+
+// The 128 most significant bits of 5^q for -342 <= q <= 308. For q >= 0
+// they are truncated. For q < 0 they are floor(2^b / 5^-q) + 1, truncated to
+// 128 bits, where b = bitlength(5^-q) + 127 for q >= -27 and
+// b = 2 * bitlength(5^-q) + 128 for q < -27.
+const uint64_t FastDoubleConversion::kPow5Significands[
+    kMaxPow5Exponent - kMinPow5Exponent + 1][2] = {
+  { DART_UINT64_C(0x113faa2906a13b3f), DART_UINT64_C(0xeef453d6923bd65a) },
+  { DART_UINT64_C(0x4ac7ca59a424c507), DART_UINT64_C(0x9558b4661b6565f8) },
+  { DART_UINT64_C(0x5d79bcf00d2df649), DART_UINT64_C(0xbaaee17fa23ebf76) },
+  { DART_UINT64_C(0xf4d82c2c107973dc), DART_UINT64_C(0xe95a99df8ace6f53) },
+  { DART_UINT64_C(0x79071b9b8a4be869), DART_UINT64_C(0x91d8a02bb6c10594) },
+  { DART_UINT64_C(0x9748e2826cdee284), DART_UINT64_C(0xb64ec836a47146f9) },
+  { DART_UINT64_C(0xfd1b1b2308169b25), DART_UINT64_C(0xe3e27a444d8d98b7) },
+  { DART_UINT64_C(0xfe30f0f5e50e20f7), DART_UINT64_C(0x8e6d8c6ab0787f72) },
+  { DART_UINT64_C(0xbdbd2d335e51a935), DART_UINT64_C(0xb208ef855c969f4f) },
+  { DART_UINT64_C(0xad2c788035e61382), DART_UINT64_C(0xde8b2b66b3bc4723) },
+  { DART_UINT64_C(0x4c3bcb5021afcc31), DART_UINT64_C(0x8b16fb203055ac76) },
+  { DART_UINT64_C(0xdf4abe242a1bbf3d), DART_UINT64_C(0xaddcb9e83c6b1793) },
+  { DART_UINT64_C(0xd71d6dad34a2af0d), DART_UINT64_C(0xd953e8624b85dd78) },
+  { DART_UINT64_C(0x8672648c40e5ad68), DART_UINT64_C(0x87d4713d6f33aa6b) },
+  { DART_UINT64_C(0x680efdaf511f18c2), DART_UINT64_C(0xa9c98d8ccb009506) },
+  { DART_UINT64_C(0x0212bd1b2566def2), DART_UINT64_C(0xd43bf0effdc0ba48) },
+  { DART_UINT64_C(0x014bb630f7604b57), DART_UINT64_C(0x84a57695fe98746d) },
+  { DART_UINT64_C(0x419ea3bd35385e2d), DART_UINT64_C(0xa5ced43b7e3e9188) },
+  { DART_UINT64_C(0x52064cac828675b9), DART_UINT64_C(0xcf42894a5dce35ea) },
+  { DART_UINT64_C(0x7343efebd1940993), DART_UINT64_C(0x818995ce7aa0e1b2) },
+  { DART_UINT64_C(0x1014ebe6c5f90bf8), DART_UINT64_C(0xa1ebfb4219491a1f) },
+  { DART_UINT64_C(0xd41a26e077774ef6), DART_UINT64_C(0xca66fa129f9b60a6) },
+  { DART_UINT64_C(0x8920b098955522b4), DART_UINT64_C(0xfd00b897478238d0) },
+  { DART_UINT64_C(0x55b46e5f5d5535b0), DART_UINT64_C(0x9e20735e8cb16382) },
+  { DART_UINT64_C(0xeb2189f734aa831d), DART_UINT64_C(0xc5a890362fddbc62) },
+  { DART_UINT64_C(0xa5e9ec7501d523e4), DART_UINT64_C(0xf712b443bbd52b7b) },
+  { DART_UINT64_C(0x47b233c92125366e), DART_UINT64_C(0x9a6bb0aa55653b2d) },
+  { DART_UINT64_C(0x999ec0bb696e840a), DART_UINT64_C(0xc1069cd4eabe89f8) },
+  { DART_UINT64_C(0xc00670ea43ca250d), DART_UINT64_C(0xf148440a256e2c76) },
+  { DART_UINT64_C(0x380406926a5e5728), DART_UINT64_C(0x96cd2a865764dbca) },
+  { DART_UINT64_C(0xc605083704f5ecf2), DART_UINT64_C(0xbc807527ed3e12bc) },
+  { DART_UINT64_C(0xf7864a44c633682e), DART_UINT64_C(0xeba09271e88d976b) },
+  { DART_UINT64_C(0x7ab3ee6afbe0211d), DART_UINT64_C(0x93445b8731587ea3) },
+  { DART_UINT64_C(0x5960ea05bad82964), DART_UINT64_C(0xb8157268fdae9e4c) },
+  { DART_UINT64_C(0x6fb92487298e33bd), DART_UINT64_C(0xe61acf033d1a45df) },
+  { DART_UINT64_C(0xa5d3b6d479f8e056), DART_UINT64_C(0x8fd0c16206306bab) },
+  { DART_UINT64_C(0x8f48a4899877186c), DART_UINT64_C(0xb3c4f1ba87bc8696) },
+  { DART_UINT64_C(0x331acdabfe94de87), DART_UINT64_C(0xe0b62e2929aba83c) },
+  { DART_UINT64_C(0x9ff0c08b7f1d0b14), DART_UINT64_C(0x8c71dcd9ba0b4925) },
+  { DART_UINT64_C(0x07ecf0ae5ee44dd9), DART_UINT64_C(0xaf8e5410288e1b6f) },
+  { DART_UINT64_C(0xc9e82cd9f69d6150), DART_UINT64_C(0xdb71e91432b1a24a) },
+  { DART_UINT64_C(0xbe311c083a225cd2), DART_UINT64_C(0x892731ac9faf056e) },
+  { DART_UINT64_C(0x6dbd630a48aaf406), DART_UINT64_C(0xab70fe17c79ac6ca) },
+  { DART_UINT64_C(0x092cbbccdad5b108), DART_UINT64_C(0xd64d3d9db981787d) },
+  { DART_UINT64_C(0x25bbf56008c58ea5), DART_UINT64_C(0x85f0468293f0eb4e) },
+  { DART_UINT64_C(0xaf2af2b80af6f24e), DART_UINT64_C(0xa76c582338ed2621) },
+  { DART_UINT64_C(0x1af5af660db4aee1), DART_UINT64_C(0xd1476e2c07286faa) },
+  { DART_UINT64_C(0x50d98d9fc890ed4d), DART_UINT64_C(0x82cca4db847945ca) },
+  { DART_UINT64_C(0xe50ff107bab528a0), DART_UINT64_C(0xa37fce126597973c) },
+  { DART_UINT64_C(0x1e53ed49a96272c8), DART_UINT64_C(0xcc5fc196fefd7d0c) },
+  { DART_UINT64_C(0x25e8e89c13bb0f7a), DART_UINT64_C(0xff77b1fcbebcdc4f) },
+  { DART_UINT64_C(0x77b191618c54e9ac), DART_UINT64_C(0x9faacf3df73609b1) },
+  { DART_UINT64_C(0xd59df5b9ef6a2417), DART_UINT64_C(0xc795830d75038c1d) },
+  { DART_UINT64_C(0x4b0573286b44ad1d), DART_UINT64_C(0xf97ae3d0d2446f25) },
+  { DART_UINT64_C(0x4ee367f9430aec32), DART_UINT64_C(0x9becce62836ac577) },
+  { DART_UINT64_C(0x229c41f793cda73f), DART_UINT64_C(0xc2e801fb244576d5) },
+  { DART_UINT64_C(0x6b43527578c1110f), DART_UINT64_C(0xf3a20279ed56d48a) },
+  { DART_UINT64_C(0x830a13896b78aaa9), DART_UINT64_C(0x9845418c345644d6) },
+  { DART_UINT64_C(0x23cc986bc656d553), DART_UINT64_C(0xbe5691ef416bd60c) },
+  { DART_UINT64_C(0x2cbfbe86b7ec8aa8), DART_UINT64_C(0xedec366b11c6cb8f) },
+  { DART_UINT64_C(0x7bf7d71432f3d6a9), DART_UINT64_C(0x94b3a202eb1c3f39) },
+  { DART_UINT64_C(0xdaf5ccd93fb0cc53), DART_UINT64_C(0xb9e08a83a5e34f07) },
+  { DART_UINT64_C(0xd1b3400f8f9cff68), DART_UINT64_C(0xe858ad248f5c22c9) },
+  { DART_UINT64_C(0x23100809b9c21fa1), DART_UINT64_C(0x91376c36d99995be) },
+  { DART_UINT64_C(0xabd40a0c2832a78a), DART_UINT64_C(0xb58547448ffffb2d) },
+  { DART_UINT64_C(0x16c90c8f323f516c), DART_UINT64_C(0xe2e69915b3fff9f9) },
+  { DART_UINT64_C(0xae3da7d97f6792e3), DART_UINT64_C(0x8dd01fad907ffc3b) },
+  { DART_UINT64_C(0x99cd11cfdf41779c), DART_UINT64_C(0xb1442798f49ffb4a) },
+  { DART_UINT64_C(0x40405643d711d583), DART_UINT64_C(0xdd95317f31c7fa1d) },
+  { DART_UINT64_C(0x482835ea666b2572), DART_UINT64_C(0x8a7d3eef7f1cfc52) },
+  { DART_UINT64_C(0xda3243650005eecf), DART_UINT64_C(0xad1c8eab5ee43b66) },
+  { DART_UINT64_C(0x90bed43e40076a82), DART_UINT64_C(0xd863b256369d4a40) },
+  { DART_UINT64_C(0x5a7744a6e804a291), DART_UINT64_C(0x873e4f75e2224e68) },
+  { DART_UINT64_C(0x711515d0a205cb36), DART_UINT64_C(0xa90de3535aaae202) },
+  { DART_UINT64_C(0x0d5a5b44ca873e03), DART_UINT64_C(0xd3515c2831559a83) },
+  { DART_UINT64_C(0xe858790afe9486c2), DART_UINT64_C(0x8412d9991ed58091) },
+  { DART_UINT64_C(0x626e974dbe39a872), DART_UINT64_C(0xa5178fff668ae0b6) },
+  { DART_UINT64_C(0xfb0a3d212dc8128f), DART_UINT64_C(0xce5d73ff402d98e3) },
+  { DART_UINT64_C(0x7ce66634bc9d0b99), DART_UINT64_C(0x80fa687f881c7f8e) },
+  { DART_UINT64_C(0x1c1fffc1ebc44e80), DART_UINT64_C(0xa139029f6a239f72) },
+  { DART_UINT64_C(0xa327ffb266b56220), DART_UINT64_C(0xc987434744ac874e) },
+  { DART_UINT64_C(0x4bf1ff9f0062baa8), DART_UINT64_C(0xfbe9141915d7a922) },
+  { DART_UINT64_C(0x6f773fc3603db4a9), DART_UINT64_C(0x9d71ac8fada6c9b5) },
+  { DART_UINT64_C(0xcb550fb4384d21d3), DART_UINT64_C(0xc4ce17b399107c22) },
+  { DART_UINT64_C(0x7e2a53a146606a48), DART_UINT64_C(0xf6019da07f549b2b) },
+  { DART_UINT64_C(0x2eda7444cbfc426d), DART_UINT64_C(0x99c102844f94e0fb) },
+  { DART_UINT64_C(0xfa911155fefb5308), DART_UINT64_C(0xc0314325637a1939) },
+  { DART_UINT64_C(0x793555ab7eba27ca), DART_UINT64_C(0xf03d93eebc589f88) },
+  { DART_UINT64_C(0x4bc1558b2f3458de), DART_UINT64_C(0x96267c7535b763b5) },
+  { DART_UINT64_C(0x9eb1aaedfb016f16), DART_UINT64_C(0xbbb01b9283253ca2) },
+  { DART_UINT64_C(0x465e15a979c1cadc), DART_UINT64_C(0xea9c227723ee8bcb) },
+  { DART_UINT64_C(0x0bfacd89ec191ec9), DART_UINT64_C(0x92a1958a7675175f) },
+  { DART_UINT64_C(0xcef980ec671f667b), DART_UINT64_C(0xb749faed14125d36) },
+  { DART_UINT64_C(0x82b7e12780e7401a), DART_UINT64_C(0xe51c79a85916f484) },
+  { DART_UINT64_C(0xd1b2ecb8b0908810), DART_UINT64_C(0x8f31cc0937ae58d2) },
+  { DART_UINT64_C(0x861fa7e6dcb4aa15), DART_UINT64_C(0xb2fe3f0b8599ef07) },
+  { DART_UINT64_C(0x67a791e093e1d49a), DART_UINT64_C(0xdfbdcece67006ac9) },
+  { DART_UINT64_C(0xe0c8bb2c5c6d24e0), DART_UINT64_C(0x8bd6a141006042bd) },
+  { DART_UINT64_C(0x58fae9f773886e18), DART_UINT64_C(0xaecc49914078536d) },
+  { DART_UINT64_C(0xaf39a475506a899e), DART_UINT64_C(0xda7f5bf590966848) },
+  { DART_UINT64_C(0x6d8406c952429603), DART_UINT64_C(0x888f99797a5e012d) },
+  { DART_UINT64_C(0xc8e5087ba6d33b83), DART_UINT64_C(0xaab37fd7d8f58178) },
+  { DART_UINT64_C(0xfb1e4a9a90880a64), DART_UINT64_C(0xd5605fcdcf32e1d6) },
+  { DART_UINT64_C(0x5cf2eea09a55067f), DART_UINT64_C(0x855c3be0a17fcd26) },
+  { DART_UINT64_C(0xf42faa48c0ea481e), DART_UINT64_C(0xa6b34ad8c9dfc06f) },
+  { DART_UINT64_C(0xf13b94daf124da26), DART_UINT64_C(0xd0601d8efc57b08b) },
+  { DART_UINT64_C(0x76c53d08d6b70858), DART_UINT64_C(0x823c12795db6ce57) },
+  { DART_UINT64_C(0x54768c4b0c64ca6e), DART_UINT64_C(0xa2cb1717b52481ed) },
+  { DART_UINT64_C(0xa9942f5dcf7dfd09), DART_UINT64_C(0xcb7ddcdda26da268) },
+  { DART_UINT64_C(0xd3f93b35435d7c4c), DART_UINT64_C(0xfe5d54150b090b02) },
+  { DART_UINT64_C(0xc47bc5014a1a6daf), DART_UINT64_C(0x9efa548d26e5a6e1) },
+  { DART_UINT64_C(0x359ab6419ca1091b), DART_UINT64_C(0xc6b8e9b0709f109a) },
+  { DART_UINT64_C(0xc30163d203c94b62), DART_UINT64_C(0xf867241c8cc6d4c0) },
+  { DART_UINT64_C(0x79e0de63425dcf1d), DART_UINT64_C(0x9b407691d7fc44f8) },
+  { DART_UINT64_C(0x985915fc12f542e4), DART_UINT64_C(0xc21094364dfb5636) },
+  { DART_UINT64_C(0x3e6f5b7b17b2939d), DART_UINT64_C(0xf294b943e17a2bc4) },
+  { DART_UINT64_C(0xa705992ceecf9c42), DART_UINT64_C(0x979cf3ca6cec5b5a) },
+  { DART_UINT64_C(0x50c6ff782a838353), DART_UINT64_C(0xbd8430bd08277231) },
+  { DART_UINT64_C(0xa4f8bf5635246428), DART_UINT64_C(0xece53cec4a314ebd) },
+  { DART_UINT64_C(0x871b7795e136be99), DART_UINT64_C(0x940f4613ae5ed136) },
+  { DART_UINT64_C(0x28e2557b59846e3f), DART_UINT64_C(0xb913179899f68584) },
+  { DART_UINT64_C(0x331aeada2fe589cf), DART_UINT64_C(0xe757dd7ec07426e5) },
+  { DART_UINT64_C(0x3ff0d2c85def7621), DART_UINT64_C(0x9096ea6f3848984f) },
+  { DART_UINT64_C(0x0fed077a756b53a9), DART_UINT64_C(0xb4bca50b065abe63) },
+  { DART_UINT64_C(0xd3e8495912c62894), DART_UINT64_C(0xe1ebce4dc7f16dfb) },
+  { DART_UINT64_C(0x64712dd7abbbd95c), DART_UINT64_C(0x8d3360f09cf6e4bd) },
+  { DART_UINT64_C(0xbd8d794d96aacfb3), DART_UINT64_C(0xb080392cc4349dec) },
+  { DART_UINT64_C(0xecf0d7a0fc5583a0), DART_UINT64_C(0xdca04777f541c567) },
+  { DART_UINT64_C(0xf41686c49db57244), DART_UINT64_C(0x89e42caaf9491b60) },
+  { DART_UINT64_C(0x311c2875c522ced5), DART_UINT64_C(0xac5d37d5b79b6239) },
+  { DART_UINT64_C(0x7d633293366b828b), DART_UINT64_C(0xd77485cb25823ac7) },
+  { DART_UINT64_C(0xae5dff9c02033197), DART_UINT64_C(0x86a8d39ef77164bc) },
+  { DART_UINT64_C(0xd9f57f830283fdfc), DART_UINT64_C(0xa8530886b54dbdeb) },
+  { DART_UINT64_C(0xd072df63c324fd7b), DART_UINT64_C(0xd267caa862a12d66) },
+  { DART_UINT64_C(0x4247cb9e59f71e6d), DART_UINT64_C(0x8380dea93da4bc60) },
+  { DART_UINT64_C(0x52d9be85f074e608), DART_UINT64_C(0xa46116538d0deb78) },
+  { DART_UINT64_C(0x67902e276c921f8b), DART_UINT64_C(0xcd795be870516656) },
+  { DART_UINT64_C(0x00ba1cd8a3db53b6), DART_UINT64_C(0x806bd9714632dff6) },
+  { DART_UINT64_C(0x80e8a40eccd228a4), DART_UINT64_C(0xa086cfcd97bf97f3) },
+  { DART_UINT64_C(0x6122cd128006b2cd), DART_UINT64_C(0xc8a883c0fdaf7df0) },
+  { DART_UINT64_C(0x796b805720085f81), DART_UINT64_C(0xfad2a4b13d1b5d6c) },
+  { DART_UINT64_C(0xcbe3303674053bb0), DART_UINT64_C(0x9cc3a6eec6311a63) },
+  { DART_UINT64_C(0xbedbfc4411068a9c), DART_UINT64_C(0xc3f490aa77bd60fc) },
+  { DART_UINT64_C(0xee92fb5515482d44), DART_UINT64_C(0xf4f1b4d515acb93b) },
+  { DART_UINT64_C(0x751bdd152d4d1c4a), DART_UINT64_C(0x991711052d8bf3c5) },
+  { DART_UINT64_C(0xd262d45a78a0635d), DART_UINT64_C(0xbf5cd54678eef0b6) },
+  { DART_UINT64_C(0x86fb897116c87c34), DART_UINT64_C(0xef340a98172aace4) },
+  { DART_UINT64_C(0xd45d35e6ae3d4da0), DART_UINT64_C(0x9580869f0e7aac0e) },
+  { DART_UINT64_C(0x8974836059cca109), DART_UINT64_C(0xbae0a846d2195712) },
+  { DART_UINT64_C(0x2bd1a438703fc94b), DART_UINT64_C(0xe998d258869facd7) },
+  { DART_UINT64_C(0x7b6306a34627ddcf), DART_UINT64_C(0x91ff83775423cc06) },
+  { DART_UINT64_C(0x1a3bc84c17b1d542), DART_UINT64_C(0xb67f6455292cbf08) },
+  { DART_UINT64_C(0x20caba5f1d9e4a93), DART_UINT64_C(0xe41f3d6a7377eeca) },
+  { DART_UINT64_C(0x547eb47b7282ee9c), DART_UINT64_C(0x8e938662882af53e) },
+  { DART_UINT64_C(0xe99e619a4f23aa43), DART_UINT64_C(0xb23867fb2a35b28d) },
+  { DART_UINT64_C(0x6405fa00e2ec94d4), DART_UINT64_C(0xdec681f9f4c31f31) },
+  { DART_UINT64_C(0xde83bc408dd3dd04), DART_UINT64_C(0x8b3c113c38f9f37e) },
+  { DART_UINT64_C(0x9624ab50b148d445), DART_UINT64_C(0xae0b158b4738705e) },
+  { DART_UINT64_C(0x3badd624dd9b0957), DART_UINT64_C(0xd98ddaee19068c76) },
+  { DART_UINT64_C(0xe54ca5d70a80e5d6), DART_UINT64_C(0x87f8a8d4cfa417c9) },
+  { DART_UINT64_C(0x5e9fcf4ccd211f4c), DART_UINT64_C(0xa9f6d30a038d1dbc) },
+  { DART_UINT64_C(0x7647c3200069671f), DART_UINT64_C(0xd47487cc8470652b) },
+  { DART_UINT64_C(0x29ecd9f40041e073), DART_UINT64_C(0x84c8d4dfd2c63f3b) },
+  { DART_UINT64_C(0xf468107100525890), DART_UINT64_C(0xa5fb0a17c777cf09) },
+  { DART_UINT64_C(0x7182148d4066eeb4), DART_UINT64_C(0xcf79cc9db955c2cc) },
+  { DART_UINT64_C(0xc6f14cd848405530), DART_UINT64_C(0x81ac1fe293d599bf) },
+  { DART_UINT64_C(0xb8ada00e5a506a7c), DART_UINT64_C(0xa21727db38cb002f) },
+  { DART_UINT64_C(0xa6d90811f0e4851c), DART_UINT64_C(0xca9cf1d206fdc03b) },
+  { DART_UINT64_C(0x908f4a166d1da663), DART_UINT64_C(0xfd442e4688bd304a) },
+  { DART_UINT64_C(0x9a598e4e043287fe), DART_UINT64_C(0x9e4a9cec15763e2e) },
+  { DART_UINT64_C(0x40eff1e1853f29fd), DART_UINT64_C(0xc5dd44271ad3cdba) },
+  { DART_UINT64_C(0xd12bee59e68ef47c), DART_UINT64_C(0xf7549530e188c128) },
+  { DART_UINT64_C(0x82bb74f8301958ce), DART_UINT64_C(0x9a94dd3e8cf578b9) },
+  { DART_UINT64_C(0xe36a52363c1faf01), DART_UINT64_C(0xc13a148e3032d6e7) },
+  { DART_UINT64_C(0xdc44e6c3cb279ac1), DART_UINT64_C(0xf18899b1bc3f8ca1) },
+  { DART_UINT64_C(0x29ab103a5ef8c0b9), DART_UINT64_C(0x96f5600f15a7b7e5) },
+  { DART_UINT64_C(0x7415d448f6b6f0e7), DART_UINT64_C(0xbcb2b812db11a5de) },
+  { DART_UINT64_C(0x111b495b3464ad21), DART_UINT64_C(0xebdf661791d60f56) },
+  { DART_UINT64_C(0xcab10dd900beec34), DART_UINT64_C(0x936b9fcebb25c995) },
+  { DART_UINT64_C(0x3d5d514f40eea742), DART_UINT64_C(0xb84687c269ef3bfb) },
+  { DART_UINT64_C(0x0cb4a5a3112a5112), DART_UINT64_C(0xe65829b3046b0afa) },
+  { DART_UINT64_C(0x47f0e785eaba72ab), DART_UINT64_C(0x8ff71a0fe2c2e6dc) },
+  { DART_UINT64_C(0x59ed216765690f56), DART_UINT64_C(0xb3f4e093db73a093) },
+  { DART_UINT64_C(0x306869c13ec3532c), DART_UINT64_C(0xe0f218b8d25088b8) },
+  { DART_UINT64_C(0x1e414218c73a13fb), DART_UINT64_C(0x8c974f7383725573) },
+  { DART_UINT64_C(0xe5d1929ef90898fa), DART_UINT64_C(0xafbd2350644eeacf) },
+  { DART_UINT64_C(0xdf45f746b74abf39), DART_UINT64_C(0xdbac6c247d62a583) },
+  { DART_UINT64_C(0x6b8bba8c328eb783), DART_UINT64_C(0x894bc396ce5da772) },
+  { DART_UINT64_C(0x066ea92f3f326564), DART_UINT64_C(0xab9eb47c81f5114f) },
+  { DART_UINT64_C(0xc80a537b0efefebd), DART_UINT64_C(0xd686619ba27255a2) },
+  { DART_UINT64_C(0xbd06742ce95f5f36), DART_UINT64_C(0x8613fd0145877585) },
+  { DART_UINT64_C(0x2c48113823b73704), DART_UINT64_C(0xa798fc4196e952e7) },
+  { DART_UINT64_C(0xf75a15862ca504c5), DART_UINT64_C(0xd17f3b51fca3a7a0) },
+  { DART_UINT64_C(0x9a984d73dbe722fb), DART_UINT64_C(0x82ef85133de648c4) },
+  { DART_UINT64_C(0xc13e60d0d2e0ebba), DART_UINT64_C(0xa3ab66580d5fdaf5) },
+  { DART_UINT64_C(0x318df905079926a8), DART_UINT64_C(0xcc963fee10b7d1b3) },
+  { DART_UINT64_C(0xfdf17746497f7052), DART_UINT64_C(0xffbbcfe994e5c61f) },
+  { DART_UINT64_C(0xfeb6ea8bedefa633), DART_UINT64_C(0x9fd561f1fd0f9bd3) },
+  { DART_UINT64_C(0xfe64a52ee96b8fc0), DART_UINT64_C(0xc7caba6e7c5382c8) },
+  { DART_UINT64_C(0x3dfdce7aa3c673b0), DART_UINT64_C(0xf9bd690a1b68637b) },
+  { DART_UINT64_C(0x06bea10ca65c084e), DART_UINT64_C(0x9c1661a651213e2d) },
+  { DART_UINT64_C(0x486e494fcff30a62), DART_UINT64_C(0xc31bfa0fe5698db8) },
+  { DART_UINT64_C(0x5a89dba3c3efccfa), DART_UINT64_C(0xf3e2f893dec3f126) },
+  { DART_UINT64_C(0xf89629465a75e01c), DART_UINT64_C(0x986ddb5c6b3a76b7) },
+  { DART_UINT64_C(0xf6bbb397f1135823), DART_UINT64_C(0xbe89523386091465) },
+  { DART_UINT64_C(0x746aa07ded582e2c), DART_UINT64_C(0xee2ba6c0678b597f) },
+  { DART_UINT64_C(0xa8c2a44eb4571cdc), DART_UINT64_C(0x94db483840b717ef) },
+  { DART_UINT64_C(0x92f34d62616ce413), DART_UINT64_C(0xba121a4650e4ddeb) },
+  { DART_UINT64_C(0x77b020baf9c81d17), DART_UINT64_C(0xe896a0d7e51e1566) },
+  { DART_UINT64_C(0x0ace1474dc1d122e), DART_UINT64_C(0x915e2486ef32cd60) },
+  { DART_UINT64_C(0x0d819992132456ba), DART_UINT64_C(0xb5b5ada8aaff80b8) },
+  { DART_UINT64_C(0x10e1fff697ed6c69), DART_UINT64_C(0xe3231912d5bf60e6) },
+  { DART_UINT64_C(0xca8d3ffa1ef463c1), DART_UINT64_C(0x8df5efabc5979c8f) },
+  { DART_UINT64_C(0xbd308ff8a6b17cb2), DART_UINT64_C(0xb1736b96b6fd83b3) },
+  { DART_UINT64_C(0xac7cb3f6d05ddbde), DART_UINT64_C(0xddd0467c64bce4a0) },
+  { DART_UINT64_C(0x6bcdf07a423aa96b), DART_UINT64_C(0x8aa22c0dbef60ee4) },
+  { DART_UINT64_C(0x86c16c98d2c953c6), DART_UINT64_C(0xad4ab7112eb3929d) },
+  { DART_UINT64_C(0xe871c7bf077ba8b7), DART_UINT64_C(0xd89d64d57a607744) },
+  { DART_UINT64_C(0x11471cd764ad4972), DART_UINT64_C(0x87625f056c7c4a8b) },
+  { DART_UINT64_C(0xd598e40d3dd89bcf), DART_UINT64_C(0xa93af6c6c79b5d2d) },
+  { DART_UINT64_C(0x4aff1d108d4ec2c3), DART_UINT64_C(0xd389b47879823479) },
+  { DART_UINT64_C(0xcedf722a585139ba), DART_UINT64_C(0x843610cb4bf160cb) },
+  { DART_UINT64_C(0xc2974eb4ee658828), DART_UINT64_C(0xa54394fe1eedb8fe) },
+  { DART_UINT64_C(0x733d226229feea32), DART_UINT64_C(0xce947a3da6a9273e) },
+  { DART_UINT64_C(0x0806357d5a3f525f), DART_UINT64_C(0x811ccc668829b887) },
+  { DART_UINT64_C(0xca07c2dcb0cf26f7), DART_UINT64_C(0xa163ff802a3426a8) },
+  { DART_UINT64_C(0xfc89b393dd02f0b5), DART_UINT64_C(0xc9bcff6034c13052) },
+  { DART_UINT64_C(0xbbac2078d443ace2), DART_UINT64_C(0xfc2c3f3841f17c67) },
+  { DART_UINT64_C(0xd54b944b84aa4c0d), DART_UINT64_C(0x9d9ba7832936edc0) },
+  { DART_UINT64_C(0x0a9e795e65d4df11), DART_UINT64_C(0xc5029163f384a931) },
+  { DART_UINT64_C(0x4d4617b5ff4a16d5), DART_UINT64_C(0xf64335bcf065d37d) },
+  { DART_UINT64_C(0x504bced1bf8e4e45), DART_UINT64_C(0x99ea0196163fa42e) },
+  { DART_UINT64_C(0xe45ec2862f71e1d6), DART_UINT64_C(0xc06481fb9bcf8d39) },
+  { DART_UINT64_C(0x5d767327bb4e5a4c), DART_UINT64_C(0xf07da27a82c37088) },
+  { DART_UINT64_C(0x3a6a07f8d510f86f), DART_UINT64_C(0x964e858c91ba2655) },
+  { DART_UINT64_C(0x890489f70a55368b), DART_UINT64_C(0xbbe226efb628afea) },
+  { DART_UINT64_C(0x2b45ac74ccea842e), DART_UINT64_C(0xeadab0aba3b2dbe5) },
+  { DART_UINT64_C(0x3b0b8bc90012929d), DART_UINT64_C(0x92c8ae6b464fc96f) },
+  { DART_UINT64_C(0x09ce6ebb40173744), DART_UINT64_C(0xb77ada0617e3bbcb) },
+  { DART_UINT64_C(0xcc420a6a101d0515), DART_UINT64_C(0xe55990879ddcaabd) },
+  { DART_UINT64_C(0x9fa946824a12232d), DART_UINT64_C(0x8f57fa54c2a9eab6) },
+  { DART_UINT64_C(0x47939822dc96abf9), DART_UINT64_C(0xb32df8e9f3546564) },
+  { DART_UINT64_C(0x59787e2b93bc56f7), DART_UINT64_C(0xdff9772470297ebd) },
+  { DART_UINT64_C(0x57eb4edb3c55b65a), DART_UINT64_C(0x8bfbea76c619ef36) },
+  { DART_UINT64_C(0xede622920b6b23f1), DART_UINT64_C(0xaefae51477a06b03) },
+  { DART_UINT64_C(0xe95fab368e45eced), DART_UINT64_C(0xdab99e59958885c4) },
+  { DART_UINT64_C(0x11dbcb0218ebb414), DART_UINT64_C(0x88b402f7fd75539b) },
+  { DART_UINT64_C(0xd652bdc29f26a119), DART_UINT64_C(0xaae103b5fcd2a881) },
+  { DART_UINT64_C(0x4be76d3346f0495f), DART_UINT64_C(0xd59944a37c0752a2) },
+  { DART_UINT64_C(0x6f70a4400c562ddb), DART_UINT64_C(0x857fcae62d8493a5) },
+  { DART_UINT64_C(0xcb4ccd500f6bb952), DART_UINT64_C(0xa6dfbd9fb8e5b88e) },
+  { DART_UINT64_C(0x7e2000a41346a7a7), DART_UINT64_C(0xd097ad07a71f26b2) },
+  { DART_UINT64_C(0x8ed400668c0c28c8), DART_UINT64_C(0x825ecc24c873782f) },
+  { DART_UINT64_C(0x728900802f0f32fa), DART_UINT64_C(0xa2f67f2dfa90563b) },
+  { DART_UINT64_C(0x4f2b40a03ad2ffb9), DART_UINT64_C(0xcbb41ef979346bca) },
+  { DART_UINT64_C(0xe2f610c84987bfa8), DART_UINT64_C(0xfea126b7d78186bc) },
+  { DART_UINT64_C(0x0dd9ca7d2df4d7c9), DART_UINT64_C(0x9f24b832e6b0f436) },
+  { DART_UINT64_C(0x91503d1c79720dbb), DART_UINT64_C(0xc6ede63fa05d3143) },
+  { DART_UINT64_C(0x75a44c6397ce912a), DART_UINT64_C(0xf8a95fcf88747d94) },
+  { DART_UINT64_C(0xc986afbe3ee11aba), DART_UINT64_C(0x9b69dbe1b548ce7c) },
+  { DART_UINT64_C(0xfbe85badce996168), DART_UINT64_C(0xc24452da229b021b) },
+  { DART_UINT64_C(0xfae27299423fb9c3), DART_UINT64_C(0xf2d56790ab41c2a2) },
+  { DART_UINT64_C(0xdccd879fc967d41a), DART_UINT64_C(0x97c560ba6b0919a5) },
+  { DART_UINT64_C(0x5400e987bbc1c920), DART_UINT64_C(0xbdb6b8e905cb600f) },
+  { DART_UINT64_C(0x290123e9aab23b68), DART_UINT64_C(0xed246723473e3813) },
+  { DART_UINT64_C(0xf9a0b6720aaf6521), DART_UINT64_C(0x9436c0760c86e30b) },
+  { DART_UINT64_C(0xf808e40e8d5b3e69), DART_UINT64_C(0xb94470938fa89bce) },
+  { DART_UINT64_C(0xb60b1d1230b20e04), DART_UINT64_C(0xe7958cb87392c2c2) },
+  { DART_UINT64_C(0xb1c6f22b5e6f48c2), DART_UINT64_C(0x90bd77f3483bb9b9) },
+  { DART_UINT64_C(0x1e38aeb6360b1af3), DART_UINT64_C(0xb4ecd5f01a4aa828) },
+  { DART_UINT64_C(0x25c6da63c38de1b0), DART_UINT64_C(0xe2280b6c20dd5232) },
+  { DART_UINT64_C(0x579c487e5a38ad0e), DART_UINT64_C(0x8d590723948a535f) },
+  { DART_UINT64_C(0x2d835a9df0c6d851), DART_UINT64_C(0xb0af48ec79ace837) },
+  { DART_UINT64_C(0xf8e431456cf88e65), DART_UINT64_C(0xdcdb1b2798182244) },
+  { DART_UINT64_C(0x1b8e9ecb641b58ff), DART_UINT64_C(0x8a08f0f8bf0f156b) },
+  { DART_UINT64_C(0xe272467e3d222f3f), DART_UINT64_C(0xac8b2d36eed2dac5) },
+  { DART_UINT64_C(0x5b0ed81dcc6abb0f), DART_UINT64_C(0xd7adf884aa879177) },
+  { DART_UINT64_C(0x98e947129fc2b4e9), DART_UINT64_C(0x86ccbb52ea94baea) },
+  { DART_UINT64_C(0x3f2398d747b36224), DART_UINT64_C(0xa87fea27a539e9a5) },
+  { DART_UINT64_C(0x8eec7f0d19a03aad), DART_UINT64_C(0xd29fe4b18e88640e) },
+  { DART_UINT64_C(0x1953cf68300424ac), DART_UINT64_C(0x83a3eeeef9153e89) },
+  { DART_UINT64_C(0x5fa8c3423c052dd7), DART_UINT64_C(0xa48ceaaab75a8e2b) },
+  { DART_UINT64_C(0x3792f412cb06794d), DART_UINT64_C(0xcdb02555653131b6) },
+  { DART_UINT64_C(0xe2bbd88bbee40bd0), DART_UINT64_C(0x808e17555f3ebf11) },
+  { DART_UINT64_C(0x5b6aceaeae9d0ec4), DART_UINT64_C(0xa0b19d2ab70e6ed6) },
+  { DART_UINT64_C(0xf245825a5a445275), DART_UINT64_C(0xc8de047564d20a8b) },
+  { DART_UINT64_C(0xeed6e2f0f0d56712), DART_UINT64_C(0xfb158592be068d2e) },
+  { DART_UINT64_C(0x55464dd69685606b), DART_UINT64_C(0x9ced737bb6c4183d) },
+  { DART_UINT64_C(0xaa97e14c3c26b886), DART_UINT64_C(0xc428d05aa4751e4c) },
+  { DART_UINT64_C(0xd53dd99f4b3066a8), DART_UINT64_C(0xf53304714d9265df) },
+  { DART_UINT64_C(0xe546a8038efe4029), DART_UINT64_C(0x993fe2c6d07b7fab) },
+  { DART_UINT64_C(0xde98520472bdd033), DART_UINT64_C(0xbf8fdb78849a5f96) },
+  { DART_UINT64_C(0x963e66858f6d4440), DART_UINT64_C(0xef73d256a5c0f77c) },
+  { DART_UINT64_C(0xdde7001379a44aa8), DART_UINT64_C(0x95a8637627989aad) },
+  { DART_UINT64_C(0x5560c018580d5d52), DART_UINT64_C(0xbb127c53b17ec159) },
+  { DART_UINT64_C(0xaab8f01e6e10b4a6), DART_UINT64_C(0xe9d71b689dde71af) },
+  { DART_UINT64_C(0xcab3961304ca70e8), DART_UINT64_C(0x9226712162ab070d) },
+  { DART_UINT64_C(0x3d607b97c5fd0d22), DART_UINT64_C(0xb6b00d69bb55c8d1) },
+  { DART_UINT64_C(0x8cb89a7db77c506a), DART_UINT64_C(0xe45c10c42a2b3b05) },
+  { DART_UINT64_C(0x77f3608e92adb242), DART_UINT64_C(0x8eb98a7a9a5b04e3) },
+  { DART_UINT64_C(0x55f038b237591ed3), DART_UINT64_C(0xb267ed1940f1c61c) },
+  { DART_UINT64_C(0x6b6c46dec52f6688), DART_UINT64_C(0xdf01e85f912e37a3) },
+  { DART_UINT64_C(0x2323ac4b3b3da015), DART_UINT64_C(0x8b61313bbabce2c6) },
+  { DART_UINT64_C(0xabec975e0a0d081a), DART_UINT64_C(0xae397d8aa96c1b77) },
+  { DART_UINT64_C(0x96e7bd358c904a21), DART_UINT64_C(0xd9c7dced53c72255) },
+  { DART_UINT64_C(0x7e50d64177da2e54), DART_UINT64_C(0x881cea14545c7575) },
+  { DART_UINT64_C(0xdde50bd1d5d0b9e9), DART_UINT64_C(0xaa242499697392d2) },
+  { DART_UINT64_C(0x955e4ec64b44e864), DART_UINT64_C(0xd4ad2dbfc3d07787) },
+  { DART_UINT64_C(0xbd5af13bef0b113e), DART_UINT64_C(0x84ec3c97da624ab4) },
+  { DART_UINT64_C(0xecb1ad8aeacdd58e), DART_UINT64_C(0xa6274bbdd0fadd61) },
+  { DART_UINT64_C(0x67de18eda5814af2), DART_UINT64_C(0xcfb11ead453994ba) },
+  { DART_UINT64_C(0x80eacf948770ced7), DART_UINT64_C(0x81ceb32c4b43fcf4) },
+  { DART_UINT64_C(0xa1258379a94d028d), DART_UINT64_C(0xa2425ff75e14fc31) },
+  { DART_UINT64_C(0x096ee45813a04330), DART_UINT64_C(0xcad2f7f5359a3b3e) },
+  { DART_UINT64_C(0x8bca9d6e188853fc), DART_UINT64_C(0xfd87b5f28300ca0d) },
+  { DART_UINT64_C(0x775ea264cf55347e), DART_UINT64_C(0x9e74d1b791e07e48) },
+  { DART_UINT64_C(0x95364afe032a819e), DART_UINT64_C(0xc612062576589dda) },
+  { DART_UINT64_C(0x3a83ddbd83f52205), DART_UINT64_C(0xf79687aed3eec551) },
+  { DART_UINT64_C(0xc4926a9672793543), DART_UINT64_C(0x9abe14cd44753b52) },
+  { DART_UINT64_C(0x75b7053c0f178294), DART_UINT64_C(0xc16d9a0095928a27) },
+  { DART_UINT64_C(0x5324c68b12dd6339), DART_UINT64_C(0xf1c90080baf72cb1) },
+  { DART_UINT64_C(0xd3f6fc16ebca5e04), DART_UINT64_C(0x971da05074da7bee) },
+  { DART_UINT64_C(0x88f4bb1ca6bcf585), DART_UINT64_C(0xbce5086492111aea) },
+  { DART_UINT64_C(0x2b31e9e3d06c32e6), DART_UINT64_C(0xec1e4a7db69561a5) },
+  { DART_UINT64_C(0x3aff322e62439fd0), DART_UINT64_C(0x9392ee8e921d5d07) },
+  { DART_UINT64_C(0x09befeb9fad487c3), DART_UINT64_C(0xb877aa3236a4b449) },
+  { DART_UINT64_C(0x4c2ebe687989a9b4), DART_UINT64_C(0xe69594bec44de15b) },
+  { DART_UINT64_C(0x0f9d37014bf60a11), DART_UINT64_C(0x901d7cf73ab0acd9) },
+  { DART_UINT64_C(0x538484c19ef38c95), DART_UINT64_C(0xb424dc35095cd80f) },
+  { DART_UINT64_C(0x2865a5f206b06fba), DART_UINT64_C(0xe12e13424bb40e13) },
+  { DART_UINT64_C(0xf93f87b7442e45d4), DART_UINT64_C(0x8cbccc096f5088cb) },
+  { DART_UINT64_C(0xf78f69a51539d749), DART_UINT64_C(0xafebff0bcb24aafe) },
+  { DART_UINT64_C(0xb573440e5a884d1c), DART_UINT64_C(0xdbe6fecebdedd5be) },
+  { DART_UINT64_C(0x31680a88f8953031), DART_UINT64_C(0x89705f4136b4a597) },
+  { DART_UINT64_C(0xfdc20d2b36ba7c3e), DART_UINT64_C(0xabcc77118461cefc) },
+  { DART_UINT64_C(0x3d32907604691b4d), DART_UINT64_C(0xd6bf94d5e57a42bc) },
+  { DART_UINT64_C(0xa63f9a49c2c1b110), DART_UINT64_C(0x8637bd05af6c69b5) },
+  { DART_UINT64_C(0x0fcf80dc33721d54), DART_UINT64_C(0xa7c5ac471b478423) },
+  { DART_UINT64_C(0xd3c36113404ea4a9), DART_UINT64_C(0xd1b71758e219652b) },
+  { DART_UINT64_C(0x645a1cac083126ea), DART_UINT64_C(0x83126e978d4fdf3b) },
+  { DART_UINT64_C(0x3d70a3d70a3d70a4), DART_UINT64_C(0xa3d70a3d70a3d70a) },
+  { DART_UINT64_C(0xcccccccccccccccd), DART_UINT64_C(0xcccccccccccccccc) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x8000000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xa000000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xc800000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xfa00000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x9c40000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xc350000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xf424000000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x9896800000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xbebc200000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xee6b280000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x9502f90000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xba43b74000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xe8d4a51000000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x9184e72a00000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xb5e620f480000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xe35fa931a0000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x8e1bc9bf04000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xb1a2bc2ec5000000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xde0b6b3a76400000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x8ac7230489e80000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xad78ebc5ac620000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xd8d726b7177a8000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x878678326eac9000) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xa968163f0a57b400) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xd3c21bcecceda100) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0x84595161401484a0) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xa56fa5b99019a5c8) },
+  { DART_UINT64_C(0x0000000000000000), DART_UINT64_C(0xcecb8f27f4200f3a) },
+  { DART_UINT64_C(0x4000000000000000), DART_UINT64_C(0x813f3978f8940984) },
+  { DART_UINT64_C(0x5000000000000000), DART_UINT64_C(0xa18f07d736b90be5) },
+  { DART_UINT64_C(0xa400000000000000), DART_UINT64_C(0xc9f2c9cd04674ede) },
+  { DART_UINT64_C(0x4d00000000000000), DART_UINT64_C(0xfc6f7c4045812296) },
+  { DART_UINT64_C(0xf020000000000000), DART_UINT64_C(0x9dc5ada82b70b59d) },
+  { DART_UINT64_C(0x6c28000000000000), DART_UINT64_C(0xc5371912364ce305) },
+  { DART_UINT64_C(0xc732000000000000), DART_UINT64_C(0xf684df56c3e01bc6) },
+  { DART_UINT64_C(0x3c7f400000000000), DART_UINT64_C(0x9a130b963a6c115c) },
+  { DART_UINT64_C(0x4b9f100000000000), DART_UINT64_C(0xc097ce7bc90715b3) },
+  { DART_UINT64_C(0x1e86d40000000000), DART_UINT64_C(0xf0bdc21abb48db20) },
+  { DART_UINT64_C(0x1314448000000000), DART_UINT64_C(0x96769950b50d88f4) },
+  { DART_UINT64_C(0x17d955a000000000), DART_UINT64_C(0xbc143fa4e250eb31) },
+  { DART_UINT64_C(0x5dcfab0800000000), DART_UINT64_C(0xeb194f8e1ae525fd) },
+  { DART_UINT64_C(0x5aa1cae500000000), DART_UINT64_C(0x92efd1b8d0cf37be) },
+  { DART_UINT64_C(0xf14a3d9e40000000), DART_UINT64_C(0xb7abc627050305ad) },
+  { DART_UINT64_C(0x6d9ccd05d0000000), DART_UINT64_C(0xe596b7b0c643c719) },
+  { DART_UINT64_C(0xe4820023a2000000), DART_UINT64_C(0x8f7e32ce7bea5c6f) },
+  { DART_UINT64_C(0xdda2802c8a800000), DART_UINT64_C(0xb35dbf821ae4f38b) },
+  { DART_UINT64_C(0xd50b2037ad200000), DART_UINT64_C(0xe0352f62a19e306e) },
+  { DART_UINT64_C(0x4526f422cc340000), DART_UINT64_C(0x8c213d9da502de45) },
+  { DART_UINT64_C(0x9670b12b7f410000), DART_UINT64_C(0xaf298d050e4395d6) },
+  { DART_UINT64_C(0x3c0cdd765f114000), DART_UINT64_C(0xdaf3f04651d47b4c) },
+  { DART_UINT64_C(0xa5880a69fb6ac800), DART_UINT64_C(0x88d8762bf324cd0f) },
+  { DART_UINT64_C(0x8eea0d047a457a00), DART_UINT64_C(0xab0e93b6efee0053) },
+  { DART_UINT64_C(0x72a4904598d6d880), DART_UINT64_C(0xd5d238a4abe98068) },
+  { DART_UINT64_C(0x47a6da2b7f864750), DART_UINT64_C(0x85a36366eb71f041) },
+  { DART_UINT64_C(0x999090b65f67d924), DART_UINT64_C(0xa70c3c40a64e6c51) },
+  { DART_UINT64_C(0xfff4b4e3f741cf6d), DART_UINT64_C(0xd0cf4b50cfe20765) },
+  { DART_UINT64_C(0xbff8f10e7a8921a4), DART_UINT64_C(0x82818f1281ed449f) },
+  { DART_UINT64_C(0xaff72d52192b6a0d), DART_UINT64_C(0xa321f2d7226895c7) },
+  { DART_UINT64_C(0x9bf4f8a69f764490), DART_UINT64_C(0xcbea6f8ceb02bb39) },
+  { DART_UINT64_C(0x02f236d04753d5b4), DART_UINT64_C(0xfee50b7025c36a08) },
+  { DART_UINT64_C(0x01d762422c946590), DART_UINT64_C(0x9f4f2726179a2245) },
+  { DART_UINT64_C(0x424d3ad2b7b97ef5), DART_UINT64_C(0xc722f0ef9d80aad6) },
+  { DART_UINT64_C(0xd2e0898765a7deb2), DART_UINT64_C(0xf8ebad2b84e0d58b) },
+  { DART_UINT64_C(0x63cc55f49f88eb2f), DART_UINT64_C(0x9b934c3b330c8577) },
+  { DART_UINT64_C(0x3cbf6b71c76b25fb), DART_UINT64_C(0xc2781f49ffcfa6d5) },
+  { DART_UINT64_C(0x8bef464e3945ef7a), DART_UINT64_C(0xf316271c7fc3908a) },
+  { DART_UINT64_C(0x97758bf0e3cbb5ac), DART_UINT64_C(0x97edd871cfda3a56) },
+  { DART_UINT64_C(0x3d52eeed1cbea317), DART_UINT64_C(0xbde94e8e43d0c8ec) },
+  { DART_UINT64_C(0x4ca7aaa863ee4bdd), DART_UINT64_C(0xed63a231d4c4fb27) },
+  { DART_UINT64_C(0x8fe8caa93e74ef6a), DART_UINT64_C(0x945e455f24fb1cf8) },
+  { DART_UINT64_C(0xb3e2fd538e122b44), DART_UINT64_C(0xb975d6b6ee39e436) },
+  { DART_UINT64_C(0x60dbbca87196b616), DART_UINT64_C(0xe7d34c64a9c85d44) },
+  { DART_UINT64_C(0xbc8955e946fe31cd), DART_UINT64_C(0x90e40fbeea1d3a4a) },
+  { DART_UINT64_C(0x6babab6398bdbe41), DART_UINT64_C(0xb51d13aea4a488dd) },
+  { DART_UINT64_C(0xc696963c7eed2dd1), DART_UINT64_C(0xe264589a4dcdab14) },
+  { DART_UINT64_C(0xfc1e1de5cf543ca2), DART_UINT64_C(0x8d7eb76070a08aec) },
+  { DART_UINT64_C(0x3b25a55f43294bcb), DART_UINT64_C(0xb0de65388cc8ada8) },
+  { DART_UINT64_C(0x49ef0eb713f39ebe), DART_UINT64_C(0xdd15fe86affad912) },
+  { DART_UINT64_C(0x6e3569326c784337), DART_UINT64_C(0x8a2dbf142dfcc7ab) },
+  { DART_UINT64_C(0x49c2c37f07965404), DART_UINT64_C(0xacb92ed9397bf996) },
+  { DART_UINT64_C(0xdc33745ec97be906), DART_UINT64_C(0xd7e77a8f87daf7fb) },
+  { DART_UINT64_C(0x69a028bb3ded71a3), DART_UINT64_C(0x86f0ac99b4e8dafd) },
+  { DART_UINT64_C(0xc40832ea0d68ce0c), DART_UINT64_C(0xa8acd7c0222311bc) },
+  { DART_UINT64_C(0xf50a3fa490c30190), DART_UINT64_C(0xd2d80db02aabd62b) },
+  { DART_UINT64_C(0x792667c6da79e0fa), DART_UINT64_C(0x83c7088e1aab65db) },
+  { DART_UINT64_C(0x577001b891185938), DART_UINT64_C(0xa4b8cab1a1563f52) },
+  { DART_UINT64_C(0xed4c0226b55e6f86), DART_UINT64_C(0xcde6fd5e09abcf26) },
+  { DART_UINT64_C(0x544f8158315b05b4), DART_UINT64_C(0x80b05e5ac60b6178) },
+  { DART_UINT64_C(0x696361ae3db1c721), DART_UINT64_C(0xa0dc75f1778e39d6) },
+  { DART_UINT64_C(0x03bc3a19cd1e38e9), DART_UINT64_C(0xc913936dd571c84c) },
+  { DART_UINT64_C(0x04ab48a04065c723), DART_UINT64_C(0xfb5878494ace3a5f) },
+  { DART_UINT64_C(0x62eb0d64283f9c76), DART_UINT64_C(0x9d174b2dcec0e47b) },
+  { DART_UINT64_C(0x3ba5d0bd324f8394), DART_UINT64_C(0xc45d1df942711d9a) },
+  { DART_UINT64_C(0xca8f44ec7ee36479), DART_UINT64_C(0xf5746577930d6500) },
+  { DART_UINT64_C(0x7e998b13cf4e1ecb), DART_UINT64_C(0x9968bf6abbe85f20) },
+  { DART_UINT64_C(0x9e3fedd8c321a67e), DART_UINT64_C(0xbfc2ef456ae276e8) },
+  { DART_UINT64_C(0xc5cfe94ef3ea101e), DART_UINT64_C(0xefb3ab16c59b14a2) },
+  { DART_UINT64_C(0xbba1f1d158724a12), DART_UINT64_C(0x95d04aee3b80ece5) },
+  { DART_UINT64_C(0x2a8a6e45ae8edc97), DART_UINT64_C(0xbb445da9ca61281f) },
+  { DART_UINT64_C(0xf52d09d71a3293bd), DART_UINT64_C(0xea1575143cf97226) },
+  { DART_UINT64_C(0x593c2626705f9c56), DART_UINT64_C(0x924d692ca61be758) },
+  { DART_UINT64_C(0x6f8b2fb00c77836c), DART_UINT64_C(0xb6e0c377cfa2e12e) },
+  { DART_UINT64_C(0x0b6dfb9c0f956447), DART_UINT64_C(0xe498f455c38b997a) },
+  { DART_UINT64_C(0x4724bd4189bd5eac), DART_UINT64_C(0x8edf98b59a373fec) },
+  { DART_UINT64_C(0x58edec91ec2cb657), DART_UINT64_C(0xb2977ee300c50fe7) },
+  { DART_UINT64_C(0x2f2967b66737e3ed), DART_UINT64_C(0xdf3d5e9bc0f653e1) },
+  { DART_UINT64_C(0xbd79e0d20082ee74), DART_UINT64_C(0x8b865b215899f46c) },
+  { DART_UINT64_C(0xecd8590680a3aa11), DART_UINT64_C(0xae67f1e9aec07187) },
+  { DART_UINT64_C(0xe80e6f4820cc9495), DART_UINT64_C(0xda01ee641a708de9) },
+  { DART_UINT64_C(0x3109058d147fdcdd), DART_UINT64_C(0x884134fe908658b2) },
+  { DART_UINT64_C(0xbd4b46f0599fd415), DART_UINT64_C(0xaa51823e34a7eede) },
+  { DART_UINT64_C(0x6c9e18ac7007c91a), DART_UINT64_C(0xd4e5e2cdc1d1ea96) },
+  { DART_UINT64_C(0x03e2cf6bc604ddb0), DART_UINT64_C(0x850fadc09923329e) },
+  { DART_UINT64_C(0x84db8346b786151c), DART_UINT64_C(0xa6539930bf6bff45) },
+  { DART_UINT64_C(0xe612641865679a63), DART_UINT64_C(0xcfe87f7cef46ff16) },
+  { DART_UINT64_C(0x4fcb7e8f3f60c07e), DART_UINT64_C(0x81f14fae158c5f6e) },
+  { DART_UINT64_C(0xe3be5e330f38f09d), DART_UINT64_C(0xa26da3999aef7749) },
+  { DART_UINT64_C(0x5cadf5bfd3072cc5), DART_UINT64_C(0xcb090c8001ab551c) },
+  { DART_UINT64_C(0x73d9732fc7c8f7f6), DART_UINT64_C(0xfdcb4fa002162a63) },
+  { DART_UINT64_C(0x2867e7fddcdd9afa), DART_UINT64_C(0x9e9f11c4014dda7e) },
+  { DART_UINT64_C(0xb281e1fd541501b8), DART_UINT64_C(0xc646d63501a1511d) },
+  { DART_UINT64_C(0x1f225a7ca91a4226), DART_UINT64_C(0xf7d88bc24209a565) },
+  { DART_UINT64_C(0x3375788de9b06958), DART_UINT64_C(0x9ae757596946075f) },
+  { DART_UINT64_C(0x0052d6b1641c83ae), DART_UINT64_C(0xc1a12d2fc3978937) },
+  { DART_UINT64_C(0xc0678c5dbd23a49a), DART_UINT64_C(0xf209787bb47d6b84) },
+  { DART_UINT64_C(0xf840b7ba963646e0), DART_UINT64_C(0x9745eb4d50ce6332) },
+  { DART_UINT64_C(0xb650e5a93bc3d898), DART_UINT64_C(0xbd176620a501fbff) },
+  { DART_UINT64_C(0xa3e51f138ab4cebe), DART_UINT64_C(0xec5d3fa8ce427aff) },
+  { DART_UINT64_C(0xc66f336c36b10137), DART_UINT64_C(0x93ba47c980e98cdf) },
+  { DART_UINT64_C(0xb80b0047445d4184), DART_UINT64_C(0xb8a8d9bbe123f017) },
+  { DART_UINT64_C(0xa60dc059157491e5), DART_UINT64_C(0xe6d3102ad96cec1d) },
+  { DART_UINT64_C(0x87c89837ad68db2f), DART_UINT64_C(0x9043ea1ac7e41392) },
+  { DART_UINT64_C(0x29babe4598c311fb), DART_UINT64_C(0xb454e4a179dd1877) },
+  { DART_UINT64_C(0xf4296dd6fef3d67a), DART_UINT64_C(0xe16a1dc9d8545e94) },
+  { DART_UINT64_C(0x1899e4a65f58660c), DART_UINT64_C(0x8ce2529e2734bb1d) },
+  { DART_UINT64_C(0x5ec05dcff72e7f8f), DART_UINT64_C(0xb01ae745b101e9e4) },
+  { DART_UINT64_C(0x76707543f4fa1f73), DART_UINT64_C(0xdc21a1171d42645d) },
+  { DART_UINT64_C(0x6a06494a791c53a8), DART_UINT64_C(0x899504ae72497eba) },
+  { DART_UINT64_C(0x0487db9d17636892), DART_UINT64_C(0xabfa45da0edbde69) },
+  { DART_UINT64_C(0x45a9d2845d3c42b6), DART_UINT64_C(0xd6f8d7509292d603) },
+  { DART_UINT64_C(0x0b8a2392ba45a9b2), DART_UINT64_C(0x865b86925b9bc5c2) },
+  { DART_UINT64_C(0x8e6cac7768d7141e), DART_UINT64_C(0xa7f26836f282b732) },
+  { DART_UINT64_C(0x3207d795430cd926), DART_UINT64_C(0xd1ef0244af2364ff) },
+  { DART_UINT64_C(0x7f44e6bd49e807b8), DART_UINT64_C(0x8335616aed761f1f) },
+  { DART_UINT64_C(0x5f16206c9c6209a6), DART_UINT64_C(0xa402b9c5a8d3a6e7) },
+  { DART_UINT64_C(0x36dba887c37a8c0f), DART_UINT64_C(0xcd036837130890a1) },
+  { DART_UINT64_C(0xc2494954da2c9789), DART_UINT64_C(0x802221226be55a64) },
+  { DART_UINT64_C(0xf2db9baa10b7bd6c), DART_UINT64_C(0xa02aa96b06deb0fd) },
+  { DART_UINT64_C(0x6f92829494e5acc7), DART_UINT64_C(0xc83553c5c8965d3d) },
+  { DART_UINT64_C(0xcb772339ba1f17f9), DART_UINT64_C(0xfa42a8b73abbf48c) },
+  { DART_UINT64_C(0xff2a760414536efb), DART_UINT64_C(0x9c69a97284b578d7) },
+  { DART_UINT64_C(0xfef5138519684aba), DART_UINT64_C(0xc38413cf25e2d70d) },
+  { DART_UINT64_C(0x7eb258665fc25d69), DART_UINT64_C(0xf46518c2ef5b8cd1) },
+  { DART_UINT64_C(0xef2f773ffbd97a61), DART_UINT64_C(0x98bf2f79d5993802) },
+  { DART_UINT64_C(0xaafb550ffacfd8fa), DART_UINT64_C(0xbeeefb584aff8603) },
+  { DART_UINT64_C(0x95ba2a53f983cf38), DART_UINT64_C(0xeeaaba2e5dbf6784) },
+  { DART_UINT64_C(0xdd945a747bf26183), DART_UINT64_C(0x952ab45cfa97a0b2) },
+  { DART_UINT64_C(0x94f971119aeef9e4), DART_UINT64_C(0xba756174393d88df) },
+  { DART_UINT64_C(0x7a37cd5601aab85d), DART_UINT64_C(0xe912b9d1478ceb17) },
+  { DART_UINT64_C(0xac62e055c10ab33a), DART_UINT64_C(0x91abb422ccb812ee) },
+  { DART_UINT64_C(0x577b986b314d6009), DART_UINT64_C(0xb616a12b7fe617aa) },
+  { DART_UINT64_C(0xed5a7e85fda0b80b), DART_UINT64_C(0xe39c49765fdf9d94) },
+  { DART_UINT64_C(0x14588f13be847307), DART_UINT64_C(0x8e41ade9fbebc27d) },
+  { DART_UINT64_C(0x596eb2d8ae258fc8), DART_UINT64_C(0xb1d219647ae6b31c) },
+  { DART_UINT64_C(0x6fca5f8ed9aef3bb), DART_UINT64_C(0xde469fbd99a05fe3) },
+  { DART_UINT64_C(0x25de7bb9480d5854), DART_UINT64_C(0x8aec23d680043bee) },
+  { DART_UINT64_C(0xaf561aa79a10ae6a), DART_UINT64_C(0xada72ccc20054ae9) },
+  { DART_UINT64_C(0x1b2ba1518094da04), DART_UINT64_C(0xd910f7ff28069da4) },
+  { DART_UINT64_C(0x90fb44d2f05d0842), DART_UINT64_C(0x87aa9aff79042286) },
+  { DART_UINT64_C(0x353a1607ac744a53), DART_UINT64_C(0xa99541bf57452b28) },
+  { DART_UINT64_C(0x42889b8997915ce8), DART_UINT64_C(0xd3fa922f2d1675f2) },
+  { DART_UINT64_C(0x69956135febada11), DART_UINT64_C(0x847c9b5d7c2e09b7) },
+  { DART_UINT64_C(0x43fab9837e699095), DART_UINT64_C(0xa59bc234db398c25) },
+  { DART_UINT64_C(0x94f967e45e03f4bb), DART_UINT64_C(0xcf02b2c21207ef2e) },
+  { DART_UINT64_C(0x1d1be0eebac278f5), DART_UINT64_C(0x8161afb94b44f57d) },
+  { DART_UINT64_C(0x6462d92a69731732), DART_UINT64_C(0xa1ba1ba79e1632dc) },
+  { DART_UINT64_C(0x7d7b8f7503cfdcfe), DART_UINT64_C(0xca28a291859bbf93) },
+  { DART_UINT64_C(0x5cda735244c3d43e), DART_UINT64_C(0xfcb2cb35e702af78) },
+  { DART_UINT64_C(0x3a0888136afa64a7), DART_UINT64_C(0x9defbf01b061adab) },
+  { DART_UINT64_C(0x088aaa1845b8fdd0), DART_UINT64_C(0xc56baec21c7a1916) },
+  { DART_UINT64_C(0x8aad549e57273d45), DART_UINT64_C(0xf6c69a72a3989f5b) },
+  { DART_UINT64_C(0x36ac54e2f678864b), DART_UINT64_C(0x9a3c2087a63f6399) },
+  { DART_UINT64_C(0x84576a1bb416a7dd), DART_UINT64_C(0xc0cb28a98fcf3c7f) },
+  { DART_UINT64_C(0x656d44a2a11c51d5), DART_UINT64_C(0xf0fdf2d3f3c30b9f) },
+  { DART_UINT64_C(0x9f644ae5a4b1b325), DART_UINT64_C(0x969eb7c47859e743) },
+  { DART_UINT64_C(0x873d5d9f0dde1fee), DART_UINT64_C(0xbc4665b596706114) },
+  { DART_UINT64_C(0xa90cb506d155a7ea), DART_UINT64_C(0xeb57ff22fc0c7959) },
+  { DART_UINT64_C(0x09a7f12442d588f2), DART_UINT64_C(0x9316ff75dd87cbd8) },
+  { DART_UINT64_C(0x0c11ed6d538aeb2f), DART_UINT64_C(0xb7dcbf5354e9bece) },
+  { DART_UINT64_C(0x8f1668c8a86da5fa), DART_UINT64_C(0xe5d3ef282a242e81) },
+  { DART_UINT64_C(0xf96e017d694487bc), DART_UINT64_C(0x8fa475791a569d10) },
+  { DART_UINT64_C(0x37c981dcc395a9ac), DART_UINT64_C(0xb38d92d760ec4455) },
+  { DART_UINT64_C(0x85bbe253f47b1417), DART_UINT64_C(0xe070f78d3927556a) },
+  { DART_UINT64_C(0x93956d7478ccec8e), DART_UINT64_C(0x8c469ab843b89562) },
+  { DART_UINT64_C(0x387ac8d1970027b2), DART_UINT64_C(0xaf58416654a6babb) },
+  { DART_UINT64_C(0x06997b05fcc0319e), DART_UINT64_C(0xdb2e51bfe9d0696a) },
+  { DART_UINT64_C(0x441fece3bdf81f03), DART_UINT64_C(0x88fcf317f22241e2) },
+  { DART_UINT64_C(0xd527e81cad7626c3), DART_UINT64_C(0xab3c2fddeeaad25a) },
+  { DART_UINT64_C(0x8a71e223d8d3b074), DART_UINT64_C(0xd60b3bd56a5586f1) },
+  { DART_UINT64_C(0xf6872d5667844e49), DART_UINT64_C(0x85c7056562757456) },
+  { DART_UINT64_C(0xb428f8ac016561db), DART_UINT64_C(0xa738c6bebb12d16c) },
+  { DART_UINT64_C(0xe13336d701beba52), DART_UINT64_C(0xd106f86e69d785c7) },
+  { DART_UINT64_C(0xecc0024661173473), DART_UINT64_C(0x82a45b450226b39c) },
+  { DART_UINT64_C(0x27f002d7f95d0190), DART_UINT64_C(0xa34d721642b06084) },
+  { DART_UINT64_C(0x31ec038df7b441f4), DART_UINT64_C(0xcc20ce9bd35c78a5) },
+  { DART_UINT64_C(0x7e67047175a15271), DART_UINT64_C(0xff290242c83396ce) },
+  { DART_UINT64_C(0x0f0062c6e984d386), DART_UINT64_C(0x9f79a169bd203e41) },
+  { DART_UINT64_C(0x52c07b78a3e60868), DART_UINT64_C(0xc75809c42c684dd1) },
+  { DART_UINT64_C(0xa7709a56ccdf8a82), DART_UINT64_C(0xf92e0c3537826145) },
+  { DART_UINT64_C(0x88a66076400bb691), DART_UINT64_C(0x9bbcc7a142b17ccb) },
+  { DART_UINT64_C(0x6acff893d00ea435), DART_UINT64_C(0xc2abf989935ddbfe) },
+  { DART_UINT64_C(0x0583f6b8c4124d43), DART_UINT64_C(0xf356f7ebf83552fe) },
+  { DART_UINT64_C(0xc3727a337a8b704a), DART_UINT64_C(0x98165af37b2153de) },
+  { DART_UINT64_C(0x744f18c0592e4c5c), DART_UINT64_C(0xbe1bf1b059e9a8d6) },
+  { DART_UINT64_C(0x1162def06f79df73), DART_UINT64_C(0xeda2ee1c7064130c) },
+  { DART_UINT64_C(0x8addcb5645ac2ba8), DART_UINT64_C(0x9485d4d1c63e8be7) },
+  { DART_UINT64_C(0x6d953e2bd7173692), DART_UINT64_C(0xb9a74a0637ce2ee1) },
+  { DART_UINT64_C(0xc8fa8db6ccdd0437), DART_UINT64_C(0xe8111c87c5c1ba99) },
+  { DART_UINT64_C(0x1d9c9892400a22a2), DART_UINT64_C(0x910ab1d4db9914a0) },
+  { DART_UINT64_C(0x2503beb6d00cab4b), DART_UINT64_C(0xb54d5e4a127f59c8) },
+  { DART_UINT64_C(0x2e44ae64840fd61d), DART_UINT64_C(0xe2a0b5dc971f303a) },
+  { DART_UINT64_C(0x5ceaecfed289e5d2), DART_UINT64_C(0x8da471a9de737e24) },
+  { DART_UINT64_C(0x7425a83e872c5f47), DART_UINT64_C(0xb10d8e1456105dad) },
+  { DART_UINT64_C(0xd12f124e28f77719), DART_UINT64_C(0xdd50f1996b947518) },
+  { DART_UINT64_C(0x82bd6b70d99aaa6f), DART_UINT64_C(0x8a5296ffe33cc92f) },
+  { DART_UINT64_C(0x636cc64d1001550b), DART_UINT64_C(0xace73cbfdc0bfb7b) },
+  { DART_UINT64_C(0x3c47f7e05401aa4e), DART_UINT64_C(0xd8210befd30efa5a) },
+  { DART_UINT64_C(0x65acfaec34810a71), DART_UINT64_C(0x8714a775e3e95c78) },
+  { DART_UINT64_C(0x7f1839a741a14d0d), DART_UINT64_C(0xa8d9d1535ce3b396) },
+  { DART_UINT64_C(0x1ede48111209a050), DART_UINT64_C(0xd31045a8341ca07c) },
+  { DART_UINT64_C(0x934aed0aab460432), DART_UINT64_C(0x83ea2b892091e44d) },
+  { DART_UINT64_C(0xf81da84d5617853f), DART_UINT64_C(0xa4e4b66b68b65d60) },
+  { DART_UINT64_C(0x36251260ab9d668e), DART_UINT64_C(0xce1de40642e3f4b9) },
+  { DART_UINT64_C(0xc1d72b7c6b426019), DART_UINT64_C(0x80d2ae83e9ce78f3) },
+  { DART_UINT64_C(0xb24cf65b8612f81f), DART_UINT64_C(0xa1075a24e4421730) },
+  { DART_UINT64_C(0xdee033f26797b627), DART_UINT64_C(0xc94930ae1d529cfc) },
+  { DART_UINT64_C(0x169840ef017da3b1), DART_UINT64_C(0xfb9b7cd9a4a7443c) },
+  { DART_UINT64_C(0x8e1f289560ee864e), DART_UINT64_C(0x9d412e0806e88aa5) },
+  { DART_UINT64_C(0xf1a6f2bab92a27e2), DART_UINT64_C(0xc491798a08a2ad4e) },
+  { DART_UINT64_C(0xae10af696774b1db), DART_UINT64_C(0xf5b5d7ec8acb58a2) },
+  { DART_UINT64_C(0xacca6da1e0a8ef29), DART_UINT64_C(0x9991a6f3d6bf1765) },
+  { DART_UINT64_C(0x17fd090a58d32af3), DART_UINT64_C(0xbff610b0cc6edd3f) },
+  { DART_UINT64_C(0xddfc4b4cef07f5b0), DART_UINT64_C(0xeff394dcff8a948e) },
+  { DART_UINT64_C(0x4abdaf101564f98e), DART_UINT64_C(0x95f83d0a1fb69cd9) },
+  { DART_UINT64_C(0x9d6d1ad41abe37f1), DART_UINT64_C(0xbb764c4ca7a4440f) },
+  { DART_UINT64_C(0x84c86189216dc5ed), DART_UINT64_C(0xea53df5fd18d5513) },
+  { DART_UINT64_C(0x32fd3cf5b4e49bb4), DART_UINT64_C(0x92746b9be2f8552c) },
+  { DART_UINT64_C(0x3fbc8c33221dc2a1), DART_UINT64_C(0xb7118682dbb66a77) },
+  { DART_UINT64_C(0x0fabaf3feaa5334a), DART_UINT64_C(0xe4d5e82392a40515) },
+  { DART_UINT64_C(0x29cb4d87f2a7400e), DART_UINT64_C(0x8f05b1163ba6832d) },
+  { DART_UINT64_C(0x743e20e9ef511012), DART_UINT64_C(0xb2c71d5bca9023f8) },
+  { DART_UINT64_C(0x914da9246b255416), DART_UINT64_C(0xdf78e4b2bd342cf6) },
+  { DART_UINT64_C(0x1ad089b6c2f7548e), DART_UINT64_C(0x8bab8eefb6409c1a) },
+  { DART_UINT64_C(0xa184ac2473b529b1), DART_UINT64_C(0xae9672aba3d0c320) },
+  { DART_UINT64_C(0xc9e5d72d90a2741e), DART_UINT64_C(0xda3c0f568cc4f3e8) },
+  { DART_UINT64_C(0x7e2fa67c7a658892), DART_UINT64_C(0x8865899617fb1871) },
+  { DART_UINT64_C(0xddbb901b98feeab7), DART_UINT64_C(0xaa7eebfb9df9de8d) },
+  { DART_UINT64_C(0x552a74227f3ea565), DART_UINT64_C(0xd51ea6fa85785631) },
+  { DART_UINT64_C(0xd53a88958f87275f), DART_UINT64_C(0x8533285c936b35de) },
+  { DART_UINT64_C(0x8a892abaf368f137), DART_UINT64_C(0xa67ff273b8460356) },
+  { DART_UINT64_C(0x2d2b7569b0432d85), DART_UINT64_C(0xd01fef10a657842c) },
+  { DART_UINT64_C(0x9c3b29620e29fc73), DART_UINT64_C(0x8213f56a67f6b29b) },
+  { DART_UINT64_C(0x8349f3ba91b47b8f), DART_UINT64_C(0xa298f2c501f45f42) },
+  { DART_UINT64_C(0x241c70a936219a73), DART_UINT64_C(0xcb3f2f7642717713) },
+  { DART_UINT64_C(0xed238cd383aa0110), DART_UINT64_C(0xfe0efb53d30dd4d7) },
+  { DART_UINT64_C(0xf4363804324a40aa), DART_UINT64_C(0x9ec95d1463e8a506) },
+  { DART_UINT64_C(0xb143c6053edcd0d5), DART_UINT64_C(0xc67bb4597ce2ce48) },
+  { DART_UINT64_C(0xdd94b7868e94050a), DART_UINT64_C(0xf81aa16fdc1b81da) },
+  { DART_UINT64_C(0xca7cf2b4191c8326), DART_UINT64_C(0x9b10a4e5e9913128) },
+  { DART_UINT64_C(0xfd1c2f611f63a3f0), DART_UINT64_C(0xc1d4ce1f63f57d72) },
+  { DART_UINT64_C(0xbc633b39673c8cec), DART_UINT64_C(0xf24a01a73cf2dccf) },
+  { DART_UINT64_C(0xd5be0503e085d813), DART_UINT64_C(0x976e41088617ca01) },
+  { DART_UINT64_C(0x4b2d8644d8a74e18), DART_UINT64_C(0xbd49d14aa79dbc82) },
+  { DART_UINT64_C(0xddf8e7d60ed1219e), DART_UINT64_C(0xec9c459d51852ba2) },
+  { DART_UINT64_C(0xcabb90e5c942b503), DART_UINT64_C(0x93e1ab8252f33b45) },
+  { DART_UINT64_C(0x3d6a751f3b936243), DART_UINT64_C(0xb8da1662e7b00a17) },
+  { DART_UINT64_C(0x0cc512670a783ad4), DART_UINT64_C(0xe7109bfba19c0c9d) },
+  { DART_UINT64_C(0x27fb2b80668b24c5), DART_UINT64_C(0x906a617d450187e2) },
+  { DART_UINT64_C(0xb1f9f660802dedf6), DART_UINT64_C(0xb484f9dc9641e9da) },
+  { DART_UINT64_C(0x5e7873f8a0396973), DART_UINT64_C(0xe1a63853bbd26451) },
+  { DART_UINT64_C(0xdb0b487b6423e1e8), DART_UINT64_C(0x8d07e33455637eb2) },
+  { DART_UINT64_C(0x91ce1a9a3d2cda62), DART_UINT64_C(0xb049dc016abc5e5f) },
+  { DART_UINT64_C(0x7641a140cc7810fb), DART_UINT64_C(0xdc5c5301c56b75f7) },
+  { DART_UINT64_C(0xa9e904c87fcb0a9d), DART_UINT64_C(0x89b9b3e11b6329ba) },
+  { DART_UINT64_C(0x546345fa9fbdcd44), DART_UINT64_C(0xac2820d9623bf429) },
+  { DART_UINT64_C(0xa97c177947ad4095), DART_UINT64_C(0xd732290fbacaf133) },
+  { DART_UINT64_C(0x49ed8eabcccc485d), DART_UINT64_C(0x867f59a9d4bed6c0) },
+  { DART_UINT64_C(0x5c68f256bfff5a74), DART_UINT64_C(0xa81f301449ee8c70) },
+  { DART_UINT64_C(0x73832eec6fff3111), DART_UINT64_C(0xd226fc195c6a2f8c) },
+  { DART_UINT64_C(0xc831fd53c5ff7eab), DART_UINT64_C(0x83585d8fd9c25db7) },
+  { DART_UINT64_C(0xba3e7ca8b77f5e55), DART_UINT64_C(0xa42e74f3d032f525) },
+  { DART_UINT64_C(0x28ce1bd2e55f35eb), DART_UINT64_C(0xcd3a1230c43fb26f) },
+  { DART_UINT64_C(0x7980d163cf5b81b3), DART_UINT64_C(0x80444b5e7aa7cf85) },
+  { DART_UINT64_C(0xd7e105bcc332621f), DART_UINT64_C(0xa0555e361951c366) },
+  { DART_UINT64_C(0x8dd9472bf3fefaa7), DART_UINT64_C(0xc86ab5c39fa63440) },
+  { DART_UINT64_C(0xb14f98f6f0feb951), DART_UINT64_C(0xfa856334878fc150) },
+  { DART_UINT64_C(0x6ed1bf9a569f33d3), DART_UINT64_C(0x9c935e00d4b9d8d2) },
+  { DART_UINT64_C(0x0a862f80ec4700c8), DART_UINT64_C(0xc3b8358109e84f07) },
+  { DART_UINT64_C(0xcd27bb612758c0fa), DART_UINT64_C(0xf4a642e14c6262c8) },
+  { DART_UINT64_C(0x8038d51cb897789c), DART_UINT64_C(0x98e7e9cccfbd7dbd) },
+  { DART_UINT64_C(0xe0470a63e6bd56c3), DART_UINT64_C(0xbf21e44003acdd2c) },
+  { DART_UINT64_C(0x1858ccfce06cac74), DART_UINT64_C(0xeeea5d5004981478) },
+  { DART_UINT64_C(0x0f37801e0c43ebc8), DART_UINT64_C(0x95527a5202df0ccb) },
+  { DART_UINT64_C(0xd30560258f54e6ba), DART_UINT64_C(0xbaa718e68396cffd) },
+  { DART_UINT64_C(0x47c6b82ef32a2069), DART_UINT64_C(0xe950df20247c83fd) },
+  { DART_UINT64_C(0x4cdc331d57fa5441), DART_UINT64_C(0x91d28b7416cdd27e) },
+  { DART_UINT64_C(0xe0133fe4adf8e952), DART_UINT64_C(0xb6472e511c81471d) },
+  { DART_UINT64_C(0x58180fddd97723a6), DART_UINT64_C(0xe3d8f9e563a198e5) },
+  { DART_UINT64_C(0x570f09eaa7ea7648), DART_UINT64_C(0x8e679c2f5e44ff8f) },
+};
+
+}  // namespace dart
@@ -0,0 +1,174 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/assert.h"
+#include "vm/double_conversion.h"
+#include "vm/fast_double_conversion.h"
+#include "vm/os.h"
+#include "vm/random.h"
+#include "vm/unit_test.h"
+
+#include "third_party/double-conversion/src/double-conversion.h"
+
+namespace dart {
+
+static const intptr_t kNumRandomValues = 100000;
+
+
+static double RandomDouble(Random* random) {
+  // Mix arbitrary bit patterns with denormals and short decimals.
+  uint64_t bits = random->NextUInt64() & ~(DART_UINT64_C(1) << 63);
+  switch (random->NextUInt32() % 4) {
+    case 0:
+      bits &= (DART_UINT64_C(1) << 52) - 1;
+      break;
+    case 1:
+      return static_cast<double>(random->NextUInt32() % 1000000) /
+          (1 + random->NextUInt32() % 1000);
+    default:
+      break;
+  }
+  return bit_cast<double>(bits);
+}
+
+
+// Compares the shortest digits with the Grisu3 and bignum implementation of
+// the double-conversion library.
+static void ExpectShortestLikeDoubleConversion(double d) {
+  const int kBufferSize = 32;
+  char expected[kBufferSize];
+  bool sign;
+  int length;
+  int point;
+  double_conversion::DoubleToStringConverter::DoubleToAscii(
+      d, double_conversion::DoubleToStringConverter::SHORTEST, 0,
+      expected, kBufferSize, &sign, &length, &point);
+
+  uint64_t digits;
+  int exponent;
+  FastDoubleConversion::ShortestDecimal(d, &digits, &exponent);
+  while ((digits % 10) == 0) {
+    digits /= 10;
+    exponent++;
+  }
+  char actual[kBufferSize];
+  const int actual_length = OS::SNPrint(actual, kBufferSize, "%" Pu64, digits);
+  EXPECT_STREQ(expected, actual);
+  EXPECT_EQ(point, actual_length + exponent);
+}
+
+
+UNIT_TEST_CASE(FastDoubleConversion_ShortestDecimal) {
+  const double kValues[] = {
+    5e-324, 2.2250738585072009e-308, 2.2250738585072014e-308,
+    1.7976931348623157e308, 0.1, 0.3, 1.0 / 3, 1e21, 1e22, 1e23,
+    9007199254740993.0, 123456789012345680000.0, 4.35, 0.000001,
+  };
+  for (size_t i = 0; i < ARRAY_SIZE(kValues); i++) {
+    ExpectShortestLikeDoubleConversion(kValues[i]);
+  }
+  Random random(42);
+  for (intptr_t i = 0; i < kNumRandomValues; i++) {
+    const double d = RandomDouble(&random);
+    if ((d != 0.0) && !isinf(d) && !isnan(d)) {
+      ExpectShortestLikeDoubleConversion(d);
+    }
+  }
+}
+
+
+UNIT_TEST_CASE(FastDoubleConversion_DoubleToCString) {
+  const struct {
+    double value;
+    const char* expected;
+  } kCases[] = {
+    { 0.0, "0.0" }, { -0.0, "-0.0" }, { 1.0, "1.0" }, { -42.0, "-42.0" },
+    { 1.5, "1.5" }, { 0.1, "0.1" }, { 100.0, "100.0" },
+    { 123.456, "123.456" }, { 1e-6, "0.000001" }, { 1.5e-7, "1.5e-7" },
+    { 1e20, "100000000000000000000.0" }, { 1e21, "1e+21" },
+    { 1.2345e25, "1.2345e+25" }, { 5e-324, "5e-324" },
+    { 1.7976931348623157e308, "1.7976931348623157e+308" },
+    { 9007199254740993.0, "9007199254740992.0" },
+  };
+  const int kBufferSize = 128;
+  char buffer[kBufferSize];
+  for (size_t i = 0; i < ARRAY_SIZE(kCases); i++) {
+    DoubleToCString(kCases[i].value, buffer, kBufferSize);
+    EXPECT_STREQ(kCases[i].expected, buffer);
+  }
+  DoubleToCString(kPosInfinity, buffer, kBufferSize);
+  EXPECT_STREQ("Infinity", buffer);
+  DoubleToCString(-kPosInfinity, buffer, kBufferSize);
+  EXPECT_STREQ("-Infinity", buffer);
+  DoubleToCString(NAN, buffer, kBufferSize);
+  EXPECT_STREQ("NaN", buffer);
+}
+
+
+static void ExpectParsesLikeDoubleConversion(const char* str) {
+  const intptr_t length = strlen(str);
+  double actual;
+  if (!FastDoubleConversion::StringToDouble(str, length, &actual)) {
+    // Left to the double-conversion library.
+    return;
+  }
+  double_conversion::StringToDoubleConverter converter(
+      double_conversion::StringToDoubleConverter::NO_FLAGS,
+      0.0, 0.0, "Infinity", "NaN");
+  int parsed_count = 0;
+  const double expected =
+      converter.StringToDouble(str, static_cast<int>(length), &parsed_count);
+  EXPECT_EQ(length, parsed_count);
+  EXPECT_EQ(bit_cast<uint64_t>(expected), bit_cast<uint64_t>(actual));
+}
+
+
+UNIT_TEST_CASE(FastDoubleConversion_StringToDouble) {
+  const char* kValid[] = {
+    "0", "-0", "+0.0", "007", "1", "1.5", "-1.5e10", "1E5", "1e-400",
+    "-1e400", "4.9e-324", "2.4703282292062327e-324",
+    "2.4703282292062328e-324", "1.7976931348623157e308",
+    "1.7976931348623159e308", "9007199254740993", "0.1", "3.14159",
+    "123456789012345678901234567890", "1.00000000000000011102230246251565",
+  };
+  for (size_t i = 0; i < ARRAY_SIZE(kValid); i++) {
+    ExpectParsesLikeDoubleConversion(kValid[i]);
+  }
+  // The fast path only accepts plain decimal numbers.
+  const char* kRejected[] = {
+    "", "-", "+", ".5", "5.", "1e", "1e+", "e5", "1.e5", "NaN", "Infinity",
+    " 1", "1 ", "0x10", "1_0", "--1",
+  };
+  for (size_t i = 0; i < ARRAY_SIZE(kRejected); i++) {
+    double result;
+    EXPECT(!FastDoubleConversion::StringToDouble(
+        kRejected[i], strlen(kRejected[i]), &result));
+  }
+
+  Random random(42);
+  const int kBufferSize = 128;
+  char buffer[kBufferSize];
+  for (intptr_t i = 0; i < kNumRandomValues; i++) {
+    // Round trip the shortest and the 17 digits representation of random
+    // doubles, and parse random digit strings with random exponents.
+    const double d = RandomDouble(&random);
+    DoubleToCString(d, buffer, kBufferSize);
+    ExpectParsesLikeDoubleConversion(buffer);
+    OS::SNPrint(buffer, kBufferSize, "%.16e", d);
+    ExpectParsesLikeDoubleConversion(buffer);
+    const intptr_t num_digits = 1 + random.NextUInt32() % 25;
+    intptr_t position = 0;
+    for (intptr_t j = 0; j < num_digits; j++) {
+      buffer[position++] = '0' + random.NextUInt32() % 10;
+      if ((j == 0) && (num_digits > 1)) {
+        buffer[position++] = '.';
+      }
+    }
+    OS::SNPrint(&buffer[position], kBufferSize - position, "e%d",
+                static_cast<int>(random.NextUInt32() % 720) - 360);
+    ExpectParsesLikeDoubleConversion(buffer);
+  }
+}
+
+}  // namespace dart
@@ -32,6 +32,9 @@
 
 namespace dart {
 
+DEFINE_FLAG(bool, coverage_probes, false,
+            "Record source coverage with probes in unoptimized and optimized "
+            "code.");
 DEFINE_FLAG(bool, eliminate_type_checks, true,
             "Eliminate type checks when allowed by static type analysis.");
 DEFINE_FLAG(bool, print_ast, false, "Print abstract syntax tree.");
@@ -303,6 +306,40 @@ JoinEntryInstr* NestedSwitch::ContinueTargetFor(SourceLabel* label) {
 }
 
 
+// Returns the coverage array of the function if coverage probes must be
+// emitted for it. Only the mutator thread allocates the array, background
+// compilations only emit probes for positions that already have a slot.
+static RawArray* CoverageArrayFor(const ParsedFunction& parsed_function) {
+  if (!FLAG_coverage_probes || FLAG_precompiled_mode) {
+    return Array::null();
+  }
+  const Function& function = parsed_function.function();
+  switch (function.kind()) {
+    case RawFunction::kRegularFunction:
+    case RawFunction::kClosureFunction:
+    case RawFunction::kGetterFunction:
+    case RawFunction::kSetterFunction:
+    case RawFunction::kConstructor:
+      break;
+    default:
+      return Array::null();
+  }
+  if (!function.token_pos().IsReal() ||
+      !function.end_token_pos().IsReal() ||
+      (function.end_token_pos() < function.token_pos())) {
+    return Array::null();
+  }
+  if ((function.coverage_array() == Array::null()) &&
+      parsed_function.thread()->IsMutatorThread()) {
+    const intptr_t length =
+        function.end_token_pos().Pos() - function.token_pos().Pos() + 1;
+    function.set_coverage_array(
+        Array::Handle(parsed_function.zone(), Array::New(length, Heap::kOld)));
+  }
+  return function.coverage_array();
+}
+
+
 FlowGraphBuilder::FlowGraphBuilder(
     const ParsedFunction& parsed_function,
     const ZoneGrowableArray<const ICData*>& ic_data_array,
@@ -327,7 +364,9 @@ FlowGraphBuilder::FlowGraphBuilder(
         nesting_stack_(NULL),
         osr_id_(osr_id),
         jump_count_(0),
-        await_joins_(new(Z) ZoneGrowableArray<JoinEntryInstr*>()) { }
+        await_joins_(new(Z) ZoneGrowableArray<JoinEntryInstr*>()),
+        coverage_array_(Array::ZoneHandle(
+            parsed_function.zone(), CoverageArrayFor(parsed_function))) { }
 
 
 void FlowGraphBuilder::AddCatchEntry(CatchBlockEntryInstr* entry) {
@@ -666,6 +705,11 @@ void EffectGraphVisitor::Append(const EffectGraphVisitor& other_fragment) {
 
 Value* EffectGraphVisitor::Bind(Definition* definition) {
   ASSERT(is_open());
+  if (definition->IsInstanceCall() ||
+      definition->IsStaticCall() ||
+      definition->IsClosureCall()) {
+    AddCoverageProbe(definition->token_pos());
+  }
   owner()->DeallocateTemps(definition->InputCount());
   owner()->add_args_pushed(-definition->ArgumentCount());
   definition->set_temp_index(owner()->AllocateTemp());
@@ -681,6 +725,11 @@ Value* EffectGraphVisitor::Bind(Definition* definition) {
 
 void EffectGraphVisitor::Do(Definition* definition) {
   ASSERT(is_open());
+  if (definition->IsInstanceCall() ||
+      definition->IsStaticCall() ||
+      definition->IsClosureCall()) {
+    AddCoverageProbe(definition->token_pos());
+  }
   owner()->DeallocateTemps(definition->InputCount());
   owner()->add_args_pushed(-definition->ArgumentCount());
   if (is_empty()) {
@@ -692,6 +741,42 @@ void EffectGraphVisitor::Do(Definition* definition) {
 }
 
 
+void EffectGraphVisitor::AddCoverageProbe(TokenPosition token_pos) {
+  const Array& coverage_array = owner()->coverage_array();
+  if (coverage_array.IsNull() || !token_pos.IsReal()) {
+    return;
+  }
+  const intptr_t index =
+      token_pos.Pos() - owner()->function().token_pos().Pos();
+  if ((index < 0) || (index >= coverage_array.Length())) {
+    return;
+  }
+  if (coverage_array.At(index) == Object::null()) {
+    if (!thread()->IsMutatorThread()) {
+      return;
+    }
+    coverage_array.SetAt(index, Smi::Handle(Z,
+        Smi::New(Function::kCoverageProbeNotHit)));
+  }
+  // The probe stores into the array every time it runs. A store is cheap
+  // enough to stay in optimized code, so no deoptimization or patching is
+  // needed to collect coverage.
+  Value* array = Bind(new(Z) ConstantInstr(coverage_array, token_pos));
+  Value* index_value = Bind(new(Z) ConstantInstr(
+      Smi::ZoneHandle(Z, Smi::New(index)), token_pos));
+  Value* hit = Bind(new(Z) ConstantInstr(
+      Smi::ZoneHandle(Z, Smi::New(Function::kCoverageProbeHit)), token_pos));
+  Do(new(Z) StoreIndexedInstr(array,
+                              index_value,
+                              hit,
+                              kNoStoreBarrier,
+                              Instance::ElementSizeFor(kArrayCid),
+                              kArrayCid,
+                              Thread::kNoDeoptId,
+                              token_pos));
+}
+
+
 void EffectGraphVisitor::AddInstruction(Instruction* instruction) {
   ASSERT(is_open());
   ASSERT(instruction->IsPushArgument() || !instruction->IsDefinition());
@@ -4014,6 +4099,11 @@ void EffectGraphVisitor::VisitSequenceNode(SequenceNode* node) {
     }
   }
 
+  if (is_top_level_sequence) {
+    // Records the entry of functions that make no calls.
+    AddCoverageProbe(function.token_pos());
+  }
+
   if (FLAG_support_debugger &&
       is_top_level_sequence &&
       function.is_debuggable()) {
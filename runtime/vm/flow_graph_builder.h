@@ -112,6 +112,9 @@ class FlowGraphBuilder : public ValueObject {
   const ZoneGrowableArray<const ICData*>& ic_data_array() const {
     return ic_data_array_;
   }
+  // The coverage array of the function or null if no coverage probes are
+  // emitted, see Function::coverage_array.
+  const Array& coverage_array() const { return coverage_array_; }
 
   void Bailout(const char* reason) const;
 
@@ -225,6 +228,8 @@ class FlowGraphBuilder : public ValueObject {
   intptr_t jump_count_;
   ZoneGrowableArray<JoinEntryInstr*>* await_joins_;
 
+  const Array& coverage_array_;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(FlowGraphBuilder);
 };
 
@@ -297,6 +302,10 @@ class EffectGraphVisitor : public AstNodeVisitor {
   // actually added to the graph.
   void AddReturnExit(TokenPosition token_pos, Value* value);
 
+  // Marks the source position as hit in the coverage array of the function
+  // when --coverage_probes is enabled.
+  void AddCoverageProbe(TokenPosition token_pos);
+
  protected:
   Definition* BuildStoreTemp(const LocalVariable& local,
                              Value* value,
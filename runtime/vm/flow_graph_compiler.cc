@@ -1290,6 +1290,7 @@ void FlowGraphCompiler::GenerateStringTypeCheck(Register kClassIdReg,
   args.Add(kTwoByteStringCid);
   args.Add(kExternalOneByteStringCid);
   args.Add(kExternalTwoByteStringCid);
+  args.Add(kConsStringCid);
   CheckClassIds(kClassIdReg, args, is_instance_lbl, is_not_instance_lbl);
 }
 
@@ -1875,7 +1876,7 @@ void FlowGraphCompiler::EmitPolymorphicInstanceCall(
     TokenPosition token_pos,
     LocationSummary* locs,
     bool complete) {
-  if (FLAG_polymorphic_with_deopt) {
+  if (parsed_function().function().AllowsPolymorphicDeopt()) {
     Label* deopt = AddDeoptStub(deopt_id,
                                 ICData::kDeoptPolymorphicInstanceCallTestFail);
     Label ok;
@@ -428,9 +428,9 @@ bool FlowGraphCompiler::GenerateInstantiatedTypeNoArgumentsTest(
 // RAX: instance to test.
 // Clobbers R10, R13.
 // Immediate class test already done.
-// TODO(srdjan): Implement a quicker subtype check, as type test
-// arrays can grow too high, but they may be useful when optimizing
-// code (type-feedback).
+// The superclass chain of the instance class is walked inline first: this
+// answers the common case of testing against a superclass without calling
+// the stub. Interface and mixin subtypes fall through to the cache.
 RawSubtypeTestCache* FlowGraphCompiler::GenerateSubtype1TestCacheLookup(
     TokenPosition token_pos,
     const Class& type_class,
@@ -440,11 +440,19 @@ RawSubtypeTestCache* FlowGraphCompiler::GenerateSubtype1TestCacheLookup(
   const Register kInstanceReg = RAX;
   __ LoadClass(R10, kInstanceReg);
   // R10: instance class.
-  // Check immediate superclass equality.
+  // Check superclass equality for all superclasses.
+  Label loop, not_superclass;
+  __ Bind(&loop);
   __ movq(R13, FieldAddress(R10, Class::super_type_offset()));
+  __ CompareObject(R13, Object::null_object());
+  __ j(EQUAL, &not_superclass, Assembler::kNearJump);
   __ movq(R13, FieldAddress(R13, Type::type_class_id_offset()));
   __ CompareImmediate(R13, Immediate(Smi::RawValue(type_class.id())));
   __ j(EQUAL, is_instance_lbl);
+  __ SmiUntag(R13);
+  __ LoadClassById(R10, R13);
+  __ jmp(&loop, Assembler::kNearJump);
+  __ Bind(&not_superclass);
 
   const Register kTypeArgumentsReg = kNoRegister;
   const Register kTempReg = R10;
@@ -51,6 +51,14 @@ DEFINE_FLAG(int, inlining_constant_arguments_min_size_threshold, 60,
 DEFINE_FLAG(int, inlining_hotness, 10,
     "Inline only hotter calls, in percents (0 .. 100); "
     "default 10%: calls above-equal 10% of max-count are inlined.");
+DEFINE_FLAG(bool, inlining_frequency_heuristics, true,
+    "Inline hotter call sites first and allow larger callees at hot call "
+    "sites.");
+DEFINE_FLAG(int, inlining_hot_call_sites, 50,
+    "Calls above-equal this percentage (0 .. 100) of max-count are hot and "
+    "may inline callees larger than inlining_callee_size_threshold.");
+DEFINE_FLAG(int, inlining_hot_callee_size_threshold, 160,
+    "Do not inline callees larger than threshold at the hottest call sites.");
 DEFINE_FLAG(int, inlining_recursion_depth_threshold, 1,
     "Inline recursive function calls up to threshold recursion depth.");
 DEFINE_FLAG(int, max_inlined_per_depth, 500,
@@ -194,11 +202,15 @@ class CallSites : public ValueObject {
   struct InstanceCallInfo {
     PolymorphicInstanceCallInstr* call;
     double ratio;
+    // Position in the order the call sites were collected, used to break
+    // ties when sorting by frequency.
+    intptr_t index;
     const FlowGraph* caller_graph;
     InstanceCallInfo(PolymorphicInstanceCallInstr* call_arg,
                      FlowGraph* flow_graph)
         : call(call_arg),
           ratio(0.0),
+          index(0),
           caller_graph(flow_graph) {}
     const Function& caller() const { return caller_graph->function(); }
   };
@@ -206,10 +218,12 @@ class CallSites : public ValueObject {
   struct StaticCallInfo {
     StaticCallInstr* call;
     double ratio;
+    intptr_t index;  // See InstanceCallInfo::index.
     FlowGraph* caller_graph;
     StaticCallInfo(StaticCallInstr* value, FlowGraph* flow_graph)
         : call(value),
           ratio(0.0),
+          index(0),
           caller_graph(flow_graph) {}
     const Function& caller() const { return caller_graph->function(); }
   };
@@ -253,6 +267,21 @@ class CallSites : public ValueObject {
     instance_calls_.Clear();
   }
 
+  // Order call sites from the hottest to the coldest so that hot call sites
+  // are inlined before the caller size budget is exhausted. Call sites with
+  // the same frequency keep the order in which they were collected, because
+  // Sort is not stable.
+  void SortByFrequency() {
+    for (intptr_t i = 0; i < instance_calls_.length(); i++) {
+      instance_calls_[i].index = i;
+    }
+    for (intptr_t i = 0; i < static_calls_.length(); i++) {
+      static_calls_[i].index = i;
+    }
+    instance_calls_.Sort(CompareInstanceCalls);
+    static_calls_.Sort(CompareStaticCalls);
+  }
+
   void ComputeCallSiteRatio(intptr_t static_call_start_ix,
                             intptr_t instance_call_start_ix) {
     const intptr_t num_static_calls =
@@ -297,6 +326,30 @@ class CallSites : public ValueObject {
     }
   }
 
+  static int CompareInstanceCalls(const InstanceCallInfo* a,
+                                  const InstanceCallInfo* b) {
+    const int result = CompareRatios(a->ratio, b->ratio);
+    return (result != 0) ? result : CompareIndices(a->index, b->index);
+  }
+
+  static int CompareStaticCalls(const StaticCallInfo* a,
+                                const StaticCallInfo* b) {
+    const int result = CompareRatios(a->ratio, b->ratio);
+    return (result != 0) ? result : CompareIndices(a->index, b->index);
+  }
+
+  static int CompareRatios(double a, double b) {
+    if (a > b) return -1;
+    if (a < b) return 1;
+    return 0;
+  }
+
+  static int CompareIndices(intptr_t a, intptr_t b) {
+    if (a < b) return -1;
+    if (a > b) return 1;
+    return 0;
+  }
+
   static void RecordAllNotInlinedFunction(
       FlowGraph* graph,
       intptr_t depth,
@@ -422,7 +475,8 @@ struct InlinedCallData {
         parameter_stubs(NULL),
         exit_collector(NULL),
         caller(caller),
-        caller_inlining_id_(caller_inlining_id) { }
+        caller_inlining_id_(caller_inlining_id),
+        ratio(0.0) { }
 
   Definition* call;
   GrowableArray<Value*>* arguments;
@@ -431,6 +485,9 @@ struct InlinedCallData {
   InlineExitCollector* exit_collector;
   const Function& caller;
   const intptr_t caller_inlining_id_;
+  // Execution count of the call site relative to the hottest call site in
+  // the same graph, if known.
+  double ratio;
 };
 
 
@@ -515,11 +572,34 @@ class CallSiteInliner : public ValueObject {
 
   bool trace_inlining() const { return inliner_->trace_inlining(); }
 
+  static bool IsHotCallSite(double ratio) {
+    return FLAG_inlining_frequency_heuristics &&
+        ((ratio * 100) >= FLAG_inlining_hot_call_sites);
+  }
+
+  // Callee size threshold for a call site that is executed 'ratio' times as
+  // often as the hottest call site in the same graph. It grows linearly from
+  // inlining_callee_size_threshold for the coldest hot call site to
+  // inlining_hot_callee_size_threshold for the hottest one.
+  static intptr_t CalleeSizeThreshold(double ratio) {
+    if (!IsHotCallSite(ratio) || (FLAG_inlining_hot_call_sites >= 100)) {
+      return FLAG_inlining_callee_size_threshold;
+    }
+    const double hot_ratio = FLAG_inlining_hot_call_sites / 100.0;
+    const double scale = (ratio - hot_ratio) / (1.0 - hot_ratio);
+    const intptr_t extra = Utils::Maximum(
+        0, FLAG_inlining_hot_callee_size_threshold -
+               FLAG_inlining_callee_size_threshold);
+    return FLAG_inlining_callee_size_threshold +
+        static_cast<intptr_t>(scale * extra);
+  }
+
   // Inlining heuristics based on Cooper et al. 2008.
   bool ShouldWeInline(const Function& callee,
                       intptr_t instr_count,
                       intptr_t call_site_count,
-                      intptr_t const_arg_count) {
+                      intptr_t const_arg_count,
+                      double ratio) {
     if (inliner_->AlwaysInline(callee)) {
       return true;
     }
@@ -527,17 +607,27 @@ class CallSiteInliner : public ValueObject {
       // Prevent methods becoming humongous and thus slow to compile.
       return false;
     }
+    const intptr_t callee_size_threshold = CalleeSizeThreshold(ratio);
     if (const_arg_count > 0) {
-      if (instr_count > FLAG_inlining_constant_arguments_max_size_threshold) {
+      if (instr_count > Utils::Maximum(
+              callee_size_threshold,
+              static_cast<intptr_t>(
+                  FLAG_inlining_constant_arguments_max_size_threshold))) {
         return false;
       }
-    } else if (instr_count > FLAG_inlining_callee_size_threshold) {
+    } else if (instr_count > callee_size_threshold) {
       return false;
     }
     // 'instr_count' can be 0 if it was not computed yet.
     if ((instr_count != 0) && (instr_count <= FLAG_inlining_size_threshold)) {
       return true;
     }
+    // Hot call sites inline callees up to the increased size threshold
+    // regardless of how many calls the callee contains.
+    if ((instr_count != 0) && IsHotCallSite(ratio) &&
+        (instr_count <= callee_size_threshold)) {
+      return true;
+    }
     if (call_site_count <= FLAG_inlining_callee_call_sites_threshold) {
       return true;
     }
@@ -580,6 +670,9 @@ class CallSiteInliner : public ValueObject {
       collected_call_sites_ = inlining_call_sites_;
       inlining_call_sites_ = call_sites_temp;
       collected_call_sites_->Clear();
+      if (FLAG_inlining_frequency_heuristics) {
+        inlining_call_sites_->SortByFrequency();
+      }
       // Inline call sites at the current depth.
       InlineInstanceCalls();
       InlineStaticCalls();
@@ -681,14 +774,19 @@ class CallSiteInliner : public ValueObject {
     if (!ShouldWeInline(function,
                         function.optimized_instruction_count(),
                         function.optimized_call_site_count(),
-                        constant_arguments)) {
+                        constant_arguments,
+                        call_data->ratio)) {
       TRACE_INLINING(THR_Print("     Bailout: early heuristics with "
                                "code size:  %" Pd ", "
                                "call sites: %" Pd ", "
-                               "const args: %" Pd "\n",
+                               "const args: %" Pd ", "
+                               "ratio: %f, "
+                               "size threshold: %" Pd "\n",
                                function.optimized_instruction_count(),
                                function.optimized_call_site_count(),
-                               constant_arguments));
+                               constant_arguments,
+                               call_data->ratio,
+                               CalleeSizeThreshold(call_data->ratio)));
       PRINT_INLINING_TREE("Early heuristic",
           &call_data->caller, &function, call_data->call);
       return false;
@@ -886,22 +984,28 @@ class CallSiteInliner : public ValueObject {
         function.set_optimized_call_site_count(call_site_count);
 
         // Use heuristics do decide if this call should be inlined.
-        if (!ShouldWeInline(function, size, call_site_count, constants_count)) {
+        if (!ShouldWeInline(function, size, call_site_count, constants_count,
+                            call_data->ratio)) {
           // If size is larger than all thresholds, don't consider it again.
           if ((size > FLAG_inlining_size_threshold) &&
               (call_site_count > FLAG_inlining_callee_call_sites_threshold) &&
               (size > FLAG_inlining_constant_arguments_min_size_threshold) &&
-              (size > FLAG_inlining_constant_arguments_max_size_threshold)) {
+              (size > FLAG_inlining_constant_arguments_max_size_threshold) &&
+              (size > CalleeSizeThreshold(1.0))) {
             function.set_is_inlinable(false);
           }
           thread()->set_deopt_id(prev_deopt_id);
           TRACE_INLINING(THR_Print("     Bailout: heuristics with "
                                    "code size:  %" Pd ", "
                                    "call sites: %" Pd ", "
-                                   "const args: %" Pd "\n",
+                                   "const args: %" Pd ", "
+                                   "ratio: %f, "
+                                   "size threshold: %" Pd "\n",
                                    size,
                                    call_site_count,
-                                   constants_count));
+                                   constants_count,
+                                   call_data->ratio,
+                                   CalleeSizeThreshold(call_data->ratio)));
           PRINT_INLINING_TREE("Heuristic fail",
               &call_data->caller, &function, call_data->call);
           return false;
@@ -1161,6 +1265,7 @@ class CallSiteInliner : public ValueObject {
       InlinedCallData call_data(
           call, &arguments, call_info[call_idx].caller(),
           call_info[call_idx].caller_graph->inlining_id());
+      call_data.ratio = call_info[call_idx].ratio;
       if (TryInlining(call->function(), call->argument_names(), &call_data)) {
         InlineCall(&call_data);
       }
@@ -1218,7 +1323,8 @@ class CallSiteInliner : public ValueObject {
       PolymorphicInstanceCallInstr* call = call_info[call_idx].call;
       if (call->with_checks()) {
         // PolymorphicInliner introduces deoptimization paths.
-        if (!call->complete() && !FLAG_polymorphic_with_deopt) {
+        if (!call->complete() &&
+            !caller_graph()->function().AllowsPolymorphicDeopt()) {
           TRACE_INLINING(THR_Print(
               "  => %s\n     Bailout: call with checks\n",
               call->instance_call()->function_name().ToCString()));
@@ -1252,6 +1358,7 @@ class CallSiteInliner : public ValueObject {
       InlinedCallData call_data(
           call, &arguments, call_info[call_idx].caller(),
           call_info[call_idx].caller_graph->inlining_id());
+      call_data.ratio = call_info[call_idx].ratio;
       if (TryInlining(target,
                       call->instance_call()->argument_names(),
                       &call_data)) {
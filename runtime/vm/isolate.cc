@@ -8,6 +8,7 @@
 #include "include/dart_native_api.h"
 #include "platform/assert.h"
 #include "platform/text_buffer.h"
+#include "vm/allocation_sampler.h"
 #include "vm/class_finalizer.h"
 #include "vm/code_observers.h"
 #include "vm/compiler.h"
@@ -50,6 +51,7 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, allocation_sample_interval);
 DECLARE_FLAG(bool, print_metrics);
 DECLARE_FLAG(bool, timing);
 DECLARE_FLAG(bool, trace_service);
@@ -810,6 +812,7 @@ Isolate::Isolate(const Dart_IsolateFlags& api_flags)
       last_allocationprofile_accumulator_reset_timestamp_(0),
       last_allocationprofile_gc_timestamp_(0),
       object_id_ring_(NULL),
+      allocation_sampler_(NULL),
       tag_table_(GrowableObjectArray::null()),
       deoptimized_code_array_(GrowableObjectArray::null()),
       sticky_error_(Error::null()),
@@ -844,6 +847,7 @@ Isolate::Isolate(const Dart_IsolateFlags& api_flags)
 Isolate::~Isolate() {
   free(name_);
   free(debugger_name_);
+  delete allocation_sampler_;
   delete store_buffer_;
   delete heap_;
   delete object_store_;
@@ -953,6 +957,10 @@ Isolate* Isolate::Init(const char* name_prefix,
     ObjectIdRing::Init(result);
   }
 
+  if (!is_vm_isolate && (FLAG_allocation_sample_interval > 0)) {
+    result->SetAllocationSampleInterval(FLAG_allocation_sample_interval);
+  }
+
   // Add to isolate list. Shutdown and delete the isolate on failure.
   if (!AddIsolateToList(result)) {
     result->LowLevelShutdown();
@@ -1741,6 +1749,11 @@ void Isolate::VisitObjectPointers(ObjectPointerVisitor* visitor,
   // Visit the tag table which is stored in the isolate.
   visitor->VisitPointer(reinterpret_cast<RawObject**>(&tag_table_));
 
+  // Visit the stacks of allocation samples.
+  if (allocation_sampler() != NULL) {
+    allocation_sampler()->VisitObjectPointers(visitor);
+  }
+
   if (background_compiler() != NULL) {
     background_compiler()->VisitPointers(visitor);
   }
@@ -1788,6 +1801,15 @@ void Isolate::VisitObjectPointers(ObjectPointerVisitor* visitor,
 }
 
 
+void Isolate::SetAllocationSampleInterval(intptr_t interval) {
+  delete allocation_sampler_;
+  allocation_sampler_ = NULL;
+  if (interval > 0) {
+    allocation_sampler_ = new AllocationSampler(this, interval);
+  }
+}
+
+
 void Isolate::VisitWeakPersistentHandles(HandleVisitor* visitor) {
   if (api_state() != NULL) {
     api_state()->VisitWeakHandles(visitor);
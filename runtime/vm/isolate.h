@@ -23,6 +23,7 @@
 namespace dart {
 
 // Forward declarations.
+class AllocationSampler;
 class ApiState;
 class BackgroundCompiler;
 class Capability;
@@ -392,6 +393,13 @@ class Isolate : public BaseIsolate {
     return object_id_ring_;
   }
 
+  AllocationSampler* allocation_sampler() const {
+    return allocation_sampler_;
+  }
+  // Starts sampling allocations on average every 'interval' bytes, dropping
+  // the previous samples. An interval of 0 stops sampling.
+  void SetAllocationSampleInterval(intptr_t interval);
+
   bool IsDeoptimizing() const { return deopt_context_ != NULL; }
   DeoptContext* deopt_context() const { return deopt_context_; }
   void set_deopt_context(DeoptContext* value) {
@@ -744,6 +752,8 @@ class Isolate : public BaseIsolate {
   // Ring buffer of objects assigned an id.
   ObjectIdRing* object_id_ring_;
 
+  AllocationSampler* allocation_sampler_;
+
   VMTagCounters vm_tag_counters_;
   RawGrowableObjectArray* tag_table_;
 
@@ -998,6 +998,7 @@ class MarkFunctionsForRecompilation : public ObjectVisitor {
       // Clear counters.
       func.set_usage_counter(0);
       func.set_deoptimization_counter(0);
+      func.ClearDeoptReasonCounts();
       func.set_optimized_instruction_count(0);
       func.set_optimized_call_site_count(0);
     }
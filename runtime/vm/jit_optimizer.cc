@@ -229,7 +229,7 @@ const ICData& JitOptimizer::TrySpecializeICData(const ICData& ic_data,
 
 void JitOptimizer::SpecializePolymorphicInstanceCall(
     PolymorphicInstanceCallInstr* call) {
-  if (!FLAG_polymorphic_with_deopt) {
+  if (!flow_graph()->function().AllowsPolymorphicDeopt()) {
     // Specialization adds receiver checks which can lead to deoptimization.
     return;
   }
@@ -2517,15 +2517,19 @@ void JitOptimizer::ReplaceWithInstanceOf(InstanceCallInstr* call) {
     if (as_bool.IsNull()) {
       if (results->length() == unary_checks.NumberOfChecks() * 2) {
         const bool can_deopt = TryExpandTestCidsResult(results, type);
-        TestCidsInstr* test_cids = new(Z) TestCidsInstr(
-            call->token_pos(),
-            negate ? Token::kISNOT : Token::kIS,
-            new(Z) Value(left),
-            *results,
-            can_deopt ? call->deopt_id() : Thread::kNoDeoptId);
-        // Remove type.
-        ReplaceCall(call, test_cids);
-        return;
+        // Do not speculate on the receiver classes again if it keeps failing.
+        if (!can_deopt ||
+            !flow_graph()->function().HasDeoptStorm(ICData::kDeoptTestCids)) {
+          TestCidsInstr* test_cids = new(Z) TestCidsInstr(
+              call->token_pos(),
+              negate ? Token::kISNOT : Token::kIS,
+              new(Z) Value(left),
+              *results,
+              can_deopt ? call->deopt_id() : Thread::kNoDeoptId);
+          // Remove type.
+          ReplaceCall(call, test_cids);
+          return;
+        }
       }
     } else {
       // TODO(srdjan): Use TestCidsInstr also for this case.
@@ -2718,7 +2722,7 @@ void JitOptimizer::VisitInstanceCall(InstanceCallInstr* instr) {
   if ((unary_checks.NumberOfChecks() <= FLAG_max_polymorphic_checks) ||
       (has_one_target && is_dense)) {
     bool call_with_checks;
-    if (has_one_target && FLAG_polymorphic_with_deopt) {
+    if (has_one_target && flow_graph()->function().AllowsPolymorphicDeopt()) {
       // Type propagation has not run yet, we cannot eliminate the check.
       AddReceiverCheck(instr);
       // Call can still deoptimize, do not detach environment from instr.
@@ -0,0 +1,643 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/json_decoder.h"
+
+#include "vm/double_conversion.h"
+#include "vm/object.h"
+#include "vm/symbols.h"
+#include "vm/thread.h"
+#include "vm/unicode.h"
+
+#if defined(HOST_ARCH_X64) || defined(HOST_ARCH_IA32)
+#include <emmintrin.h>  // NOLINT
+#define USE_SSE2_JSON 1
+#endif
+
+namespace dart {
+
+// Number of entries of the key cache, must be a power of two.
+static const intptr_t kKeyCacheSize = 64;
+
+// Only keys of at most this length are cached.
+static const intptr_t kMaxCachedKeyLength = 32;
+
+// Objects with at most this many keys are checked for duplicated keys by
+// comparing all pairs of keys.
+static const intptr_t kMaxPairwiseKeys = 8;
+
+// Integers with at most this many digits fit in an int64_t.
+static const intptr_t kMaxInt64Digits = 18;
+
+
+static intptr_t InputLength(const Instance& input) {
+  if (input.IsString()) {
+    return String::Cast(input).Length();
+  }
+  if (input.IsTypedData()) {
+    return TypedData::Cast(input).Length();
+  }
+  return ExternalTypedData::Cast(input).Length();
+}
+
+
+JSONDecoder::JSONDecoder(Thread* thread, const Instance& input, bool is_utf8)
+    : thread_(thread),
+      zone_(thread->zone()),
+      input_(input),
+      is_utf8_(is_utf8),
+      data_(NULL),
+      position_(0),
+      length_(InputLength(input)),
+      failed_(false),
+      stack_(GrowableObjectArray::Handle(thread->zone(),
+                                         GrowableObjectArray::New())),
+      key_cache_(Array::Handle(thread->zone())),
+      value_(Object::Handle(thread->zone())),
+      string_(String::Handle(thread->zone())),
+      array_(Array::Handle(thread->zone())),
+      buffer_(thread->zone(), 0) {
+  InputMayHaveMoved();
+}
+
+
+RawObject* JSONDecoder::Decode(Thread* thread, const Instance& input) {
+  Zone* zone = thread->zone();
+  if (input.IsString()) {
+    const String& str = String::Handle(zone,
+        ConsString::FlattenIfCons(String::Cast(input)));
+    if (str.IsOneByteString() || str.IsExternalOneByteString()) {
+      if (str.Length() > 0) {
+        JSONDecoder decoder(thread, str, false);
+        return decoder.DecodeInput();
+      }
+    }
+    return Object::sentinel().raw();
+  }
+  const intptr_t cid = input.GetClassId();
+  if (((cid == kTypedDataUint8ArrayCid) ||
+       (cid == kExternalTypedDataUint8ArrayCid)) &&
+      (InputLength(input) > 0)) {
+    JSONDecoder decoder(thread, input, true);
+    return decoder.DecodeInput();
+  }
+  return Object::sentinel().raw();
+}
+
+
+RawObject* JSONDecoder::DecodeInput() {
+  if (!ParseValue(0)) {
+    ASSERT(failed_);
+    return Object::sentinel().raw();
+  }
+  SkipWhitespace();
+  if (!AtEnd()) {
+    return Object::sentinel().raw();
+  }
+  ASSERT(stack_.Length() == 1);
+  return stack_.At(0);
+}
+
+
+void JSONDecoder::InputMayHaveMoved() {
+  switch (input_.GetClassId()) {
+    case kOneByteStringCid:
+      data_ = OneByteString::CharAddr(String::Cast(input_), 0);
+      break;
+    case kExternalOneByteStringCid:
+      data_ = ExternalOneByteString::CharAddr(String::Cast(input_), 0);
+      break;
+    case kTypedDataUint8ArrayCid:
+      data_ = reinterpret_cast<const uint8_t*>(
+          TypedData::Cast(input_).DataAddr(0));
+      break;
+    default:
+      ASSERT(input_.GetClassId() == kExternalTypedDataUint8ArrayCid);
+      data_ = reinterpret_cast<const uint8_t*>(
+          ExternalTypedData::Cast(input_).DataAddr(0));
+      break;
+  }
+}
+
+
+void JSONDecoder::Push(const Object& value) {
+  stack_.Add(value);
+  InputMayHaveMoved();
+}
+
+
+void JSONDecoder::SkipWhitespace() {
+  while (position_ < length_) {
+    const uint8_t c = data_[position_];
+    if ((c != ' ') && (c != '\n') && (c != '\r') && (c != '\t')) {
+      return;
+    }
+    position_++;
+  }
+}
+
+
+bool JSONDecoder::ParseValue(intptr_t depth) {
+  SkipWhitespace();
+  if (AtEnd()) {
+    return Fail();
+  }
+  switch (data_[position_]) {
+    case '{':
+      return ParseObject(depth + 1);
+    case '[':
+      return ParseArray(depth + 1);
+    case '"':
+      position_++;
+      if (!ParseString(false)) {
+        return false;
+      }
+      Push(value_);
+      return true;
+    case 't':
+      return ParseLiteral("true", Bool::True());
+    case 'f':
+      return ParseLiteral("false", Bool::False());
+    case 'n':
+      return ParseLiteral("null", Object::null_object());
+    default:
+      return ParseNumber();
+  }
+}
+
+
+bool JSONDecoder::ParseLiteral(const char* literal, const Object& value) {
+  const intptr_t length = strlen(literal);
+  if ((length_ - position_) < length) {
+    return Fail();
+  }
+  if (memcmp(&data_[position_], literal, length) != 0) {
+    return Fail();
+  }
+  position_ += length;
+  Push(value);
+  return true;
+}
+
+
+bool JSONDecoder::ParseArray(intptr_t depth) {
+  if (depth > kMaxDepth) {
+    return Fail();
+  }
+  ASSERT(data_[position_] == '[');
+  position_++;
+  const intptr_t base = stack_.Length();
+  SkipWhitespace();
+  if (!AtEnd() && (data_[position_] == ']')) {
+    position_++;
+  } else {
+    while (true) {
+      if (!ParseValue(depth)) {
+        return false;
+      }
+      SkipWhitespace();
+      if (AtEnd()) {
+        return Fail();
+      }
+      const uint8_t c = data_[position_++];
+      if (c == ']') {
+        break;
+      }
+      if (c != ',') {
+        return Fail();
+      }
+    }
+  }
+  const intptr_t length = stack_.Length() - base;
+  if (length == 0) {
+    // The backing store of a _GrowableList must not be empty.
+    value_ = GrowableObjectArray::New();
+    Push(value_);
+    return true;
+  }
+  array_ = Array::New(length);
+  for (intptr_t i = 0; i < length; i++) {
+    value_ = stack_.At(base + i);
+    array_.SetAt(i, value_);
+  }
+  stack_.SetLength(base);
+  value_ = GrowableObjectArray::New(array_);
+  GrowableObjectArray::Cast(value_).SetLength(length);
+  Push(value_);
+  return true;
+}
+
+
+bool JSONDecoder::ParseObject(intptr_t depth) {
+  if (depth > kMaxDepth) {
+    return Fail();
+  }
+  ASSERT(data_[position_] == '{');
+  position_++;
+  const intptr_t base = stack_.Length();
+  SkipWhitespace();
+  if (!AtEnd() && (data_[position_] == '}')) {
+    position_++;
+  } else {
+    while (true) {
+      SkipWhitespace();
+      if (AtEnd() || (data_[position_] != '"')) {
+        return Fail();
+      }
+      position_++;
+      if (!ParseString(true)) {
+        return false;
+      }
+      Push(value_);
+      SkipWhitespace();
+      if (AtEnd() || (data_[position_] != ':')) {
+        return Fail();
+      }
+      position_++;
+      if (!ParseValue(depth)) {
+        return false;
+      }
+      SkipWhitespace();
+      if (AtEnd()) {
+        return Fail();
+      }
+      const uint8_t c = data_[position_++];
+      if (c == '}') {
+        break;
+      }
+      if (c != ',') {
+        return Fail();
+      }
+    }
+  }
+  const intptr_t num_pairs =
+      RemoveDuplicateKeys(base, (stack_.Length() - base) >> 1);
+  const intptr_t used_data = num_pairs << 1;
+  // The index of the map is built lazily by the Dart implementation, in
+  // the same way as for maps read from snapshots.
+  array_ = Array::New(LinkedHashMap::DataCapacity(used_data));
+  for (intptr_t i = 0; i < used_data; i++) {
+    value_ = stack_.At(base + i);
+    array_.SetAt(i, value_);
+  }
+  stack_.SetLength(base);
+  value_ = LinkedHashMap::New(array_,
+                              TypedData::Handle(zone_),
+                              0,  // Hash mask.
+                              used_data,
+                              0);  // Deleted keys.
+  Push(value_);
+  return true;
+}
+
+
+intptr_t JSONDecoder::RemoveDuplicateKeys(intptr_t base, intptr_t num_pairs) {
+  if (num_pairs <= 1) {
+    return num_pairs;
+  }
+  String& key = String::Handle(zone_);
+  String& other = String::Handle(zone_);
+  // For each pair, the index of the earlier pair with the same key, or -1.
+  GrowableArray<intptr_t> duplicate_of(zone_, num_pairs);
+  bool has_duplicates = false;
+  if (num_pairs <= kMaxPairwiseKeys) {
+    for (intptr_t i = 0; i < num_pairs; i++) {
+      duplicate_of.Add(-1);
+      key ^= stack_.At(base + 2 * i);
+      for (intptr_t j = 0; j < i; j++) {
+        other ^= stack_.At(base + 2 * j);
+        if ((duplicate_of[j] < 0) &&
+            ((key.raw() == other.raw()) || key.Equals(other))) {
+          duplicate_of[i] = j;
+          has_duplicates = true;
+          break;
+        }
+      }
+    }
+  } else {
+    // Open addressing table of pair indices keyed by the hash of the key.
+    const intptr_t table_size = Utils::RoundUpToPowerOfTwo(2 * num_pairs);
+    const intptr_t mask = table_size - 1;
+    intptr_t* table = zone_->Alloc<intptr_t>(table_size);
+    for (intptr_t i = 0; i < table_size; i++) {
+      table[i] = -1;
+    }
+    for (intptr_t i = 0; i < num_pairs; i++) {
+      duplicate_of.Add(-1);
+      key ^= stack_.At(base + 2 * i);
+      intptr_t probe = key.Hash() & mask;
+      while (table[probe] >= 0) {
+        other ^= stack_.At(base + 2 * table[probe]);
+        if ((key.raw() == other.raw()) || key.Equals(other)) {
+          duplicate_of[i] = table[probe];
+          has_duplicates = true;
+          break;
+        }
+        probe = (probe + 1) & mask;
+      }
+      if (duplicate_of[i] < 0) {
+        table[probe] = i;
+      }
+    }
+  }
+  if (!has_duplicates) {
+    return num_pairs;
+  }
+  // Later values replace earlier ones, but the key keeps its position.
+  intptr_t result = 0;
+  for (intptr_t i = 0; i < num_pairs; i++) {
+    if (duplicate_of[i] >= 0) {
+      value_ = stack_.At(base + 2 * i + 1);
+      stack_.SetAt(base + 2 * duplicate_of[i] + 1, value_);
+    }
+  }
+  for (intptr_t i = 0; i < num_pairs; i++) {
+    if (duplicate_of[i] < 0) {
+      value_ = stack_.At(base + 2 * i);
+      stack_.SetAt(base + 2 * result, value_);
+      value_ = stack_.At(base + 2 * i + 1);
+      stack_.SetAt(base + 2 * result + 1, value_);
+      result++;
+    }
+  }
+  stack_.SetLength(base + 2 * result);
+  return result;
+}
+
+
+bool JSONDecoder::ParseNumber() {
+  // Format: '-'?('0'|[1-9][0-9]*)('.'[0-9]+)?([eE][+-]?[0-9]+)?
+  const intptr_t start = position_;
+  bool negative = false;
+  if (data_[position_] == '-') {
+    negative = true;
+    position_++;
+  }
+  const intptr_t digits_start = position_;
+  int64_t int_value = 0;
+  while (!AtEnd() && Utils::IsDecimalDigit(data_[position_])) {
+    int_value = 10 * int_value + (data_[position_] - '0');
+    position_++;
+    if ((position_ - digits_start) > kMaxInt64Digits) {
+      // Large integers are decoded by the Dart implementation, which
+      // supports Bigints. Large doubles are rare enough to do the same.
+      return Fail();
+    }
+  }
+  const intptr_t num_digits = position_ - digits_start;
+  if ((num_digits == 0) ||
+      ((num_digits > 1) && (data_[digits_start] == '0'))) {
+    return Fail();
+  }
+  bool is_double = false;
+  if (!AtEnd() && (data_[position_] == '.')) {
+    is_double = true;
+    position_++;
+    const intptr_t fraction_start = position_;
+    while (!AtEnd() && Utils::IsDecimalDigit(data_[position_])) {
+      position_++;
+    }
+    if (position_ == fraction_start) {
+      return Fail();
+    }
+  }
+  if (!AtEnd() && ((data_[position_] | 0x20) == 'e')) {
+    is_double = true;
+    position_++;
+    if (!AtEnd() && ((data_[position_] == '+') || (data_[position_] == '-'))) {
+      position_++;
+    }
+    const intptr_t exponent_start = position_;
+    while (!AtEnd() && Utils::IsDecimalDigit(data_[position_])) {
+      position_++;
+    }
+    if (position_ == exponent_start) {
+      return Fail();
+    }
+  }
+  if (!is_double) {
+    // Like in the Dart implementation, "-0" is the integer 0.
+    value_ = Integer::New(negative ? -int_value : int_value);
+  } else {
+    double double_value;
+    if (!CStringToDouble(reinterpret_cast<const char*>(&data_[start]),
+                         position_ - start,
+                         &double_value)) {
+      return Fail();
+    }
+    value_ = Double::New(double_value);
+  }
+  InputMayHaveMoved();
+  Push(value_);
+  return true;
+}
+
+
+#if defined(USE_SSE2_JSON)
+static const intptr_t kBlockSize = 16;
+
+// Returns a mask with bit i set if byte i of the block is a quote, a
+// backslash, a control character or not ASCII.
+static inline uint32_t SpecialCharacterMask(const uint8_t* block) {
+  const __m128i chars =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  // Bytes 0x80-0xff are negative when compared as signed bytes, so a
+  // single signed comparison finds both control and non-ASCII characters.
+  const __m128i control = _mm_cmplt_epi8(chars, _mm_set1_epi8(0x20));
+  const __m128i quote = _mm_cmpeq_epi8(chars, _mm_set1_epi8('"'));
+  const __m128i backslash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'));
+  return static_cast<uint32_t>(_mm_movemask_epi8(
+      _mm_or_si128(control, _mm_or_si128(quote, backslash))));
+}
+#endif
+
+
+static inline bool IsSpecialCharacter(uint8_t c) {
+  return (c < 0x20) || (c >= 0x80) || (c == '"') || (c == '\\');
+}
+
+
+intptr_t JSONDecoder::ScanStringCharacters(intptr_t position) const {
+#if defined(USE_SSE2_JSON)
+  for (; (position + kBlockSize) <= length_; position += kBlockSize) {
+    const uint32_t mask = SpecialCharacterMask(&data_[position]);
+    if (mask != 0) {
+      return position + Utils::CountTrailingZeros(mask);
+    }
+  }
+#endif
+  while ((position < length_) && !IsSpecialCharacter(data_[position])) {
+    position++;
+  }
+  return position;
+}
+
+
+RawString* JSONDecoder::NewOneByteString(intptr_t start, intptr_t length) {
+  string_ = OneByteString::New(length, Heap::kNew);
+  InputMayHaveMoved();
+  if (length > 0) {
+    NoSafepointScope no_safepoint;
+    memmove(OneByteString::CharAddr(string_, 0), &data_[start], length);
+  }
+  return string_.raw();
+}
+
+
+RawString* JSONDecoder::LookupKey(intptr_t start, intptr_t length) {
+  if (length > kMaxCachedKeyLength) {
+    return NewOneByteString(start, length);
+  }
+  if (key_cache_.IsNull()) {
+    key_cache_ = Array::New(kKeyCacheSize);
+    InputMayHaveMoved();
+  }
+  uint32_t hash = static_cast<uint32_t>(length);
+  for (intptr_t i = 0; i < length; i++) {
+    hash = (hash * 31) + data_[start + i];
+  }
+  const intptr_t index = (hash ^ (hash >> 16)) & (kKeyCacheSize - 1);
+  string_ ^= key_cache_.At(index);
+  if (!string_.IsNull() && (string_.Length() == length)) {
+    NoSafepointScope no_safepoint;
+    if (memcmp(OneByteString::CharAddr(string_, 0),
+               &data_[start],
+               length) == 0) {
+      return string_.raw();
+    }
+  }
+  NewOneByteString(start, length);
+  key_cache_.SetAt(index, string_);
+  return string_.raw();
+}
+
+
+bool JSONDecoder::ParseString(bool is_key) {
+  const intptr_t start = position_;
+  const intptr_t special = ScanStringCharacters(start);
+  if ((special < length_) && (data_[special] == '"')) {
+    // The common case of a string of ASCII characters without escapes.
+    const intptr_t length = special - start;
+    position_ = special + 1;
+    if (is_key && (length > 0)) {
+      value_ = LookupKey(start, length);
+    } else if (length == 0) {
+      value_ = Symbols::Empty().raw();
+    } else {
+      value_ = NewOneByteString(start, length);
+    }
+    return true;
+  }
+  return ParseEscapedString(start, special);
+}
+
+
+bool JSONDecoder::ParseEscapedString(intptr_t start, intptr_t special) {
+  buffer_.Clear();
+  uint16_t max_char = 0;
+  intptr_t position = start;
+  while (true) {
+    for (intptr_t i = position; i < special; i++) {
+      buffer_.Add(data_[i]);
+    }
+    position = special;
+    if (position >= length_) {
+      return Fail();
+    }
+    const uint8_t c = data_[position];
+    if (c == '"') {
+      position++;
+      break;
+    }
+    if (c < 0x20) {
+      return Fail();
+    }
+    if (c == '\\') {
+      if ((position + 1) >= length_) {
+        return Fail();
+      }
+      uint16_t unescaped;
+      switch (data_[position + 1]) {
+        case '"': unescaped = '"'; break;
+        case '\\': unescaped = '\\'; break;
+        case '/': unescaped = '/'; break;
+        case 'b': unescaped = '\b'; break;
+        case 'f': unescaped = '\f'; break;
+        case 'n': unescaped = '\n'; break;
+        case 'r': unescaped = '\r'; break;
+        case 't': unescaped = '\t'; break;
+        case 'u': {
+          if ((position + 6) > length_) {
+            return Fail();
+          }
+          intptr_t code_unit = 0;
+          for (intptr_t i = position + 2; i < position + 6; i++) {
+            if (!Utils::IsHexDigit(data_[i])) {
+              return Fail();
+            }
+            code_unit = (code_unit << 4) | Utils::HexDigitToInt(data_[i]);
+          }
+          // Like the Dart implementation, unpaired surrogates are kept.
+          unescaped = static_cast<uint16_t>(code_unit);
+          position += 4;
+          break;
+        }
+        default:
+          return Fail();
+      }
+      position += 2;
+      buffer_.Add(unescaped);
+      max_char = Utils::Maximum(max_char, unescaped);
+    } else {
+      ASSERT(c >= 0x80);
+      if (!is_utf8_) {
+        // One-byte strings hold Latin-1 characters.
+        buffer_.Add(c);
+        max_char = Utils::Maximum(max_char, static_cast<uint16_t>(c));
+        position++;
+      } else {
+        // Malformed UTF-8 is left to the Dart implementation, which reports
+        // it or replaces it depending on allowMalformed.
+        int32_t code_point;
+        const intptr_t consumed = Utf8::Decode(&data_[position],
+                                               length_ - position,
+                                               &code_point);
+        if ((consumed <= 1) || (code_point < 0) ||
+            Utf16::IsSurrogate(code_point)) {
+          return Fail();
+        }
+        position += consumed;
+        if (Utf::IsSupplementary(code_point)) {
+          uint16_t pair[2];
+          Utf16::Encode(code_point, pair);
+          buffer_.Add(pair[0]);
+          buffer_.Add(pair[1]);
+          max_char = Utf16::kMaxCodeUnit;
+        } else {
+          buffer_.Add(static_cast<uint16_t>(code_point));
+          max_char = Utils::Maximum(max_char,
+                                    static_cast<uint16_t>(code_point));
+        }
+      }
+    }
+    special = ScanStringCharacters(position);
+  }
+  position_ = position;
+  const intptr_t length = buffer_.length();
+  if (max_char <= 0xFF) {
+    string_ = OneByteString::New(length, Heap::kNew);
+    NoSafepointScope no_safepoint;
+    uint8_t* chars = OneByteString::CharAddr(string_, 0);
+    for (intptr_t i = 0; i < length; i++) {
+      chars[i] = static_cast<uint8_t>(buffer_[i]);
+    }
+  } else {
+    string_ = TwoByteString::New(buffer_.data(), length, Heap::kNew);
+  }
+  InputMayHaveMoved();
+  value_ = string_.raw();
+  return true;
+}
+
+}  // namespace dart
@@ -0,0 +1,103 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef VM_JSON_DECODER_H_
+#define VM_JSON_DECODER_H_
+
+#include "vm/allocation.h"
+#include "vm/growable_array.h"
+#include "vm/object.h"
+
+namespace dart {
+
+class Thread;
+class Zone;
+
+// Decodes JSON text directly into VM objects: maps become
+// _InternalLinkedHashMaps, arrays become _GrowableLists, and strings,
+// numbers, booleans and null become the corresponding instances.
+//
+// The input is either a one-byte string or a Uint8List holding UTF-8. The
+// decoder only handles well-formed input that the Dart implementation in
+// dart:convert would decode to the same objects. For everything else, e.g.
+// syntax errors, malformed UTF-8, integers that do not fit in 64 bits or
+// very deep nesting, it returns Object::sentinel() and the caller must use
+// the Dart decoder, which produces the result or the error message.
+class JSONDecoder : public ValueObject {
+ public:
+  static RawObject* Decode(Thread* thread, const Instance& input);
+
+  // Maximal nesting of arrays and objects decoded natively.
+  static const intptr_t kMaxDepth = 256;
+
+ private:
+  JSONDecoder(Thread* thread, const Instance& input, bool is_utf8);
+
+  RawObject* DecodeInput();
+
+  // Fails the decoding. Always returns false to allow 'return Fail();'.
+  bool Fail() {
+    failed_ = true;
+    return false;
+  }
+
+  // Parses the value at the current position and pushes it on the value
+  // stack.
+  bool ParseValue(intptr_t depth);
+  bool ParseObject(intptr_t depth);
+  bool ParseArray(intptr_t depth);
+  bool ParseNumber();
+  bool ParseLiteral(const char* literal, const Object& value);
+  void Push(const Object& value);
+
+  // Parses a string literal starting after its opening quote into
+  // 'value_'. Keys are canonicalized through the key cache.
+  bool ParseString(bool is_key);
+  bool ParseEscapedString(intptr_t start, intptr_t special);
+  RawString* NewOneByteString(intptr_t start, intptr_t length);
+  RawString* LookupKey(intptr_t start, intptr_t length);
+
+  // Returns the position of the first quote, backslash, control character
+  // or non-ASCII character at or after 'position'.
+  intptr_t ScanStringCharacters(intptr_t position) const;
+
+  void SkipWhitespace();
+  bool AtEnd() const { return position_ >= length_; }
+
+  // Removes the key/value pairs of an object from the value stack, with
+  // later values of duplicated keys replacing earlier ones like in
+  // Map.operator[]=, and returns the number of remaining pairs.
+  intptr_t RemoveDuplicateKeys(intptr_t base, intptr_t num_pairs);
+
+  // The character data of strings and typed data in new space may move
+  // when objects are allocated, so the pointer to the input is reloaded
+  // after every allocation.
+  void InputMayHaveMoved();
+
+  Thread* thread_;
+  Zone* zone_;
+  const Instance& input_;
+  const bool is_utf8_;
+  const uint8_t* data_;
+  intptr_t position_;
+  const intptr_t length_;
+  bool failed_;
+
+  // Values of the arrays and objects being decoded.
+  GrowableObjectArray& stack_;
+  // Small direct mapped cache of recently decoded keys.
+  Array& key_cache_;
+  Object& value_;
+  String& string_;
+  Array& array_;
+
+  // Buffer for strings that contain escapes or non-ASCII characters.
+  GrowableArray<uint16_t> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(JSONDecoder);
+};
+
+}  // namespace dart
+
+#endif  // VM_JSON_DECODER_H_
@@ -0,0 +1,157 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/assert.h"
+#include "platform/text_buffer.h"
+#include "vm/dart_api_impl.h"
+#include "vm/json_decoder.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+// Compares the result of the native decoder with the Dart implementation,
+// which is used when a reviver is given.
+static const char* kCheckScript =
+    "import 'dart:convert';\n"
+    "check(decoded, String json) {\n"
+    "  var expected = JSON.decode(json, reviver: (key, value) => value);\n"
+    "  return JSON.encode(decoded) == JSON.encode(expected);\n"
+    "}\n"
+    "lookup(Map map, String key) => map[key];\n";
+
+
+static RawObject* DecodeOneByte(const char* json) {
+  const String& input = String::Handle(String::New(json));
+  EXPECT(input.IsOneByteString());
+  return JSONDecoder::Decode(Thread::Current(), input);
+}
+
+
+static RawObject* DecodeUtf8(const char* json) {
+  const intptr_t length = strlen(json);
+  const TypedData& input = TypedData::Handle(
+      TypedData::New(kTypedDataUint8ArrayCid, length));
+  for (intptr_t i = 0; i < length; i++) {
+    input.SetUint8(i, static_cast<uint8_t>(json[i]));
+  }
+  return JSONDecoder::Decode(Thread::Current(), input);
+}
+
+
+static void ExpectDecodesLikeDart(Dart_Handle lib,
+                                  const char* json,
+                                  const Object& decoded) {
+  EXPECT(decoded.raw() != Object::sentinel().raw());
+  Dart_Handle args[2];
+  args[0] = Api::NewHandle(Thread::Current(), decoded.raw());
+  args[1] = Dart_NewStringFromUTF8(reinterpret_cast<const uint8_t*>(json),
+                                   strlen(json));
+  Dart_Handle result = Dart_Invoke(lib, NewString("check"), 2, args);
+  EXPECT_VALID(result);
+  bool equal = false;
+  EXPECT_VALID(Dart_BooleanValue(result, &equal));
+  EXPECT(equal);
+}
+
+
+TEST_CASE(JSONDecoder_Values) {
+  Dart_Handle lib = TestCase::LoadTestScript(kCheckScript, NULL);
+  EXPECT_VALID(lib);
+  const char* kInputs[] = {
+    "0", "-0", "123456789012345678", "-42", "1.5", "-0.0", "1e3", "2.5E-3",
+    "true", "false", "null", " \t\r\n[ ] ", "{}", "\"\"", "\"abc\"",
+    "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\\u00e9\\u20ac\\ud83d\\ude00\"",
+    "[1, [2, [3, {}]], {\"a\": [true, false, null]}]",
+    "{\"key\": 1, \"other\": {\"key\": 2}, \"list\": [{\"key\": 3}]}",
+    "{\"a\": 1, \"b\": 2, \"a\": 3}",
+    "{\"k0\": 0, \"k1\": 1, \"k2\": 2, \"k3\": 3, \"k4\": 4, \"k5\": 5,"
+    " \"k6\": 6, \"k7\": 7, \"k8\": 8, \"k9\": 9, \"k1\": 10, \"k9\": 11}",
+    "\"a string that is long enough to be scanned in several blocks\"",
+  };
+  Object& decoded = Object::Handle();
+  for (size_t i = 0; i < ARRAY_SIZE(kInputs); i++) {
+    decoded = DecodeOneByte(kInputs[i]);
+    ExpectDecodesLikeDart(lib, kInputs[i], decoded);
+    decoded = DecodeUtf8(kInputs[i]);
+    ExpectDecodesLikeDart(lib, kInputs[i], decoded);
+  }
+
+  // Non-ASCII characters in UTF-8 input.
+  const char* kUtf8 = "{\"caf\xC3\xA9\": \"\xE2\x82\xAC \xF0\x9F\x98\x80\"}";
+  decoded = DecodeUtf8(kUtf8);
+  ExpectDecodesLikeDart(lib, kUtf8, decoded);
+}
+
+
+TEST_CASE(JSONDecoder_Maps) {
+  Dart_Handle lib = TestCase::LoadTestScript(kCheckScript, NULL);
+  EXPECT_VALID(lib);
+  Object& decoded = Object::Handle(
+      DecodeOneByte("[{\"id\": 1, \"name\": \"a\"}, {\"id\": 2, \"id\": 3}]"));
+  EXPECT(decoded.IsGrowableObjectArray());
+  const GrowableObjectArray& list = GrowableObjectArray::Cast(decoded);
+  EXPECT_EQ(2, list.Length());
+  const LinkedHashMap& first = LinkedHashMap::Handle(
+      LinkedHashMap::RawCast(list.At(0)));
+  const LinkedHashMap& second = LinkedHashMap::Handle(
+      LinkedHashMap::RawCast(list.At(1)));
+  EXPECT_EQ(2, first.Length());
+  EXPECT_EQ(1, second.Length());
+
+  // Keys are shared between objects through the key cache.
+  LinkedHashMap::Iterator first_keys(first);
+  LinkedHashMap::Iterator second_keys(second);
+  EXPECT(first_keys.MoveNext());
+  EXPECT(second_keys.MoveNext());
+  EXPECT(first_keys.CurrentKey() == second_keys.CurrentKey());
+  EXPECT_STREQ("3", Object::Handle(second_keys.CurrentValue()).ToCString());
+
+  // The index of the maps is built on first use.
+  Dart_Handle args[2];
+  args[0] = Api::NewHandle(thread, first.raw());
+  args[1] = NewString("name");
+  Dart_Handle result = Dart_Invoke(lib, NewString("lookup"), 2, args);
+  EXPECT_VALID(result);
+  EXPECT(Dart_IsString(result));
+  args[1] = NewString("missing");
+  result = Dart_Invoke(lib, NewString("lookup"), 2, args);
+  EXPECT(Dart_IsNull(result));
+}
+
+
+VM_TEST_CASE(JSONDecoder_Fallback) {
+  // Malformed input and input the Dart implementation decodes differently
+  // are left to the Dart implementation.
+  const char* kInputs[] = {
+    "", " ", "[", "[1,]", "{\"a\" 1}", "{\"a\": 1,}", "{1: 2}", "01", "1.",
+    "1e", "-", "+1", ".5", "tru", "nul", "\"abc", "\"\\x\"", "\"\\u12\"",
+    "\"\t\"", "[] x", "1234567890123456789", "NaN",
+  };
+  for (size_t i = 0; i < ARRAY_SIZE(kInputs); i++) {
+    EXPECT(DecodeOneByte(kInputs[i]) == Object::sentinel().raw());
+    EXPECT(DecodeUtf8(kInputs[i]) == Object::sentinel().raw());
+  }
+  // Malformed UTF-8.
+  EXPECT(DecodeUtf8("\"\xC3\"") == Object::sentinel().raw());
+  EXPECT(DecodeUtf8("\"\xED\xA0\x80\"") == Object::sentinel().raw());
+  // Latin-1 characters in one-byte strings are not UTF-8.
+  const uint8_t kLatin1[] = { '"', 0xE9, '"' };
+  const String& latin1 = String::Handle(String::FromLatin1(kLatin1, 3));
+  const String& decoded = String::Handle(
+      String::RawCast(JSONDecoder::Decode(thread, latin1)));
+  EXPECT_EQ(1, decoded.Length());
+  EXPECT_EQ(0xE9, decoded.CharAt(0));
+
+  // Deeply nested input.
+  TextBuffer nested(1024);
+  for (intptr_t i = 0; i <= JSONDecoder::kMaxDepth; i++) {
+    nested.AddString("[");
+  }
+  for (intptr_t i = 0; i <= JSONDecoder::kMaxDepth; i++) {
+    nested.AddString("]");
+  }
+  EXPECT(DecodeOneByte(nested.buf()) == Object::sentinel().raw());
+}
+
+}  // namespace dart
@@ -0,0 +1,461 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/json_encoder.h"
+
+#include "vm/dart_entry.h"
+#include "vm/double_conversion.h"
+#include "vm/exceptions.h"
+#include "vm/object.h"
+#include "vm/thread.h"
+#include "vm/unicode.h"
+
+#if defined(HOST_ARCH_X64) || defined(HOST_ARCH_IA32)
+#include <emmintrin.h>  // NOLINT
+#define USE_SSE2_JSON 1
+#endif
+
+namespace dart {
+
+static const intptr_t kInitialCapacity = 256;
+
+
+JSONEncoder::JSONEncoder(Thread* thread,
+                         const GrowableObjectArray& seen,
+                         const Instance& encode_other)
+    : zone_(thread->zone()),
+      seen_(seen),
+      encode_other_(encode_other),
+      string_(String::Handle(thread->zone())),
+      buffer_(thread->zone()->Alloc<uint8_t>(kInitialCapacity)),
+      length_(0),
+      capacity_(kInitialCapacity) {
+}
+
+
+RawObject* JSONEncoder::Encode(Thread* thread,
+                               const Instance& object,
+                               const GrowableObjectArray& seen,
+                               const Instance& encode_other,
+                               bool utf8) {
+  JSONEncoder encoder(thread, seen, encode_other);
+  encoder.WriteValue(object, 0);
+  return encoder.Result(utf8);
+}
+
+
+RawObject* JSONEncoder::Result(bool utf8) const {
+  if (utf8) {
+    const TypedData& result = TypedData::Handle(zone_,
+        TypedData::New(kTypedDataUint8ArrayCid, length_));
+    if (length_ > 0) {
+      NoSafepointScope no_safepoint;
+      memmove(result.DataAddr(0), buffer_, length_);
+    }
+    return result.raw();
+  }
+  return String::FromUTF8(buffer_, length_);
+}
+
+
+void JSONEncoder::Grow(intptr_t size) {
+  const intptr_t new_capacity =
+      Utils::Maximum(2 * capacity_, length_ + size);
+  buffer_ = zone_->Realloc<uint8_t>(buffer_, capacity_, new_capacity);
+  capacity_ = new_capacity;
+}
+
+
+void JSONEncoder::WriteValue(const Object& value, intptr_t depth) {
+  switch (value.GetClassId()) {
+    case kNullCid:
+      WriteCString("null");
+      return;
+    case kBoolCid:
+      WriteCString(Bool::Cast(value).value() ? "true" : "false");
+      return;
+    case kSmiCid:
+      WriteInteger(Smi::Cast(value).Value());
+      return;
+    case kMintCid:
+      WriteInteger(Mint::Cast(value).value());
+      return;
+    case kDoubleCid: {
+      const double d = Double::Cast(value).value();
+      if (!isnan(d) && !isinf(d)) {
+        WriteDouble(d);
+        return;
+      }
+      // Non-finite doubles are passed to toEncodable.
+      break;
+    }
+    case kOneByteStringCid:
+    case kTwoByteStringCid:
+    case kExternalOneByteStringCid:
+    case kExternalTwoByteStringCid:
+    case kConsStringCid:
+      WriteString(String::Cast(value));
+      return;
+    case kArrayCid:
+    case kImmutableArrayCid:
+    case kGrowableObjectArrayCid:
+      if ((depth < kMaxDepth) && PushSeen(Instance::Cast(value))) {
+        WriteList(Instance::Cast(value), depth + 1);
+        PopSeen();
+        return;
+      }
+      break;
+    case kLinkedHashMapCid:
+      if ((depth < kMaxDepth) && PushSeen(Instance::Cast(value))) {
+        const bool written = WriteMap(LinkedHashMap::Cast(value), depth + 1);
+        PopSeen();
+        if (written) {
+          return;
+        }
+      }
+      break;
+    default:
+      break;
+  }
+  WriteOther(value);
+}
+
+
+void JSONEncoder::WriteList(const Instance& list, intptr_t depth) {
+  Object& element = Object::Handle(zone_);
+  WriteByte('[');
+  if (list.IsGrowableObjectArray()) {
+    // The length is read in every iteration like in
+    // _JsonStringifier.writeList, as toEncodable may change the list.
+    const GrowableObjectArray& growable = GrowableObjectArray::Cast(list);
+    for (intptr_t i = 0; i < growable.Length(); i++) {
+      if (i > 0) {
+        WriteByte(',');
+      }
+      element = growable.At(i);
+      WriteValue(element, depth);
+    }
+  } else {
+    const Array& array = Array::Cast(list);
+    for (intptr_t i = 0; i < array.Length(); i++) {
+      if (i > 0) {
+        WriteByte(',');
+      }
+      element = array.At(i);
+      WriteValue(element, depth);
+    }
+  }
+  WriteByte(']');
+}
+
+
+bool JSONEncoder::WriteMap(const LinkedHashMap& map, intptr_t depth) {
+  const intptr_t length = map.Length();
+  if (length == 0) {
+    WriteCString("{}");
+    return true;
+  }
+  // Like _JsonStringifier.writeMap, collect the entries before writing any
+  // of them, so that toEncodable calls changing the map do not affect the
+  // output.
+  const Array& entries = Array::Handle(zone_, Array::New(2 * length));
+  Object& key = Object::Handle(zone_);
+  Object& value = Object::Handle(zone_);
+  LinkedHashMap::Iterator it(map);
+  intptr_t num_entries = 0;
+  while (it.MoveNext()) {
+    key = it.CurrentKey();
+    if (!key.IsString()) {
+      // Maps with other keys are passed to toEncodable.
+      return false;
+    }
+    value = it.CurrentValue();
+    entries.SetAt(num_entries++, key);
+    entries.SetAt(num_entries++, value);
+  }
+  ASSERT(num_entries == 2 * length);
+  WriteByte('{');
+  for (intptr_t i = 0; i < num_entries; i += 2) {
+    if (i > 0) {
+      WriteByte(',');
+    }
+    key = entries.At(i);
+    WriteString(String::Cast(key));
+    WriteByte(':');
+    value = entries.At(i + 1);
+    WriteValue(value, depth);
+  }
+  WriteByte('}');
+  return true;
+}
+
+
+void JSONEncoder::WriteOther(const Object& object) {
+  const Array& args = Array::Handle(zone_, Array::New(2));
+  args.SetAt(0, encode_other_);
+  args.SetAt(1, object);
+  const Object& result = Object::Handle(zone_,
+                                        DartEntry::InvokeClosure(args));
+  if (result.IsError()) {
+    Exceptions::PropagateError(Error::Cast(result));
+  }
+  WriteUtf8(String::Cast(result));
+}
+
+
+bool JSONEncoder::PushSeen(const Instance& object) {
+  const intptr_t length = seen_.Length();
+  for (intptr_t i = 0; i < length; i++) {
+    if (seen_.At(i) == object.raw()) {
+      return false;
+    }
+  }
+  seen_.Add(object);
+  return true;
+}
+
+
+void JSONEncoder::PopSeen() {
+  ASSERT(seen_.Length() > 0);
+  seen_.SetLength(seen_.Length() - 1);
+}
+
+
+void JSONEncoder::WriteInteger(int64_t value) {
+  uint8_t digits[20];
+  uint64_t magnitude = (value < 0) ? (0 - static_cast<uint64_t>(value))
+                                   : static_cast<uint64_t>(value);
+  intptr_t position = sizeof(digits);
+  do {
+    digits[--position] = '0' + static_cast<uint8_t>(magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0) {
+    WriteByte('-');
+  }
+  WriteBytes(&digits[position], sizeof(digits) - position);
+}
+
+
+void JSONEncoder::WriteDouble(double value) {
+  // Same as double.toString.
+  const int kBufferSize = 128;
+  char buffer[kBufferSize];
+  DoubleToCString(value, buffer, kBufferSize);
+  WriteCString(buffer);
+}
+
+
+void JSONEncoder::WriteString(const String& str) {
+  string_ = ConsString::FlattenIfCons(str);
+  WriteByte('"');
+  const intptr_t length = string_.Length();
+  if (length > 0) {
+    NoSafepointScope no_safepoint;
+    switch (string_.GetClassId()) {
+      case kOneByteStringCid:
+        WriteOneByteContent(OneByteString::CharAddr(string_, 0), length);
+        break;
+      case kExternalOneByteStringCid:
+        WriteOneByteContent(ExternalOneByteString::CharAddr(string_, 0),
+                            length);
+        break;
+      case kTwoByteStringCid:
+        WriteTwoByteContent(TwoByteString::CharAddr(string_, 0), length);
+        break;
+      default:
+        ASSERT(string_.IsExternalTwoByteString());
+        WriteTwoByteContent(ExternalTwoByteString::CharAddr(string_, 0),
+                            length);
+        break;
+    }
+  }
+  WriteByte('"');
+}
+
+
+void JSONEncoder::WriteUtf8(const String& str) {
+  string_ = ConsString::FlattenIfCons(str);
+  const intptr_t size = Utf8::Length(string_);
+  Reserve(size);
+  Utf8::Encode(string_, reinterpret_cast<char*>(&buffer_[length_]), size);
+  length_ += size;
+}
+
+
+void JSONEncoder::WriteEscape(uint8_t c) {
+  static const char kHexDigits[] = "0123456789abcdef";
+  Reserve(6);
+  buffer_[length_++] = '\\';
+  switch (c) {
+    case '\b':
+      buffer_[length_++] = 'b';
+      break;
+    case '\t':
+      buffer_[length_++] = 't';
+      break;
+    case '\n':
+      buffer_[length_++] = 'n';
+      break;
+    case '\f':
+      buffer_[length_++] = 'f';
+      break;
+    case '\r':
+      buffer_[length_++] = 'r';
+      break;
+    case '"':
+    case '\\':
+      buffer_[length_++] = c;
+      break;
+    default:
+      ASSERT(c < 0x20);
+      buffer_[length_++] = 'u';
+      buffer_[length_++] = '0';
+      buffer_[length_++] = '0';
+      buffer_[length_++] = kHexDigits[c >> 4];
+      buffer_[length_++] = kHexDigits[c & 0xf];
+      break;
+  }
+}
+
+
+#if defined(USE_SSE2_JSON)
+// Returns a mask with bit i set if character i of the block is a quote, a
+// backslash, a control character or not ASCII.
+static inline uint32_t SpecialOneByteMask(const uint8_t* block) {
+  const __m128i chars =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  // Characters 0x80-0xff are negative when compared as signed bytes, so a
+  // single signed comparison finds both control and non-ASCII characters.
+  const __m128i control = _mm_cmplt_epi8(chars, _mm_set1_epi8(0x20));
+  const __m128i quote = _mm_cmpeq_epi8(chars, _mm_set1_epi8('"'));
+  const __m128i backslash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'));
+  return static_cast<uint32_t>(_mm_movemask_epi8(
+      _mm_or_si128(control, _mm_or_si128(quote, backslash))));
+}
+
+
+// Returns a mask with bits 2 * i and 2 * i + 1 set if code unit i of the
+// block is a quote, a backslash, a control character or not ASCII.
+static inline uint32_t SpecialTwoByteMask(const uint16_t* block) {
+  const __m128i units =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  // The saturating differences are non-zero for code units above 0x7f and
+  // below 0x20 respectively.
+  const __m128i above = _mm_subs_epu16(units, _mm_set1_epi16(0x7f));
+  const __m128i below = _mm_subs_epu16(_mm_set1_epi16(0x20), units);
+  const __m128i plain =
+      _mm_cmpeq_epi16(_mm_or_si128(above, below), _mm_setzero_si128());
+  const __m128i quote = _mm_cmpeq_epi16(units, _mm_set1_epi16('"'));
+  const __m128i backslash = _mm_cmpeq_epi16(units, _mm_set1_epi16('\\'));
+  const uint32_t plain_mask =
+      static_cast<uint32_t>(_mm_movemask_epi8(plain));
+  const uint32_t escaped_mask = static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_or_si128(quote, backslash)));
+  return (~plain_mask & 0xffff) | escaped_mask;
+}
+#endif
+
+
+static inline bool IsSpecialCharacter(uint16_t c) {
+  return (c < 0x20) || (c >= 0x80) || (c == '"') || (c == '\\');
+}
+
+
+void JSONEncoder::WriteOneByteContent(const uint8_t* chars, intptr_t length) {
+  intptr_t position = 0;
+  while (position < length) {
+    intptr_t special = position;
+#if defined(USE_SSE2_JSON)
+    uint32_t mask = 0;
+    while ((special + 16) <= length) {
+      mask = SpecialOneByteMask(&chars[special]);
+      if (mask != 0) {
+        break;
+      }
+      special += 16;
+    }
+    if (mask != 0) {
+      special += Utils::CountTrailingZeros(mask);
+    } else {
+      while ((special < length) && !IsSpecialCharacter(chars[special])) {
+        special++;
+      }
+    }
+#else
+    while ((special < length) && !IsSpecialCharacter(chars[special])) {
+      special++;
+    }
+#endif
+    WriteBytes(&chars[position], special - position);
+    if (special == length) {
+      return;
+    }
+    const uint8_t c = chars[special];
+    if (c >= 0x80) {
+      // Latin-1 characters take two bytes in UTF-8.
+      Reserve(2);
+      buffer_[length_++] = 0xc0 | (c >> 6);
+      buffer_[length_++] = 0x80 | (c & 0x3f);
+    } else {
+      WriteEscape(c);
+    }
+    position = special + 1;
+  }
+}
+
+
+void JSONEncoder::WriteTwoByteContent(const uint16_t* chars,
+                                      intptr_t length) {
+  intptr_t position = 0;
+  while (position < length) {
+    // Narrow the run of ASCII characters that need no escaping.
+    intptr_t special = position;
+#if defined(USE_SSE2_JSON)
+    for (; (special + 8) <= length; special += 8) {
+      const uint32_t mask = SpecialTwoByteMask(&chars[special]);
+      if (mask != 0) {
+        const intptr_t plain = Utils::CountTrailingZeros(mask) >> 1;
+        Reserve(plain);
+        for (intptr_t i = 0; i < plain; i++) {
+          buffer_[length_++] = static_cast<uint8_t>(chars[special + i]);
+        }
+        special += plain;
+        break;
+      }
+      const __m128i units =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&chars[special]));
+      Reserve(8);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(&buffer_[length_]),
+                       _mm_packus_epi16(units, units));
+      length_ += 8;
+    }
+#endif
+    while ((special < length) && !IsSpecialCharacter(chars[special])) {
+      WriteByte(static_cast<uint8_t>(chars[special]));
+      special++;
+    }
+    if (special == length) {
+      return;
+    }
+    int32_t c = chars[special];
+    position = special + 1;
+    if (c < 0x80) {
+      WriteEscape(static_cast<uint8_t>(c));
+      continue;
+    }
+    if (Utf16::IsLeadSurrogate(c) &&
+        (position < length) &&
+        Utf16::IsTrailSurrogate(chars[position])) {
+      c = Utf16::Decode(c, chars[position]);
+      position++;
+    }
+    // Unpaired surrogates are encoded like other characters, like in
+    // _JsonUtf8Stringifier.writeStringSlice.
+    Reserve(4);
+    length_ += Utf8::Encode(c, reinterpret_cast<char*>(&buffer_[length_]));
+  }
+}
+
+}  // namespace dart
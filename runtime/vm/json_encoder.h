@@ -0,0 +1,101 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef VM_JSON_ENCODER_H_
+#define VM_JSON_ENCODER_H_
+
+#include "vm/allocation.h"
+#include "vm/object.h"
+
+namespace dart {
+
+class Thread;
+class Zone;
+
+// Encodes JSON values directly into a UTF-8 buffer in the zone.
+//
+// Null, booleans, integers, finite doubles, strings, built-in lists and
+// _InternalLinkedHashMaps with string keys are encoded natively. Every other
+// object, e.g. an object with a toJson method, a map with non-string keys or
+// a value nested deeper than kMaxDepth, is passed to the 'encode_other'
+// closure. The closure runs the Dart stringifier of dart:convert, which
+// shares the 'seen' list of objects being traversed with the native encoder,
+// and returns the encoding of the object. Cyclic structures are also passed
+// to the closure, which throws the same error as the Dart implementation.
+//
+// The result is a String or, if 'utf8' is true, a Uint8List.
+class JSONEncoder : public ValueObject {
+ public:
+  static RawObject* Encode(Thread* thread,
+                           const Instance& object,
+                           const GrowableObjectArray& seen,
+                           const Instance& encode_other,
+                           bool utf8);
+
+  // Maximal nesting of lists and maps encoded natively.
+  static const intptr_t kMaxDepth = 512;
+
+ private:
+  JSONEncoder(Thread* thread,
+              const GrowableObjectArray& seen,
+              const Instance& encode_other);
+
+  void WriteValue(const Object& value, intptr_t depth);
+  void WriteList(const Instance& list, intptr_t depth);
+  bool WriteMap(const LinkedHashMap& map, intptr_t depth);
+  void WriteOther(const Object& object);
+  void WriteInteger(int64_t value);
+  void WriteDouble(double value);
+
+  // Writes a string literal with the characters of 'str' escaped like in
+  // _JsonStringifier.writeStringContent.
+  void WriteString(const String& str);
+  void WriteOneByteContent(const uint8_t* chars, intptr_t length);
+  void WriteTwoByteContent(const uint16_t* chars, intptr_t length);
+  void WriteEscape(uint8_t c);
+
+  // Writes the characters of 'str' as they are.
+  void WriteUtf8(const String& str);
+
+  // Pushes 'object' on the list of objects being traversed. Returns false,
+  // without pushing, if the object is already on the list.
+  bool PushSeen(const Instance& object);
+  void PopSeen();
+
+  void Reserve(intptr_t size) {
+    if ((length_ + size) > capacity_) {
+      Grow(size);
+    }
+  }
+  void Grow(intptr_t size);
+  void WriteByte(uint8_t byte) {
+    Reserve(1);
+    buffer_[length_++] = byte;
+  }
+  void WriteBytes(const uint8_t* bytes, intptr_t size) {
+    Reserve(size);
+    memmove(&buffer_[length_], bytes, size);
+    length_ += size;
+  }
+  void WriteCString(const char* str) {
+    WriteBytes(reinterpret_cast<const uint8_t*>(str), strlen(str));
+  }
+
+  RawObject* Result(bool utf8) const;
+
+  Zone* zone_;
+  const GrowableObjectArray& seen_;
+  const Instance& encode_other_;
+  String& string_;
+
+  uint8_t* buffer_;
+  intptr_t length_;
+  intptr_t capacity_;
+
+  DISALLOW_COPY_AND_ASSIGN(JSONEncoder);
+};
+
+}  // namespace dart
+
+#endif  // VM_JSON_ENCODER_H_
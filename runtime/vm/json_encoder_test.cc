@@ -0,0 +1,137 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/assert.h"
+#include "vm/dart_api_impl.h"
+#include "vm/json_encoder.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+// Compares JSON.encode and JsonUtf8Encoder, which are intercepted by the
+// native encoder, with the Dart implementation used for chunked encoding.
+// The check functions return an empty string on success and a description
+// of the first mismatch otherwise.
+static const char* kCheckScript =
+    "import 'dart:convert';\n"
+    "class Custom {\n"
+    "  final value;\n"
+    "  Custom(this.value);\n"
+    "  toJson() => value;\n"
+    "}\n"
+    "dartEncode(object, toEncodable) {\n"
+    "  var result;\n"
+    "  var sink = new JsonEncoder(toEncodable).startChunkedConversion(\n"
+    "      new StringConversionSink.withCallback((s) { result = s; }));\n"
+    "  sink.add(object);\n"
+    "  sink.close();\n"
+    "  return result;\n"
+    "}\n"
+    "check(object, [toEncodable]) {\n"
+    "  var expected = dartEncode(object, toEncodable);\n"
+    "  var actual = new JsonEncoder(toEncodable).convert(object);\n"
+    "  if (actual != expected) return '$actual != $expected';\n"
+    "  var bytes = new JsonUtf8Encoder(null, toEncodable).convert(object);\n"
+    "  var expectedBytes = UTF8.encode(expected);\n"
+    "  if (bytes.length != expectedBytes.length) return 'UTF-8 $expected';\n"
+    "  for (int i = 0; i < bytes.length; i++) {\n"
+    "    if (bytes[i] != expectedBytes[i]) return 'UTF-8 $expected';\n"
+    "  }\n"
+    "  return '';\n"
+    "}\n"
+    "errorOf(f) {\n"
+    "  try {\n"
+    "    f();\n"
+    "  } catch (e) {\n"
+    "    return e;\n"
+    "  }\n"
+    "  return null;\n"
+    "}\n"
+    "checkError(object) {\n"
+    "  var expected = errorOf(() => dartEncode(object, null));\n"
+    "  var actual = errorOf(() => JSON.encode(object));\n"
+    "  if (expected == null || actual == null ||\n"
+    "      actual.runtimeType != expected.runtimeType ||\n"
+    "      !identical(actual.unsupportedObject, expected.unsupportedObject)\n"
+    "      || actual.cause.runtimeType != expected.cause.runtimeType) {\n"
+    "    return '$actual != $expected';\n"
+    "  }\n"
+    "  return '';\n"
+    "}\n"
+    "checkAll(List values, [toEncodable]) {\n"
+    "  for (var value in values) {\n"
+    "    var result = check(value, toEncodable);\n"
+    "    if (result != '') return result;\n"
+    "  }\n"
+    "  return '';\n"
+    "}\n"
+    "checkValues() {\n"
+    "  var long = 'a long string that is scanned in several blocks';\n"
+    "  var strings = ['', 'plain', 'quote\" backslash\\\\ \\b\\f\\n\\r\\t',\n"
+    "                 '\\u0001\\u001f\\u007f caf\\u00e9 \\u00ff',\n"
+    "                 '\\u20ac \\u{1F600} \\ud800 x \\udc00 \\ud800'];\n"
+    "  for (var s in strings.toList()) {\n"
+    "    for (int i = 0; i < 20; i++) {\n"
+    "      strings.add(long.substring(0, i) + s + long.substring(i));\n"
+    "    }\n"
+    "  }\n"
+    "  var cons = '';\n"
+    "  for (int i = 0; i < 10; i++) cons = cons + long + '\\n';\n"
+    "  strings.add(cons);\n"
+    "  var deep = [];\n"
+    "  for (int i = 0; i < 600; i++) deep = [deep, i];\n"
+    "  return checkAll([null, true, false, 0, -1, 1 << 40,\n"
+    "      -9223372036854775808, 9223372036854775807, 1 << 100,\n"
+    "      1.5, -0.0, 0.0, 1e100, 0.1, -1.5e-10,\n"
+    "      strings, [], [1, [2, [3]]], new List(3), const [1, 'a'],\n"
+    "      {}, {'a': 1, 'b': [{}], 'c': {'d': null}}, const {'e': 2},\n"
+    "      {'caf\\u00e9': '\\u2028', 'k\\u{1F600}': strings},\n"
+    "      new Custom([1, 2.5, 'x']), {'c': new Custom(new Custom({}))},\n"
+    "      deep]);\n"
+    "}\n"
+    "checkToEncodable() {\n"
+    "  return checkAll([double.NAN, [double.INFINITY], {1: 2},\n"
+    "                   {'a': {true: false}}, new Object()],\n"
+    "                  (o) => '$o');\n"
+    "}\n"
+    "checkErrors() {\n"
+    "  var list = [];\n"
+    "  list.add([list]);\n"
+    "  var map = {};\n"
+    "  map['map'] = map;\n"
+    "  var indirect = {};\n"
+    "  indirect['custom'] = new Custom([indirect]);\n"
+    "  for (var value in [list, map, indirect, double.NAN, {1: 2},\n"
+    "                     new Object(), new Custom(new Object())]) {\n"
+    "    var result = checkError(value);\n"
+    "    if (result != '') return result;\n"
+    "  }\n"
+    "  return '';\n"
+    "}\n";
+
+
+static void ExpectChecks(Dart_Handle lib, const char* name) {
+  Dart_Handle result = Dart_Invoke(lib, NewString(name), 0, NULL);
+  EXPECT_VALID(result);
+  const char* mismatch = NULL;
+  EXPECT_VALID(Dart_StringToCString(result, &mismatch));
+  EXPECT_STREQ("", mismatch);
+}
+
+
+TEST_CASE(JSONEncoder_Values) {
+  Dart_Handle lib = TestCase::LoadTestScript(kCheckScript, NULL);
+  EXPECT_VALID(lib);
+  ExpectChecks(lib, "checkValues");
+  ExpectChecks(lib, "checkToEncodable");
+}
+
+
+TEST_CASE(JSONEncoder_Errors) {
+  Dart_Handle lib = TestCase::LoadTestScript(kCheckScript, NULL);
+  EXPECT_VALID(lib);
+  ExpectChecks(lib, "checkErrors");
+}
+
+}  // namespace dart
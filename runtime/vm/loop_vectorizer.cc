@@ -0,0 +1,734 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/loop_vectorizer.h"
+
+#include "vm/flags.h"
+#include "vm/flow_graph.h"
+#include "vm/flow_graph_compiler.h"
+#include "vm/flow_graph_range_analysis.h"
+#include "vm/intermediate_language.h"
+#include "vm/object.h"
+
+namespace dart {
+
+DEFINE_FLAG(bool, trace_loop_vectorization, false,
+    "Print loop vectorization decisions.");
+
+#define Z (flow_graph()->zone())
+
+// Number of bytes of every accessed array processed by one iteration of the
+// vector loop.
+static const intptr_t kVectorSizeInBytes = kQuadSize;
+
+
+// Returns the class id used to load or store 16 bytes at once from an
+// internal typed data array of class [cid] or kIllegalCid if accesses to such
+// arrays are not vectorized.
+static intptr_t VectorCidFor(intptr_t cid) {
+  switch (cid) {
+    case kTypedDataInt8ArrayCid:
+    case kTypedDataUint8ArrayCid:
+    case kTypedDataUint8ClampedArrayCid:
+    case kTypedDataInt16ArrayCid:
+    case kTypedDataUint16ArrayCid:
+    case kTypedDataInt32ArrayCid:
+    case kTypedDataUint32ArrayCid:
+    case kTypedDataInt64ArrayCid:
+      return kTypedDataInt32x4ArrayCid;
+    case kTypedDataFloat32ArrayCid:
+      return kTypedDataFloat32x4ArrayCid;
+    case kTypedDataFloat64ArrayCid:
+      return kTypedDataFloat64x2ArrayCid;
+    default:
+      return kIllegalCid;
+  }
+}
+
+
+static bool IsFloatArrayCid(intptr_t cid) {
+  return (cid == kTypedDataFloat32ArrayCid) ||
+         (cid == kTypedDataFloat64ArrayCid);
+}
+
+
+// Returns true if storing an element loaded from an array of class
+// [from_cid] into an array of class [to_cid] does not change its bit pattern,
+// so that the copy can be performed on raw 16 byte vectors.
+// Note: copying Float32List elements through scalar code quiets signalling
+// NaNs, which raw vector copies preserve. NaN payloads are not observable
+// through double values, so both are considered equivalent.
+static bool IsBitwiseCopy(intptr_t from_cid, intptr_t to_cid) {
+  if (Instance::ElementSizeFor(from_cid) != Instance::ElementSizeFor(to_cid)) {
+    return false;
+  }
+  if (IsFloatArrayCid(from_cid) || IsFloatArrayCid(to_cid)) {
+    return from_cid == to_cid;
+  }
+  if (to_cid == kTypedDataUint8ClampedArrayCid) {
+    // Negative Int8 values are clamped to 0 when stored.
+    return (from_cid == kTypedDataUint8ArrayCid) ||
+           (from_cid == kTypedDataUint8ClampedArrayCid);
+  }
+  return true;
+}
+
+
+// Returns true if the given double value is exactly representable as a
+// single precision float.
+static bool IsFloat32Value(Definition* defn) {
+  LoadIndexedInstr* load = defn->AsLoadIndexed();
+  if (load != NULL) {
+    return load->class_id() == kTypedDataFloat32ArrayCid;
+  }
+  ConstantInstr* constant = defn->AsConstant();
+  if ((constant != NULL) && constant->value().IsDouble()) {
+    const double value = Double::Cast(constant->value()).value();
+    return isnan(value) ||
+        (static_cast<double>(static_cast<float>(value)) == value);
+  }
+  return false;
+}
+
+
+static bool IsSupportedDoubleOp(Token::Kind op_kind) {
+  return (op_kind == Token::kADD) ||
+         (op_kind == Token::kSUB) ||
+         (op_kind == Token::kMUL) ||
+         (op_kind == Token::kDIV);
+}
+
+
+// Replaces all uses of [from] in the given environment with [to].
+static void RenameEnvironmentUses(Environment* env,
+                                  Definition* from,
+                                  Definition* to) {
+  for (Environment::DeepIterator it(env); !it.Done(); it.Advance()) {
+    Value* use = it.CurrentValue();
+    if (use->definition() == from) {
+      use->RemoveFromUseList();
+      use->set_definition(to);
+      to->AddEnvUse(use);
+    }
+  }
+}
+
+
+static bool ContainsBlock(const GrowableArray<BlockEntryInstr*>& blocks,
+                          BlockEntryInstr* block) {
+  for (intptr_t i = 0; i < blocks.length(); i++) {
+    if (blocks[i] == block) return true;
+  }
+  return false;
+}
+
+
+static void SetPhiInput(Zone* zone,
+                        PhiInstr* phi,
+                        intptr_t index,
+                        Definition* defn) {
+  Value* input = new(zone) Value(defn);
+  phi->SetInputAt(index, input);
+  defn->AddInputUse(input);
+}
+
+
+LoopVectorizer::LoopVectorizer(FlowGraph* flow_graph)
+    : flow_graph_(flow_graph),
+      header_(NULL),
+      pre_header_(NULL),
+      body_(NULL),
+      induction_(NULL),
+      increment_(NULL),
+      limit_(NULL),
+      stack_check_(NULL),
+      element_size_(0),
+      arrays_(),
+      array_cids_(),
+      bounds_(),
+      scalar_values_(),
+      vector_values_() {
+}
+
+
+void LoopVectorizer::Optimize() {
+#if defined(TARGET_ARCH_X64) || defined(TARGET_ARCH_IA32)
+  if (!FlowGraphCompiler::SupportsUnboxedSimd128() ||
+      flow_graph()->IsCompiledForOsr()) {
+    return;
+  }
+
+  // Vectorizing a loop changes the block order and the dominator tree, which
+  // invalidates the loop information. Recompute it after every transformation
+  // and remember the headers that were already visited: the scalar loop stays
+  // in the graph and would otherwise be matched again.
+  GrowableArray<BlockEntryInstr*> visited;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    const ZoneGrowableArray<BlockEntryInstr*>& loop_headers =
+        flow_graph()->LoopHeaders();
+    for (intptr_t i = 0; i < loop_headers.length(); ++i) {
+      BlockEntryInstr* header = loop_headers[i];
+      if (ContainsBlock(visited, header)) continue;
+      visited.Add(header);
+      if (header->IsJoinEntry() && TryVectorizeLoop(header->AsJoinEntry())) {
+        changed = true;
+        break;
+      }
+    }
+  }
+#else
+  // Vector loads and stores with the element scale of a scalar typed data
+  // array are only implemented on x64 and ia32.
+#endif
+}
+
+
+bool LoopVectorizer::TryVectorizeLoop(JoinEntryInstr* header) {
+  element_size_ = 0;
+  stack_check_ = NULL;
+  arrays_.Clear();
+  array_cids_.Clear();
+  bounds_.Clear();
+  scalar_values_.Clear();
+  vector_values_.Clear();
+
+  if (!MatchLoopShape(header) || !MatchLoopBody()) {
+    return false;
+  }
+
+  if (FLAG_trace_loop_vectorization) {
+    THR_Print("Vectorizing loop B%" Pd " in %s (%" Pd " lanes)\n",
+              header->block_id(),
+              flow_graph()->function().ToFullyQualifiedCString(),
+              kVectorSizeInBytes / element_size_);
+  }
+  EmitVectorLoop();
+  return true;
+}
+
+
+bool LoopVectorizer::IsLoopInvariant(Definition* defn) const {
+  return defn->GetBlock()->Dominates(pre_header_);
+}
+
+
+bool LoopVectorizer::IsInLoopBody(Definition* defn) const {
+  return !defn->IsPhi() && (defn->GetBlock() == body_);
+}
+
+
+bool LoopVectorizer::MatchLoopShape(JoinEntryInstr* header) {
+  header_ = header;
+  if ((header->try_index() != CatchClauseNode::kInvalidTryIndex) ||
+      (header->PredecessorCount() != 2)) {
+    return false;
+  }
+
+  // The loop must consist of the header and a single body block.
+  intptr_t loop_size = 0;
+  for (BitVector::Iterator it(header->loop_info()); !it.Done(); it.Advance()) {
+    loop_size++;
+  }
+  if (loop_size != 2) return false;
+
+  pre_header_ = header->ImmediateDominator();
+  if ((pre_header_ == NULL) ||
+      (header->IndexOfPredecessor(pre_header_) == -1) ||
+      !pre_header_->last_instruction()->IsGoto()) {
+    return false;
+  }
+  body_ = header->PredecessorAt(1 - header->IndexOfPredecessor(pre_header_));
+  if (!body_->IsTargetEntry() ||
+      (body_->PredecessorCount() != 1) ||
+      (body_->PredecessorAt(0) != header) ||
+      !body_->last_instruction()->IsGoto()) {
+    return false;
+  }
+
+  // The header may only contain a stack overflow check followed by the
+  // branch on the loop condition.
+  BranchInstr* branch = NULL;
+  for (ForwardInstructionIterator it(header); !it.Done(); it.Advance()) {
+    Instruction* current = it.Current();
+    if (current->IsCheckStackOverflow() && (stack_check_ == NULL)) {
+      stack_check_ = current->AsCheckStackOverflow();
+    } else if (current->IsBranch() && (current == header->last_instruction())) {
+      branch = current->AsBranch();
+    } else {
+      return false;
+    }
+  }
+  if ((branch == NULL) ||
+      (branch->true_successor() != body_) ||
+      ((stack_check_ != NULL) && (stack_check_->env() == NULL))) {
+    return false;
+  }
+
+  // Loop condition: i < limit or limit > i, compared as smis.
+  RelationalOpInstr* condition = branch->comparison()->AsRelationalOp();
+  if ((condition == NULL) || (condition->operation_cid() != kSmiCid)) {
+    return false;
+  }
+  if (condition->kind() == Token::kLT) {
+    induction_ = condition->left()->definition()->AsPhi();
+    limit_ = condition->right()->definition();
+  } else if (condition->kind() == Token::kGT) {
+    induction_ = condition->right()->definition()->AsPhi();
+    limit_ = condition->left()->definition();
+  } else {
+    return false;
+  }
+  if ((induction_ == NULL) ||
+      (induction_->block() != header) ||
+      (induction_->representation() != kTagged) ||
+      (induction_->Type()->ToCid() != kSmiCid) ||
+      !IsLoopInvariant(limit_)) {
+    return false;
+  }
+
+  // The induction variable must be the only phi.
+  intptr_t phi_count = 0;
+  for (PhiIterator it(header); !it.Done(); it.Advance()) {
+    if (it.Current() != NULL) phi_count++;
+  }
+  if (phi_count != 1) return false;
+
+  // The induction variable starts at a non-negative value: the vector loop
+  // does not check array bounds and relies on all indices it accesses being
+  // smaller than the length of every array.
+  const intptr_t entry_index = header->IndexOfPredecessor(pre_header_);
+  Definition* start = induction_->InputAt(entry_index)->definition();
+  ConstantInstr* start_constant = start->AsConstant();
+  if ((start_constant != NULL) && start_constant->value().IsSmi()) {
+    if (Smi::Cast(start_constant->value()).Value() < 0) return false;
+  } else if (!RangeUtils::IsPositive(start->range())) {
+    return false;
+  }
+
+  // The induction variable is incremented by one on the back edge.
+  BinarySmiOpInstr* increment =
+      induction_->InputAt(1 - entry_index)->definition()->AsBinarySmiOp();
+  if ((increment == NULL) ||
+      (increment->op_kind() != Token::kADD) ||
+      !IsInLoopBody(increment)) {
+    return false;
+  }
+  Definition* step = NULL;
+  if (increment->left()->definition() == induction_) {
+    step = increment->right()->definition();
+  } else if (increment->right()->definition() == induction_) {
+    step = increment->left()->definition();
+  }
+  if ((step == NULL) ||
+      !step->IsConstant() ||
+      (step->AsConstant()->value().raw() != Smi::New(1))) {
+    return false;
+  }
+  increment_ = increment;
+  return true;
+}
+
+
+bool LoopVectorizer::MatchArrayAccess(Value* array,
+                                      Value* index,
+                                      intptr_t class_id,
+                                      intptr_t index_scale) {
+  Definition* array_defn = array->definition();
+  if ((index->definition() != induction_) ||
+      (VectorCidFor(class_id) == kIllegalCid) ||
+      (array_defn->representation() != kTagged) ||
+      !IsLoopInvariant(array_defn)) {
+    return false;
+  }
+  const intptr_t element_size = Instance::ElementSizeFor(class_id);
+  if ((index_scale != element_size) ||
+      ((element_size_ != 0) && (element_size_ != element_size))) {
+    return false;
+  }
+  element_size_ = element_size;
+  for (intptr_t i = 0; i < arrays_.length(); i++) {
+    if (arrays_[i] == array_defn) return true;
+  }
+  arrays_.Add(array_defn);
+  array_cids_.Add(class_id);
+  return true;
+}
+
+
+bool LoopVectorizer::MatchLoopBody() {
+  bool has_store = false;
+  for (ForwardInstructionIterator it(body_); !it.Done(); it.Advance()) {
+    Instruction* current = it.Current();
+    if ((current == increment_) || (current == body_->last_instruction())) {
+      continue;
+    }
+    if (current->IsCheckArrayBound()) {
+      // Bounds checks are replaced by limiting the vector loop to the
+      // smallest checked length.
+      CheckArrayBoundInstr* check = current->AsCheckArrayBound();
+      if ((check->index()->definition() != induction_) ||
+          !IsLoopInvariant(check->length()->definition())) {
+        return false;
+      }
+      bounds_.Add(check->length()->definition());
+    } else if (current->IsLoadIndexed()) {
+      LoadIndexedInstr* load = current->AsLoadIndexed();
+      if (!MatchArrayAccess(load->array(),
+                            load->index(),
+                            load->class_id(),
+                            load->index_scale())) {
+        return false;
+      }
+    } else if (current->IsStoreIndexed()) {
+      StoreIndexedInstr* store = current->AsStoreIndexed();
+      if (!MatchArrayAccess(store->array(),
+                            store->index(),
+                            store->class_id(),
+                            store->index_scale())) {
+        return false;
+      }
+      has_store = true;
+    } else if (current->IsBinaryDoubleOp()) {
+      if (!IsSupportedDoubleOp(current->AsBinaryDoubleOp()->op_kind())) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  if (!has_store) return false;
+
+  // Check the values flowing into the stores now that the element size of
+  // the loop is known.
+  for (ForwardInstructionIterator it(body_); !it.Done(); it.Advance()) {
+    StoreIndexedInstr* store = it.Current()->AsStoreIndexed();
+    if ((store != NULL) &&
+        !CanVectorizeStoredValue(store->value()->definition(),
+                                 store->class_id())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+bool LoopVectorizer::CanVectorizeStoredValue(Definition* value,
+                                             intptr_t class_id) {
+  if (IsInLoopBody(value)) {
+    LoadIndexedInstr* load = value->AsLoadIndexed();
+    if (load != NULL) {
+      return IsBitwiseCopy(load->class_id(), class_id);
+    }
+    return IsFloatArrayCid(class_id) && CanVectorizeArithmetic(value, class_id);
+  }
+  if (!IsLoopInvariant(value)) {
+    return false;
+  }
+  // Fill with a loop invariant value.
+  switch (class_id) {
+    case kTypedDataFloat32ArrayCid:
+    case kTypedDataFloat64ArrayCid:
+      return value->representation() == kUnboxedDouble;
+    case kTypedDataInt32ArrayCid:
+      return value->representation() == kUnboxedInt32;
+    default:
+      return false;
+  }
+}
+
+
+bool LoopVectorizer::CanVectorizeArithmetic(Definition* defn,
+                                            intptr_t class_id) {
+  BinaryDoubleOpInstr* op = defn->AsBinaryDoubleOp();
+  if ((op == NULL) || !IsInLoopBody(op)) {
+    return false;
+  }
+  if (class_id == kTypedDataFloat32ArrayCid) {
+    // The result must be rounded to float32 immediately by a store.
+    for (Value::Iterator it(op->input_use_list()); !it.Done(); it.Advance()) {
+      StoreIndexedInstr* store = it.Current()->instruction()->AsStoreIndexed();
+      if ((store == NULL) ||
+          (it.Current()->use_index() != StoreIndexedInstr::kValuePos) ||
+          (store->class_id() != kTypedDataFloat32ArrayCid)) {
+        return false;
+      }
+    }
+  }
+  for (intptr_t i = 0; i < op->InputCount(); i++) {
+    Definition* input = op->InputAt(i)->definition();
+    if (class_id == kTypedDataFloat32ArrayCid) {
+      if (!IsFloat32Value(input) ||
+          (!IsInLoopBody(input) && !IsLoopInvariant(input))) {
+        return false;
+      }
+    } else if (IsInLoopBody(input)) {
+      LoadIndexedInstr* load = input->AsLoadIndexed();
+      if (load != NULL) {
+        if (load->class_id() != kTypedDataFloat64ArrayCid) return false;
+      } else if (!CanVectorizeArithmetic(input, class_id)) {
+        return false;
+      }
+    } else if (!IsLoopInvariant(input)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+Definition* LoopVectorizer::VectorValueFor(Definition* defn,
+                                           intptr_t vector_cid) {
+  for (intptr_t i = 0; i < scalar_values_.length(); i++) {
+    if (scalar_values_[i] == defn) return vector_values_[i];
+  }
+
+  // Values computed in the loop body are vectorized before their uses.
+  ASSERT(IsLoopInvariant(defn));
+  Definition* splat = NULL;
+  switch (vector_cid) {
+    case kTypedDataFloat32x4ArrayCid:
+      splat = new(Z) Float32x4SplatInstr(new(Z) Value(defn),
+                                         Thread::kNoDeoptId);
+      break;
+    case kTypedDataFloat64x2ArrayCid:
+      splat = new(Z) Float64x2SplatInstr(new(Z) Value(defn),
+                                         Thread::kNoDeoptId);
+      break;
+    case kTypedDataInt32x4ArrayCid:
+      ASSERT(defn->representation() == kUnboxedInt32);
+      splat = new(Z) Int32x4ConstructorInstr(new(Z) Value(defn),
+                                             new(Z) Value(defn),
+                                             new(Z) Value(defn),
+                                             new(Z) Value(defn),
+                                             Thread::kNoDeoptId);
+      break;
+    default:
+      UNREACHABLE();
+  }
+  flow_graph()->InsertBefore(pre_header_->last_instruction(),
+                             splat,
+                             NULL,
+                             FlowGraph::kValue);
+  scalar_values_.Add(defn);
+  vector_values_.Add(splat);
+  return splat;
+}
+
+
+Definition* LoopVectorizer::EmitVectorLimit(GotoInstr* pre_header_goto) {
+  // end = max(min(limit, length(a), length(b), ...), 0)
+  Definition* end = limit_;
+  for (intptr_t i = 0; i < arrays_.length(); i++) {
+    LoadFieldInstr* length = new(Z) LoadFieldInstr(
+        new(Z) Value(arrays_[i]),
+        CheckArrayBoundInstr::LengthOffsetFor(array_cids_[i]),
+        Type::ZoneHandle(Z, Type::SmiType()),
+        TokenPosition::kNoSource);
+    length->set_is_immutable(true);
+    length->set_result_cid(kSmiCid);
+    length->set_recognized_kind(
+        LoadFieldInstr::RecognizedKindFromArrayCid(array_cids_[i]));
+    flow_graph()->InsertBefore(pre_header_goto, length, NULL,
+                               FlowGraph::kValue);
+    bounds_.Add(length);
+  }
+  for (intptr_t i = 0; i < bounds_.length(); i++) {
+    MathMinMaxInstr* min = new(Z) MathMinMaxInstr(MethodRecognizer::kMathMin,
+                                                  new(Z) Value(end),
+                                                  new(Z) Value(bounds_[i]),
+                                                  Thread::kNoDeoptId,
+                                                  kSmiCid);
+    flow_graph()->InsertBefore(pre_header_goto, min, NULL, FlowGraph::kValue);
+    end = min;
+  }
+  MathMinMaxInstr* max = new(Z) MathMinMaxInstr(
+      MethodRecognizer::kMathMax,
+      new(Z) Value(end),
+      new(Z) Value(flow_graph()->GetConstant(Smi::ZoneHandle(Z, Smi::New(0)))),
+      Thread::kNoDeoptId,
+      kSmiCid);
+  flow_graph()->InsertBefore(pre_header_goto, max, NULL, FlowGraph::kValue);
+
+  // The last vector iteration starts at end - (lanes - 1). The subtraction
+  // cannot overflow because end is non-negative.
+  const intptr_t lanes = kVectorSizeInBytes / element_size_;
+  BinarySmiOpInstr* vector_end = new(Z) BinarySmiOpInstr(
+      Token::kSUB,
+      new(Z) Value(max),
+      new(Z) Value(
+          flow_graph()->GetConstant(Smi::ZoneHandle(Z, Smi::New(lanes - 1)))),
+      Thread::kNoDeoptId);
+  vector_end->set_can_overflow(false);
+  flow_graph()->InsertBefore(pre_header_goto, vector_end, NULL,
+                             FlowGraph::kValue);
+  return vector_end;
+}
+
+
+// Rewrites
+//
+//   B_pre:  ...; goto B_header
+//   B_header: i <- phi(start, i'); CheckStackOverflow; if i < limit B_body
+//   B_body: ...; i' <- i + 1; goto B_header
+//
+// into
+//
+//   B_pre:  ...; end <- vector limit; goto B_vheader
+//   B_vheader: vi <- phi(start, vi'); CheckStackOverflow; if vi < end B_vbody
+//   B_vbody: ...vector operations...; vi' <- vi + lanes; goto B_vheader
+//   B_vexit: goto B_header
+//   B_header: i <- phi(vi, i'); ...
+//   B_body: ...
+//
+// The scalar loop executes the remaining iterations and performs the bounds
+// checks that throw if the loop accesses elements out of range.
+void LoopVectorizer::EmitVectorLoop() {
+  const intptr_t lanes = kVectorSizeInBytes / element_size_;
+  const intptr_t try_index = header_->try_index();
+  GotoInstr* pre_header_goto = pre_header_->last_instruction()->AsGoto();
+  BranchInstr* branch = header_->last_instruction()->AsBranch();
+
+  const intptr_t entry_index = header_->IndexOfPredecessor(pre_header_);
+  Definition* start = induction_->InputAt(entry_index)->definition();
+  Definition* back_edge_value =
+      induction_->InputAt(1 - entry_index)->definition();
+
+  Definition* vector_end = EmitVectorLimit(pre_header_goto);
+
+  // Vector loop header.
+  JoinEntryInstr* vector_header =
+      new(Z) JoinEntryInstr(flow_graph()->allocate_block_id(), try_index);
+  PhiInstr* vector_index = new(Z) PhiInstr(vector_header, 2);
+  vector_header->InsertPhi(vector_index);
+  flow_graph()->AllocateSSAIndexes(vector_index);
+  vector_index->mark_alive();
+  vector_index->UpdateType(CompileType::FromCid(kSmiCid));
+
+  Instruction* cursor = vector_header;
+  if (stack_check_ != NULL) {
+    CheckStackOverflowInstr* check = new(Z) CheckStackOverflowInstr(
+        stack_check_->token_pos(), stack_check_->loop_depth());
+    cursor = flow_graph()->AppendTo(cursor, check, NULL, FlowGraph::kEffect);
+    // Deoptimizing here resumes the scalar loop at the current vector index.
+    check->InheritDeoptTarget(Z, stack_check_);
+    RenameEnvironmentUses(check->env(), induction_, vector_index);
+  }
+  RelationalOpInstr* condition = new(Z) RelationalOpInstr(
+      branch->token_pos(),
+      Token::kLT,
+      new(Z) Value(vector_index),
+      new(Z) Value(vector_end),
+      kSmiCid,
+      Thread::kNoDeoptId);
+  BranchInstr* vector_branch = new(Z) BranchInstr(condition);
+  flow_graph()->AppendTo(cursor, vector_branch, NULL, FlowGraph::kEffect);
+  vector_header->set_last_instruction(vector_branch);
+
+  // Vector loop body.
+  TargetEntryInstr* vector_body =
+      new(Z) TargetEntryInstr(flow_graph()->allocate_block_id(), try_index);
+  cursor = vector_body;
+  for (ForwardInstructionIterator it(body_); !it.Done(); it.Advance()) {
+    Instruction* current = it.Current();
+    if (current->IsLoadIndexed()) {
+      LoadIndexedInstr* load = current->AsLoadIndexed();
+      LoadIndexedInstr* vector = new(Z) LoadIndexedInstr(
+          new(Z) Value(load->array()->definition()),
+          new(Z) Value(vector_index),
+          load->index_scale(),
+          VectorCidFor(load->class_id()),
+          Thread::kNoDeoptId,
+          load->token_pos());
+      cursor = flow_graph()->AppendTo(cursor, vector, NULL, FlowGraph::kValue);
+      scalar_values_.Add(load);
+      vector_values_.Add(vector);
+    } else if (current->IsBinaryDoubleOp()) {
+      BinaryDoubleOpInstr* op = current->AsBinaryDoubleOp();
+      const intptr_t vector_cid = (element_size_ == kFloatSize)
+          ? kTypedDataFloat32x4ArrayCid
+          : kTypedDataFloat64x2ArrayCid;
+      Value* left = new(Z) Value(
+          VectorValueFor(op->left()->definition(), vector_cid));
+      Value* right = new(Z) Value(
+          VectorValueFor(op->right()->definition(), vector_cid));
+      Definition* vector = NULL;
+      if (vector_cid == kTypedDataFloat32x4ArrayCid) {
+        vector = new(Z) BinaryFloat32x4OpInstr(
+            op->op_kind(), left, right, Thread::kNoDeoptId);
+      } else {
+        vector = new(Z) BinaryFloat64x2OpInstr(
+            op->op_kind(), left, right, Thread::kNoDeoptId);
+      }
+      cursor = flow_graph()->AppendTo(cursor, vector, NULL, FlowGraph::kValue);
+      scalar_values_.Add(op);
+      vector_values_.Add(vector);
+    } else if (current->IsStoreIndexed()) {
+      StoreIndexedInstr* store = current->AsStoreIndexed();
+      const intptr_t vector_cid = VectorCidFor(store->class_id());
+      StoreIndexedInstr* vector = new(Z) StoreIndexedInstr(
+          new(Z) Value(store->array()->definition()),
+          new(Z) Value(vector_index),
+          new(Z) Value(VectorValueFor(store->value()->definition(),
+                                      vector_cid)),
+          kNoStoreBarrier,
+          store->index_scale(),
+          vector_cid,
+          Thread::kNoDeoptId,
+          store->token_pos());
+      cursor = flow_graph()->AppendTo(cursor, vector, NULL, FlowGraph::kEffect);
+    }
+  }
+  // The vector index stays below the length of the arrays, so adding the
+  // number of lanes cannot overflow.
+  BinarySmiOpInstr* vector_next = new(Z) BinarySmiOpInstr(
+      Token::kADD,
+      new(Z) Value(vector_index),
+      new(Z) Value(
+          flow_graph()->GetConstant(Smi::ZoneHandle(Z, Smi::New(lanes)))),
+      Thread::kNoDeoptId);
+  vector_next->set_can_overflow(false);
+  cursor = flow_graph()->AppendTo(cursor, vector_next, NULL,
+                                  FlowGraph::kValue);
+  GotoInstr* back_edge = new(Z) GotoInstr(vector_header);
+  flow_graph()->CopyDeoptTarget(back_edge, pre_header_goto);
+  flow_graph()->AppendTo(cursor, back_edge, NULL, FlowGraph::kEffect);
+  vector_body->set_last_instruction(back_edge);
+
+  // Vector loop exit, continuing with the scalar loop.
+  TargetEntryInstr* vector_exit =
+      new(Z) TargetEntryInstr(flow_graph()->allocate_block_id(), try_index);
+  GotoInstr* exit_goto = new(Z) GotoInstr(header_);
+  flow_graph()->CopyDeoptTarget(exit_goto, pre_header_goto);
+  flow_graph()->AppendTo(vector_exit, exit_goto, NULL, FlowGraph::kEffect);
+  vector_exit->set_last_instruction(exit_goto);
+
+  *vector_branch->true_successor_address() = vector_body;
+  *vector_branch->false_successor_address() = vector_exit;
+  pre_header_goto->set_successor(vector_header);
+
+  // Detach the inputs of the scalar induction variable: the predecessors of
+  // the loop header change and phi inputs are ordered by predecessor.
+  induction_->InputAt(0)->RemoveFromUseList();
+  induction_->InputAt(1)->RemoveFromUseList();
+
+  // Recompute block order, predecessors and dominators.
+  flow_graph()->DiscoverBlocks();
+  GrowableArray<BitVector*> dominance_frontier;
+  flow_graph()->ComputeDominators(&dominance_frontier);
+
+  const intptr_t vector_entry_index =
+      vector_header->IndexOfPredecessor(pre_header_);
+  ASSERT(vector_entry_index != -1);
+  SetPhiInput(Z, vector_index, vector_entry_index, start);
+  SetPhiInput(Z, vector_index, 1 - vector_entry_index, vector_next);
+
+  const intptr_t scalar_entry_index = header_->IndexOfPredecessor(vector_exit);
+  ASSERT(scalar_entry_index != -1);
+  SetPhiInput(Z, induction_, scalar_entry_index, vector_index);
+  SetPhiInput(Z, induction_, 1 - scalar_entry_index, back_edge_value);
+}
+
+}  // namespace dart
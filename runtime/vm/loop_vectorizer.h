@@ -0,0 +1,104 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef VM_LOOP_VECTORIZER_H_
+#define VM_LOOP_VECTORIZER_H_
+
+#include "vm/allocation.h"
+#include "vm/growable_array.h"
+
+namespace dart {
+
+class BlockEntryInstr;
+class CheckStackOverflowInstr;
+class Definition;
+class FlowGraph;
+class GotoInstr;
+class Instruction;
+class JoinEntryInstr;
+class PhiInstr;
+class Value;
+
+// Rewrites simple counted loops over typed data into a loop that processes
+// 16 bytes of every accessed array per iteration using SIMD values, followed
+// by the original scalar loop which handles the remaining iterations.
+//
+// Only loops of the form
+//
+//   for (var i = start; i < end; i++) {
+//     a[i] = f(b[i], c[i], ...);
+//   }
+//
+// are vectorized, where all accessed arrays are loop invariant internal
+// typed data arrays with the same element size, start is known to be
+// non-negative and f is one of:
+//
+//   * a copy of an element from an array with the same element
+//     representation;
+//   * a loop invariant value (fill);
+//   * an element-wise expression of double arithmetic (+, -, *, /) over
+//     Float32List or Float64List elements and loop invariant values.
+//
+// For Float32List only expressions consisting of a single operation are
+// vectorized: computing a single operation on float32 inputs in double
+// precision and rounding the result to float32 is equivalent to computing
+// it in single precision, but this does not hold for longer expressions.
+class LoopVectorizer : public ValueObject {
+ public:
+  explicit LoopVectorizer(FlowGraph* flow_graph);
+
+  void Optimize();
+
+ private:
+  FlowGraph* flow_graph() const { return flow_graph_; }
+
+  bool TryVectorizeLoop(JoinEntryInstr* header);
+
+  // Checks that the loop has the expected shape and collects the loop
+  // header, pre-header, body, induction variable and loop limit.
+  bool MatchLoopShape(JoinEntryInstr* header);
+
+  // Checks that every instruction in the loop body can be vectorized and
+  // collects the arrays and bounds accessed by the loop.
+  bool MatchLoopBody();
+
+  bool MatchArrayAccess(Value* array,
+                        Value* index,
+                        intptr_t class_id,
+                        intptr_t index_scale);
+  bool CanVectorizeStoredValue(Definition* value, intptr_t class_id);
+  bool CanVectorizeArithmetic(Definition* defn, intptr_t class_id);
+
+  bool IsLoopInvariant(Definition* defn) const;
+  bool IsInLoopBody(Definition* defn) const;
+
+  void EmitVectorLoop();
+  Definition* EmitVectorLimit(GotoInstr* pre_header_goto);
+  Definition* VectorValueFor(Definition* defn, intptr_t vector_cid);
+
+  FlowGraph* const flow_graph_;
+
+  // State of the loop that is currently being vectorized.
+  JoinEntryInstr* header_;
+  BlockEntryInstr* pre_header_;
+  BlockEntryInstr* body_;
+  PhiInstr* induction_;
+  Definition* increment_;
+  Definition* limit_;
+  CheckStackOverflowInstr* stack_check_;
+  intptr_t element_size_;
+  GrowableArray<Definition*> arrays_;
+  GrowableArray<intptr_t> array_cids_;
+  GrowableArray<Definition*> bounds_;
+
+  // Maps scalar definitions to their vector counterparts.
+  GrowableArray<Definition*> scalar_values_;
+  GrowableArray<Definition*> vector_values_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoopVectorizer);
+};
+
+}  // namespace dart
+
+#endif  // VM_LOOP_VECTORIZER_H_
@@ -6,6 +6,7 @@
 
 #include "include/dart_api.h"
 #include "platform/assert.h"
+#include "vm/allocation_sampler.h"
 #include "vm/assembler.h"
 #include "vm/become.h"
 #include "vm/cpu.h"
@@ -68,6 +69,7 @@ DEFINE_FLAG(bool, ignore_patch_signature_mismatch, false,
 DEFINE_FLAG(bool, remove_script_timestamps_for_test, false,
             "Remove script timestamps to allow for deterministic testing.");
 
+DECLARE_FLAG(int, deoptimization_storm_threshold);
 DECLARE_FLAG(bool, show_invisible_frames);
 DECLARE_FLAG(bool, trace_deoptimization);
 DECLARE_FLAG(bool, trace_deoptimization_verbose);
@@ -1269,6 +1271,11 @@ NOT_IN_PRODUCT(
   RegisterPrivateClass(cls, Symbols::ExternalTwoByteString(), core_lib);
   pending_classes.Add(cls);
 
+  cls = Class::NewStringClass(kConsStringCid);
+  object_store->set_cons_string_class(cls);
+  RegisterPrivateClass(cls, Symbols::ConsString(), core_lib);
+  pending_classes.Add(cls);
+
   // Pre-register the isolate library so the native class implementations
   // can be hooked up before compiling it.
   Library& isolate_lib =
@@ -1730,6 +1737,9 @@ NOT_IN_PRODUCT(
   cls = Class::NewStringClass(kExternalTwoByteStringCid);
   object_store->set_external_two_byte_string_class(cls);
 
+  cls = Class::NewStringClass(kConsStringCid);
+  object_store->set_cons_string_class(cls);
+
   cls = Class::New<Bool>();
   object_store->set_bool_class(cls);
 
@@ -1861,6 +1871,12 @@ RawObject* Object::Allocate(intptr_t cls_id,
   InitializeObject(address, cls_id, size, (isolate == Dart::vm_isolate()));
   RawObject* raw_obj = reinterpret_cast<RawObject*>(address + kHeapObjectTag);
   ASSERT(cls_id == RawObject::ClassIdTag::decode(raw_obj->ptr()->tags_));
+  AllocationSampler* sampler = isolate->allocation_sampler();
+  if ((sampler != NULL) &&
+      thread->IsMutatorThread() &&
+      sampler->ShouldSample(raw_obj, size)) {
+    sampler->SampleAllocation(thread, raw_obj, cls_id, size);
+  }
   return raw_obj;
 }
 
@@ -3243,9 +3259,11 @@ RawClass* Class::NewStringClass(intptr_t class_id) {
     instance_size = TwoByteString::InstanceSize();
   } else if (class_id == kExternalOneByteStringCid) {
     instance_size = ExternalOneByteString::InstanceSize();
-  } else {
-    ASSERT(class_id == kExternalTwoByteStringCid);
+  } else if (class_id == kExternalTwoByteStringCid) {
     instance_size = ExternalTwoByteString::InstanceSize();
+  } else {
+    ASSERT(class_id == kConsStringCid);
+    instance_size = ConsString::InstanceSize();
   }
   Class& result = Class::Handle(New<String>(class_id));
   result.set_instance_size(instance_size);
@@ -3440,6 +3458,7 @@ NOT_IN_PRODUCT(
     case kTwoByteStringCid:
     case kExternalOneByteStringCid:
     case kExternalTwoByteStringCid:
+    case kConsStringCid:
       return Symbols::_String().raw();
     case kArrayCid:
     case kImmutableArrayCid:
@@ -5881,6 +5900,67 @@ void Function::SetNumOptionalParameters(intptr_t num_optional_parameters,
 }
 
 
+intptr_t Function::DeoptReasonCount(ICData::DeoptReasonId reason) const {
+  ASSERT((reason >= 0) && (reason < ICData::kDeoptNumReasons));
+  const intptr_t shift = reason * kDeoptReasonCountBits;
+  return static_cast<intptr_t>(
+      (raw_ptr()->deopt_reason_counts_ >> shift) & kMaxDeoptReasonCount);
+}
+
+
+void Function::IncrementDeoptReasonCount(ICData::DeoptReasonId reason) const {
+  COMPILE_ASSERT((ICData::kDeoptNumReasons * kDeoptReasonCountBits) <=
+                 (kBitsPerByte * sizeof(raw_ptr()->deopt_reason_counts_)));
+  if (DeoptReasonCount(reason) == kMaxDeoptReasonCount) {
+    return;
+  }
+  const intptr_t shift = reason * kDeoptReasonCountBits;
+  StoreNonPointer(&raw_ptr()->deopt_reason_counts_,
+                  raw_ptr()->deopt_reason_counts_ +
+                      (static_cast<uint64_t>(1) << shift));
+}
+
+
+intptr_t Function::optimization_backoff() const {
+  return static_cast<intptr_t>(
+      (raw_ptr()->deopt_reason_counts_ >> kOptimizationBackoffShift) &
+      kMaxOptimizationBackoff);
+}
+
+
+void Function::set_optimization_backoff(intptr_t value) const {
+  COMPILE_ASSERT((kOptimizationBackoffShift + kOptimizationBackoffBits) <=
+                 (kBitsPerByte * sizeof(raw_ptr()->deopt_reason_counts_)));
+  ASSERT((value >= 0) && (value <= kMaxOptimizationBackoff));
+  const uint64_t mask =
+      static_cast<uint64_t>(kMaxOptimizationBackoff) <<
+          kOptimizationBackoffShift;
+  StoreNonPointer(&raw_ptr()->deopt_reason_counts_,
+                  (raw_ptr()->deopt_reason_counts_ & ~mask) |
+                      (static_cast<uint64_t>(value) <<
+                          kOptimizationBackoffShift));
+}
+
+
+void Function::ClearDeoptReasonCounts() const {
+  StoreNonPointer(&raw_ptr()->deopt_reason_counts_,
+                  static_cast<uint64_t>(0));
+}
+
+
+bool Function::HasDeoptStorm(ICData::DeoptReasonId reason) const {
+  return (FLAG_deoptimization_storm_threshold > 0) &&
+      (DeoptReasonCount(reason) >= FLAG_deoptimization_storm_threshold);
+}
+
+
+bool Function::AllowsPolymorphicDeopt() const {
+  return FLAG_polymorphic_with_deopt &&
+      !HasDeoptStorm(ICData::kDeoptPolymorphicInstanceCallTestFail) &&
+      !HasDeoptStorm(ICData::kDeoptCheckClass);
+}
+
+
 bool Function::IsOptimizable() const {
   if (is_native()) {
     // Native methods don't need to be optimized.
@@ -6507,6 +6587,7 @@ RawFunction* Function::New(const String& name,
   result.set_num_optional_parameters(0);
   result.set_usage_counter(0);
   result.set_deoptimization_counter(0);
+  result.ClearDeoptReasonCounts();
   result.set_optimized_instruction_count(0);
   result.set_optimized_call_site_count(0);
   result.set_is_optimizable(is_native ? false : true);
@@ -6535,6 +6616,7 @@ RawFunction* Function::Clone(const Class& new_owner) const {
   clone.ClearCode();
   clone.set_usage_counter(0);
   clone.set_deoptimization_counter(0);
+  clone.ClearDeoptReasonCounts();
   clone.set_optimized_instruction_count(0);
   clone.set_optimized_call_site_count(0);
   if (new_owner.NumTypeParameters() > 0) {
@@ -7119,6 +7201,11 @@ void Function::ClearICDataArray() const {
 }
 
 
+void Function::set_coverage_array(const Array& value) const {
+  StorePointer(&raw_ptr()->coverage_array_, value.raw());
+}
+
+
 void Function::SetDeoptReasonForAll(intptr_t deopt_id,
                                     ICData::DeoptReasonId reason) {
   const Array& array = Array::Handle(ic_data_array());
@@ -14803,10 +14890,114 @@ void SubtypeTestCache::set_cache(const Array& value) const {
 }
 
 
+// Hashed layout is only used on architectures where the SubtypeNTestCache
+// stubs know how to probe it.
+static bool SupportsHashedSubtypeTestCache() {
+#if defined(TARGET_ARCH_X64)
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+static intptr_t SubtypeTestCacheHash(const Object& class_id_or_function) {
+  return class_id_or_function.IsSmi()
+      ? Smi::Cast(class_id_or_function).Value()
+      : static_cast<intptr_t>(kClosureCid);
+}
+
+
+bool SubtypeTestCache::IsHashed() const {
+  NoSafepointScope no_safepoint;
+  return (Smi::Value(cache()->ptr()->length_) % kTestEntryLength) != 0;
+}
+
+
 intptr_t SubtypeTestCache::NumberOfChecks() const {
   NoSafepointScope no_safepoint;
-  // Do not count the sentinel;
-  return (Smi::Value(cache()->ptr()->length_) / kTestEntryLength) - 1;
+  if (!IsHashed()) {
+    // Do not count the sentinel;
+    return (Smi::Value(cache()->ptr()->length_) / kTestEntryLength) - 1;
+  }
+  RawArray* data = cache();
+  const intptr_t num_entries =
+      Smi::Value(data->ptr()->length_) / kTestEntryLength;
+  intptr_t count = 0;
+  for (intptr_t i = 0; i < num_entries; i++) {
+    if (data->ptr()->data()[i * kTestEntryLength + kInstanceClassIdOrFunction]
+            != Object::null()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+
+// Store the check into the first free entry starting from the entry selected
+// by the hash of the instance class id, growing the overflow area if probing
+// reaches the terminating null entry.
+void SubtypeTestCache::InsertHashed(
+    Array* data,
+    const Object& instance_class_id_or_function,
+    const Object& instance_type_arguments,
+    const Object& instantiator_type_arguments,
+    const Object& test_result) {
+  const intptr_t mask = Smi::Value(Smi::RawCast(data->At(data->Length() - 1)));
+  // The terminating null entry precedes the mask.
+  const intptr_t last = (data->Length() - 1) / kTestEntryLength - 1;
+  intptr_t ix = SubtypeTestCacheHash(instance_class_id_or_function) & mask;
+  while (data->At(ix * kTestEntryLength + kInstanceClassIdOrFunction) !=
+         Object::null()) {
+    ix++;
+  }
+  if (ix == last) {
+    *data = Array::Grow(*data, data->Length() + kTestEntryLength);
+    data->SetAt((last + 1) * kTestEntryLength, Object::null_object());
+    data->SetAt(data->Length() - 1, Smi::Handle(Smi::New(mask)));
+  }
+  const intptr_t data_pos = ix * kTestEntryLength;
+  data->SetAt(data_pos + kInstanceTypeArguments, instance_type_arguments);
+  data->SetAt(data_pos + kInstantiatorTypeArguments,
+              instantiator_type_arguments);
+  data->SetAt(data_pos + kTestResult, test_result);
+  data->SetAt(data_pos + kInstanceClassIdOrFunction,
+              instance_class_id_or_function);
+}
+
+
+// Move all checks into a new hashed cache with the given number of entries
+// (a power of two) in the hashed part.
+void SubtypeTestCache::Rehash(intptr_t capacity) const {
+  ASSERT(Utils::IsPowerOfTwo(capacity));
+  const Array& old_data = Array::Handle(cache());
+  const intptr_t old_entries = old_data.Length() / kTestEntryLength;
+  // Hashed entries, terminating null entry and mask.
+  Array& data = Array::Handle(
+      Array::New((capacity + 1) * kTestEntryLength + 1, Heap::kOld));
+  data.SetAt(data.Length() - 1, Smi::Handle(Smi::New(capacity - 1)));
+  Object& instance_class_id_or_function = Object::Handle();
+  Object& instance_type_arguments = Object::Handle();
+  Object& instantiator_type_arguments = Object::Handle();
+  Object& test_result = Object::Handle();
+  for (intptr_t i = 0; i < old_entries; i++) {
+    const intptr_t data_pos = i * kTestEntryLength;
+    instance_class_id_or_function =
+        old_data.At(data_pos + kInstanceClassIdOrFunction);
+    if (instance_class_id_or_function.IsNull()) {
+      continue;
+    }
+    instance_type_arguments = old_data.At(data_pos + kInstanceTypeArguments);
+    instantiator_type_arguments =
+        old_data.At(data_pos + kInstantiatorTypeArguments);
+    test_result = old_data.At(data_pos + kTestResult);
+    InsertHashed(&data,
+                 instance_class_id_or_function,
+                 instance_type_arguments,
+                 instantiator_type_arguments,
+                 test_result);
+  }
+  set_cache(data);
 }
 
 
@@ -14816,6 +15007,26 @@ void SubtypeTestCache::AddCheck(
     const TypeArguments& instantiator_type_arguments,
     const Bool& test_result) const {
   intptr_t old_num = NumberOfChecks();
+  if (SupportsHashedSubtypeTestCache() &&
+      (IsHashed() || (old_num >= kMaxLinearChecks))) {
+    // Keep the hashed part of the cache at most half full.
+    const Array& data = Array::Handle(cache());
+    const intptr_t capacity = IsHashed()
+        ? Smi::Value(Smi::RawCast(data.At(data.Length() - 1))) + 1
+        : 0;
+    if (2 * (old_num + 1) > capacity) {
+      Rehash(static_cast<intptr_t>(
+          Utils::RoundUpToPowerOfTwo(4 * (old_num + 1))));
+    }
+    Array& hashed_data = Array::Handle(cache());
+    InsertHashed(&hashed_data,
+                 instance_class_id_or_function,
+                 instance_type_arguments,
+                 instantiator_type_arguments,
+                 test_result);
+    set_cache(hashed_data);
+    return;
+  }
   Array& data = Array::Handle(cache());
   intptr_t new_len = data.Length() + kTestEntryLength;
   data = Array::Grow(data, new_len);
@@ -14836,6 +15047,22 @@ void SubtypeTestCache::GetCheck(intptr_t ix,
                                 TypeArguments* instantiator_type_arguments,
                                 Bool* test_result) const {
   Array& data = Array::Handle(cache());
+  if (IsHashed()) {
+    // Find the ix-th used entry.
+    intptr_t entry = 0;
+    intptr_t used = 0;
+    while (true) {
+      if (data.At(entry * kTestEntryLength + kInstanceClassIdOrFunction) !=
+          Object::null()) {
+        if (used == ix) {
+          break;
+        }
+        used++;
+      }
+      entry++;
+    }
+    ix = entry;
+  }
   intptr_t data_pos = ix * kTestEntryLength;
   *instance_class_id_or_function =
       data.At(data_pos + kInstanceClassIdOrFunction);
@@ -14846,6 +15073,36 @@ void SubtypeTestCache::GetCheck(intptr_t ix,
 }
 
 
+bool SubtypeTestCache::HasCheck(
+    const Object& instance_class_id_or_function,
+    const TypeArguments& instance_type_arguments,
+    const TypeArguments& instantiator_type_arguments) const {
+  const Array& data = Array::Handle(cache());
+  intptr_t ix = 0;
+  if (IsHashed()) {
+    const intptr_t mask =
+        Smi::Value(Smi::RawCast(data.At(data.Length() - 1)));
+    ix = SubtypeTestCacheHash(instance_class_id_or_function) & mask;
+  }
+  // Both layouts are probed until the next null entry.
+  while (true) {
+    const intptr_t data_pos = ix * kTestEntryLength;
+    RawObject* entry = data.At(data_pos + kInstanceClassIdOrFunction);
+    if (entry == Object::null()) {
+      return false;
+    }
+    if ((entry == instance_class_id_or_function.raw()) &&
+        (data.At(data_pos + kInstanceTypeArguments) ==
+         instance_type_arguments.raw()) &&
+        (data.At(data_pos + kInstantiatorTypeArguments) ==
+         instantiator_type_arguments.raw())) {
+      return true;
+    }
+    ix++;
+  }
+}
+
+
 const char* SubtypeTestCache::ToCString() const {
   return "SubtypeTestCache";
 }
@@ -19611,6 +19868,9 @@ uint16_t String::CharAt(intptr_t index) const {
   if (class_id == kExternalOneByteStringCid) {
     return ExternalOneByteString::CharAt(*this, index);
   }
+  if (class_id == kConsStringCid) {
+    return ConsString::CharAt(*this, index);
+  }
   ASSERT(class_id == kExternalTwoByteStringCid);
   return ExternalTwoByteString::CharAt(*this, index);
 }
@@ -19628,6 +19888,9 @@ Scanner::CharAtFunc String::CharAtFunc() const {
   if (class_id == kExternalOneByteStringCid) {
     return &ExternalOneByteString::CharAt;
   }
+  if (class_id == kConsStringCid) {
+    return &ConsString::CharAt;
+  }
   ASSERT(class_id == kExternalTwoByteStringCid);
   return &ExternalTwoByteString::CharAt;
 }
@@ -19638,6 +19901,9 @@ intptr_t String::CharSize() const {
   if (class_id == kOneByteStringCid || class_id == kExternalOneByteStringCid) {
     return kOneByteChar;
   }
+  if (class_id == kConsStringCid) {
+    return ConsString::CharSize(*this);
+  }
   ASSERT(class_id == kTwoByteStringCid ||
          class_id == kExternalTwoByteStringCid);
   return kTwoByteChar;
@@ -19680,6 +19946,15 @@ bool String::Equals(const String& str,
     return false;  // Lengths don't match.
   }
 
+  if ((len > 0) && (IsConsString() || str.IsConsString())) {
+    // Compare copies instead of walking the trees for every character.
+    Zone* zone = Thread::Current()->zone();
+    const uint16_t* this_chars = ConsString::ToUTF16(zone, *this, 0, len);
+    const uint16_t* str_chars =
+        ConsString::ToUTF16(zone, str, begin_index, len);
+    return memcmp(this_chars, str_chars, len * sizeof(uint16_t)) == 0;
+  }
+
   Scanner::CharAtFunc this_char_at_func = this->CharAtFunc();
   Scanner::CharAtFunc str_char_at_func = str.CharAtFunc();
   for (intptr_t i = 0; i < len; i++) {
@@ -19978,6 +20253,18 @@ void String::Copy(const String& dst, intptr_t dst_offset,
   ASSERT(len >= 0);
   ASSERT(len <= (dst.Length() - dst_offset));
   ASSERT(len <= (src.Length() - src_offset));
+  if ((len > 0) && src.IsConsString()) {
+    NoSafepointScope no_safepoint;
+    if (dst.IsOneByteString()) {
+      ConsString::CopyChars(src, src_offset, len,
+                            OneByteString::CharAddr(dst, dst_offset));
+    } else {
+      ASSERT(dst.IsTwoByteString());
+      ConsString::CopyChars(src, src_offset, len,
+                            TwoByteString::CharAddr(dst, dst_offset));
+    }
+    return;
+  }
   if (len > 0) {
     intptr_t char_size = src.CharSize();
     if (char_size == kOneByteChar) {
@@ -20026,7 +20313,7 @@ RawString* String::EscapeSpecialCharacters(const String& str) {
   if (str.IsExternalOneByteString()) {
     return ExternalOneByteString::EscapeSpecialCharacters(str);
   }
-  ASSERT(str.IsExternalTwoByteString());
+  ASSERT(str.IsExternalTwoByteString() || str.IsConsString());
   // If EscapeSpecialCharacters is frequently called on external two byte
   // strings, we should implement it directly on ExternalTwoByteString rather
   // than first converting to a TwoByteString.
@@ -20386,13 +20673,18 @@ RawString* String::MakeExternal(void* array,
     intptr_t class_id = raw()->GetClassId();
 
     ASSERT(!InVMHeap());
-    if (class_id == kOneByteStringCid) {
+    if (this->CharSize() == kOneByteChar) {
       intptr_t used_size = ExternalOneByteString::InstanceSize();
-      intptr_t original_size = OneByteString::InstanceSize(str_length);
+      intptr_t original_size = (class_id == kConsStringCid) ?
+          ConsString::InstanceSize() : OneByteString::InstanceSize(str_length);
       ASSERT(original_size >= used_size);
 
       // Copy the data into the external array.
-      if (str_length > 0) {
+      if (class_id == kConsStringCid) {
+        ConsString::CopyChars(*this, 0, str_length,
+                              reinterpret_cast<uint8_t*>(array));
+      } else if (str_length > 0) {
+        ASSERT(class_id == kOneByteStringCid);
         memmove(array, OneByteString::CharAddr(*this, 0), str_length);
       }
 
@@ -20422,13 +20714,17 @@ RawString* String::MakeExternal(void* array,
       external_data = ext_data;
       finalizer = ExternalOneByteString::Finalize;
     } else {
-      ASSERT(class_id == kTwoByteStringCid);
       intptr_t used_size = ExternalTwoByteString::InstanceSize();
-      intptr_t original_size = TwoByteString::InstanceSize(str_length);
+      intptr_t original_size = (class_id == kConsStringCid) ?
+          ConsString::InstanceSize() : TwoByteString::InstanceSize(str_length);
       ASSERT(original_size >= used_size);
 
       // Copy the data into the external array.
-      if (str_length > 0) {
+      if (class_id == kConsStringCid) {
+        ConsString::CopyChars(*this, 0, str_length,
+                              reinterpret_cast<uint16_t*>(array));
+      } else if (str_length > 0) {
+        ASSERT(class_id == kTwoByteStringCid);
         memmove(array,
                 TwoByteString::CharAddr(*this, 0),
                 (str_length * kTwoByteChar));
@@ -20599,6 +20895,8 @@ static bool EqualsIgnoringPrivateKey(const String& str1,
     case kExternalTwoByteStringCid :                                           \
       return dart::EqualsIgnoringPrivateKey<type, ExternalTwoByteString>(str1, \
                                                                          str2);\
+    case kConsStringCid :                                                      \
+      return dart::EqualsIgnoringPrivateKey<type, ConsString>(str1, str2);     \
   }                                                                            \
   UNREACHABLE();                                                               \
 
@@ -20626,20 +20924,34 @@ bool String::EqualsIgnoringPrivateKey(const String& str1,
       EQUALS_IGNORING_PRIVATE_KEY(str2_class_id,
                                   ExternalTwoByteString, str1, str2);
       break;
+    case kConsStringCid :
+      EQUALS_IGNORING_PRIVATE_KEY(str2_class_id, ConsString, str1, str2);
+      break;
   }
   UNREACHABLE();
   return false;
 }
 
 
+const uint16_t* String::CodePointIterator::CodeUnits(const String& str,
+                                                     intptr_t start,
+                                                     intptr_t length) {
+  ASSERT(str.IsConsString());
+  if (ConsString::IsFlat(str)) {
+    return NULL;  // CharAt reads the flat string directly.
+  }
+  return ConsString::ToUTF16(Thread::Current()->zone(), str, start, length);
+}
+
+
 bool String::CodePointIterator::Next() {
   ASSERT(index_ >= -1);
   intptr_t length = Utf16::Length(ch_);
   if (index_ < (end_ - length)) {
     index_ += length;
-    ch_ = str_.CharAt(index_);
+    ch_ = CodeUnitAt(index_);
     if (Utf16::IsLeadSurrogate(ch_) && (index_ < (end_ - 1))) {
-      int32_t ch2 = str_.CharAt(index_ + 1);
+      int32_t ch2 = CodeUnitAt(index_ + 1);
       if (Utf16::IsTrailSurrogate(ch2)) {
         ch_ = Utf16::Decode(ch_, ch2);
       }
@@ -21215,6 +21527,227 @@ void ExternalTwoByteString::Finalize(void* isolate_callback_data,
 }
 
 
+uint16_t ConsString::LeafCharAt(RawString* leaf, intptr_t index) {
+  ASSERT((index >= 0) && (index < RawLength(leaf)));
+  switch (leaf->GetClassId()) {
+    case kOneByteStringCid:
+      return reinterpret_cast<RawOneByteString*>(leaf)->ptr()->data()[index];
+    case kTwoByteStringCid:
+      return reinterpret_cast<RawTwoByteString*>(leaf)->ptr()->data()[index];
+    case kExternalOneByteStringCid:
+      return reinterpret_cast<RawExternalOneByteString*>(leaf)->
+          ptr()->external_data_->data()[index];
+    default:
+      ASSERT(leaf->GetClassId() == kExternalTwoByteStringCid);
+      return reinterpret_cast<RawExternalTwoByteString*>(leaf)->
+          ptr()->external_data_->data()[index];
+  }
+}
+
+
+uint16_t ConsString::CharAt(const String& str, intptr_t index) {
+  ASSERT((index >= 0) && (index < str.Length()));
+  NoSafepointScope no_safepoint;
+  RawString* node = str.raw();
+  while (node->GetClassId() == kConsStringCid) {
+    RawConsString* cons = reinterpret_cast<RawConsString*>(node);
+    RawString* first = cons->ptr()->first_;
+    const intptr_t first_length = RawLength(first);
+    if (index < first_length) {
+      node = first;
+    } else {
+      index -= first_length;
+      node = cons->ptr()->second_;
+    }
+  }
+  return LeafCharAt(node, index);
+}
+
+
+template<typename SrcType, typename DstType>
+static void CopyCodeUnits(const SrcType* src, intptr_t len, DstType* dst) {
+  for (intptr_t i = 0; i < len; i++) {
+    ASSERT((sizeof(DstType) >= sizeof(SrcType)) || Utf::IsLatin1(src[i]));
+    dst[i] = static_cast<DstType>(src[i]);
+  }
+}
+
+
+template<typename CharType>
+void ConsString::CopyLeaves(RawString* str,
+                            intptr_t start,
+                            intptr_t len,
+                            CharType* chars) {
+  // The tree is walked with an explicit stack of pending subtrees and their
+  // offsets, as strings built in a loop are deep left or right leaning
+  // chains of cons strings.
+  struct Piece {
+    RawString* str;
+    intptr_t offset;
+  };
+  const intptr_t end = start + len;
+  GrowableArray<Piece> pieces;
+  Piece root = { str, 0 };
+  pieces.Add(root);
+  while (!pieces.is_empty()) {
+    const Piece piece = pieces.RemoveLast();
+    const intptr_t piece_length = RawLength(piece.str);
+    if ((piece.offset >= end) || ((piece.offset + piece_length) <= start)) {
+      continue;  // Outside of the copied range.
+    }
+    if (piece.str->GetClassId() == kConsStringCid) {
+      RawConsString* cons = reinterpret_cast<RawConsString*>(piece.str);
+      RawString* first = cons->ptr()->first_;
+      Piece second_piece = { cons->ptr()->second_,
+                             piece.offset + RawLength(first) };
+      Piece first_piece = { first, piece.offset };
+      pieces.Add(second_piece);
+      pieces.Add(first_piece);
+      continue;
+    }
+    const intptr_t from = Utils::Maximum(start, piece.offset);
+    const intptr_t to = Utils::Minimum(end, piece.offset + piece_length);
+    const intptr_t leaf_index = from - piece.offset;
+    CharType* dst = chars + (from - start);
+    switch (piece.str->GetClassId()) {
+      case kOneByteStringCid:
+        CopyCodeUnits(reinterpret_cast<RawOneByteString*>(piece.str)->
+                          ptr()->data() + leaf_index,
+                      to - from, dst);
+        break;
+      case kTwoByteStringCid:
+        CopyCodeUnits(reinterpret_cast<RawTwoByteString*>(piece.str)->
+                          ptr()->data() + leaf_index,
+                      to - from, dst);
+        break;
+      case kExternalOneByteStringCid:
+        CopyCodeUnits(reinterpret_cast<RawExternalOneByteString*>(piece.str)->
+                          ptr()->external_data_->data() + leaf_index,
+                      to - from, dst);
+        break;
+      default:
+        ASSERT(piece.str->GetClassId() == kExternalTwoByteStringCid);
+        CopyCodeUnits(reinterpret_cast<RawExternalTwoByteString*>(piece.str)->
+                          ptr()->external_data_->data() + leaf_index,
+                      to - from, dst);
+        break;
+    }
+  }
+}
+
+
+void ConsString::CopyChars(const String& str,
+                           intptr_t start,
+                           intptr_t len,
+                           uint8_t* chars) {
+  ASSERT(str.IsConsString());
+  ASSERT((start >= 0) && (len >= 0) && ((start + len) <= str.Length()));
+  NoSafepointScope no_safepoint;
+  CopyLeaves(str.raw(), start, len, chars);
+}
+
+
+void ConsString::CopyChars(const String& str,
+                           intptr_t start,
+                           intptr_t len,
+                           uint16_t* chars) {
+  ASSERT(str.IsConsString());
+  ASSERT((start >= 0) && (len >= 0) && ((start + len) <= str.Length()));
+  NoSafepointScope no_safepoint;
+  CopyLeaves(str.raw(), start, len, chars);
+}
+
+
+const uint16_t* ConsString::ToUTF16(Zone* zone,
+                                    const String& str,
+                                    intptr_t start,
+                                    intptr_t len) {
+  ASSERT((start >= 0) && (len >= 0) && ((start + len) <= str.Length()));
+  uint16_t* chars = zone->Alloc<uint16_t>(len);
+  if (str.IsConsString()) {
+    CopyChars(str, start, len, chars);
+  } else {
+    for (intptr_t i = 0; i < len; i++) {
+      chars[i] = str.CharAt(start + i);
+    }
+  }
+  return chars;
+}
+
+
+RawString* ConsString::Flatten(const String& str) {
+  ASSERT(str.IsConsString());
+  if (IsFlat(str)) {
+    return first(str);
+  }
+  const intptr_t len = str.Length();
+  String& result = String::Handle();
+  if (CharSize(str) == String::kOneByteChar) {
+    result = OneByteString::New(len, Heap::kNew);
+    NoSafepointScope no_safepoint;
+    CopyLeaves(str.raw(), 0, len,
+               reinterpret_cast<RawOneByteString*>(result.raw())->
+                   ptr()->data());
+  } else {
+    result = TwoByteString::New(len, Heap::kNew);
+    NoSafepointScope no_safepoint;
+    CopyLeaves(str.raw(), 0, len,
+               reinterpret_cast<RawTwoByteString*>(result.raw())->
+                   ptr()->data());
+  }
+  if (str.HasHash()) {
+    result.SetHash(str.Hash());
+  }
+  // Keep only the flat string so that the leaves can be collected.
+  str.StorePointer(&raw_ptr(str)->first_, result.raw());
+  str.StorePointer(&raw_ptr(str)->second_, Symbols::Empty().raw());
+  return result.raw();
+}
+
+
+intptr_t ConsString::Hash(const String& str) {
+  ASSERT(str.IsConsString());
+  if (str.HasHash()) {
+    return str.Hash();
+  }
+  const String& flat = String::Handle(Flatten(str));
+  const intptr_t hash = flat.Hash();
+  str.SetHash(hash);
+  return hash;
+}
+
+
+RawConsString* ConsString::New(const String& first,
+                               const String& second,
+                               Heap::Space space) {
+  ASSERT(Isolate::Current()->object_store()->cons_string_class() !=
+         Class::null());
+  ASSERT(!first.IsNull() && (first.Length() > 0));
+  ASSERT(!second.IsNull() && (second.Length() > 0));
+  const intptr_t first_length = first.Length();
+  if ((String::kMaxElements - first_length) < second.Length()) {
+    Exceptions::ThrowOOM();
+    UNREACHABLE();
+  }
+  const intptr_t char_size =
+      Utils::Maximum(first.CharSize(), second.CharSize());
+  String& result = String::Handle();
+  {
+    RawObject* raw = Object::Allocate(ConsString::kClassId,
+                                      ConsString::InstanceSize(),
+                                      space);
+    NoSafepointScope no_safepoint;
+    result ^= raw;
+    result.SetLength(first_length + second.Length());
+    result.SetHash(0);
+    result.StoreSmi(&raw_ptr(result)->char_size_, Smi::New(char_size));
+    result.StorePointer(&raw_ptr(result)->first_, first.raw());
+    result.StorePointer(&raw_ptr(result)->second_, second.raw());
+  }
+  return ConsString::raw(result);
+}
+
+
 RawBool* Bool::New(bool value) {
   ASSERT(Isolate::Current()->object_store()->bool_class() != Class::null());
   Bool& result = Bool::Handle();
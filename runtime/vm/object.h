@@ -2549,6 +2549,37 @@ class Function : public Object {
                     static_cast<uint16_t>(value));
   }
 
+  // Number of times optimized code of this function was deoptimized with the
+  // given reason. Counts are kept in 3-bit saturating counters.
+  static const intptr_t kDeoptReasonCountBits = 3;
+  static const intptr_t kMaxDeoptReasonCount = (1 << kDeoptReasonCountBits) - 1;
+  intptr_t DeoptReasonCount(ICData::DeoptReasonId reason) const;
+  void IncrementDeoptReasonCount(ICData::DeoptReasonId reason) const;
+  // Also clears the optimization backoff.
+  void ClearDeoptReasonCounts() const;
+
+  // Number of times the usage counter has to reach the optimization threshold
+  // again before this function is reoptimized, see
+  // --deoptimization_backoff_threshold. Kept next to the deoptimization
+  // reason counts, so that it does not interfere with the usage counter.
+  static const intptr_t kOptimizationBackoffShift =
+      ICData::kDeoptNumReasons * kDeoptReasonCountBits;
+  static const intptr_t kOptimizationBackoffBits = 16;
+  static const intptr_t kMaxOptimizationBackoff =
+      (1 << kOptimizationBackoffBits) - 1;
+  intptr_t optimization_backoff() const;
+  void set_optimization_backoff(intptr_t value) const;
+
+  // Returns true if deoptimizations with the given reason recur often enough
+  // (see --deoptimization_storm_threshold) that optimized code of this
+  // function should stop making the speculation which causes them.
+  bool HasDeoptStorm(ICData::DeoptReasonId reason) const;
+
+  // Returns true if polymorphic instance calls in optimized code of this
+  // function may deoptimize when no receiver class check matches, instead of
+  // falling back to a megamorphic call.
+  bool AllowsPolymorphicDeopt() const;
+
   bool IsOptimizable() const;
   bool IsNativeAutoSetupScope() const;
   void SetIsOptimizable(bool value) const;
@@ -2797,6 +2828,19 @@ class Function : public Object {
   RawArray* ic_data_array() const;
   void ClearICDataArray() const;
 
+  // With --coverage_probes, the coverage array has one slot per token of the
+  // function: null where no probe was compiled, otherwise a Smi with one of
+  // the CoverageProbeState values. The probes store kCoverageProbeHit in
+  // unoptimized, optimized and inlined code alike.
+  enum CoverageProbeState {
+    kCoverageProbeNotHit = 1,
+    kCoverageProbeHit = 2,
+    // Hit before the last coverage delta report, but not since.
+    kCoverageProbeHitReported = 3,
+  };
+  RawArray* coverage_array() const { return raw_ptr()->coverage_array_; }
+  void set_coverage_array(const Array& value) const;
+
   // Sets deopt reason in all ICData-s with given deopt_id.
   void SetDeoptReasonForAll(intptr_t deopt_id, ICData::DeoptReasonId reason);
 
@@ -5058,6 +5102,18 @@ class MegamorphicCache : public Object {
 };
 
 
+// The cache is an array of entries. Small caches are searched linearly until
+// an entry with a null kInstanceClassIdOrFunction is found. Caches with more
+// than kMaxLinearChecks checks are rehashed into the layout
+//
+//   [entry 0, ..., entry mask, overflow entries..., null entry, Smi mask]
+//
+// where the check for an instance with class id C is stored in the first
+// free entry starting from entry (C & mask); checks of closures use
+// kClosureCid. The trailing mask makes the length of a hashed cache not a
+// multiple of kTestEntryLength, which is how lookups distinguish the two
+// layouts. Both layouts are probed linearly until a null entry is found, so
+// the lookup stubs only need to compute the starting entry.
 class SubtypeTestCache : public Object {
  public:
   enum Entries {
@@ -5068,6 +5124,8 @@ class SubtypeTestCache : public Object {
     kTestEntryLength  = 4,
   };
 
+  static const intptr_t kMaxLinearChecks = 16;
+
   intptr_t NumberOfChecks() const;
   void AddCheck(const Object& instance_class_id_or_function,
                 const TypeArguments& instance_type_arguments,
@@ -5078,6 +5136,12 @@ class SubtypeTestCache : public Object {
                 TypeArguments* instance_type_arguments,
                 TypeArguments* instantiator_type_arguments,
                 Bool* test_result) const;
+  // Returns whether the cache has a check for the given instance class id or
+  // function and type arguments. Probes the hashed layout from the hashed
+  // entry, so it does not scan large caches.
+  bool HasCheck(const Object& instance_class_id_or_function,
+                const TypeArguments& instance_type_arguments,
+                const TypeArguments& instantiator_type_arguments) const;
 
   static RawSubtypeTestCache* New();
 
@@ -5098,6 +5162,14 @@ class SubtypeTestCache : public Object {
 
   intptr_t TestEntryLength() const;
 
+  bool IsHashed() const;
+  void Rehash(intptr_t capacity) const;
+  static void InsertHashed(Array* data,
+                           const Object& instance_class_id_or_function,
+                           const Object& instance_type_arguments,
+                           const Object& instantiator_type_arguments,
+                           const Object& test_result);
+
   FINAL_HEAP_OBJECT_IMPLEMENTATION(SubtypeTestCache, Object);
   friend class Class;
 };
@@ -6465,17 +6537,27 @@ class String : public Instance {
         : str_(str),
           ch_(0),
           index_(-1),
-          end_(str.Length()) {
+          end_(str.Length()),
+          start_(0),
+          chars_(NULL) {
       ASSERT(!str_.IsNull());
+      if (str.IsConsString()) {
+        chars_ = CodeUnits(str, start_, end_);
+      }
     }
 
     CodePointIterator(const String& str, intptr_t start, intptr_t length)
         : str_(str),
           ch_(0),
           index_(start - 1),
-          end_(start + length) {
+          end_(start + length),
+          start_(start),
+          chars_(NULL) {
       ASSERT(start >= 0);
       ASSERT(end_ <= str.Length());
+      if (str.IsConsString()) {
+        chars_ = CodeUnits(str, start_, length);
+      }
     }
 
     int32_t Current() const {
@@ -6487,10 +6569,23 @@ class String : public Instance {
     bool Next();
 
    private:
+    // Returns a zone copy of the characters of a cons string which is not
+    // flattened yet, so that they are not looked up in the tree one by one,
+    // and NULL for a flattened one.
+    static const uint16_t* CodeUnits(const String& str,
+                                     intptr_t start,
+                                     intptr_t length);
+
+    int32_t CodeUnitAt(intptr_t index) const {
+      return (chars_ != NULL) ? chars_[index - start_] : str_.CharAt(index);
+    }
+
     const String& str_;
     int32_t ch_;
     intptr_t index_;
     intptr_t end_;
+    intptr_t start_;
+    const uint16_t* chars_;
     DISALLOW_IMPLICIT_CONSTRUCTORS(CodePointIterator);
   };
 
@@ -6596,6 +6691,10 @@ class String : public Instance {
     return raw()->GetClassId() == kExternalTwoByteStringCid;
   }
 
+  bool IsConsString() const {
+    return raw()->GetClassId() == kConsStringCid;
+  }
+
   bool IsExternal() const {
     return RawObject::IsExternalStringClassId(raw()->GetClassId());
   }
@@ -6769,6 +6868,7 @@ class String : public Instance {
   friend class TwoByteString;
   friend class ExternalOneByteString;
   friend class ExternalTwoByteString;
+  friend class ConsString;
   // So that SkippedCodeFunctions can print a debug string from a NoHandleScope.
   friend class SkippedCodeFunctions;
   friend class RawOneByteString;
@@ -6903,6 +7003,8 @@ class OneByteString : public AllStatic {
   friend class String;
   friend class Symbols;
   friend class ExternalOneByteString;
+  friend class JSONDecoder;
+  friend class JSONEncoder;
   friend class SnapshotReader;
   friend class StringHasher;
 };
@@ -7016,6 +7118,7 @@ class TwoByteString : public AllStatic {
                                     bool as_reference);
 
   friend class Class;
+  friend class JSONEncoder;
   friend class String;
   friend class SnapshotReader;
   friend class Symbols;
@@ -7100,6 +7203,8 @@ class ExternalOneByteString : public AllStatic {
   }
 
   friend class Class;
+  friend class JSONDecoder;
+  friend class JSONEncoder;
   friend class String;
   friend class SnapshotReader;
   friend class Symbols;
@@ -7180,12 +7285,128 @@ class ExternalTwoByteString : public AllStatic {
   }
 
   friend class Class;
+  friend class JSONEncoder;
   friend class String;
   friend class SnapshotReader;
   friend class Symbols;
 };
 
 
+// A lazily concatenated string, see RawConsString. Long strings built by
+// repeated concatenation are represented as a tree of cons strings so that
+// each concatenation takes constant time. The characters are copied into a
+// flat string by Flatten, which natives call before indexing or hashing.
+class ConsString : public AllStatic {
+ public:
+  // Concatenations producing shorter strings are copied eagerly, as the
+  // copy is cheaper than allocating and later flattening a cons string.
+  static const intptr_t kMinLength = 64;
+
+  static intptr_t CharSize(const String& str) {
+    return Smi::Value(raw_ptr(str)->char_size_);
+  }
+
+  static RawString* first(const String& str) {
+    return raw_ptr(str)->first_;
+  }
+
+  static RawString* second(const String& str) {
+    return raw_ptr(str)->second_;
+  }
+
+  // A flattened cons string has a flat first string and an empty second.
+  static bool IsFlat(const String& str) {
+    return Smi::Value(raw_ptr(str)->second_->ptr()->length_) == 0;
+  }
+
+  // Walks down to the leaf holding the character without flattening.
+  static uint16_t CharAt(const String& str, intptr_t index);
+
+  // Returns the characters [start, start + len) of 'str' in a zone
+  // allocated array. Operations iterating over all characters of a cons
+  // string use this instead of walking the tree for every character.
+  // Does not allocate in the Dart heap.
+  static const uint16_t* ToUTF16(Zone* zone,
+                                 const String& str,
+                                 intptr_t start,
+                                 intptr_t len);
+
+  // Copies the characters [start, start + len) of the cons string 'str'
+  // into 'chars'. Does not allocate in the Dart heap.
+  static void CopyChars(const String& str,
+                        intptr_t start,
+                        intptr_t len,
+                        uint8_t* chars);
+  static void CopyChars(const String& str,
+                        intptr_t start,
+                        intptr_t len,
+                        uint16_t* chars);
+
+  // Returns the flat string holding the characters of 'str', copying them
+  // on the first call.
+  static RawString* Flatten(const String& str);
+
+  // Returns a flat string for any string.
+  static RawString* FlattenIfCons(const String& str) {
+    return str.IsConsString() ? Flatten(str) : str.raw();
+  }
+
+  // Flattens 'str' and caches the hash of its characters.
+  static intptr_t Hash(const String& str);
+
+  static intptr_t InstanceSize() {
+    return String::RoundedAllocationSize(sizeof(RawConsString));
+  }
+
+  static RawConsString* New(const String& first,
+                            const String& second,
+                            Heap::Space space = Heap::kNew);
+
+  static RawConsString* null() {
+    return reinterpret_cast<RawConsString*>(Object::null());
+  }
+
+  static const ClassId kClassId = kConsStringCid;
+
+ private:
+  static RawConsString* raw(const String& str) {
+    return reinterpret_cast<RawConsString*>(str.raw());
+  }
+
+  static const RawConsString* raw_ptr(const String& str) {
+    ASSERT(str.IsConsString());
+    return reinterpret_cast<const RawConsString*>(str.raw_ptr());
+  }
+
+  static intptr_t RawLength(RawString* str) {
+    return Smi::Value(str->ptr()->length_);
+  }
+
+  static uint16_t LeafCharAt(RawString* leaf, intptr_t index);
+
+  template<typename CharType>
+  static void CopyLeaves(RawString* str,
+                         intptr_t start,
+                         intptr_t len,
+                         CharType* chars);
+
+  static RawConsString* ReadFrom(SnapshotReader* reader,
+                                 intptr_t object_id,
+                                 intptr_t tags,
+                                 Snapshot::Kind kind,
+                                 bool as_reference);
+
+  static intptr_t NextFieldOffset() {
+    // Indicates this class cannot be extended by dart code.
+    return -kWordSize;
+  }
+
+  friend class Class;
+  friend class String;
+  friend class SnapshotReader;
+};
+
+
 // Class Bool implements Dart core class bool.
 class Bool : public Instance {
  public:
@@ -7993,6 +8214,14 @@ class LinkedHashMap : public Instance {
                                intptr_t deleted_keys,
                                Heap::Space space = Heap::kNew);
 
+  // Returns the length of a data array holding 'used_data' keys and values
+  // of a map whose index is regenerated lazily, i.e., a map created with a
+  // null index and a hash mask of 0.
+  static intptr_t DataCapacity(intptr_t used_data) {
+    return Utils::Maximum(Utils::RoundUpToPowerOfTwo(used_data),
+                          static_cast<uintptr_t>(kInitialIndexSize));
+  }
+
   virtual RawTypeArguments* GetTypeArguments() const {
     return raw_ptr()->type_arguments_;
   }
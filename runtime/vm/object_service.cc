@@ -2,6 +2,7 @@
 // for details. All rights reserved. Use of this source code is governed by a
 // BSD-style license that can be found in the LICENSE file.
 
+#include "vm/code_generator.h"
 #include "vm/debugger.h"
 #include "vm/disassembler.h"
 #include "vm/object.h"
@@ -327,6 +328,17 @@ void Function::PrintJSONImpl(JSONStream* stream, bool ref) const {
   jsobj.AddProperty("_optimizedCallSiteCount", optimized_call_site_count());
   jsobj.AddProperty("_deoptimizations",
                     static_cast<intptr_t>(deoptimization_counter()));
+  {
+    JSONObject reasons(&jsobj, "_deoptReasons");
+    for (intptr_t i = 0; i < ICData::kDeoptNumReasons; i++) {
+      const ICData::DeoptReasonId reason =
+          static_cast<ICData::DeoptReasonId>(i);
+      const intptr_t count = DeoptReasonCount(reason);
+      if (count > 0) {
+        reasons.AddProperty(DeoptReasonToCString(reason), count);
+      }
+    }
+  }
   if ((kind() == RawFunction::kImplicitGetter) ||
       (kind() == RawFunction::kImplicitSetter) ||
       (kind() == RawFunction::kImplicitStaticFinalGetter)) {
@@ -43,6 +43,7 @@ ObjectStore::ObjectStore()
     two_byte_string_class_(Class::null()),
     external_one_byte_string_class_(Class::null()),
     external_two_byte_string_class_(Class::null()),
+    cons_string_class_(Class::null()),
     bool_type_(Type::null()),
     bool_class_(Class::null()),
     array_class_(Class::null()),
@@ -160,6 +160,11 @@ class ObjectStore {
     external_two_byte_string_class_ = value.raw();
   }
 
+  RawClass* cons_string_class() const { return cons_string_class_; }
+  void set_cons_string_class(const Class& value) {
+    cons_string_class_ = value.raw();
+  }
+
   RawType* bool_type() const { return bool_type_; }
   void set_bool_type(const Type& value) { bool_type_ = value.raw(); }
 
@@ -532,6 +537,7 @@ class ObjectStore {
   V(RawClass*, two_byte_string_class_)                                         \
   V(RawClass*, external_one_byte_string_class_)                                \
   V(RawClass*, external_two_byte_string_class_)                                \
+  V(RawClass*, cons_string_class_)                                             \
   V(RawType*, bool_type_)                                                      \
   V(RawClass*, bool_class_)                                                    \
   V(RawClass*, array_class_)                                                   \
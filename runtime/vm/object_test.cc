@@ -1380,6 +1380,57 @@ VM_TEST_CASE(StringHashConcat) {
 }
 
 
+VM_TEST_CASE(ConsString) {
+  const intptr_t kLength = ConsString::kMinLength;
+  uint8_t ascii[kLength];
+  for (intptr_t i = 0; i < kLength; i++) {
+    ascii[i] = 'a' + (i % 26);
+  }
+  const String& one = String::Handle(OneByteString::New(ascii, kLength,
+                                                        Heap::kNew));
+  uint16_t wide[] = { 0x05D0, 0x05D1, 'x', 0x05D2 };
+  const intptr_t wide_length = sizeof(wide) / sizeof(wide[0]);
+  const String& two = String::Handle(TwoByteString::New(wide, wide_length,
+                                                        Heap::kNew));
+  // ((one + two) + one), concatenated both lazily and eagerly.
+  String& left = String::Handle(ConsString::New(one, two));
+  String& cons = String::Handle(ConsString::New(left, one));
+  left = String::Concat(one, two);
+  const String& flat = String::Handle(String::Concat(left, one));
+  EXPECT(cons.IsConsString());
+  EXPECT_EQ(2 * kLength + wide_length, cons.Length());
+  EXPECT_EQ(String::kTwoByteChar, cons.CharSize());
+  for (intptr_t i = 0; i < flat.Length(); i++) {
+    EXPECT_EQ(flat.CharAt(i), cons.CharAt(i));
+  }
+  uint16_t chars[8];
+  ConsString::CopyChars(cons, kLength - 2, 8, chars);
+  for (intptr_t i = 0; i < 8; i++) {
+    EXPECT_EQ(flat.CharAt(kLength - 2 + i), chars[i]);
+  }
+  EXPECT(cons.Equals(flat));
+  EXPECT(flat.Equals(cons));
+  EXPECT(!ConsString::IsFlat(cons));
+
+  // Hashing flattens the string and keeps the hash.
+  EXPECT_EQ(flat.Hash(), ConsString::Hash(cons));
+  EXPECT(ConsString::IsFlat(cons));
+  EXPECT_EQ(flat.Hash(), cons.Hash());
+  const String& first = String::Handle(ConsString::first(cons));
+  EXPECT(first.IsTwoByteString());
+  EXPECT(first.Equals(flat));
+  EXPECT(String::Handle(ConsString::FlattenIfCons(cons)).Equals(flat));
+
+  // One-byte leaves produce a one-byte flat string.
+  const String& ones = String::Handle(ConsString::New(one, one));
+  EXPECT_EQ(String::kOneByteChar, ones.CharSize());
+  EXPECT(String::Handle(ConsString::Flatten(ones)).IsOneByteString());
+  const String& symbol = String::Handle(Symbols::New(thread, cons));
+  EXPECT(symbol.IsSymbol());
+  EXPECT(symbol.Equals(flat));
+}
+
+
 VM_TEST_CASE(StringSubStringDifferentWidth) {
   // Create 1-byte substring from a 1-byte source string.
   const char* onechars =
@@ -2704,6 +2755,48 @@ static RawFunction* CreateFunction(const char* name) {
 }
 
 
+VM_TEST_CASE(FunctionDeoptReasonCounts) {
+  const Function& function =
+      Function::Handle(CreateFunction("Test_DeoptReasonCounts"));
+  for (intptr_t i = 0; i < ICData::kDeoptNumReasons; i++) {
+    EXPECT_EQ(0, function.DeoptReasonCount(
+        static_cast<ICData::DeoptReasonId>(i)));
+  }
+  for (intptr_t i = 0; i < 3; i++) {
+    function.IncrementDeoptReasonCount(ICData::kDeoptCheckClass);
+  }
+  EXPECT_EQ(3, function.DeoptReasonCount(ICData::kDeoptCheckClass));
+  EXPECT_EQ(0, function.DeoptReasonCount(ICData::kDeoptCheckSmi));
+  EXPECT_EQ(0, function.DeoptReasonCount(ICData::kDeoptCheckArrayBound));
+
+  // Counters saturate without overflowing into their neighbours.
+  for (intptr_t i = 0; i < 2 * Function::kMaxDeoptReasonCount; i++) {
+    function.IncrementDeoptReasonCount(ICData::kDeoptTestCids);
+  }
+  EXPECT_EQ(Function::kMaxDeoptReasonCount,
+            function.DeoptReasonCount(ICData::kDeoptTestCids));
+  EXPECT_EQ(0, function.DeoptReasonCount(ICData::kDeoptGuardField));
+  EXPECT(function.HasDeoptStorm(ICData::kDeoptTestCids));
+  EXPECT(!function.HasDeoptStorm(ICData::kDeoptGuardField));
+
+  // The optimization backoff shares the word with the counters.
+  function.set_optimization_backoff(Function::kMaxOptimizationBackoff);
+  EXPECT_EQ(Function::kMaxOptimizationBackoff,
+            function.optimization_backoff());
+  EXPECT_EQ(Function::kMaxDeoptReasonCount,
+            function.DeoptReasonCount(ICData::kDeoptTestCids));
+  function.set_optimization_backoff(2);
+  EXPECT_EQ(2, function.optimization_backoff());
+  EXPECT_EQ(3, function.DeoptReasonCount(ICData::kDeoptCheckClass));
+  EXPECT_EQ(0, function.usage_counter());
+
+  function.ClearDeoptReasonCounts();
+  EXPECT_EQ(0, function.DeoptReasonCount(ICData::kDeoptCheckClass));
+  EXPECT_EQ(0, function.DeoptReasonCount(ICData::kDeoptTestCids));
+  EXPECT_EQ(0, function.optimization_backoff());
+}
+
+
 // Test for Code and Instruction object creation.
 VM_TEST_CASE(Code) {
   extern void GenerateIncrement(Assembler* assembler);
@@ -3125,6 +3218,47 @@ VM_TEST_CASE(SubtypeTestCache) {
   EXPECT_EQ(targ_0.raw(), test_targ_0.raw());
   EXPECT_EQ(targ_1.raw(), test_targ_1.raw());
   EXPECT_EQ(Bool::True().raw(), test_result.raw());
+  EXPECT(cache.HasCheck(class_id_or_fun, targ_0, targ_1));
+  EXPECT(!cache.HasCheck(class_id_or_fun, targ_1, targ_0));
+}
+
+
+VM_TEST_CASE(SubtypeTestCacheManyChecks) {
+  SubtypeTestCache& cache = SubtypeTestCache::Handle(SubtypeTestCache::New());
+  const TypeArguments& targ = TypeArguments::Handle(TypeArguments::New(2));
+  const intptr_t kNumChecks = 4 * SubtypeTestCache::kMaxLinearChecks;
+  Object& class_id_or_fun = Object::Handle();
+  for (intptr_t i = 0; i < kNumChecks; i++) {
+    // Use colliding class ids to exercise probing.
+    class_id_or_fun = Smi::New(kNumPredefinedCids + (i % 3) * 64 + i);
+    cache.AddCheck(class_id_or_fun, targ, TypeArguments::Handle(),
+                   (i % 2) == 0 ? Bool::True() : Bool::False());
+    EXPECT_EQ(i + 1, cache.NumberOfChecks());
+  }
+  Object& test_class_id_or_fun = Object::Handle();
+  TypeArguments& test_targ_0 = TypeArguments::Handle();
+  TypeArguments& test_targ_1 = TypeArguments::Handle();
+  Bool& test_result = Bool::Handle();
+  for (intptr_t i = 0; i < kNumChecks; i++) {
+    bool found = false;
+    class_id_or_fun = Smi::New(kNumPredefinedCids + (i % 3) * 64 + i);
+    for (intptr_t j = 0; j < cache.NumberOfChecks(); j++) {
+      cache.GetCheck(
+          j, &test_class_id_or_fun, &test_targ_0, &test_targ_1, &test_result);
+      if (test_class_id_or_fun.raw() == class_id_or_fun.raw()) {
+        EXPECT(!found);
+        found = true;
+        EXPECT_EQ(targ.raw(), test_targ_0.raw());
+        EXPECT(test_targ_1.IsNull());
+        EXPECT_EQ((i % 2) == 0, test_result.value());
+      }
+    }
+    EXPECT(found);
+    EXPECT(cache.HasCheck(class_id_or_fun, targ, TypeArguments::Handle()));
+    EXPECT(!cache.HasCheck(class_id_or_fun, TypeArguments::Handle(), targ));
+  }
+  class_id_or_fun = Smi::New(kNumPredefinedCids + 3 * kNumChecks);
+  EXPECT(!cache.HasCheck(class_id_or_fun, targ, TypeArguments::Handle()));
 }
 
 
@@ -7,6 +7,7 @@
 #include "vm/atomic.h"
 #include "vm/lockers.h"
 #include "vm/log.h"
+#include "vm/profiler.h"
 #include "vm/thread_interrupter.h"
 #include "vm/timeline.h"
 
@@ -30,6 +31,7 @@ OSThread::OSThread() :
     name_(NULL),
     timeline_block_lock_(new Mutex()),
     timeline_block_(NULL),
+    sample_block_(NULL),
     thread_list_next_(NULL),
     thread_interrupt_disabled_(1),  // Thread interrupts disabled by default.
     log_(new class Log()),
@@ -60,6 +62,12 @@ OSThread::~OSThread() {
     }
   }
   timeline_block_ = NULL;
+#ifndef PRODUCT
+  if (sample_block_ != NULL) {
+    SampleBuffer::ReleaseBlock(sample_block_);
+  }
+#endif  // !PRODUCT
+  sample_block_ = NULL;
   delete timeline_block_lock_;
   free(name_);
 }
@@ -27,6 +27,7 @@ namespace dart {
 // Forward declarations.
 class Log;
 class Mutex;
+class SampleBlock;
 class Thread;
 class TimelineEventBlock;
 
@@ -93,6 +94,10 @@ class OSThread : public BaseThread {
     timeline_block_ = block;
   }
 
+  // Block of the profiler's sample buffer this thread's samples are written
+  // to. Only accessed while sampling this thread, see SampleBuffer.
+  SampleBlock** sample_block_address() { return &sample_block_; }
+
   Log* log() const { return log_; }
 
   uword stack_base() const { return stack_base_; }
@@ -222,6 +227,7 @@ class OSThread : public BaseThread {
 
   Mutex* timeline_block_lock_;
   TimelineEventBlock* timeline_block_;
+  SampleBlock* sample_block_;
 
   // All |Thread|s are registered in the thread list.
   OSThread* thread_list_next_;
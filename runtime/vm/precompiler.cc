@@ -29,6 +29,7 @@
 #include "vm/isolate.h"
 #include "vm/log.h"
 #include "vm/longjump.h"
+#include "vm/loop_vectorizer.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/os.h"
@@ -61,6 +62,7 @@ DECLARE_FLAG(bool, allocation_sinking);
 DECLARE_FLAG(bool, common_subexpression_elimination);
 DECLARE_FLAG(bool, constant_propagation);
 DECLARE_FLAG(bool, loop_invariant_code_motion);
+DECLARE_FLAG(bool, loop_vectorization);
 DECLARE_FLAG(bool, print_flow_graph);
 DECLARE_FLAG(bool, print_flow_graph_optimized);
 DECLARE_FLAG(bool, range_analysis);
@@ -2554,6 +2556,17 @@ bool PrecompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
           DEBUG_ASSERT(flow_graph->VerifyUseLists());
         }
 
+        if (FLAG_loop_vectorization) {
+#ifndef PRODUCT
+          TimelineDurationScope tds2(thread(),
+                                     compiler_timeline,
+                                     "LoopVectorizer");
+#endif  // !PRODUCT
+          LoopVectorizer vectorizer(flow_graph);
+          vectorizer.Optimize();
+          DEBUG_ASSERT(flow_graph->VerifyUseLists());
+        }
+
         // Recompute types after code movement was done to ensure correct
         // reaching types for hoisted values.
         FlowGraphTypePropagator::Propagate(flow_graph);
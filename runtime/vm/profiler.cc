@@ -122,8 +122,10 @@ uword* Sample::GetPCArray() const {
 }
 
 
-SampleBuffer::SampleBuffer(intptr_t capacity) {
+SampleBuffer::SampleBuffer(intptr_t capacity, intptr_t samples_per_block) {
   ASSERT(Sample::instance_size() > 0);
+  ASSERT(capacity > 0);
+  ASSERT(samples_per_block > 0);
   samples_ = reinterpret_cast<Sample*>(
       calloc(capacity, Sample::instance_size()));
   if (FLAG_trace_profiler) {
@@ -133,7 +135,19 @@ SampleBuffer::SampleBuffer(intptr_t capacity) {
               capacity * Sample::instance_size());
   }
   capacity_ = capacity;
-  cursor_ = 0;
+  if (samples_per_block > capacity) {
+    samples_per_block = capacity;
+  }
+  num_blocks_ = capacity / samples_per_block;
+  blocks_ = new SampleBlock[num_blocks_];
+  for (intptr_t i = 0; i < num_blocks_; i++) {
+    blocks_[i].start_ = i * samples_per_block;
+    blocks_[i].capacity_ = samples_per_block;
+  }
+  // The last block also holds the remaining samples.
+  blocks_[num_blocks_ - 1].capacity_ +=
+      capacity - (num_blocks_ * samples_per_block);
+  next_block_ = 0;
 }
 
 
@@ -146,22 +160,66 @@ Sample* SampleBuffer::At(intptr_t idx) const {
 }
 
 
-intptr_t SampleBuffer::ReserveSampleSlot() {
+SampleBlock* SampleBuffer::AcquireBlock() {
+  for (intptr_t i = 0; i < num_blocks_; i++) {
+    // Start with the least recently acquired block, which holds the oldest
+    // samples.
+    const uintptr_t index =
+        AtomicOperations::FetchAndIncrement(&next_block_) % num_blocks_;
+    SampleBlock* block = &blocks_[index];
+    if (AtomicOperations::CompareAndSwapWord(&block->in_use_, 0, 1) == 0) {
+      block->cursor_ = 0;
+      return block;
+    }
+  }
+  // Every block is owned by another writer.
+  return NULL;
+}
+
+
+void SampleBuffer::ReleaseBlock(SampleBlock* block) {
+  ASSERT(block != NULL);
+  // Use an atomic operation rather than a plain store, so that the samples
+  // written into the block are visible to the next writer that acquires it.
+  const uword old_value =
+      AtomicOperations::CompareAndSwapWord(&block->in_use_, 1, 0);
+  ASSERT(old_value == 1);
+  USE(old_value);
+}
+
+
+intptr_t SampleBuffer::ReserveSampleSlot(SampleBlock** block) {
   ASSERT(samples_ != NULL);
-  uintptr_t cursor = AtomicOperations::FetchAndIncrement(&cursor_);
-  // Map back into sample buffer range.
-  cursor = cursor % capacity_;
-  return cursor;
+  ASSERT(block != NULL);
+  SampleBlock* current = *block;
+  if ((current == NULL) || current->is_full()) {
+    if (current != NULL) {
+      ReleaseBlock(current);
+    }
+    current = AcquireBlock();
+    *block = current;
+    if (current == NULL) {
+      return -1;
+    }
+  }
+  ASSERT(current->in_use_ == 1);
+  return current->start_ + current->cursor_++;
 }
 
-Sample* SampleBuffer::ReserveSample() {
-  return At(ReserveSampleSlot());
+
+Sample* SampleBuffer::ReserveSample(SampleBlock** block) {
+  const intptr_t index = ReserveSampleSlot(block);
+  return (index < 0) ? NULL : At(index);
 }
 
 
-Sample* SampleBuffer::ReserveSampleAndLink(Sample* previous) {
+Sample* SampleBuffer::ReserveSampleAndLink(SampleBlock** block,
+                                           Sample* previous) {
   ASSERT(previous != NULL);
-  intptr_t next_index = ReserveSampleSlot();
+  intptr_t next_index = ReserveSampleSlot(block);
+  if (next_index < 0) {
+    return NULL;
+  }
   Sample* next = At(next_index);
   next->Init(previous->isolate(), previous->timestamp(), previous->tid());
   next->set_head_sample(false);
@@ -359,17 +417,21 @@ class ProfilerStackWalker : public ValueObject {
  public:
   ProfilerStackWalker(Isolate* isolate,
                       Sample* head_sample,
-                      SampleBuffer* sample_buffer)
+                      SampleBuffer* sample_buffer,
+                      SampleBlock** sample_block)
     : isolate_(isolate),
       sample_(head_sample),
       sample_buffer_(sample_buffer),
+      sample_block_(sample_block),
       frame_index_(0),
       total_frames_(0) {
     ASSERT(isolate_ != NULL);
     if (sample_ == NULL) {
       ASSERT(sample_buffer_ == NULL);
+      ASSERT(sample_block_ == NULL);
     } else {
       ASSERT(sample_buffer_ != NULL);
+      ASSERT(sample_block_ != NULL);
       ASSERT(sample_->head_sample());
     }
   }
@@ -397,7 +459,8 @@ class ProfilerStackWalker : public ValueObject {
     }
     ASSERT(sample_ != NULL);
     if (frame_index_ == kSampleSize) {
-      Sample* new_sample = sample_buffer_->ReserveSampleAndLink(sample_);
+      Sample* new_sample =
+          sample_buffer_->ReserveSampleAndLink(sample_block_, sample_);
       if (new_sample == NULL) {
         // Could not reserve new sample- mark this as truncated.
         sample_->set_truncated_trace(true);
@@ -417,6 +480,7 @@ class ProfilerStackWalker : public ValueObject {
   Isolate* isolate_;
   Sample* sample_;
   SampleBuffer* sample_buffer_;
+  SampleBlock** sample_block_;
   intptr_t frame_index_;
   intptr_t total_frames_;
 };
@@ -428,8 +492,9 @@ class ProfilerDartExitStackWalker : public ProfilerStackWalker {
   ProfilerDartExitStackWalker(Thread* thread,
                               Isolate* isolate,
                               Sample* sample,
-                              SampleBuffer* sample_buffer)
-      : ProfilerStackWalker(isolate, sample, sample_buffer),
+                              SampleBuffer* sample_buffer,
+                              SampleBlock** sample_block)
+      : ProfilerStackWalker(isolate, sample, sample_buffer, sample_block),
         frame_iterator_(thread) {
   }
 
@@ -469,12 +534,13 @@ class ProfilerDartStackWalker : public ProfilerStackWalker {
   ProfilerDartStackWalker(Isolate* isolate,
                           Sample* sample,
                           SampleBuffer* sample_buffer,
+                          SampleBlock** sample_block,
                           uword stack_lower,
                           uword stack_upper,
                           uword pc,
                           uword fp,
                           uword sp)
-      : ProfilerStackWalker(isolate, sample, sample_buffer),
+      : ProfilerStackWalker(isolate, sample, sample_buffer, sample_block),
         stack_upper_(stack_upper),
         stack_lower_(stack_lower) {
     pc_ = reinterpret_cast<uword*>(pc);
@@ -624,12 +690,13 @@ class ProfilerNativeStackWalker : public ProfilerStackWalker {
   ProfilerNativeStackWalker(Isolate* isolate,
                             Sample* sample,
                             SampleBuffer* sample_buffer,
+                            SampleBlock** sample_block,
                             uword stack_lower,
                             uword stack_upper,
                             uword pc,
                             uword fp,
                             uword sp)
-      : ProfilerStackWalker(isolate, sample, sample_buffer),
+      : ProfilerStackWalker(isolate, sample, sample_buffer, sample_block),
         stack_upper_(stack_upper),
         original_pc_(pc),
         original_fp_(fp),
@@ -894,12 +961,17 @@ static bool InitialRegisterCheck(uintptr_t pc, uintptr_t fp, uintptr_t sp) {
 
 static Sample* SetupSample(Thread* thread,
                            SampleBuffer* sample_buffer,
-                           ThreadId tid) {
+                           OSThread* os_thread) {
   ASSERT(thread != NULL);
   Isolate* isolate = thread->isolate();
   ASSERT(sample_buffer != NULL);
-  Sample* sample = sample_buffer->ReserveSample();
-  sample->Init(isolate, OS::GetCurrentMonotonicMicros(), tid);
+  Sample* sample =
+      sample_buffer->ReserveSample(os_thread->sample_block_address());
+  if (sample == NULL) {
+    // All blocks are in use by other threads.
+    return NULL;
+  }
+  sample->Init(isolate, OS::GetCurrentMonotonicMicros(), os_thread->trace_id());
   uword vm_tag = thread->vm_tag();
 #if defined(USING_SIMULATOR) && !defined(TARGET_ARCH_DBC)
   // When running in the simulator, the runtime entry function address
@@ -982,6 +1054,7 @@ void Profiler::DumpStackTrace(bool native_stack_trace) {
 
   if (native_stack_trace) {
     ProfilerNativeStackWalker native_stack_walker(isolate,
+                                                  NULL,
                                                   NULL,
                                                   NULL,
                                                   stack_lower,
@@ -994,10 +1067,12 @@ void Profiler::DumpStackTrace(bool native_stack_trace) {
     ProfilerDartExitStackWalker dart_exit_stack_walker(thread,
                                                        isolate,
                                                        NULL,
+                                                       NULL,
                                                        NULL);
     dart_exit_stack_walker.walk();
   } else {
     ProfilerDartStackWalker dart_stack_walker(isolate,
+                                              NULL,
                                               NULL,
                                               NULL,
                                               stack_lower,
@@ -1027,6 +1102,10 @@ void Profiler::SampleAllocation(Thread* thread, intptr_t cid) {
     return;
   }
 
+  // The thread's sample block must not be written by an interrupt while we
+  // write the allocation sample.
+  DisableThreadInterruptsScope dtis(thread);
+
   if (FLAG_profile_vm) {
     uintptr_t sp = Thread::GetCurrentStackPointer();
     uintptr_t fp = 0;
@@ -1050,29 +1129,42 @@ void Profiler::SampleAllocation(Thread* thread, intptr_t cid) {
       return;
     }
 
-    Sample* sample = SetupSample(thread, sample_buffer, os_thread->trace_id());
+    Sample* sample = SetupSample(thread, sample_buffer, os_thread);
+    if (sample == NULL) {
+      return;
+    }
     sample->SetAllocationCid(cid);
-    ProfilerNativeStackWalker native_stack_walker(isolate,
-                                                  sample,
-                                                  sample_buffer,
-                                                  stack_lower,
-                                                  stack_upper,
-                                                  pc,
-                                                  fp,
-                                                  sp);
+    ProfilerNativeStackWalker native_stack_walker(
+        isolate,
+        sample,
+        sample_buffer,
+        os_thread->sample_block_address(),
+        stack_lower,
+        stack_upper,
+        pc,
+        fp,
+        sp);
     native_stack_walker.walk();
   } else if (exited_dart_code) {
-    Sample* sample = SetupSample(thread, sample_buffer, os_thread->trace_id());
+    Sample* sample = SetupSample(thread, sample_buffer, os_thread);
+    if (sample == NULL) {
+      return;
+    }
     sample->SetAllocationCid(cid);
-    ProfilerDartExitStackWalker dart_exit_stack_walker(thread,
-                                                       isolate,
-                                                       sample,
-                                                       sample_buffer);
+    ProfilerDartExitStackWalker dart_exit_stack_walker(
+        thread,
+        isolate,
+        sample,
+        sample_buffer,
+        os_thread->sample_block_address());
     dart_exit_stack_walker.walk();
   } else {
     // Fall back.
     uintptr_t pc = GetProgramCounter();
-    Sample* sample = SetupSample(thread, sample_buffer, os_thread->trace_id());
+    Sample* sample = SetupSample(thread, sample_buffer, os_thread);
+    if (sample == NULL) {
+      return;
+    }
     sample->SetAllocationCid(cid);
     sample->SetAt(0, pc);
   }
@@ -1092,7 +1184,10 @@ void Profiler::SampleThreadSingleFrame(Thread* thread, uintptr_t pc) {
   }
 
   // Setup sample.
-  Sample* sample = SetupSample(thread, sample_buffer, os_thread->trace_id());
+  Sample* sample = SetupSample(thread, sample_buffer, os_thread);
+  if (sample == NULL) {
+    return;
+  }
   // Increment counter for vm tag.
   VMTagCounters* counters = isolate->vm_tag_counters();
   ASSERT(counters != NULL);
@@ -1122,6 +1217,12 @@ void Profiler::SampleThread(Thread* thread,
     return;
   }
 
+  if (!os_thread->ThreadInterruptsEnabled()) {
+    // Interrupts were disabled after the thread interrupter checked them,
+    // e.g. by SampleAllocation, which writes to the thread's sample block.
+    return;
+  }
+
   if (StubCode::HasBeenInitialized() &&
       StubCode::InJumpToExceptionHandlerStub(state.pc)) {
     // The JumpToExceptionHandler stub manually adjusts the stack pointer,
@@ -1191,7 +1292,10 @@ void Profiler::SampleThread(Thread* thread,
   }
 
   // Setup sample.
-  Sample* sample = SetupSample(thread, sample_buffer, os_thread->trace_id());
+  Sample* sample = SetupSample(thread, sample_buffer, os_thread);
+  if (sample == NULL) {
+    return;
+  }
   // Increment counter for vm tag.
   VMTagCounters* counters = isolate->vm_tag_counters();
   ASSERT(counters != NULL);
@@ -1199,9 +1303,12 @@ void Profiler::SampleThread(Thread* thread,
     counters->Increment(sample->vm_tag());
   }
 
+  SampleBlock** sample_block = os_thread->sample_block_address();
+
   ProfilerNativeStackWalker native_stack_walker(isolate,
                                                 sample,
                                                 sample_buffer,
+                                                sample_block,
                                                 stack_lower,
                                                 stack_upper,
                                                 pc,
@@ -1211,11 +1318,13 @@ void Profiler::SampleThread(Thread* thread,
   ProfilerDartExitStackWalker dart_exit_stack_walker(thread,
                                                      isolate,
                                                      sample,
-                                                     sample_buffer);
+                                                     sample_buffer,
+                                                     sample_block);
 
   ProfilerDartStackWalker dart_stack_walker(isolate,
                                             sample,
                                             sample_buffer,
+                                            sample_block,
                                             stack_lower,
                                             stack_upper,
                                             pc,
@@ -1413,6 +1522,7 @@ ProcessedSampleBuffer* SampleBuffer::BuildProcessedSampleBuffer(
     }
     buffer->Add(BuildProcessedSample(sample, buffer->code_lookup_table()));
   }
+  buffer->SortByTimestamp();
   return buffer;
 }
 
@@ -472,28 +472,69 @@ class CodeLookupTable : public ZoneAllocated {
 };
 
 
+// A range of samples in a SampleBuffer that is written by a single thread.
+// The samples of a block are reused in ring order when the block is full and
+// no other block is free.
+class SampleBlock {
+ public:
+  intptr_t start() const { return start_; }
+  intptr_t capacity() const { return capacity_; }
+  bool is_full() const { return cursor_ == capacity_; }
+
+ private:
+  SampleBlock() : start_(0), capacity_(0), cursor_(0), in_use_(0) { }
+
+  intptr_t start_;
+  intptr_t capacity_;
+  intptr_t cursor_;
+  uword in_use_;
+
+  friend class SampleBuffer;
+
+  DISALLOW_COPY_AND_ASSIGN(SampleBlock);
+};
+
+
 // Ring buffer of Samples that is (usually) shared by many isolates.
+//
+// The buffer is divided into SampleBlocks. Every writer, usually the thread
+// interrupter sampling a given thread, owns one block at a time and reserves
+// samples in it without synchronization. Writers only use atomic operations
+// when they acquire a new block, and multi-part samples linked by
+// ReserveSampleAndLink stay in the writer's blocks. Readers scan all samples
+// and merge the blocks when processing the buffer.
 class SampleBuffer {
  public:
   static const intptr_t kDefaultBufferCapacity = 120000;  // 2 minutes @ 1000hz.
+  static const intptr_t kDefaultSamplesPerBlock = 256;
 
-  explicit SampleBuffer(intptr_t capacity = kDefaultBufferCapacity);
+  explicit SampleBuffer(intptr_t capacity = kDefaultBufferCapacity,
+                        intptr_t samples_per_block = kDefaultSamplesPerBlock);
 
   ~SampleBuffer() {
     if (samples_ != NULL) {
       free(samples_);
       samples_ = NULL;
-      cursor_ = 0;
       capacity_ = 0;
     }
+    delete[] blocks_;
+    blocks_ = NULL;
+    num_blocks_ = 0;
   }
 
   intptr_t capacity() const { return capacity_; }
+  intptr_t num_blocks() const { return num_blocks_; }
 
   Sample* At(intptr_t idx) const;
-  intptr_t ReserveSampleSlot();
-  Sample* ReserveSample();
-  Sample* ReserveSampleAndLink(Sample* previous);
+
+  // Reserves the next sample of |*block|, which must only be written by the
+  // caller. A new block is acquired, and stored in |*block|, when |*block| is
+  // NULL or full. Returns NULL if all blocks are owned by other writers.
+  Sample* ReserveSample(SampleBlock** block);
+  Sample* ReserveSampleAndLink(SampleBlock** block, Sample* previous);
+
+  // Allows other writers to acquire |block|.
+  static void ReleaseBlock(SampleBlock* block);
 
   void VisitSamples(SampleVisitor* visitor) {
     ASSERT(visitor != NULL);
@@ -532,9 +573,14 @@ class SampleBuffer {
                                         const CodeLookupTable& clt);
   Sample* Next(Sample* sample);
 
+  intptr_t ReserveSampleSlot(SampleBlock** block);
+  SampleBlock* AcquireBlock();
+
   Sample* samples_;
   intptr_t capacity_;
-  uintptr_t cursor_;
+  SampleBlock* blocks_;
+  intptr_t num_blocks_;
+  uintptr_t next_block_;
 
   DISALLOW_COPY_AND_ASSIGN(SampleBuffer);
 };
@@ -652,7 +698,26 @@ class ProcessedSampleBuffer : public ZoneAllocated {
     return *code_lookup_table_;
   }
 
+  // Merges the samples of the different sample blocks into a single
+  // timeline.
+  void SortByTimestamp() {
+    samples_.Sort(CompareTimestamps);
+  }
+
  private:
+  static int CompareTimestamps(ProcessedSample* const* a,
+                               ProcessedSample* const* b) {
+    const int64_t a_timestamp = (*a)->timestamp();
+    const int64_t b_timestamp = (*b)->timestamp();
+    if (a_timestamp < b_timestamp) {
+      return -1;
+    } else if (a_timestamp > b_timestamp) {
+      return 1;
+    } else {
+      return 0;
+    }
+  }
+
   ZoneGrowableArray<ProcessedSample*> samples_;
   CodeLookupTable* code_lookup_table_;
 
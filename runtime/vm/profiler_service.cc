@@ -4,6 +4,7 @@
 
 #include "vm/profiler_service.h"
 
+#include "vm/datastream.h"
 #include "vm/growable_array.h"
 #include "vm/hash_map.h"
 #include "vm/log.h"
@@ -2202,30 +2203,7 @@ class ProfileBuilder : public ValueObject {
   }
 
   ProfileCode* GetProfileCode(uword pc, int64_t timestamp) {
-    ProfileCodeTable* live_table = profile_->live_code_;
-    ProfileCodeTable* dead_table = profile_->dead_code_;
-
-    intptr_t index = live_table->FindCodeIndexForPC(pc);
-    ProfileCode* code = NULL;
-    if (index < 0) {
-      index = dead_table->FindCodeIndexForPC(pc);
-      ASSERT(index >= 0);
-      code = dead_table->At(index);
-    } else {
-      code = live_table->At(index);
-      ASSERT(code != NULL);
-      if (code->compile_timestamp() > timestamp) {
-        // Code is newer than sample. Fall back to dead code table.
-        index = dead_table->FindCodeIndexForPC(pc);
-        ASSERT(index >= 0);
-        code = dead_table->At(index);
-      }
-    }
-
-    ASSERT(code != NULL);
-    ASSERT(code->Contains(pc));
-    ASSERT(code->compile_timestamp() <= timestamp);
-    return code;
+    return profile_->GetCodeForPC(pc, timestamp);
   }
 
   void RegisterProfileCodeTag(uword tag) {
@@ -2434,6 +2412,31 @@ ProfileCode* Profile::GetCode(intptr_t index) {
 }
 
 
+ProfileCode* Profile::GetCodeForPC(uword pc, int64_t timestamp) const {
+  intptr_t index = live_code_->FindCodeIndexForPC(pc);
+  ProfileCode* code = NULL;
+  if (index < 0) {
+    index = dead_code_->FindCodeIndexForPC(pc);
+    ASSERT(index >= 0);
+    code = dead_code_->At(index);
+  } else {
+    code = live_code_->At(index);
+    ASSERT(code != NULL);
+    if (code->compile_timestamp() > timestamp) {
+      // Code is newer than sample. Fall back to dead code table.
+      index = dead_code_->FindCodeIndexForPC(pc);
+      ASSERT(index >= 0);
+      code = dead_code_->At(index);
+    }
+  }
+
+  ASSERT(code != NULL);
+  ASSERT(code->Contains(pc));
+  ASSERT(code->compile_timestamp() <= timestamp);
+  return code;
+}
+
+
 ProfileTrieNode* Profile::GetTrieRoot(TrieKind trie_kind) {
   return roots_[static_cast<intptr_t>(trie_kind)];
 }
@@ -2584,6 +2587,540 @@ void Profile::PrintProfileJSON(JSONStream* stream) {
 }
 
 
+// Encodes protocol buffer fields into a growable buffer.
+class ProtobufEncoder : public ValueObject {
+ public:
+  ProtobufEncoder() : buffer_(NULL), length_(0), capacity_(0) { }
+  ~ProtobufEncoder() {
+    free(buffer_);
+  }
+
+  const uint8_t* buffer() const { return buffer_; }
+  intptr_t length() const { return length_; }
+
+  void Clear() {
+    length_ = 0;
+  }
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      WriteByte(static_cast<uint8_t>(value) | 0x80);
+      value >>= 7;
+    }
+    WriteByte(static_cast<uint8_t>(value));
+  }
+
+  void WriteVarintField(intptr_t field, uint64_t value) {
+    WriteVarint((static_cast<uint64_t>(field) << 3) | kVarintWireType);
+    WriteVarint(value);
+  }
+
+  void WriteBytesField(intptr_t field, const void* bytes, intptr_t length) {
+    WriteVarint((static_cast<uint64_t>(field) << 3) | kLengthDelimitedWireType);
+    WriteVarint(length);
+    EnsureCapacity(length);
+    memmove(&buffer_[length_], bytes, length);
+    length_ += length;
+  }
+
+  // Packed repeated fields are encoded like embedded messages.
+  void WriteMessageField(intptr_t field, const ProtobufEncoder& message) {
+    WriteBytesField(field, message.buffer(), message.length());
+  }
+
+ private:
+  static const uint64_t kVarintWireType = 0;
+  static const uint64_t kLengthDelimitedWireType = 2;
+  static const intptr_t kInitialCapacity = 256;
+
+  void WriteByte(uint8_t value) {
+    EnsureCapacity(1);
+    buffer_[length_++] = value;
+  }
+
+  void EnsureCapacity(intptr_t extra) {
+    if ((length_ + extra) <= capacity_) {
+      return;
+    }
+    intptr_t new_capacity = (capacity_ == 0) ? kInitialCapacity : capacity_;
+    while (new_capacity < (length_ + extra)) {
+      new_capacity *= 2;
+    }
+    buffer_ = reinterpret_cast<uint8_t*>(realloc(buffer_, new_capacity));
+    capacity_ = new_capacity;
+  }
+
+  uint8_t* buffer_;
+  intptr_t length_;
+  intptr_t capacity_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProtobufEncoder);
+};
+
+
+// An entry of the pprof string table.
+class PprofString : public ZoneAllocated {
+ public:
+  PprofString(const char* str, intptr_t index)
+      : str_(str), length_(strlen(str)), index_(index) { }
+
+  intptr_t index() const { return index_; }
+
+  intptr_t Hashcode() const {
+    return Utils::StringHash(str_, static_cast<int>(length_));
+  }
+
+  bool Equals(const PprofString* other) const {
+    return (length_ == other->length_) &&
+           (strncmp(str_, other->str_, length_) == 0);
+  }
+
+ private:
+  const char* str_;
+  const intptr_t length_;
+  const intptr_t index_;
+};
+
+
+// A pprof location: a pc in one code object. The pc of a frame that is not
+// executing is a return address, which can be in a different inlining
+// interval than the same pc in an executing frame.
+class PprofLocation : public ZoneAllocated {
+ public:
+  PprofLocation(uword pc, intptr_t code_index, bool executing, intptr_t id)
+      : pc_(pc), code_index_(code_index), executing_(executing), id_(id) { }
+
+  intptr_t id() const { return id_; }
+
+  intptr_t Hashcode() const {
+    return static_cast<intptr_t>(pc_);
+  }
+
+  bool Equals(const PprofLocation* other) const {
+    return (pc_ == other->pc_) &&
+           (code_index_ == other->code_index_) &&
+           (executing_ == other->executing_);
+  }
+
+ private:
+  const uword pc_;
+  const intptr_t code_index_;
+  const bool executing_;
+  const intptr_t id_;
+};
+
+
+// Writes a |Profile| in the pprof format. Strings, functions and locations
+// are written before the first message that refers to them, so the output
+// can be flushed while the samples are walked.
+class PprofWriter : public ValueObject {
+ public:
+  PprofWriter(Profile* profile,
+              Profile::StreamCallback callback,
+              void* callback_data)
+      : profile_(profile),
+        callback_(callback),
+        callback_data_(callback_data),
+        zone_(Thread::Current()->zone()),
+        script_(Script::Handle(zone_)),
+        url_(String::Handle(zone_)),
+        num_strings_(0),
+        num_locations_(0),
+        functions_written_(NULL) {
+    for (intptr_t i = 0; i < UserTags::kMaxUserTags; i++) {
+      user_tag_names_[i] = -1;
+    }
+  }
+
+  void Write() {
+    const intptr_t num_functions = profile_->NumFunctions();
+    functions_written_ = zone_->Alloc<bool>(num_functions);
+    for (intptr_t i = 0; i < num_functions; i++) {
+      functions_written_[i] = false;
+    }
+
+    // The first entry of the string table must be the empty string.
+    out_.WriteBytesField(kStringTableField, "", 0);
+    num_strings_ = 1;
+
+    const int64_t period_nanos =
+        static_cast<int64_t>(FLAG_profile_period) * kNanosecondsPerMicrosecond;
+    WriteValueType(kSampleTypeField, "samples", "count");
+    WriteValueType(kSampleTypeField, "cpu", "nanoseconds");
+    WriteValueType(kPeriodTypeField, "cpu", "nanoseconds");
+    out_.WriteVarintField(kPeriodField, period_nanos);
+    if (profile_->sample_count() > 0) {
+      out_.WriteVarintField(kTimeNanosField,
+                            profile_->min_time() * kNanosecondsPerMicrosecond);
+      out_.WriteVarintField(
+          kDurationNanosField,
+          profile_->GetTimeSpan() * kNanosecondsPerMicrosecond);
+    }
+    for (intptr_t kind = 1; kind < kNumCodeKinds; kind++) {
+      WriteMapping(static_cast<CodeKind>(kind));
+    }
+
+    thread_key_ = InternString("thread");
+    vm_tag_key_ = InternString("vmTag");
+    user_tag_key_ = InternString("userTag");
+    code_kind_key_ = InternString("codeKind");
+
+    ProcessedSampleBuffer* samples = profile_->samples_;
+    for (intptr_t i = 0; i < samples->length(); i++) {
+      WriteSample(samples->At(i), period_nanos);
+    }
+    Flush();
+  }
+
+ private:
+  // Field numbers of the messages in profile.proto.
+  enum {
+    kSampleTypeField = 1,
+    kSampleField = 2,
+    kMappingField = 3,
+    kLocationField = 4,
+    kFunctionField = 5,
+    kStringTableField = 6,
+    kTimeNanosField = 9,
+    kDurationNanosField = 10,
+    kPeriodTypeField = 11,
+    kPeriodField = 12,
+  };
+
+  enum {
+    kValueTypeTypeField = 1,
+    kValueTypeUnitField = 2,
+  };
+
+  enum {
+    kSampleLocationIdField = 1,
+    kSampleValueField = 2,
+    kSampleLabelField = 3,
+  };
+
+  enum {
+    kLabelKeyField = 1,
+    kLabelStrField = 2,
+    kLabelNumField = 3,
+  };
+
+  enum {
+    kMappingIdField = 1,
+    kMappingFilenameField = 5,
+    kMappingHasFunctionsField = 7,
+    kMappingHasFilenamesField = 8,
+    kMappingHasLineNumbersField = 9,
+    kMappingHasInlineFramesField = 10,
+  };
+
+  enum {
+    kLocationIdField = 1,
+    kLocationMappingIdField = 2,
+    kLocationAddressField = 3,
+    kLocationLineField = 4,
+  };
+
+  enum {
+    kLineFunctionIdField = 1,
+    kLineLineField = 2,
+  };
+
+  enum {
+    kFunctionIdField = 1,
+    kFunctionNameField = 2,
+    kFunctionSystemNameField = 3,
+    kFunctionFilenameField = 4,
+    kFunctionStartLineField = 5,
+  };
+
+  // Each kind of code is reported as a separate mapping, which is the id of
+  // the mapping.
+  enum CodeKind {
+    kOptimizedCode = 1,
+    kUnoptimizedCode,
+    kStubCode,
+    kNativeCode,
+    kCollectedCode,
+    kTagCode,
+    kNumCodeKinds,
+  };
+
+  static const intptr_t kChunkSize = 64 * KB;
+
+  static const char* CodeKindToCString(CodeKind kind) {
+    switch (kind) {
+      case kOptimizedCode:
+        return "optimized";
+      case kUnoptimizedCode:
+        return "unoptimized";
+      case kStubCode:
+        return "stub";
+      case kNativeCode:
+        return "native";
+      case kCollectedCode:
+        return "collected";
+      case kTagCode:
+        return "tag";
+      default:
+        UNREACHABLE();
+        return NULL;
+    }
+  }
+
+  static CodeKind KindOf(ProfileCode* code) {
+    switch (code->kind()) {
+      case ProfileCode::kDartCode: {
+        const Code& dart_code = Code::Handle(code->code());
+        if (!dart_code.IsFunctionCode()) {
+          return kStubCode;
+        }
+        return dart_code.is_optimized() ? kOptimizedCode : kUnoptimizedCode;
+      }
+      case ProfileCode::kNativeCode:
+        return kNativeCode;
+      case ProfileCode::kTagCode:
+        return kTagCode;
+      default:
+        return kCollectedCode;
+    }
+  }
+
+  void Emit(intptr_t field, const ProtobufEncoder& message) {
+    out_.WriteMessageField(field, message);
+    if (out_.length() >= kChunkSize) {
+      Flush();
+    }
+  }
+
+  void Flush() {
+    if (out_.length() > 0) {
+      callback_(out_.buffer(), out_.length(), callback_data_);
+      out_.Clear();
+    }
+  }
+
+  intptr_t InternString(const char* str) {
+    if (str[0] == '\0') {
+      return 0;
+    }
+    PprofString key(str, -1);
+    PprofString* entry = strings_.Lookup(&key);
+    if (entry != NULL) {
+      return entry->index();
+    }
+    const intptr_t index = num_strings_++;
+    strings_.Insert(new(zone_) PprofString(str, index));
+    out_.WriteBytesField(kStringTableField, str, strlen(str));
+    return index;
+  }
+
+  void WriteValueType(intptr_t field, const char* type, const char* unit) {
+    scratch_.Clear();
+    scratch_.WriteVarintField(kValueTypeTypeField, InternString(type));
+    scratch_.WriteVarintField(kValueTypeUnitField, InternString(unit));
+    Emit(field, scratch_);
+  }
+
+  void WriteMapping(CodeKind kind) {
+    scratch_.Clear();
+    scratch_.WriteVarintField(kMappingIdField, kind);
+    scratch_.WriteVarintField(kMappingFilenameField,
+                              InternString(CodeKindToCString(kind)));
+    // Locations are fully symbolized.
+    scratch_.WriteVarintField(kMappingHasFunctionsField, 1);
+    scratch_.WriteVarintField(kMappingHasFilenamesField, 1);
+    scratch_.WriteVarintField(kMappingHasLineNumbersField, 1);
+    scratch_.WriteVarintField(kMappingHasInlineFramesField, 1);
+    Emit(kMappingField, scratch_);
+  }
+
+  intptr_t LineNumber(ProfileFunction* function, TokenPosition token_pos) {
+    const Function* dart_function = function->function();
+    if (dart_function->IsNull() || !token_pos.IsReal()) {
+      return 0;
+    }
+    script_ = dart_function->script();
+    if (script_.IsNull()) {
+      return 0;
+    }
+    intptr_t line = 0;
+    intptr_t column = 0;
+    script_.GetTokenLocation(token_pos, &line, &column);
+    return line;
+  }
+
+  intptr_t FunctionId(ProfileFunction* function) {
+    const intptr_t index = function->table_index();
+    const intptr_t id = index + 1;
+    if (functions_written_[index]) {
+      return id;
+    }
+    functions_written_[index] = true;
+    // Native functions are named by their symbol, see
+    // ProfileCode::SetFunctionAndName.
+    const intptr_t name = InternString(function->Name());
+    intptr_t filename = 0;
+    intptr_t start_line = 0;
+    const Function* dart_function = function->function();
+    if (!dart_function->IsNull()) {
+      script_ = dart_function->script();
+      if (!script_.IsNull()) {
+        url_ = script_.url();
+        filename = InternString(url_.ToCString());
+        start_line = LineNumber(function, dart_function->token_pos());
+      }
+    }
+    function_.Clear();
+    function_.WriteVarintField(kFunctionIdField, id);
+    function_.WriteVarintField(kFunctionNameField, name);
+    function_.WriteVarintField(kFunctionSystemNameField, name);
+    if (filename != 0) {
+      function_.WriteVarintField(kFunctionFilenameField, filename);
+    }
+    if (start_line > 0) {
+      function_.WriteVarintField(kFunctionStartLineField, start_line);
+    }
+    Emit(kFunctionField, function_);
+    return id;
+  }
+
+  void AddLine(ProfileFunction* function, TokenPosition token_pos) {
+    const intptr_t function_id = FunctionId(function);
+    const intptr_t line = LineNumber(function, token_pos);
+    line_.Clear();
+    line_.WriteVarintField(kLineFunctionIdField, function_id);
+    if (line > 0) {
+      line_.WriteVarintField(kLineLineField, line);
+    }
+    location_.WriteMessageField(kLocationLineField, line_);
+  }
+
+  intptr_t LocationId(ProcessedSample* sample, intptr_t frame_index) {
+    const uword pc = sample->At(frame_index);
+    ProfileCode* profile_code = profile_->GetCodeForPC(pc, sample->timestamp());
+    const bool executing = (frame_index == 0) &&
+                           sample->first_frame_executing() &&
+                           !sample->IsAllocationSample();
+    PprofLocation key(pc, profile_code->code_table_index(), executing, -1);
+    PprofLocation* entry = locations_.Lookup(&key);
+    if (entry != NULL) {
+      return entry->id();
+    }
+    const intptr_t id = ++num_locations_;
+    locations_.Insert(new(zone_) PprofLocation(
+        pc, profile_code->code_table_index(), executing, id));
+
+    const Code& code = Code::ZoneHandle(zone_, profile_code->code());
+    GrowableArray<Function*>* inlined_functions = NULL;
+    GrowableArray<TokenPosition>* inlined_token_positions = NULL;
+    TokenPosition token_position = TokenPosition::kNoSource;
+    if (!code.IsNull()) {
+      inlined_functions_cache_.Get(pc, code, sample, frame_index,
+                                   &inlined_functions,
+                                   &inlined_token_positions,
+                                   &token_position);
+    }
+    location_.Clear();
+    location_.WriteVarintField(kLocationIdField, id);
+    location_.WriteVarintField(kLocationMappingIdField, KindOf(profile_code));
+    location_.WriteVarintField(kLocationAddressField, pc);
+    if ((inlined_functions == NULL) || (inlined_functions->length() == 0)) {
+      AddLine(profile_code->function(), token_position);
+    } else {
+      // The innermost inlined function comes first, as in pprof.
+      for (intptr_t i = 0; i < inlined_functions->length(); i++) {
+        ProfileFunction* function =
+            profile_->FindFunction(*(*inlined_functions)[i]);
+        ASSERT(function != NULL);
+        AddLine(function, (*inlined_token_positions)[i]);
+      }
+    }
+    Emit(kLocationField, location_);
+    return id;
+  }
+
+  intptr_t UserTagName(uword user_tag) {
+    const intptr_t index = user_tag - UserTags::kUserTagIdOffset;
+    if (user_tag_names_[index] < 0) {
+      user_tag_names_[index] = InternString(UserTags::TagName(user_tag));
+    }
+    return user_tag_names_[index];
+  }
+
+  void AddLabel(intptr_t key, intptr_t value_field, int64_t value) {
+    label_.Clear();
+    label_.WriteVarintField(kLabelKeyField, key);
+    label_.WriteVarintField(value_field, value);
+    sample_.WriteMessageField(kSampleLabelField, label_);
+  }
+
+  void WriteSample(ProcessedSample* sample, int64_t period_nanos) {
+    // Writes the locations of new frames before the sample.
+    scratch_.Clear();
+    for (intptr_t i = 0; i < sample->length(); i++) {
+      scratch_.WriteVarint(LocationId(sample, i));
+    }
+    sample_.Clear();
+    sample_.WriteMessageField(kSampleLocationIdField, scratch_);
+    sample_.WriteVarintField(kSampleValueField, 1);
+    sample_.WriteVarintField(kSampleValueField, period_nanos);
+    AddLabel(thread_key_, kLabelNumField,
+             OSThread::ThreadIdToIntPtr(sample->tid()));
+    AddLabel(vm_tag_key_, kLabelStrField,
+             InternString(VMTag::TagName(sample->vm_tag())));
+    if (UserTags::IsUserTag(sample->user_tag())) {
+      AddLabel(user_tag_key_, kLabelStrField,
+               UserTagName(sample->user_tag()));
+    }
+    if (sample->length() > 0) {
+      ProfileCode* leaf =
+          profile_->GetCodeForPC(sample->At(0), sample->timestamp());
+      AddLabel(code_kind_key_, kLabelStrField,
+               InternString(CodeKindToCString(KindOf(leaf))));
+    }
+    Emit(kSampleField, sample_);
+  }
+
+  Profile* profile_;
+  Profile::StreamCallback callback_;
+  void* callback_data_;
+  Zone* zone_;
+  Script& script_;
+  String& url_;
+
+  ProtobufEncoder out_;
+  ProtobufEncoder scratch_;
+  ProtobufEncoder sample_;
+  ProtobufEncoder label_;
+  ProtobufEncoder location_;
+  ProtobufEncoder line_;
+  ProtobufEncoder function_;
+
+  DirectChainedHashMap<PointerKeyValueTrait<PprofString> > strings_;
+  intptr_t num_strings_;
+  DirectChainedHashMap<PointerKeyValueTrait<PprofLocation> > locations_;
+  intptr_t num_locations_;
+  bool* functions_written_;
+  intptr_t user_tag_names_[UserTags::kMaxUserTags];
+
+  intptr_t thread_key_;
+  intptr_t vm_tag_key_;
+  intptr_t user_tag_key_;
+  intptr_t code_kind_key_;
+
+  ProfileCodeInlinedFunctionsCache inlined_functions_cache_;
+
+  DISALLOW_COPY_AND_ASSIGN(PprofWriter);
+};
+
+
+void Profile::WritePprof(StreamCallback callback, void* callback_data) {
+  ScopeTimer sw("Profile::WritePprof", FLAG_trace_profiler);
+  PprofWriter writer(this, callback, callback_data);
+  writer.Write();
+}
+
+
 void ProfileTrieWalker::Reset(Profile::TrieKind trie_kind) {
   code_trie_ = Profile::IsCodeTrie(trie_kind);
   parent_ = NULL;
@@ -2848,6 +3385,67 @@ void ProfilerService::PrintTimelineJSON(JSONStream* stream,
 }
 
 
+bool ProfilerService::WritePprof(Profile::StreamCallback callback,
+                                 void* callback_data,
+                                 int64_t time_origin_micros,
+                                 int64_t time_extent_micros) {
+  Thread* thread = Thread::Current();
+  Isolate* isolate = thread->isolate();
+  // Disable thread interrupts while processing the buffer.
+  DisableThreadInterruptsScope dtis(thread);
+
+  SampleBuffer* sample_buffer = Profiler::sample_buffer();
+  if (sample_buffer == NULL) {
+    return false;
+  }
+
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  NoAllocationSampleFilter filter(isolate,
+                                  Thread::kMutatorTask,
+                                  time_origin_micros,
+                                  time_extent_micros);
+  Profile profile(isolate);
+  profile.Build(thread, &filter, Profile::kNoTags);
+  profile.WritePprof(callback, callback_data);
+  return true;
+}
+
+
+static uint8_t* PprofReAlloc(uint8_t* ptr,
+                             intptr_t old_size,
+                             intptr_t new_size) {
+  return reinterpret_cast<uint8_t*>(realloc(ptr, new_size));
+}
+
+
+static void AppendToWriteStream(const uint8_t* data,
+                                intptr_t length,
+                                void* callback_data) {
+  reinterpret_cast<WriteStream*>(callback_data)->WriteBytes(data, length);
+}
+
+
+void ProfilerService::PrintPprofJSON(JSONStream* stream,
+                                     int64_t time_origin_micros,
+                                     int64_t time_extent_micros) {
+  // The buffer must outlive the zone of the profile.
+  uint8_t* buffer = NULL;
+  WriteStream pprof(&buffer, PprofReAlloc, 64 * KB);
+  if (!WritePprof(AppendToWriteStream,
+                  &pprof,
+                  time_origin_micros,
+                  time_extent_micros)) {
+    stream->PrintError(kFeatureDisabled, NULL);
+  } else {
+    JSONObject obj(stream);
+    obj.AddProperty("type", "_CpuProfilePprof");
+    obj.AddPropertyBase64("data", buffer, pprof.bytes_written());
+  }
+  free(buffer);
+}
+
+
 void ProfilerService::ClearSamples() {
   SampleBuffer* sample_buffer = Profiler::sample_buffer();
   if (sample_buffer == NULL) {
@@ -253,6 +253,7 @@ class ProfileCode : public ZoneAllocated {
   ZoneGrowableArray<ProfileCodeAddress> address_ticks_;
 
   friend class ProfileBuilder;
+  friend class PprofWriter;
 };
 
 
@@ -366,9 +367,23 @@ class Profile : public ValueObject {
   void PrintProfileJSON(JSONStream* stream);
   void PrintTimelineJSON(JSONStream* stream);
 
+  // Called with consecutive chunks of an encoded profile.
+  typedef void (*StreamCallback)(const uint8_t* data,
+                                 intptr_t length,
+                                 void* callback_data);
+
+  // Writes the samples in the pprof protocol buffer format, see
+  // https://github.com/google/pprof/blob/master/proto/profile.proto.
+  // The output is streamed in chunks: only the distinct strings, functions
+  // and frames are kept in memory, not the samples.
+  void WritePprof(StreamCallback callback, void* callback_data);
+
   ProfileFunction* FindFunction(const Function& function);
 
  private:
+  // The code that contained |pc| when a sample was taken at |timestamp|.
+  ProfileCode* GetCodeForPC(uword pc, int64_t timestamp) const;
+
   void PrintHeaderJSON(JSONObject* obj);
   void PrintTimelineFrameJSON(JSONObject* frames,
                               ProfileTrieNode* current,
@@ -393,6 +408,7 @@ class Profile : public ValueObject {
   intptr_t sample_count_;
 
   friend class ProfileBuilder;
+  friend class PprofWriter;
 };
 
 
@@ -459,6 +475,18 @@ class ProfilerService : public AllStatic {
                                 int64_t time_origin_micros,
                                 int64_t time_extent_micros);
 
+  // Writes the CPU profile of the current isolate in the pprof format, see
+  // Profile::WritePprof. Returns false if the profiler is disabled.
+  static bool WritePprof(Profile::StreamCallback callback,
+                         void* callback_data,
+                         int64_t time_origin_micros,
+                         int64_t time_extent_micros);
+
+  // Prints the pprof encoded profile base64 encoded in a service response.
+  static void PrintPprofJSON(JSONStream* stream,
+                             int64_t time_origin_micros,
+                             int64_t time_extent_micros);
+
   static void ClearSamples();
 
  private:
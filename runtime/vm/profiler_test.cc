@@ -104,22 +104,23 @@ class ProfileSampleBufferTestHelper {
 
 TEST_CASE(Profiler_SampleBufferWrapTest) {
   SampleBuffer* sample_buffer = new SampleBuffer(3);
+  SampleBlock* block = NULL;
   Isolate* i = reinterpret_cast<Isolate*>(0x1);
   EXPECT_EQ(0, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
   Sample* s;
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   s->SetAt(0, 2);
   EXPECT_EQ(2, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   s->SetAt(0, 4);
   EXPECT_EQ(6, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   s->SetAt(0, 6);
   EXPECT_EQ(12, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   s->SetAt(0, 8);
   EXPECT_EQ(18, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
@@ -129,19 +130,20 @@ TEST_CASE(Profiler_SampleBufferWrapTest) {
 
 TEST_CASE(Profiler_SampleBufferIterateTest) {
   SampleBuffer* sample_buffer = new SampleBuffer(3);
+  SampleBlock* block = NULL;
   Isolate* i = reinterpret_cast<Isolate*>(0x1);
   EXPECT_EQ(0, ProfileSampleBufferTestHelper::IterateCount(i, *sample_buffer));
   Sample* s;
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   EXPECT_EQ(1, ProfileSampleBufferTestHelper::IterateCount(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   EXPECT_EQ(2, ProfileSampleBufferTestHelper::IterateCount(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   EXPECT_EQ(3, ProfileSampleBufferTestHelper::IterateCount(i, *sample_buffer));
-  s = sample_buffer->ReserveSample();
+  s = sample_buffer->ReserveSample(&block);
   s->Init(i, 0, 0);
   EXPECT_EQ(3, ProfileSampleBufferTestHelper::IterateCount(i, *sample_buffer));
   delete sample_buffer;
@@ -151,7 +153,8 @@ TEST_CASE(Profiler_SampleBufferIterateTest) {
 TEST_CASE(Profiler_AllocationSampleTest) {
   Isolate* isolate = Isolate::Current();
   SampleBuffer* sample_buffer = new SampleBuffer(3);
-  Sample* sample = sample_buffer->ReserveSample();
+  SampleBlock* block = NULL;
+  Sample* sample = sample_buffer->ReserveSample(&block);
   sample->Init(isolate, 0, 0);
   sample->set_metadata(99);
   sample->set_is_allocation_sample(true);
@@ -160,6 +163,93 @@ TEST_CASE(Profiler_AllocationSampleTest) {
 }
 
 
+TEST_CASE(Profiler_SampleBufferBlockTest) {
+  // Three blocks of two samples, the last one holding the remaining sample.
+  SampleBuffer* sample_buffer = new SampleBuffer(7, 2);
+  EXPECT_EQ(3, sample_buffer->num_blocks());
+  Isolate* i = reinterpret_cast<Isolate*>(0x1);
+  SampleBlock* a = NULL;
+  SampleBlock* b = NULL;
+  SampleBlock* c = NULL;
+  Sample* s;
+  s = sample_buffer->ReserveSample(&a);
+  s->Init(i, 0, 0);
+  s->SetAt(0, 1);
+  s = sample_buffer->ReserveSample(&b);
+  s->Init(i, 0, 0);
+  s->SetAt(0, 2);
+  s = sample_buffer->ReserveSample(&a);
+  s->Init(i, 0, 0);
+  s->SetAt(0, 4);
+  // Writers fill their own blocks.
+  EXPECT(a != b);
+  EXPECT_EQ(0, a->start());
+  EXPECT_EQ(2, b->start());
+  EXPECT(a->is_full());
+  EXPECT_EQ(7, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
+  // The last block is acquired by a third writer.
+  s = sample_buffer->ReserveSample(&c);
+  EXPECT(s != NULL);
+  EXPECT_EQ(4, c->start());
+  EXPECT_EQ(3, c->capacity());
+  // All other blocks are in use, the full block of the first writer is
+  // reused.
+  s = sample_buffer->ReserveSample(&a);
+  EXPECT(s != NULL);
+  EXPECT_EQ(0, a->start());
+  s->Init(i, 0, 0);
+  s->SetAt(0, 8);
+  EXPECT_EQ(14, ProfileSampleBufferTestHelper::IterateSumPC(i, *sample_buffer));
+  // A writer cannot steal a block that is in use.
+  SampleBlock* d = NULL;
+  EXPECT(sample_buffer->ReserveSample(&d) == NULL);
+  EXPECT(d == NULL);
+  SampleBuffer::ReleaseBlock(b);
+  EXPECT(sample_buffer->ReserveSample(&d) != NULL);
+  EXPECT_EQ(2, d->start());
+  delete sample_buffer;
+}
+
+
+static void ReserveSamples(SampleBuffer* sample_buffer,
+                           intptr_t count,
+                           SampleBlock** block) {
+  for (intptr_t i = 0; i < count; i++) {
+    Sample* sample = sample_buffer->ReserveSample(block);
+    EXPECT(sample != NULL);
+    sample->Init(NULL, 1, 0);
+  }
+}
+
+
+TEST_CASE(Profiler_SampleBufferLinkTest) {
+  SampleBuffer* sample_buffer = new SampleBuffer(8, 4);
+  Isolate* i = reinterpret_cast<Isolate*>(0x1);
+  SampleBlock* block = NULL;
+  SampleBlock* other = NULL;
+  Sample* head = sample_buffer->ReserveSample(&block);
+  head->Init(i, 42, 0);
+  ReserveSamples(sample_buffer, 2, &block);
+  Sample* second = sample_buffer->ReserveSampleAndLink(&block, head);
+  EXPECT(block->is_full());
+  // The link continues in a new block of the same writer.
+  Sample* third = sample_buffer->ReserveSampleAndLink(&block, second);
+  EXPECT(third != NULL);
+  EXPECT_EQ(4, block->start());
+  EXPECT(!second->head_sample());
+  EXPECT(!third->head_sample());
+  EXPECT_EQ(42, third->timestamp());
+  EXPECT(head->is_continuation_sample());
+  EXPECT_EQ(3, head->continuation_index());
+  EXPECT(second->is_continuation_sample());
+  EXPECT_EQ(4, second->continuation_index());
+  // Another writer reuses the released block.
+  ReserveSamples(sample_buffer, 1, &other);
+  EXPECT_EQ(0, other->start());
+  delete sample_buffer;
+}
+
+
 static RawClass* GetClass(const Library& lib, const char* name) {
   const Class& cls = Class::Handle(
       lib.LookupClassAllowPrivate(String::Handle(Symbols::New(Thread::Current(),
@@ -323,6 +413,83 @@ TEST_CASE(Profiler_TrivialRecordAllocation) {
 }
 
 
+static void AppendPprofChunk(const uint8_t* data,
+                             intptr_t length,
+                             void* callback_data) {
+  GrowableArray<uint8_t>* pprof =
+      reinterpret_cast<GrowableArray<uint8_t>*>(callback_data);
+  for (intptr_t i = 0; i < length; i++) {
+    pprof->Add(data[i]);
+  }
+}
+
+
+static bool ContainsBytes(const GrowableArray<uint8_t>& data,
+                          const char* bytes) {
+  const intptr_t length = strlen(bytes);
+  for (intptr_t i = 0; i + length <= data.length(); i++) {
+    if (memcmp(&data[i], bytes, length) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+TEST_CASE(Profiler_Pprof) {
+  DisableNativeProfileScope dnps;
+  const char* kScript =
+      "class A {\n"
+      "  var a;\n"
+      "  var b;\n"
+      "}\n"
+      "class B {\n"
+      "  static boo() {\n"
+      "    return new A();\n"
+      "  }\n"
+      "}\n"
+      "main() {\n"
+      "  return B.boo();\n"
+      "}\n";
+
+  Dart_Handle lib = TestCase::LoadTestScript(kScript, NULL);
+  EXPECT_VALID(lib);
+  Library& root_library = Library::Handle();
+  root_library ^= Api::UnwrapHandle(lib);
+
+  const Class& class_a = Class::Handle(GetClass(root_library, "A"));
+  EXPECT(!class_a.IsNull());
+  class_a.SetTraceAllocation(true);
+
+  Dart_Handle result = Dart_Invoke(lib, NewString("main"), 0, NULL);
+  EXPECT_VALID(result);
+
+  {
+    Thread* thread = Thread::Current();
+    Isolate* isolate = thread->isolate();
+    StackZone zone(thread);
+    HANDLESCOPE(thread);
+    Profile profile(isolate);
+    AllocationFilter filter(isolate, class_a.id());
+    profile.Build(thread, &filter, Profile::kNoTags);
+    EXPECT_EQ(1, profile.sample_count());
+
+    GrowableArray<uint8_t> pprof;
+    profile.WritePprof(AppendPprofChunk, &pprof);
+    // The string table starts with the empty string: field 6, length 0.
+    EXPECT(pprof.length() > 2);
+    EXPECT_EQ(0x32, pprof[0]);
+    EXPECT_EQ(0, pprof[1]);
+    EXPECT(ContainsBytes(pprof, "samples"));
+    EXPECT(ContainsBytes(pprof, "nanoseconds"));
+    EXPECT(ContainsBytes(pprof, "DRT_AllocateObject"));
+    EXPECT(ContainsBytes(pprof, "B.boo"));
+    EXPECT(ContainsBytes(pprof, "main"));
+    EXPECT(ContainsBytes(pprof, "unoptimized"));
+  }
+}
+
+
 TEST_CASE(Profiler_ToggleRecordAllocation) {
   DisableNativeProfileScope dnps;
   const char* kScript =
@@ -2362,7 +2529,8 @@ static void InsertFakeSample(SampleBuffer* sample_buffer,
                              uword* pc_offsets) {
   ASSERT(sample_buffer != NULL);
   Isolate* isolate = Isolate::Current();
-  Sample* sample = sample_buffer->ReserveSample();
+  Sample* sample = sample_buffer->ReserveSample(
+      OSThread::Current()->sample_block_address());
   ASSERT(sample != NULL);
   sample->Init(isolate,
                OS::GetCurrentMonotonicMicros(),
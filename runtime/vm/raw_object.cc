@@ -832,6 +832,15 @@ intptr_t RawExternalTwoByteString::VisitExternalTwoByteStringPointers(
 }
 
 
+intptr_t RawConsString::VisitConsStringPointers(
+    RawConsString* raw_obj, ObjectPointerVisitor* visitor) {
+  // Make sure that we got here with the tagged pointer as this.
+  ASSERT(raw_obj->IsHeapObject());
+  visitor->VisitPointers(raw_obj->from(), raw_obj->to());
+  return ConsString::InstanceSize();
+}
+
+
 intptr_t RawBool::VisitBoolPointers(RawBool* raw_obj,
                                     ObjectPointerVisitor* visitor) {
   // Make sure that we got here with the tagged pointer as this.
@@ -89,7 +89,8 @@ namespace dart {
     V(OneByteString)                                                           \
     V(TwoByteString)                                                           \
     V(ExternalOneByteString)                                                   \
-    V(ExternalTwoByteString)
+    V(ExternalTwoByteString)                                                   \
+    V(ConsString)
 
 #define CLASS_LIST_TYPED_DATA(V)                                               \
   V(Int8Array)                                                                 \
@@ -614,6 +615,7 @@ CLASS_LIST_TYPED_DATA(DEFINE_IS_CID)
   friend class ByteBuffer;
   friend class Closure;
   friend class Code;
+  friend class ConsString;  // GetClassId
   friend class Double;
   friend class ForwardPointersVisitor;  // StorePointer
   friend class FreeListElement;
@@ -845,8 +847,9 @@ class RawFunction : public RawObject {
     return reinterpret_cast<RawObject**>(&ptr()->data_);
   }
   RawArray* ic_data_array_;  // ICData of unoptimized code.
+  RawArray* coverage_array_;  // State of the coverage probes.
   RawObject** to_no_code() {
-    return reinterpret_cast<RawObject**>(&ptr()->ic_data_array_);
+    return reinterpret_cast<RawObject**>(&ptr()->coverage_array_);
   }
   RawCode* code_;  // Currently active code.
   RawCode* unoptimized_code_;  // Unoptimized code, keep it after optimization.
@@ -865,6 +868,7 @@ class RawFunction : public RawObject {
   uint32_t kind_tag_;  // See Function::KindTagBits.
   uint16_t optimized_instruction_count_;
   uint16_t optimized_call_site_count_;
+  uint64_t deopt_reason_counts_;  // See Function::DeoptReasonCount.
 };
 
 
@@ -1837,6 +1841,7 @@ class RawString : public RawInstance {
   RawSmi* hash_;
   RawObject** to() { return reinterpret_cast<RawObject**>(&ptr()->hash_); }
 
+  friend class ConsString;
   friend class Library;
 };
 
@@ -1849,6 +1854,7 @@ class RawOneByteString : public RawString {
   const uint8_t* data() const { OPEN_ARRAY_START(uint8_t, uint8_t); }
 
   friend class ApiMessageReader;
+  friend class ConsString;
   friend class SnapshotReader;
 };
 
@@ -1860,6 +1866,7 @@ class RawTwoByteString : public RawString {
   uint16_t* data() { OPEN_ARRAY_START(uint16_t, uint16_t); }
   const uint16_t* data() const { OPEN_ARRAY_START(uint16_t, uint16_t); }
 
+  friend class ConsString;
   friend class SnapshotReader;
 };
 
@@ -1900,6 +1907,7 @@ class RawExternalOneByteString : public RawString {
  private:
   ExternalData* external_data_;
   friend class Api;
+  friend class ConsString;
 };
 
 
@@ -1911,6 +1919,22 @@ class RawExternalTwoByteString : public RawString {
  private:
   ExternalData* external_data_;
   friend class Api;
+  friend class ConsString;
+};
+
+
+// A string formed by the concatenation of two strings. The characters are
+// only copied into a flat string when they are first needed, at which point
+// first_ is replaced by the flat string and second_ by the empty string.
+class RawConsString : public RawString {
+  RAW_HEAP_OBJECT_IMPLEMENTATION(ConsString);
+
+  RawSmi* char_size_;  // Largest character size of the leaves.
+  RawString* first_;
+  RawString* second_;
+  RawObject** to() { return reinterpret_cast<RawObject**>(&ptr()->second_); }
+
+  friend class ConsString;
 };
 
 
@@ -2257,8 +2281,9 @@ inline bool RawObject::IsStringClassId(intptr_t index) {
   COMPILE_ASSERT(kOneByteStringCid == kStringCid + 1 &&
                  kTwoByteStringCid == kStringCid + 2 &&
                  kExternalOneByteStringCid == kStringCid + 3 &&
-                 kExternalTwoByteStringCid == kStringCid + 4);
-  return (index >= kStringCid && index <= kExternalTwoByteStringCid);
+                 kExternalTwoByteStringCid == kStringCid + 4 &&
+                 kConsStringCid == kStringCid + 5);
+  return (index >= kStringCid && index <= kConsStringCid);
 }
 
 
@@ -2267,7 +2292,8 @@ inline bool RawObject::IsOneByteStringClassId(intptr_t index) {
   COMPILE_ASSERT(kOneByteStringCid == kStringCid + 1 &&
                  kTwoByteStringCid == kStringCid + 2 &&
                  kExternalOneByteStringCid == kStringCid + 3 &&
-                 kExternalTwoByteStringCid == kStringCid + 4);
+                 kExternalTwoByteStringCid == kStringCid + 4 &&
+                 kConsStringCid == kStringCid + 5);
   return (index == kOneByteStringCid || index == kExternalOneByteStringCid);
 }
 
@@ -2277,7 +2303,8 @@ inline bool RawObject::IsTwoByteStringClassId(intptr_t index) {
   COMPILE_ASSERT(kOneByteStringCid == kStringCid + 1 &&
                  kTwoByteStringCid == kStringCid + 2 &&
                  kExternalOneByteStringCid == kStringCid + 3 &&
-                 kExternalTwoByteStringCid == kStringCid + 4);
+                 kExternalTwoByteStringCid == kStringCid + 4 &&
+                 kConsStringCid == kStringCid + 5);
   return (index == kOneByteStringCid ||
           index == kTwoByteStringCid ||
           index == kExternalOneByteStringCid ||
@@ -2290,7 +2317,8 @@ inline bool RawObject::IsExternalStringClassId(intptr_t index) {
   COMPILE_ASSERT(kOneByteStringCid == kStringCid + 1 &&
                  kTwoByteStringCid == kStringCid + 2 &&
                  kExternalOneByteStringCid == kStringCid + 3 &&
-                 kExternalTwoByteStringCid == kStringCid + 4);
+                 kExternalTwoByteStringCid == kStringCid + 4 &&
+                 kConsStringCid == kStringCid + 5);
   return (index == kExternalOneByteStringCid ||
           index == kExternalTwoByteStringCid);
 }
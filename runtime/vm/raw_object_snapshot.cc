@@ -766,6 +766,7 @@ RawFunction* Function::ReadFrom(SnapshotReader* reader,
       func.set_optimized_call_site_count(reader->Read<uint16_t>());
     }
     func.set_was_compiled(false);
+    func.ClearDeoptReasonCounts();
 
     // Set all the object fields.
     READ_OBJECT_FIELDS(func,
@@ -2832,6 +2833,51 @@ void RawExternalTwoByteString::WriteTo(SnapshotWriter* writer,
 }
 
 
+RawConsString* ConsString::ReadFrom(SnapshotReader* reader,
+                                    intptr_t object_id,
+                                    intptr_t tags,
+                                    Snapshot::Kind kind,
+                                    bool as_reference) {
+  UNREACHABLE();
+  return ConsString::null();
+}
+
+
+void RawConsString::WriteTo(SnapshotWriter* writer,
+                            intptr_t object_id,
+                            Snapshot::Kind kind,
+                            bool as_reference) {
+  // Serialize as a flat string. The characters are gathered in a zone buffer
+  // as the cons string cannot be flattened without allocating in the heap.
+  const String& str = String::Handle(this);
+  const intptr_t len = str.Length();
+  Zone* zone = Thread::Current()->zone();
+  if (str.CharSize() == String::kOneByteChar) {
+    uint8_t* data = zone->Alloc<uint8_t>(len);
+    ConsString::CopyChars(str, 0, len, data);
+    StringWriteTo(writer,
+                  object_id,
+                  kind,
+                  kOneByteStringCid,
+                  writer->GetObjectTags(this),
+                  ptr()->length_,
+                  ptr()->hash_,
+                  data);
+  } else {
+    uint16_t* data = zone->Alloc<uint16_t>(len);
+    ConsString::CopyChars(str, 0, len, data);
+    StringWriteTo(writer,
+                  object_id,
+                  kind,
+                  kTwoByteStringCid,
+                  writer->GetObjectTags(this),
+                  ptr()->length_,
+                  ptr()->hash_,
+                  data);
+  }
+}
+
+
 RawBool* Bool::ReadFrom(SnapshotReader* reader,
                         intptr_t object_id,
                         intptr_t tags,
@@ -16,6 +16,8 @@ namespace dart {
 
 DEFINE_FLAG(bool, dead_store_elimination, true, "Eliminate dead stores");
 DEFINE_FLAG(bool, load_cse, true, "Use redundant load elimination.");
+DEFINE_FLAG(bool, partial_escape_analysis, true,
+    "Sink allocations that escape only on some paths to their escape points.");
 DEFINE_FLAG(bool, trace_load_optimization, false,
     "Print live sets for load optimization pass.");
 
@@ -2832,7 +2834,8 @@ void AllocationSinking::CollectCandidates() {
     for (ForwardInstructionIterator it(block); !it.Done(); it.Advance()) {
       { AllocateObjectInstr* alloc = it.Current()->AsAllocateObject();
         if ((alloc != NULL) &&
-            IsAllocationSinkingCandidate(alloc, kOptimisticCheck)) {
+            (IsAllocationSinkingCandidate(alloc, kOptimisticCheck) ||
+             CollectEscapePoints(alloc))) {
           alloc->SetIdentity(AliasIdentity::AllocationSinkingCandidate());
           candidates_.Add(alloc);
         }
@@ -2849,12 +2852,15 @@ void AllocationSinking::CollectCandidates() {
   }
 
   // Transitively unmark all candidates that are not strictly valid.
+  // Partially escaping candidates are never stored into other allocations
+  // (see CollectEscapePoints) so they stay valid.
   bool changed;
   do {
     changed = false;
     for (intptr_t i = 0; i < candidates_.length(); i++) {
       Definition* alloc = candidates_[i];
-      if (alloc->Identity().IsAllocationSinkingCandidate()) {
+      if (alloc->Identity().IsAllocationSinkingCandidate() &&
+          !HasEscapePoints(alloc)) {
         if (!IsAllocationSinkingCandidate(alloc, kStrictCheck)) {
           alloc->SetIdentity(AliasIdentity::Unknown());
           changed = true;
@@ -2880,6 +2886,316 @@ void AllocationSinking::CollectCandidates() {
     }
   }
   candidates_.TruncateTo(j);
+
+  // Candidates that escape on some paths now get a real allocation at each
+  // of their escape points. After that they are only used by stores into
+  // their own fields and by loads that load forwarding will eliminate.
+  for (intptr_t i = 0; i < candidates_.length(); i++) {
+    if (HasEscapePoints(candidates_[i])) {
+      MaterializeAtEscapePoints(candidates_[i]);
+    }
+  }
+  escaping_allocations_.Clear();
+  escape_points_.Clear();
+}
+
+
+// Returns true if the instruction dom is executed before the instruction
+// instr on every path that reaches instr: either dom precedes instr in the
+// same block or dom's block dominates instr's block.
+static bool InstructionDominates(Instruction* dom, Instruction* instr) {
+  BlockEntryInstr* dom_block = dom->GetBlock();
+  BlockEntryInstr* block = instr->GetBlock();
+  if (block != dom_block) {
+    return dom_block->Dominates(block);
+  }
+  if (instr->IsPhi()) {
+    return false;
+  }
+  for (Instruction* it = dom; it != NULL; it = it->next()) {
+    if (it == instr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// Collect blocks that can be reached from the given block without passing
+// through the stop block.
+static BitVector* ReachableBlocks(FlowGraph* flow_graph,
+                                  BlockEntryInstr* block,
+                                  BlockEntryInstr* stop) {
+  Zone* zone = flow_graph->zone();
+  BitVector* reachable =
+      new(zone) BitVector(zone, flow_graph->preorder().length());
+  GrowableArray<BlockEntryInstr*> worklist;
+  worklist.Add(block);
+  while (!worklist.is_empty()) {
+    Instruction* last = worklist.RemoveLast()->last_instruction();
+    for (intptr_t i = 0; i < last->SuccessorCount(); i++) {
+      BlockEntryInstr* succ = last->SuccessorAt(i);
+      if ((succ != stop) && !reachable->Contains(succ->preorder_number())) {
+        reachable->Add(succ->preorder_number());
+        worklist.Add(succ);
+      }
+    }
+  }
+  return reachable;
+}
+
+
+// Partial escape analysis. An allocation that escapes only on some paths
+// (e.g. it is passed to a call that throws an error or logs something) does
+// not need to exist on the other paths. Such allocation is replaced by a
+// fresh allocation, initialized from the current state of the virtual object,
+// right before each instruction at which it escapes ("escape point"). All uses
+// dominated by the escape point are redirected to the copy.
+//
+// This preserves identity of the object as long as every path starting at
+// the escape point either re-executes the original allocation or only uses
+// the object at instructions dominated by the escape point. In particular
+// an escape point can't be inside a loop that does not contain the
+// allocation itself and paths from the escape point can't merge with paths
+// where the object is still virtual while the object is still in use.
+//
+// Stores into the object and loads from it are not escape points: like in
+// the full allocation sinking they only change or read the state of the
+// virtual object.
+//
+// To keep the identity of the object unambiguous allocations that are stored
+// into other allocations are never handled: the other allocation might fail
+// to be sunk and then would keep a reference to the original object.
+bool AllocationSinking::CollectEscapePoints(Definition* alloc) {
+  if (!FLAG_partial_escape_analysis ||
+      !alloc->IsAllocateObject() ||
+      (alloc->ArgumentCount() > 0)) {
+    return false;
+  }
+
+  BlockEntryInstr* alloc_block = alloc->GetBlock();
+  GrowableArray<Instruction*> escapes(2);
+  for (Value* use = alloc->input_use_list();
+       use != NULL;
+       use = use->next_use()) {
+    Instruction* instr = use->instruction();
+    StoreInstanceFieldInstr* store = instr->AsStoreInstanceField();
+    if (store != NULL) {
+      if (use != store->value()) {
+        continue;  // Store into the object itself.
+      }
+      Definition* instance = store->instance()->definition();
+      if ((instance == alloc) ||
+          instance->IsAllocateObject() ||
+          instance->IsAllocateUninitializedContext()) {
+        return false;
+      }
+    } else if (instr->IsPhi()) {
+      // Phis must be dominated by an escape point. Checked below.
+      continue;
+    } else if (instr->IsLoadField() &&
+               (instr->AsLoadField()->instance()->definition() == alloc)) {
+      // Load from the object itself. Loads before the escape point will be
+      // forwarded, loads after it are redirected to the copy.
+      continue;
+    }
+
+    // Keep only escape points that are not dominated by other escape points.
+    bool is_dominated = false;
+    for (intptr_t i = 0; i < escapes.length(); i++) {
+      if (InstructionDominates(escapes[i], instr)) {
+        is_dominated = true;
+        break;
+      }
+    }
+    if (is_dominated) {
+      continue;
+    }
+    intptr_t j = 0;
+    for (intptr_t i = 0; i < escapes.length(); i++) {
+      if (!InstructionDominates(instr, escapes[i])) {
+        escapes[j++] = escapes[i];
+      }
+    }
+    escapes.TruncateTo(j);
+    escapes.Add(instr);
+  }
+
+  if (escapes.is_empty()) {
+    return false;
+  }
+
+  for (Value* use = alloc->input_use_list();
+       use != NULL;
+       use = use->next_use()) {
+    if (use->instruction()->IsPhi()) {
+      bool is_dominated = false;
+      for (intptr_t i = 0; i < escapes.length(); i++) {
+        if (InstructionDominates(escapes[i], use->instruction())) {
+          is_dominated = true;
+          break;
+        }
+      }
+      if (!is_dominated) {
+        return false;
+      }
+    }
+  }
+
+  for (intptr_t i = 0; i < escapes.length(); i++) {
+    Instruction* escape = escapes[i];
+    BlockEntryInstr* escape_block = escape->GetBlock();
+    if (escape_block == alloc_block) {
+      // The object escapes on every path: nothing to gain.
+      return false;
+    }
+
+    BitVector* reachable =
+        ReachableBlocks(flow_graph_, escape_block, alloc_block);
+    if (reachable->Contains(escape_block->preorder_number())) {
+      // Escape point might be executed several times for the same object.
+      return false;
+    }
+
+    for (intptr_t k = 0; k < 2; k++) {
+      for (Value* use = (k == 0) ? alloc->input_use_list()
+                                 : alloc->env_use_list();
+           use != NULL;
+           use = use->next_use()) {
+        Instruction* instr = use->instruction();
+        if (reachable->Contains(instr->GetBlock()->preorder_number()) &&
+            !InstructionDominates(escape, instr)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  if (FLAG_support_il_printer && FLAG_trace_optimization) {
+    for (intptr_t i = 0; i < escapes.length(); i++) {
+      THR_Print("allocation v%" Pd " partially escapes at %s\n",
+                alloc->ssa_temp_index(),
+                escapes[i]->ToCString());
+    }
+  }
+
+  for (intptr_t i = 0; i < escapes.length(); i++) {
+    escaping_allocations_.Add(alloc);
+    escape_points_.Add(escapes[i]);
+  }
+  return true;
+}
+
+
+bool AllocationSinking::HasEscapePoints(Definition* alloc) const {
+  for (intptr_t i = 0; i < escaping_allocations_.length(); i++) {
+    if (escaping_allocations_[i] == alloc) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void AllocationSinking::MaterializeAtEscapePoints(Definition* alloc) {
+  // Collect a store for every field that is written for this instance.
+  GrowableArray<StoreInstanceFieldInstr*> stores(5);
+  for (Value* use = alloc->input_use_list();
+       use != NULL;
+       use = use->next_use()) {
+    StoreInstanceFieldInstr* store = use->instruction()->AsStoreInstanceField();
+    if ((store != NULL) && (store->instance()->definition() == alloc)) {
+      bool is_new_slot = true;
+      for (intptr_t i = 0; i < stores.length(); i++) {
+        if (stores[i]->offset_in_bytes() == store->offset_in_bytes()) {
+          is_new_slot = false;
+          break;
+        }
+      }
+      if (is_new_slot) {
+        stores.Add(store);
+      }
+    }
+  }
+
+  for (intptr_t i = 0; i < escaping_allocations_.length(); i++) {
+    if (escaping_allocations_[i] == alloc) {
+      MaterializeAtEscapePoint(escape_points_[i], alloc, stores);
+    }
+  }
+}
+
+
+// Insert a copy of the given allocation before the escape point:
+//   v_1     <- AllocateObject
+//   v_2     <- LoadField(v_0, field_1)
+//              StoreInstanceField(v_1, field_1, v_2)
+//              ...
+// and replace all uses of the original allocation v_0 dominated by the escape
+// point with v_1. Inserted loads are eliminated by load forwarding.
+void AllocationSinking::MaterializeAtEscapePoint(
+    Instruction* escape,
+    Definition* alloc,
+    const GrowableArray<StoreInstanceFieldInstr*>& stores) {
+  AllocateObjectInstr* alloc_object = alloc->AsAllocateObject();
+  AllocateObjectInstr* copy = new(Z) AllocateObjectInstr(
+      alloc_object->token_pos(),
+      alloc_object->cls(),
+      new(Z) ZoneGrowableArray<PushArgumentInstr*>(0));
+  copy->set_closure_function(alloc_object->closure_function());
+  flow_graph_->InsertBefore(escape, copy, NULL, FlowGraph::kValue);
+
+  for (intptr_t i = 0; i < stores.length(); i++) {
+    StoreInstanceFieldInstr* store = stores[i];
+    LoadFieldInstr* load = NULL;
+    StoreInstanceFieldInstr* init = NULL;
+    if (!store->field().IsNull()) {
+      load = new(Z) LoadFieldInstr(new(Z) Value(alloc),
+                                   &store->field(),
+                                   AbstractType::ZoneHandle(Z),
+                                   alloc->token_pos());
+      init = new(Z) StoreInstanceFieldInstr(store->field(),
+                                            new(Z) Value(copy),
+                                            new(Z) Value(load),
+                                            kEmitStoreBarrier,
+                                            alloc->token_pos());
+      init->set_is_potential_unboxed_initialization(true);
+    } else {
+      load = new(Z) LoadFieldInstr(new(Z) Value(alloc),
+                                   store->offset_in_bytes(),
+                                   AbstractType::ZoneHandle(Z),
+                                   alloc->token_pos());
+      init = new(Z) StoreInstanceFieldInstr(store->offset_in_bytes(),
+                                            new(Z) Value(copy),
+                                            new(Z) Value(load),
+                                            kEmitStoreBarrier,
+                                            alloc->token_pos());
+    }
+    flow_graph_->InsertBefore(escape, load, NULL, FlowGraph::kValue);
+    flow_graph_->InsertBefore(escape, init, NULL, FlowGraph::kEffect);
+  }
+
+  if (FLAG_trace_optimization) {
+    THR_Print("materializing v%" Pd " as v%" Pd " at escape point\n",
+              alloc->ssa_temp_index(),
+              copy->ssa_temp_index());
+  }
+
+  Value* next_use;
+  for (Value* use = alloc->input_use_list(); use != NULL; use = next_use) {
+    next_use = use->next_use();
+    if (InstructionDominates(escape, use->instruction())) {
+      use->BindTo(copy);
+    }
+  }
+  for (Value* use = alloc->env_use_list(); use != NULL; use = next_use) {
+    next_use = use->next_use();
+    if (InstructionDominates(escape, use->instruction())) {
+      use->RemoveFromUseList();
+      use->set_definition(copy);
+      copy->AddEnvUse(use);
+    }
+  }
 }
 
 
@@ -2903,6 +3219,24 @@ void AllocationSinking::NormalizeMaterializations() {
 }
 
 
+// Loads inserted by CreateMaterializationAt are used only by
+// materializations, while loads inserted by MaterializeAtEscapePoint
+// initialize real objects.
+static bool HasOnlyMaterializationUses(Definition* defn) {
+  if (defn->env_use_list() != NULL) {
+    return false;
+  }
+  for (Value* use = defn->input_use_list();
+       use != NULL;
+       use = use->next_use()) {
+    if (!use->instruction()->IsMaterializeObject()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 // We transitively insert materializations at each deoptimization exit that
 // might see the given allocation (see ExitsCollector). Some of this
 // materializations are not actually used and some fail to compute because
@@ -2920,7 +3254,8 @@ void AllocationSinking::RemoveUnusedMaterializations() {
       for (intptr_t i = 0; i < mat->InputCount(); i++) {
         LoadFieldInstr* load = mat->InputAt(i)->definition()->AsLoadField();
         if ((load != NULL) &&
-            (load->instance()->definition() == mat->allocation())) {
+            (load->instance()->definition() == mat->allocation()) &&
+            HasOnlyMaterializationUses(load)) {
           load->ReplaceUsesWith(flow_graph_->constant_null());
           load->RemoveFromGraph();
         }
@@ -2985,9 +3320,13 @@ void AllocationSinking::DiscoverFailedCandidates() {
            use != NULL;
            use = use->next_use()) {
         if (use->instruction()->IsLoadField()) {
+          // Loads that initialize copies inserted at escape points are
+          // preserved: the allocation stays in the graph.
           LoadFieldInstr* load = use->instruction()->AsLoadField();
-          load->ReplaceUsesWith(flow_graph_->constant_null());
-          load->RemoveFromGraph();
+          if (HasOnlyMaterializationUses(load)) {
+            load->ReplaceUsesWith(flow_graph_->constant_null());
+            load->RemoveFromGraph();
+          }
         } else {
           ASSERT(use->instruction()->IsMaterializeObject() ||
                  use->instruction()->IsPhi() ||
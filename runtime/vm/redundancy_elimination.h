@@ -17,7 +17,9 @@ class AllocationSinking : public ZoneAllocated {
   explicit AllocationSinking(FlowGraph* flow_graph)
       : flow_graph_(flow_graph),
         candidates_(5),
-        materializations_(5) { }
+        materializations_(5),
+        escaping_allocations_(5),
+        escape_points_(5) { }
 
   const GrowableArray<Definition*>& candidates() const {
     return candidates_;
@@ -58,6 +60,22 @@ class AllocationSinking : public ZoneAllocated {
 
   void CollectCandidates();
 
+  // Partial escape analysis: check if the given allocation escapes only
+  // on some paths through the graph and record the instructions at which
+  // it escapes. See comment in the implementation for details.
+  bool CollectEscapePoints(Definition* alloc);
+
+  bool HasEscapePoints(Definition* alloc) const;
+
+  // Replace the given allocation with a fresh copy at each of its escape
+  // points.
+  void MaterializeAtEscapePoints(Definition* alloc);
+
+  void MaterializeAtEscapePoint(
+      Instruction* escape,
+      Definition* alloc,
+      const GrowableArray<StoreInstanceFieldInstr*>& stores);
+
   void NormalizeMaterializations();
 
   void RemoveUnusedMaterializations();
@@ -81,6 +99,11 @@ class AllocationSinking : public ZoneAllocated {
   GrowableArray<Definition*> candidates_;
   GrowableArray<MaterializeObjectInstr*> materializations_;
 
+  // Escape points of partially escaping candidates: an allocation
+  // escaping_allocations_[i] escapes at escape_points_[i].
+  GrowableArray<Definition*> escaping_allocations_;
+  GrowableArray<Instruction*> escape_points_;
+
   ExitsCollector exits_collector_;
 };
 
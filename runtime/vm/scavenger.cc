@@ -4,6 +4,7 @@
 
 #include "vm/scavenger.h"
 
+#include "vm/allocation_sampler.h"
 #include "vm/dart.h"
 #include "vm/dart_api_state.h"
 #include "vm/isolate.h"
@@ -353,6 +354,8 @@ Scavenger::Scavenger(Heap* heap,
   top_ = FirstObjectStart();
   resolved_top_ = top_;
   end_ = to_->end();
+  sample_point_ = 0;
+  sample_address_ = 0;
 
   survivor_end_ = FirstObjectStart();
 
@@ -784,6 +787,18 @@ void Scavenger::Scavenge(bool invoke_api_callbacks) {
   ASSERT(!scavenging_);
   scavenging_ = true;
 
+  // Copying objects uses the whole to-space. The sample point is moved to
+  // the same distance from the new allocation top afterwards.
+  const bool has_sample_point = HasSamplePoint();
+  const intptr_t bytes_until_sample = has_sample_point ?
+      Utils::Maximum(BytesUntilSamplePoint(),
+                     static_cast<intptr_t>(kObjectAlignment)) : 0;
+  sample_point_ = 0;
+  // The allocation of a pending sample may be moved by this scavenge, so it
+  // can no longer be matched.
+  const bool had_pending_sample = HasPendingSample();
+  sample_address_ = 0;
+
   PageSpace* page_space = heap_->old_space();
   NoSafepointScope no_safepoints;
 
@@ -840,6 +855,50 @@ void Scavenger::Scavenge(bool invoke_api_callbacks) {
   // Done scavenging. Reset the marker.
   ASSERT(scavenging_);
   scavenging_ = false;
+
+  if (has_sample_point) {
+    SetSamplePoint(bytes_until_sample);
+  } else if (had_pending_sample) {
+    // Sampling continues at a new sample point instead of charging the
+    // dropped sample to a later allocation.
+    AllocationSampler* sampler = heap_->isolate()->allocation_sampler();
+    if (sampler != NULL) {
+      sampler->ScheduleNextSample();
+    }
+  }
+}
+
+
+void Scavenger::SetSamplePoint(intptr_t bytes_until_sample) {
+  ASSERT(!scavenging_);
+  ASSERT(bytes_until_sample > 0);
+  sample_point_ = top_ + bytes_until_sample;
+  // The sample point may lie beyond the end of the to-space, in which case
+  // it is reached after the next scavenge.
+  end_ = Utils::Minimum(sample_point_, to_->end());
+}
+
+
+void Scavenger::ClearSamplePoint() {
+  ASSERT(!scavenging_);
+  sample_point_ = 0;
+  end_ = to_->end();
+}
+
+
+uword Scavenger::TryAllocateAtSamplePoint(intptr_t size) {
+  ASSERT(HasSamplePoint());
+  if (scavenging_ ||
+      (end_ == to_->end()) ||
+      (static_cast<intptr_t>(to_->end() - top_) < size)) {
+    // The to-space is exhausted. The sample point is kept, so that the
+    // scavenge moves it along with the allocation top.
+    return 0;
+  }
+  // This allocation crosses the sample point.
+  ClearSamplePoint();
+  sample_address_ = TryAllocate(size);
+  return sample_address_;
 }
 
 
@@ -134,7 +134,7 @@ class Scavenger {
     uword result = top_;
     intptr_t remaining = end_ - top_;
     if (remaining < size) {
-      return 0;
+      return (sample_point_ == 0) ? 0 : TryAllocateAtSamplePoint(size);
     }
     ASSERT(to_->Contains(result));
     ASSERT((result & kObjectAlignmentMask) == object_alignment_);
@@ -155,6 +155,27 @@ class Scavenger {
     ASSERT(UsedInWords() == 0);
   }
 
+  // Allocation sampling support, see AllocationSampler. While a sample point
+  // is set, end_ is lowered to it so that the allocation crossing it misses
+  // inline allocation and takes the slow path, where it clears the sample
+  // point and records the address of the allocation as the pending sample.
+  // The pending sample is dropped by the next scavenge.
+  void SetSamplePoint(intptr_t bytes_until_sample);
+  void ClearSamplePoint();
+  bool HasSamplePoint() const { return sample_point_ != 0; }
+  intptr_t BytesUntilSamplePoint() const {
+    ASSERT(HasSamplePoint());
+    return sample_point_ - top_;
+  }
+  bool HasPendingSample() const { return sample_address_ != 0; }
+  // Clears the pending sample and returns whether it is the allocation at
+  // 'address'.
+  bool TakePendingSample(uword address) {
+    const bool is_sample = (sample_address_ == address);
+    sample_address_ = 0;
+    return is_sample;
+  }
+
   // Accessors to generate code for inlined allocation.
   uword* TopAddress() { return &top_; }
   uword* EndAddress() { return &end_; }
@@ -269,11 +290,19 @@ class Scavenger {
 
   intptr_t NewSizeInWords(intptr_t old_size_in_words) const;
 
+  uword TryAllocateAtSamplePoint(intptr_t size);
+
   // Current allocation top and end. These values are being accessed directly
   // from generated code.
   uword top_;
   uword end_;
 
+  // Address at which the next allocation is sampled or 0.
+  uword sample_point_;
+  // Address of the allocation that crossed the sample point and is still to
+  // be sampled, or 0.
+  uword sample_address_;
+
   SemiSpace* to_;
 
   Heap* heap_;
@@ -8,6 +8,7 @@
 #include "include/dart_native_api.h"
 #include "platform/globals.h"
 
+#include "vm/allocation_sampler.h"
 #include "vm/compiler.h"
 #include "vm/cpu.h"
 #include "vm/dart_api_impl.h"
@@ -2302,6 +2303,7 @@ static const char* const report_enum_names[] = {
   SourceReport::kCoverageStr,
   SourceReport::kPossibleBreakpointsStr,
   SourceReport::kProfileStr,
+  SourceReport::kCoverageDeltaStr,
   NULL,
 };
 
@@ -2337,6 +2339,8 @@ static bool GetSourceReport(Thread* thread, JSONStream* js) {
       report_set |= SourceReport::kPossibleBreakpoints;
     } else if (strcmp(*reports, SourceReport::kProfileStr) == 0) {
       report_set |= SourceReport::kProfile;
+    } else if (strcmp(*reports, SourceReport::kCoverageDeltaStr) == 0) {
+      report_set |= SourceReport::kCoverageDelta;
     }
     reports++;
   }
@@ -3097,6 +3101,24 @@ static bool GetCpuProfileTimeline(Thread* thread, JSONStream* js) {
 }
 
 
+static const MethodParameter* get_cpu_profile_pprof_params[] = {
+  RUNNABLE_ISOLATE_PARAMETER,
+  new Int64Parameter("timeOriginMicros", false),
+  new Int64Parameter("timeExtentMicros", false),
+  NULL,
+};
+
+
+static bool GetCpuProfilePprof(Thread* thread, JSONStream* js) {
+  int64_t time_origin_micros =
+      Int64Parameter::Parse(js->LookupParam("timeOriginMicros"));
+  int64_t time_extent_micros =
+      Int64Parameter::Parse(js->LookupParam("timeExtentMicros"));
+  ProfilerService::PrintPprofJSON(js, time_origin_micros, time_extent_micros);
+  return true;
+}
+
+
 static const MethodParameter* get_allocation_samples_params[] = {
   RUNNABLE_ISOLATE_PARAMETER,
   new EnumParameter("tags", true, tags_enum_names),
@@ -3184,6 +3206,55 @@ static bool GetAllocationProfile(Thread* thread, JSONStream* js) {
 }
 
 
+static const MethodParameter* get_sampled_allocation_profile_params[] = {
+  RUNNABLE_ISOLATE_PARAMETER,
+  new BoolParameter("collectGarbage", false /* not required */),
+  NULL,
+};
+
+
+static bool GetSampledAllocationProfile(Thread* thread, JSONStream* js) {
+  const bool collect_garbage =
+      BoolParameter::Parse(js->LookupParam("collectGarbage"), false);
+  Isolate* isolate = thread->isolate();
+  if (collect_garbage) {
+    // Finalizes the samples of unreachable objects.
+    isolate->heap()->CollectAllGarbage();
+  }
+  AllocationSampler* sampler = isolate->allocation_sampler();
+  if (sampler != NULL) {
+    sampler->PrintJSON(js);
+  } else {
+    JSONObject jsobj(js);
+    jsobj.AddProperty("type", "_AllocationSamples");
+    jsobj.AddProperty("samplingInterval", static_cast<intptr_t>(0));
+    jsobj.AddProperty("sampleCount", static_cast<intptr_t>(0));
+    JSONArray members(&jsobj, "members");
+  }
+  return true;
+}
+
+
+static const MethodParameter* set_allocation_sample_interval_params[] = {
+  RUNNABLE_ISOLATE_PARAMETER,
+  new UIntParameter("interval", true),
+  NULL,
+};
+
+
+static bool SetAllocationSampleInterval(Thread* thread, JSONStream* js) {
+  const intptr_t interval =
+      UIntParameter::Parse(js->LookupParam("interval"));
+  if (interval < 0) {
+    PrintInvalidParamError(js, "interval");
+    return true;
+  }
+  thread->isolate()->SetAllocationSampleInterval(interval);
+  PrintSuccess(js);
+  return true;
+}
+
+
 static const MethodParameter* get_heap_map_params[] = {
   RUNNABLE_ISOLATE_PARAMETER,
   NULL,
@@ -3966,6 +4037,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_class_list_params },
   { "_getCpuProfile", GetCpuProfile,
     get_cpu_profile_params },
+  { "_getCpuProfilePprof", GetCpuProfilePprof,
+    get_cpu_profile_pprof_params },
   { "_getCpuProfileTimeline", GetCpuProfileTimeline,
     get_cpu_profile_timeline_params },
   { "getFlagList", GetFlagList,
@@ -3998,6 +4071,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_retained_size_params },
   { "_getRetainingPath", GetRetainingPath,
     get_retaining_path_params },
+  { "_getSampledAllocationProfile", GetSampledAllocationProfile,
+    get_sampled_allocation_profile_params },
   { "getSourceReport", GetSourceReport,
     get_source_report_params },
   { "getStack", GetStack,
@@ -4030,6 +4105,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     resume_params },
   { "_requestHeapSnapshot", RequestHeapSnapshot,
     request_heap_snapshot_params },
+  { "_setAllocationSampleInterval", SetAllocationSampleInterval,
+    set_allocation_sample_interval_params },
   { "setExceptionPauseMode", SetExceptionPauseMode,
     set_exception_pause_mode_params },
   { "_setFlag", SetFlag,
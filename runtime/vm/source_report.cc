@@ -17,6 +17,7 @@ const char* SourceReport::kCallSitesStr = "_CallSites";
 const char* SourceReport::kCoverageStr = "Coverage";
 const char* SourceReport::kPossibleBreakpointsStr = "PossibleBreakpoints";
 const char* SourceReport::kProfileStr = "_Profile";
+const char* SourceReport::kCoverageDeltaStr = "_CoverageDelta";
 
 SourceReport::SourceReport(intptr_t report_set, CompileMode compile_mode)
     : report_set_(report_set),
@@ -223,33 +224,50 @@ void SourceReport::PrintCoverageData(JSONObject* jsobj,
     coverage[i] = kCoverageNone;
   }
 
-  PcDescriptors::Iterator iter(
-      descriptors,
-      RawPcDescriptors::kIcCall | RawPcDescriptors::kUnoptStaticCall);
-  while (iter.MoveNext()) {
-    HANDLESCOPE(thread());
-    // TODO(zra): Remove this bailout once DBC has reliable ICData.
-#if defined(TARGET_ARCH_DBC)
-    if (iter.DeoptId() >= ic_data_array->length()) {
-      continue;
+  const Array& probes = Array::Handle(zone(), function.coverage_array());
+  if (!probes.IsNull()) {
+    // Unlike the ICData, the coverage probes also record the calls made by
+    // optimized and inlined code.
+    ASSERT(probes.Length() == func_length);
+    Smi& state = Smi::Handle(zone());
+    for (intptr_t i = 0; i < func_length; i++) {
+      if (probes.At(i) == Object::null()) {
+        continue;
+      }
+      state ^= probes.At(i);
+      coverage[i] = (state.Value() >= Function::kCoverageProbeHit)
+          ? kCoverageHit
+          : kCoverageMiss;
     }
-#else
-    ASSERT(iter.DeoptId() < ic_data_array->length());
-#endif
-    const ICData* ic_data = (*ic_data_array)[iter.DeoptId()];
-    if (ic_data != NULL) {
-      const TokenPosition token_pos = iter.TokenPos();
-      if ((token_pos < begin_pos) || (token_pos > end_pos)) {
-        // Does not correspond to a valid source position.
+  } else {
+    PcDescriptors::Iterator iter(
+        descriptors,
+        RawPcDescriptors::kIcCall | RawPcDescriptors::kUnoptStaticCall);
+    while (iter.MoveNext()) {
+      HANDLESCOPE(thread());
+      // TODO(zra): Remove this bailout once DBC has reliable ICData.
+#if defined(TARGET_ARCH_DBC)
+      if (iter.DeoptId() >= ic_data_array->length()) {
         continue;
       }
-      intptr_t count = ic_data->AggregateCount();
-      intptr_t token_offset = token_pos.Pos() - begin_pos.Pos();
-      if (count > 0) {
-        coverage[token_offset] = kCoverageHit;
-      } else {
-        if (coverage[token_offset] == kCoverageNone) {
-          coverage[token_offset] = kCoverageMiss;
+#else
+      ASSERT(iter.DeoptId() < ic_data_array->length());
+#endif
+      const ICData* ic_data = (*ic_data_array)[iter.DeoptId()];
+      if (ic_data != NULL) {
+        const TokenPosition token_pos = iter.TokenPos();
+        if ((token_pos < begin_pos) || (token_pos > end_pos)) {
+          // Does not correspond to a valid source position.
+          continue;
+        }
+        intptr_t count = ic_data->AggregateCount();
+        intptr_t token_offset = token_pos.Pos() - begin_pos.Pos();
+        if (count > 0) {
+          coverage[token_offset] = kCoverageHit;
+        } else {
+          if (coverage[token_offset] == kCoverageNone) {
+            coverage[token_offset] = kCoverageMiss;
+          }
         }
       }
     }
@@ -369,6 +387,45 @@ void SourceReport::PrintProfileData(JSONObject* jsobj,
 }
 
 
+void SourceReport::PrintCoverageDeltaData(JSONObject* jsobj,
+                                          const Function& function) {
+  const TokenPosition begin_pos = function.token_pos();
+  const Array& probes = Array::Handle(zone(), function.coverage_array());
+
+  JSONObject delta(jsobj, "coverageDelta");
+  JSONArray hits(&delta, "hits");
+  if (probes.IsNull()) {
+    return;
+  }
+  // Report the positions hit since the last delta and reset them, so that
+  // the next delta only contains the positions executed in between.
+  RawSmi* hit = Smi::New(Function::kCoverageProbeHit);
+  const Smi& reported =
+      Smi::Handle(zone(), Smi::New(Function::kCoverageProbeHitReported));
+  for (intptr_t i = 0; i < probes.Length(); i++) {
+    if (probes.At(i) == hit) {
+      hits.AddValue(begin_pos.Pos() + i);
+      probes.SetAt(i, reported);
+    }
+  }
+}
+
+
+bool SourceReport::HasCoverageDelta(const Function& func) {
+  const Array& probes = Array::Handle(zone(), func.coverage_array());
+  if (probes.IsNull()) {
+    return false;
+  }
+  RawSmi* hit = Smi::New(Function::kCoverageProbeHit);
+  for (intptr_t i = 0; i < probes.Length(); i++) {
+    if (probes.At(i) == hit) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
 void SourceReport::PrintScriptTable(JSONArray* scripts) {
   for (intptr_t i = 0; i < script_table_entries_.length(); i++) {
     const Script* script = script_table_entries_[i]->script;
@@ -386,6 +443,24 @@ void SourceReport::VisitFunction(JSONArray* jsarr, const Function& func) {
   const TokenPosition begin_pos = func.token_pos();
   const TokenPosition end_pos = func.end_token_pos();
 
+  if (report_set_ == kCoverageDelta) {
+    // Coverage deltas are polled while the program runs. Only report the
+    // functions with new hits, and do not compile anything.
+    if (func.IsAsyncFunction() ||
+        func.IsAsyncGenerator() ||
+        func.IsSyncGenerator() ||
+        !HasCoverageDelta(func)) {
+      return;
+    }
+    JSONObject range(jsarr);
+    range.AddProperty("scriptIndex", GetScriptIndex(script));
+    range.AddProperty("startPos", begin_pos);
+    range.AddProperty("endPos", end_pos);
+    range.AddProperty("compiled", true);
+    PrintCoverageDeltaData(&range, func);
+    return;
+  }
+
   Code& code = Code::Handle(zone(), func.unoptimized_code());
   if (code.IsNull()) {
     if (func.HasCode() || (compile_mode_ == kForceCompile)) {
@@ -438,6 +513,9 @@ void SourceReport::VisitFunction(JSONArray* jsarr, const Function& func) {
   if (IsReportRequested(kPossibleBreakpoints)) {
     PrintPossibleBreakpointsData(&range, func, code);
   }
+  if (IsReportRequested(kCoverageDelta)) {
+    PrintCoverageDeltaData(&range, func);
+  }
   if (IsReportRequested(kProfile)) {
     ProfileFunction* profile_function = profile_.FindFunction(func);
     if ((profile_function != NULL) &&
@@ -457,6 +535,10 @@ void SourceReport::VisitLibrary(JSONArray* jsarr, const Library& lib) {
   while (it.HasNext()) {
     cls = it.GetNextClass();
     if (!cls.is_finalized()) {
+      if (report_set_ == kCoverageDelta) {
+        // No function of the class has run yet.
+        continue;
+      }
       if (compile_mode_ == kForceCompile) {
         const Error& err = Error::Handle(cls.EnsureIsFinalized(thread()));
         if (!err.IsNull()) {
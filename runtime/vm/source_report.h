@@ -24,12 +24,14 @@ class SourceReport {
     kCoverage            = 0x2,
     kPossibleBreakpoints = 0x4,
     kProfile             = 0x8,
+    kCoverageDelta       = 0x10,
   };
 
   static const char* kCallSitesStr;
   static const char* kCoverageStr;
   static const char* kPossibleBreakpointsStr;
   static const char* kProfileStr;
+  static const char* kCoverageDeltaStr;
 
   enum CompileMode {
     kNoCompile,
@@ -71,6 +73,8 @@ class SourceReport {
   void PrintPossibleBreakpointsData(JSONObject* jsobj,
                                     const Function& func, const Code& code);
   void PrintProfileData(JSONObject* jsobj, ProfileFunction* profile_function);
+  void PrintCoverageDeltaData(JSONObject* jsobj, const Function& func);
+  bool HasCoverageDelta(const Function& func);
 #if defined(DEBUG)
   void VerifyScriptTable();
 #endif
@@ -8,6 +8,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, coverage_probes);
+
 #ifndef PRODUCT
 
 static RawObject* ExecuteScript(const char* script) {
@@ -97,6 +99,117 @@ TEST_CASE(SourceReport_Coverage_SimpleCall) {
 }
 
 
+TEST_CASE(SourceReport_Coverage_Probes) {
+  char buffer[1024];
+  const char* kScript =
+      "helper0() {}\n"
+      "helper1() {}\n"
+      "main() {\n"
+      "  if (true) {\n"
+      "    helper0();\n"
+      "  } else {\n"
+      "    helper1();\n"
+      "  }\n"
+      "}";
+
+  const bool old_flag = FLAG_coverage_probes;
+  FLAG_coverage_probes = true;
+  Library& lib = Library::Handle();
+  lib ^= ExecuteScript(kScript);
+  ASSERT(!lib.IsNull());
+  const Script& script = Script::Handle(lib.LookupScript(
+      String::Handle(String::New("test-lib"))));
+
+  SourceReport report(SourceReport::kCoverage);
+  JSONStream js;
+  report.PrintJSON(&js, script);
+  ElideJSONSubstring("classes", js.ToCString(), buffer);
+  ElideJSONSubstring("libraries", buffer, buffer);
+  EXPECT_STREQ(
+      "{\"type\":\"SourceReport\",\"ranges\":["
+
+      // The entry of helper0 is a hit.
+      "{\"scriptIndex\":0,\"startPos\":0,\"endPos\":4,\"compiled\":true,"
+      "\"coverage\":{\"hits\":[0],\"misses\":[]}},"
+
+      // One range not compiled (helper1).
+      "{\"scriptIndex\":0,\"startPos\":6,\"endPos\":10,\"compiled\":false},"
+
+      // The entry and the call to helper0 are hits (main).
+      "{\"scriptIndex\":0,\"startPos\":12,\"endPos\":39,\"compiled\":true,"
+      "\"coverage\":{\"hits\":[12,23],\"misses\":[32]}}],"
+
+      // Only one script in the script table.
+      "\"scripts\":[{\"type\":\"@Script\",\"fixedId\":true,\"id\":\"\","
+      "\"uri\":\"test-lib\",\"_kind\":\"script\"}]}",
+      buffer);
+  FLAG_coverage_probes = old_flag;
+}
+
+
+TEST_CASE(SourceReport_CoverageDelta) {
+  char buffer[1024];
+  const char* kScript =
+      "helper0() {}\n"
+      "helper1() {}\n"
+      "main() {\n"
+      "  if (true) {\n"
+      "    helper0();\n"
+      "  } else {\n"
+      "    helper1();\n"
+      "  }\n"
+      "}";
+
+  const bool old_flag = FLAG_coverage_probes;
+  FLAG_coverage_probes = true;
+  Library& lib = Library::Handle();
+  lib ^= ExecuteScript(kScript);
+  ASSERT(!lib.IsNull());
+  const Script& script = Script::Handle(lib.LookupScript(
+      String::Handle(String::New("test-lib"))));
+
+  {
+    SourceReport report(SourceReport::kCoverageDelta);
+    JSONStream js;
+    report.PrintJSON(&js, script);
+    ElideJSONSubstring("classes", js.ToCString(), buffer);
+    ElideJSONSubstring("libraries", buffer, buffer);
+    EXPECT_STREQ(
+        "{\"type\":\"SourceReport\",\"ranges\":["
+
+        // Only the ranges with new hits are reported.
+        "{\"scriptIndex\":0,\"startPos\":0,\"endPos\":4,\"compiled\":true,"
+        "\"coverageDelta\":{\"hits\":[0]}},"
+        "{\"scriptIndex\":0,\"startPos\":12,\"endPos\":39,"
+        "\"compiled\":true,\"coverageDelta\":{\"hits\":[12,23]}}],"
+
+        "\"scripts\":[{\"type\":\"@Script\",\"fixedId\":true,\"id\":\"\","
+        "\"uri\":\"test-lib\",\"_kind\":\"script\"}]}",
+        buffer);
+  }
+  {
+    // Nothing ran since the last delta.
+    SourceReport report(SourceReport::kCoverageDelta);
+    JSONStream js;
+    report.PrintJSON(&js, script);
+    EXPECT_STREQ("{\"type\":\"SourceReport\",\"ranges\":[],"
+                 "\"scripts\":[]}",
+                 js.ToCString());
+  }
+  EXPECT_VALID(Dart_Invoke(Api::NewHandle(thread, lib.raw()),
+                           NewString("main"), 0, NULL));
+  {
+    SourceReport report(SourceReport::kCoverage | SourceReport::kCoverageDelta);
+    JSONStream js;
+    report.PrintJSON(&js, script);
+    EXPECT_SUBSTRING("\"coverage\":{\"hits\":[12,23],\"misses\":[32]},"
+                     "\"coverageDelta\":{\"hits\":[12,23]}",
+                     js.ToCString());
+  }
+  FLAG_coverage_probes = old_flag;
+}
+
+
 TEST_CASE(SourceReport_Coverage_ForceCompile) {
   char buffer[1024];
   const char* kScript =
@@ -1822,6 +1822,25 @@ static void GenerateSubtypeNTestCacheStub(Assembler* assembler, int n) {
   __ movq(RDX, Address(RSP, kCacheOffsetInBytes));
   // RDX: SubtypeTestCache.
   __ movq(RDX, FieldAddress(RDX, SubtypeTestCache::cache_offset()));
+  // RDX: cache array.
+  // Hashed caches have a length that is not a multiple of the entry length
+  // and store the hash mask in the last element. Start probing hashed caches
+  // at the entry selected by the instance class id (see SubtypeTestCache).
+  ASSERT(Utils::IsPowerOfTwo(SubtypeTestCache::kTestEntryLength));
+  Label probe;
+  __ movq(RDI, FieldAddress(RDX, Array::length_offset()));
+  __ testq(RDI,
+           Immediate(Smi::RawValue(SubtypeTestCache::kTestEntryLength - 1)));
+  __ j(ZERO, &probe, Assembler::kNearJump);
+  // RDI: Smi length, TIMES_4 scales it to bytes.
+  __ movq(RDI, FieldAddress(RDX, RDI, TIMES_4,
+                            Array::data_offset() - kWordSize));
+  __ SmiUntag(RDI);
+  __ andq(RDI, R10);
+  __ shlq(RDI, Immediate(Utils::ShiftForPowerOfTwo(
+      kWordSize * SubtypeTestCache::kTestEntryLength)));
+  __ addq(RDX, RDI);
+  __ Bind(&probe);
   __ addq(RDX, Immediate(Array::data_offset() - kHeapObjectTag));
   // RDX: Entry start.
   // R10: instance class id.
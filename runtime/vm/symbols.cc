@@ -527,11 +527,15 @@ RawString* Symbols::FromConcatAll(Thread* thread,
       intptr_t str_len = lengths[i];
       if (str_len > 0) {
         const String& str = strs[i];
-        ASSERT(str.IsOneByteString() || str.IsExternalOneByteString());
-        const uint8_t* src_p = str.IsOneByteString() ?
-            OneByteString::CharAddr(str, 0) :
-            ExternalOneByteString::CharAddr(str, 0);
-        memmove(buffer, src_p, str_len);
+        if (str.IsConsString()) {
+          ConsString::CopyChars(str, 0, str_len, buffer);
+        } else {
+          ASSERT(str.IsOneByteString() || str.IsExternalOneByteString());
+          const uint8_t* src_p = str.IsOneByteString() ?
+              OneByteString::CharAddr(str, 0) :
+              ExternalOneByteString::CharAddr(str, 0);
+          memmove(buffer, src_p, str_len);
+        }
         buffer += str_len;
       }
     }
@@ -549,6 +553,8 @@ RawString* Symbols::FromConcatAll(Thread* thread,
           memmove(buffer, TwoByteString::CharAddr(str, 0), str_len * 2);
         } else if (str.IsExternalTwoByteString()) {
           memmove(buffer, ExternalTwoByteString::CharAddr(str, 0), str_len * 2);
+        } else if (str.IsConsString()) {
+          ConsString::CopyChars(str, 0, str_len, buffer);
         } else {
           // One-byte to two-byte string copy.
           ASSERT(str.IsOneByteString() || str.IsExternalOneByteString());
@@ -660,6 +666,11 @@ RawString* Symbols::New(Thread* thread, const String& str) {
   if (str.IsSymbol()) {
     return str.raw();
   }
+  if (str.IsConsString()) {
+    const String& flat = String::Handle(thread->zone(),
+                                        ConsString::Flatten(str));
+    return New(thread, flat, 0, flat.Length());
+  }
   return New(thread, str, 0, str.Length());
 }
 
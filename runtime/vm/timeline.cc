@@ -5,6 +5,8 @@
 #include <cstdlib>
 
 #include "vm/atomic.h"
+#include "vm/dart.h"
+#include "vm/datastream.h"
 #include "vm/isolate.h"
 #include "vm/json_stream.h"
 #include "vm/lockers.h"
@@ -35,7 +37,10 @@ DEFINE_FLAG(charp, timeline_streams, NULL,
             "GC, Isolate, and VM.");
 DEFINE_FLAG(charp, timeline_recorder, "ring",
             "Select the timeline recorder used. "
-            "Valid values: ring, endless, and startup.")
+            "Valid values: ring, endless, startup, and file.")
+DEFINE_FLAG(charp, timeline_file, NULL,
+            "Stream the timeline into the specified file in a binary format. "
+            "Implies --timeline_recorder=file.")
 
 // Implementation notes:
 //
@@ -81,6 +86,26 @@ DEFINE_FLAG(charp, timeline_recorder, "ring",
 
 
 static TimelineEventRecorder* CreateTimelineRecorder() {
+  const bool use_file_recorder = (FLAG_timeline_file != NULL) ||
+      ((FLAG_timeline_recorder != NULL) &&
+       (strcmp("file", FLAG_timeline_recorder) == 0));
+  if (use_file_recorder) {
+    char* path = (FLAG_timeline_file != NULL) ?
+        strdup(FLAG_timeline_file) :
+        OS::SCreate(NULL, "dart-timeline-%" Pd ".dtl", OS::ProcessId());
+    TimelineEventFileRecorder* recorder = new TimelineEventFileRecorder(path);
+    if (recorder->is_open()) {
+      if (FLAG_trace_timeline) {
+        THR_Print("Using the file timeline recorder (%s).\n", path);
+      }
+      free(path);
+      return recorder;
+    }
+    OS::PrintErr("Failed to open timeline file: %s\n", path);
+    free(path);
+    delete recorder;
+  }
+
   // Some flags require that we use the endless recorder.
   const bool use_endless_recorder =
       (FLAG_timeline_dir != NULL) || FLAG_timing || FLAG_complete_timeline;
@@ -1071,7 +1096,7 @@ TimelineEvent* TimelineEventRecorder::ThreadBlockStartEvent() {
     MutexLocker ml(&lock_);
     // Thread has a block and it is full:
     // 1) Mark it as finished.
-    thread_block->Finish();
+    FinishBlockLocked(thread_block);
     // 2) Allocate a new block.
     thread_block = GetNewBlockLocked();
     thread->set_timeline_block(thread_block);
@@ -1203,7 +1228,7 @@ void TimelineEventRecorder::FinishBlock(TimelineEventBlock* block) {
     return;
   }
   MutexLocker ml(&lock_);
-  block->Finish();
+  FinishBlockLocked(block);
 }
 
 
@@ -1548,6 +1573,408 @@ void TimelineEventEndlessRecorder::Clear() {
 }
 
 
+static uint8_t* FileRecorderRealloc(uint8_t* ptr,
+                                    intptr_t old_size,
+                                    intptr_t new_size) {
+  return reinterpret_cast<uint8_t*>(realloc(ptr, new_size));
+}
+
+
+static void WriteLEB128(WriteStream* stream, uint64_t value) {
+  uint8_t bytes[10];
+  intptr_t length = 0;
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    bytes[length++] = byte;
+  } while (value != 0);
+  stream->WriteBytes(bytes, length);
+}
+
+
+static void WriteZigZag(WriteStream* stream, int64_t value) {
+  WriteLEB128(stream, (static_cast<uint64_t>(value) << 1) ^
+                      static_cast<uint64_t>(value >> 63));
+}
+
+
+static void WriteString(WriteStream* stream, const char* string) {
+  const intptr_t length = strlen(string);
+  WriteLEB128(stream, length);
+  stream->WriteBytes(reinterpret_cast<const uint8_t*>(string), length);
+}
+
+
+static uint32_t HashCString(const char* string) {
+  // FNV-1a.
+  uint32_t hash = 2166136261u;
+  for (const char* p = string; *p != '\0'; p++) {
+    hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+  }
+  return hash;
+}
+
+
+TimelineEventFileRecorder::TimelineEventFileRecorder(const char* path,
+                                                     intptr_t capacity)
+    : file_(NULL),
+      blocks_(NULL),
+      num_blocks_(0),
+      free_blocks_(NULL),
+      pending_head_(NULL),
+      pending_tail_(NULL),
+      writing_(false),
+      shutting_down_(false),
+      writer_running_(false),
+      writer_id_(OSThread::kInvalidThreadJoinId),
+      strings_(NULL),
+      strings_capacity_(0),
+      num_strings_(0),
+      last_timestamp_(0) {
+  // Capacity must be a multiple of TimelineEventBlock::kBlockSize
+  ASSERT((capacity % TimelineEventBlock::kBlockSize) == 0);
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  if ((file_open == NULL) ||
+      (Dart::file_write_callback() == NULL) ||
+      (Dart::file_close_callback() == NULL)) {
+    return;
+  }
+  file_ = (*file_open)(path, true);
+  if (file_ == NULL) {
+    return;
+  }
+  num_blocks_ = capacity / TimelineEventBlock::kBlockSize;
+  blocks_ = reinterpret_cast<TimelineEventBlock**>(
+      calloc(num_blocks_, sizeof(TimelineEventBlock*)));
+  for (intptr_t i = num_blocks_ - 1; i >= 0; i--) {
+    blocks_[i] = new TimelineEventBlock(i);
+    blocks_[i]->set_next(free_blocks_);
+    free_blocks_ = blocks_[i];
+  }
+  strings_capacity_ = 256;
+  strings_ = reinterpret_cast<InternedString*>(
+      calloc(strings_capacity_, sizeof(InternedString)));
+
+  uint8_t* buffer = NULL;
+  WriteStream stream(&buffer, FileRecorderRealloc, 64);
+  stream.WriteBytes(reinterpret_cast<const uint8_t*>("DARTTL01"), 8);
+  WriteLEB128(&stream, OS::ProcessId());
+  WriteToFile(&stream);
+  free(buffer);
+
+  MonitorLocker ml(&monitor_);
+  OSThread::Start("TimelineFileWriter", WriterMain,
+                  reinterpret_cast<uword>(this));
+  while (!writer_running_) {
+    ml.Wait();
+  }
+}
+
+
+TimelineEventFileRecorder::~TimelineEventFileRecorder() {
+  if (file_ == NULL) {
+    return;
+  }
+  if (Timeline::recorder() == this) {
+    // Write the events of the blocks cached by threads.
+    Timeline::ReclaimCachedBlocksFromThreads();
+  }
+  {
+    MonitorLocker ml(&monitor_);
+    shutting_down_ = true;
+    ml.NotifyAll();
+  }
+  // The writer drains the pending blocks before exiting.
+  ASSERT(writer_id_ != OSThread::kInvalidThreadJoinId);
+  OSThread::Join(writer_id_);
+  writer_id_ = OSThread::kInvalidThreadJoinId;
+
+  WriteThreadNames();
+  (*Dart::file_close_callback())(file_);
+  file_ = NULL;
+
+  for (intptr_t i = 0; i < num_blocks_; i++) {
+    delete blocks_[i];
+  }
+  free(blocks_);
+  for (intptr_t i = 0; i < strings_capacity_; i++) {
+    free(strings_[i].string);
+  }
+  free(strings_);
+}
+
+
+void TimelineEventFileRecorder::PrintJSON(JSONStream* js,
+                                          TimelineEventFilter* filter) {
+  if (!FLAG_support_service) {
+    return;
+  }
+  JSONObject topLevel(js);
+  topLevel.AddProperty("type", "_Timeline");
+  {
+    JSONArray events(&topLevel, "traceEvents");
+    PrintJSONMeta(&events);
+  }
+}
+
+
+void TimelineEventFileRecorder::PrintTraceEvent(
+    JSONStream* js,
+    TimelineEventFilter* filter) {
+  if (!FLAG_support_service) {
+    return;
+  }
+  JSONArray events(js);
+  PrintJSONMeta(&events);
+}
+
+
+void TimelineEventFileRecorder::Flush() {
+  MonitorLocker ml(&monitor_);
+  while ((pending_head_ != NULL) || writing_) {
+    ml.Wait();
+  }
+}
+
+
+TimelineEvent* TimelineEventFileRecorder::StartEvent() {
+  return ThreadBlockStartEvent();
+}
+
+
+void TimelineEventFileRecorder::CompleteEvent(TimelineEvent* event) {
+  if (event == NULL) {
+    return;
+  }
+  ThreadBlockCompleteEvent(event);
+}
+
+
+TimelineEventBlock* TimelineEventFileRecorder::GetHeadBlockLocked() {
+  // Written events cannot be iterated.
+  return NULL;
+}
+
+
+TimelineEventBlock* TimelineEventFileRecorder::GetNewBlockLocked() {
+  TimelineEventBlock* block = free_blocks_;
+  if (block == NULL) {
+    // The writer is behind, drop events until it catches up.
+    return NULL;
+  }
+  free_blocks_ = block->next();
+  block->set_next(NULL);
+  block->Open();
+  return block;
+}
+
+
+void TimelineEventFileRecorder::FinishBlockLocked(TimelineEventBlock* block) {
+  block->Finish();
+  MonitorLocker ml(&monitor_);
+  if (pending_tail_ == NULL) {
+    pending_head_ = block;
+  } else {
+    pending_tail_->set_next(block);
+  }
+  pending_tail_ = block;
+  ml.Notify();
+}
+
+
+void TimelineEventFileRecorder::Clear() {
+  // Events already written to the file are kept.
+}
+
+
+void TimelineEventFileRecorder::WriterMain(uword parameter) {
+  TimelineEventFileRecorder* recorder =
+      reinterpret_cast<TimelineEventFileRecorder*>(parameter);
+  MonitorLocker ml(&recorder->monitor_);
+  recorder->writer_id_ =
+      OSThread::GetCurrentThreadJoinId(OSThread::Current());
+  recorder->writer_running_ = true;
+  ml.NotifyAll();
+  while (true) {
+    while ((recorder->pending_head_ == NULL) && !recorder->shutting_down_) {
+      ml.Wait();
+    }
+    TimelineEventBlock* blocks = recorder->pending_head_;
+    if (blocks == NULL) {
+      // Shutting down and all blocks are written.
+      break;
+    }
+    recorder->pending_head_ = NULL;
+    recorder->pending_tail_ = NULL;
+    recorder->writing_ = true;
+    ml.Exit();
+    recorder->WriteBlocks(blocks);
+    ml.Enter();
+    recorder->writing_ = false;
+    ml.NotifyAll();
+  }
+  recorder->writer_running_ = false;
+}
+
+
+void TimelineEventFileRecorder::WriteBlocks(TimelineEventBlock* blocks) {
+  uint8_t* buffer = NULL;
+  WriteStream stream(&buffer, FileRecorderRealloc, 64 * KB);
+  TimelineEventBlock* last = NULL;
+  for (TimelineEventBlock* block = blocks;
+       block != NULL;
+       block = block->next()) {
+    for (intptr_t i = 0; i < block->length(); i++) {
+      const TimelineEvent* event = block->At(i);
+      if (event->IsValid()) {
+        WriteEvent(&stream, event);
+      }
+    }
+    block->Reset();
+    last = block;
+  }
+  WriteToFile(&stream);
+  free(buffer);
+
+  // Return the blocks to the pool.
+  MutexLocker ml(&lock_);
+  last->set_next(free_blocks_);
+  free_blocks_ = blocks;
+}
+
+
+void TimelineEventFileRecorder::WriteEvent(WriteStream* stream,
+                                           const TimelineEvent* event) {
+  const intptr_t label_id = InternString(stream, event->label());
+  const intptr_t category_id = InternString(stream, event->category_);
+  intptr_t arguments_length = event->arguments_length_;
+  for (intptr_t i = 0; i < arguments_length; i++) {
+    InternString(stream, event->arguments_[i].name);
+  }
+
+  const TimelineEvent::EventType type = event->event_type();
+  uint8_t flags = 0;
+  if (event->HasThreadCPUTime()) {
+    flags |= kHasThreadCPUTime;
+  }
+  if (event->pre_serialized_json()) {
+    flags |= kPreSerializedJSON;
+  }
+  WriteLEB128(stream, kEventRecord);
+  const uint8_t type_and_flags = static_cast<uint8_t>(type | (flags << 4));
+  stream->WriteBytes(&type_and_flags, 1);
+  WriteLEB128(stream, label_id);
+  WriteLEB128(stream, category_id);
+  WriteLEB128(stream, OSThread::ThreadIdToIntPtr(event->thread()));
+  WriteLEB128(stream, static_cast<uint64_t>(event->isolate_id()));
+  WriteZigZag(stream, event->TimeOrigin() - last_timestamp_);
+  last_timestamp_ = event->TimeOrigin();
+  if (event->HasThreadCPUTime()) {
+    WriteLEB128(stream, event->ThreadCPUTimeOrigin());
+  }
+  switch (type) {
+    case TimelineEvent::kDuration:
+      WriteLEB128(stream, event->TimeDuration());
+      if (event->HasThreadCPUTime()) {
+        WriteLEB128(stream, event->ThreadCPUTimeDuration());
+      }
+      break;
+    case TimelineEvent::kAsyncBegin:
+    case TimelineEvent::kAsyncInstant:
+    case TimelineEvent::kAsyncEnd:
+      WriteLEB128(stream, event->AsyncId());
+      break;
+    default:
+      break;
+  }
+  WriteLEB128(stream, arguments_length);
+  for (intptr_t i = 0; i < arguments_length; i++) {
+    const TimelineEventArgument& argument = event->arguments_[i];
+    WriteLEB128(stream, InternString(stream, argument.name));
+    WriteString(stream, argument.value);
+  }
+}
+
+
+void TimelineEventFileRecorder::WriteThreadNames() {
+  uint8_t* buffer = NULL;
+  WriteStream stream(&buffer, FileRecorderRealloc, 4 * KB);
+  OSThreadIterator it;
+  while (it.HasNext()) {
+    OSThread* thread = it.Next();
+    const char* thread_name = thread->name();
+    if (thread_name == NULL) {
+      continue;
+    }
+    const intptr_t name_id = InternString(&stream, thread_name);
+    WriteLEB128(&stream, kThreadNameRecord);
+    WriteLEB128(&stream, OSThread::ThreadIdToIntPtr(thread->trace_id()));
+    WriteLEB128(&stream, name_id);
+  }
+  WriteToFile(&stream);
+  free(buffer);
+}
+
+
+void TimelineEventFileRecorder::WriteToFile(WriteStream* stream) {
+  if (stream->bytes_written() > 0) {
+    (*Dart::file_write_callback())(stream->buffer(),
+                                   stream->bytes_written(),
+                                   file_);
+  }
+}
+
+
+intptr_t TimelineEventFileRecorder::InternString(WriteStream* stream,
+                                                 const char* string) {
+  const uint32_t hash = HashCString(string);
+  const intptr_t mask = strings_capacity_ - 1;
+  intptr_t index = hash & mask;
+  while (strings_[index].string != NULL) {
+    if ((strings_[index].hash == hash) &&
+        (strcmp(strings_[index].string, string) == 0)) {
+      return strings_[index].id;
+    }
+    index = (index + 1) & mask;
+  }
+  const intptr_t id = num_strings_++;
+  strings_[index].string = strdup(string);
+  strings_[index].hash = hash;
+  strings_[index].id = id;
+  if ((num_strings_ * 2) > strings_capacity_) {
+    GrowStringTable();
+  }
+  WriteLEB128(stream, kStringRecord);
+  WriteLEB128(stream, id);
+  WriteString(stream, string);
+  return id;
+}
+
+
+void TimelineEventFileRecorder::GrowStringTable() {
+  InternedString* old_strings = strings_;
+  const intptr_t old_capacity = strings_capacity_;
+  strings_capacity_ = old_capacity * 2;
+  strings_ = reinterpret_cast<InternedString*>(
+      calloc(strings_capacity_, sizeof(InternedString)));
+  const intptr_t mask = strings_capacity_ - 1;
+  for (intptr_t i = 0; i < old_capacity; i++) {
+    if (old_strings[i].string == NULL) {
+      continue;
+    }
+    intptr_t index = old_strings[i].hash & mask;
+    while (strings_[index].string != NULL) {
+      index = (index + 1) & mask;
+    }
+    strings_[index] = old_strings[i];
+  }
+  free(old_strings);
+}
+
+
 TimelineEventBlock::TimelineEventBlock(intptr_t block_index)
     : next_(NULL),
       length_(0),
@@ -25,6 +25,7 @@ class TimelineEvent;
 class TimelineEventBlock;
 class TimelineEventRecorder;
 class TimelineStream;
+class WriteStream;
 class Zone;
 
 // (name, enabled by default for isolate).
@@ -411,6 +412,7 @@ class TimelineEvent {
 
   friend class TimelineEventRecorder;
   friend class TimelineEventEndlessRecorder;
+  friend class TimelineEventFileRecorder;
   friend class TimelineEventRingRecorder;
   friend class TimelineEventStartupRecorder;
   friend class TimelineStream;
@@ -620,6 +622,7 @@ class TimelineEventBlock {
   friend class Thread;
   friend class TimelineEventRecorder;
   friend class TimelineEventEndlessRecorder;
+  friend class TimelineEventFileRecorder;
   friend class TimelineEventRingRecorder;
   friend class TimelineEventStartupRecorder;
   friend class TimelineTestHelper;
@@ -715,6 +718,10 @@ class TimelineEventRecorder {
   virtual TimelineEventBlock* GetHeadBlockLocked() = 0;
   virtual TimelineEventBlock* GetNewBlockLocked() = 0;
   virtual void Clear() = 0;
+  // Called when a thread is done with |block|.
+  virtual void FinishBlockLocked(TimelineEventBlock* block) {
+    block->Finish();
+  }
 
   // Utility method(s).
   void PrintJSONMeta(JSONArray* array) const;
@@ -865,6 +872,119 @@ class TimelineEventEndlessRecorder : public TimelineEventRecorder {
 };
 
 
+// A recorder that streams events to a file. Threads fill blocks from a pool
+// of fixed capacity and hand the full blocks to a background thread, which
+// appends them to the file in a compact binary format and returns them to the
+// pool. Memory use and recording overhead do not depend on the length of the
+// trace. When the writer falls behind and the pool is exhausted, new events
+// are dropped.
+//
+// Events are not kept in memory, so PrintJSON only prints metadata. The file
+// is converted to the trace-event format by
+// runtime/tools/timeline_file_to_json.py.
+//
+// File format, all integers are unsigned LEB128 unless noted otherwise:
+//   magic: the 8 bytes "DARTTL01"
+//   pid
+//   records:
+//     kStringRecord: id, length, UTF-8 bytes
+//       Defines the string with |id|. Labels, categories and argument names
+//       are written once and referred to by id.
+//     kEventRecord: type | (flags << 4) as a byte, label id, category id,
+//                   thread id, isolate port,
+//                   timestamp delta to the previous event (zigzag encoded),
+//                   [thread timestamp]                   if kHasThreadCPUTime
+//                   [duration, [thread duration]]        for kDuration
+//                   [async id]                           for kAsync*
+//                   argument count, (name id, length, UTF-8 bytes)*
+//       A pre-serialized event has a single argument holding its JSON.
+//     kThreadNameRecord: thread id, name id
+class TimelineEventFileRecorder : public TimelineEventRecorder {
+ public:
+  static const intptr_t kDefaultCapacity = 8192;
+
+  enum RecordType {
+    kStringRecord = 1,
+    kEventRecord = 2,
+    kThreadNameRecord = 3,
+  };
+
+  enum EventFlags {
+    kHasThreadCPUTime = 1 << 0,
+    kPreSerializedJSON = 1 << 1,
+  };
+
+  explicit TimelineEventFileRecorder(const char* path,
+                                     intptr_t capacity = kDefaultCapacity);
+  ~TimelineEventFileRecorder();
+
+  void PrintJSON(JSONStream* js, TimelineEventFilter* filter);
+  void PrintTraceEvent(JSONStream* js, TimelineEventFilter* filter);
+
+  const char* name() const {
+    return "File";
+  }
+
+  // Waits until all finished blocks have been written.
+  void Flush();
+
+  // False if the file could not be opened.
+  bool is_open() const {
+    return file_ != NULL;
+  }
+
+ protected:
+  TimelineEvent* StartEvent();
+  void CompleteEvent(TimelineEvent* event);
+  TimelineEventBlock* GetHeadBlockLocked();
+  TimelineEventBlock* GetNewBlockLocked();
+  void FinishBlockLocked(TimelineEventBlock* block);
+  void Clear();
+
+ private:
+  struct InternedString {
+    char* string;
+    uint32_t hash;
+    intptr_t id;
+  };
+
+  static void WriterMain(uword parameter);
+  void WriteBlocks(TimelineEventBlock* blocks);
+  void WriteEvent(WriteStream* stream, const TimelineEvent* event);
+  void WriteThreadNames();
+  void WriteToFile(WriteStream* stream);
+
+  // Returns the id of |string|, defining it in |stream| on first use.
+  intptr_t InternString(WriteStream* stream, const char* string);
+  void GrowStringTable();
+
+  void* file_;
+
+  TimelineEventBlock** blocks_;
+  intptr_t num_blocks_;
+  // Blocks ready to be handed out, under |lock_|.
+  TimelineEventBlock* free_blocks_;
+
+  // Protects the fields below.
+  Monitor monitor_;
+  // Finished blocks waiting for the writer, in order.
+  TimelineEventBlock* pending_head_;
+  TimelineEventBlock* pending_tail_;
+  bool writing_;
+  bool shutting_down_;
+  bool writer_running_;
+  ThreadJoinId writer_id_;
+
+  // Only accessed by the writer.
+  InternedString* strings_;
+  intptr_t strings_capacity_;
+  intptr_t num_strings_;
+  int64_t last_timestamp_;
+
+  DISALLOW_COPY_AND_ASSIGN(TimelineEventFileRecorder);
+};
+
+
 // An iterator for blocks.
 class TimelineEventBlockIterator {
  public:
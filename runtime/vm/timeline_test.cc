@@ -6,6 +6,7 @@
 
 #include "platform/assert.h"
 
+#include "vm/dart.h"
 #include "vm/dart_api_impl.h"
 #include "vm/dart_api_state.h"
 #include "vm/globals.h"
@@ -475,6 +476,70 @@ TEST_CASE(TimelineRingRecorderJSONOrder) {
 }
 
 
+TEST_CASE(TimelineFileRecorder) {
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileReadCallback file_read = Dart::file_read_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == NULL) || (file_read == NULL) || (file_close == NULL)) {
+    return;
+  }
+  TimelineStream stream;
+  stream.Init("testStream", true);
+
+  char* path = OS::SCreate(NULL, "dart-timeline-test-%" Pd ".dtl",
+                           OS::ProcessId());
+  TimelineEventFileRecorder* recorder =
+      new TimelineEventFileRecorder(path, TimelineEventBlock::kBlockSize * 2);
+  EXPECT(recorder->is_open());
+  // Many more events than the recorder can hold in memory.
+  const intptr_t kNumBlocks = 16;
+  for (intptr_t i = 0; i < kNumBlocks; i++) {
+    TimelineEventBlock* block = recorder->GetNewBlock();
+    EXPECT(block != NULL);
+    for (intptr_t j = 0; j < TimelineEventBlock::kBlockSize; j++) {
+      TimelineTestHelper::FakeThreadEvent(block, 2, "FileRecorderEvent",
+                                          &stream);
+    }
+    recorder->FinishBlock(block);
+    // Wait for the block to return to the pool.
+    recorder->Flush();
+  }
+  delete recorder;
+
+  void* file = (*file_open)(path, false);
+  EXPECT(file != NULL);
+  const uint8_t* data = NULL;
+  intptr_t length = 0;
+  (*file_read)(&data, &length, file);
+  (*file_close)(file);
+  remove(path);
+  free(path);
+  ASSERT(data != NULL);
+
+  EXPECT(length > 8);
+  EXPECT(memcmp(data, "DARTTL01", 8) == 0);
+  // The label and the category are written once.
+  const char* kLabel = "FileRecorderEvent";
+  intptr_t label_count = 0;
+  intptr_t category_count = 0;
+  for (intptr_t i = 0; i < length; i++) {
+    if (((length - i) >= static_cast<intptr_t>(strlen(kLabel))) &&
+        (memcmp(&data[i], kLabel, strlen(kLabel)) == 0)) {
+      label_count++;
+    }
+    if (((length - i) >= 10) && (memcmp(&data[i], "testStream", 10) == 0)) {
+      category_count++;
+    }
+  }
+  EXPECT_EQ(1, label_count);
+  EXPECT_EQ(1, category_count);
+  // An event takes a few tens of bytes, an order of magnitude less than JSON.
+  const intptr_t num_events = kNumBlocks * TimelineEventBlock::kBlockSize;
+  EXPECT(length < (num_events * 40));
+  free(const_cast<uint8_t*>(data));
+}
+
+
 TEST_CASE(TimelinePauses_Basic) {
   TimelineEventEndlessRecorder* recorder = new TimelineEventEndlessRecorder();
   ASSERT(recorder != NULL);
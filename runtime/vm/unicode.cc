@@ -8,6 +8,11 @@
 #include "vm/globals.h"
 #include "vm/object.h"
 
+#if defined(HOST_ARCH_X64) || defined(HOST_ARCH_IA32)
+#include <emmintrin.h>  // NOLINT
+#define USE_SSE2_UTF8 1
+#endif
+
 namespace dart {
 
 const int8_t Utf8::kTrailBytes[256] = {
@@ -53,6 +58,115 @@ const uint32_t Utf8::kOverlongMinimum[7] = {
 };
 
 
+// The helpers below process the input in blocks of kBlockSize bytes. Both
+// SSE2 on x64 and ia32 hosts and the word-at-a-time fallback used on other
+// hosts allow unaligned loads of a block.
+#if defined(USE_SSE2_UTF8)
+static const intptr_t kBlockSize = 16;
+
+static inline __m128i LoadBlock(const uint8_t* src) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+
+// Returns a mask with bit i set if byte i of the block is not ASCII.
+static inline uint32_t NonAsciiMask(__m128i block) {
+  return static_cast<uint32_t>(_mm_movemask_epi8(block));
+}
+
+
+// Returns a mask with bit i set if byte i of the block is greater than
+// 'value' when both are interpreted as signed bytes.
+static inline uint32_t GreaterThanMask(__m128i block, int8_t value) {
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpgt_epi8(block, _mm_set1_epi8(value))));
+}
+#else
+static const intptr_t kBlockSize = sizeof(uword);
+static const uword kHighBits = static_cast<uword>(0x8080808080808080ULL);
+
+static inline uword LoadBlock(const uint8_t* src) {
+  uword block;
+  memmove(&block, src, sizeof(block));
+  return block;
+}
+#endif
+
+
+// Returns the length of the longest prefix of 'utf8_array' that only
+// consists of ASCII characters.
+static intptr_t AsciiPrefixLength(const uint8_t* utf8_array,
+                                  intptr_t array_len) {
+  intptr_t i = 0;
+#if defined(USE_SSE2_UTF8)
+  // Check 32 bytes per step while the input is pure ASCII.
+  for (; (i + 2 * kBlockSize) <= array_len; i += 2 * kBlockSize) {
+    const __m128i any = _mm_or_si128(LoadBlock(&utf8_array[i]),
+                                     LoadBlock(&utf8_array[i + kBlockSize]));
+    if (NonAsciiMask(any) != 0) {
+      break;
+    }
+  }
+  for (; (i + kBlockSize) <= array_len; i += kBlockSize) {
+    const uint32_t mask = NonAsciiMask(LoadBlock(&utf8_array[i]));
+    if (mask != 0) {
+      return i + Utils::CountTrailingZeros(mask);
+    }
+  }
+#else
+  for (; (i + kBlockSize) <= array_len; i += kBlockSize) {
+    if ((LoadBlock(&utf8_array[i]) & kHighBits) != 0) {
+      break;
+    }
+  }
+#endif
+  while ((i < array_len) && (utf8_array[i] <= Utf8::kMaxOneByteChar)) {
+    i++;
+  }
+  return i;
+}
+
+
+// Copies the longest prefix of 'utf8_array' that only consists of ASCII
+// characters to 'dst', widening each character to a code unit of type
+// 'CodeUnit'. Returns the length of the prefix.
+template<typename CodeUnit>
+static intptr_t CopyAsciiPrefix(const uint8_t* utf8_array,
+                                intptr_t array_len,
+                                CodeUnit* dst) {
+  intptr_t i = 0;
+  for (; (i + kBlockSize) <= array_len; i += kBlockSize) {
+#if defined(USE_SSE2_UTF8)
+    const __m128i block = LoadBlock(&utf8_array[i]);
+    if (NonAsciiMask(block) != 0) {
+      break;
+    }
+    if (sizeof(CodeUnit) == 1) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]), block);
+    } else {
+      ASSERT(sizeof(CodeUnit) == 2);
+      const __m128i zero = _mm_setzero_si128();
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]),
+                       _mm_unpacklo_epi8(block, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i + kBlockSize / 2]),
+                       _mm_unpackhi_epi8(block, zero));
+    }
+#else
+    if ((LoadBlock(&utf8_array[i]) & kHighBits) != 0) {
+      break;
+    }
+    for (intptr_t k = 0; k < kBlockSize; k++) {
+      dst[i + k] = utf8_array[i + k];
+    }
+#endif
+  }
+  for (; (i < array_len) && (utf8_array[i] <= Utf8::kMaxOneByteChar); i++) {
+    dst[i] = utf8_array[i];
+  }
+  return i;
+}
+
+
 // Returns the most restricted coding form in which the sequence of utf8
 // characters in 'utf8_array' can be represented in, and the number of
 // code units needed in that form.
@@ -61,7 +175,35 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
                              Type* type) {
   intptr_t len = 0;
   Type char_type = kLatin1;
-  for (intptr_t i = 0; i < array_len; i++) {
+  intptr_t i = 0;
+#if defined(USE_SSE2_UTF8)
+  // Classify 16 bytes per step. Interpreted as signed bytes, trail bytes
+  // are in [-128, -65], starts of sequences encoding code points above
+  // U+00FF are in [-60, -1] and starts of supplementary sequences are in
+  // [-16, -1].
+  uint32_t non_latin1 = 0;
+  uint32_t supplementary = 0;
+  for (; (i + kBlockSize) <= array_len; i += kBlockSize) {
+    const __m128i block = LoadBlock(&utf8_array[i]);
+    const uint32_t non_ascii = NonAsciiMask(block);
+    if (non_ascii == 0) {
+      len += kBlockSize;
+      continue;
+    }
+    const uint32_t supplementary_starts =
+        GreaterThanMask(block, -17) & non_ascii;
+    len += Utils::CountOneBits(GreaterThanMask(block, -65)) +
+        Utils::CountOneBits(supplementary_starts);
+    non_latin1 |= GreaterThanMask(block, -61) & non_ascii;
+    supplementary |= supplementary_starts;
+  }
+  if (supplementary != 0) {
+    char_type = kSupplementary;
+  } else if (non_latin1 != 0) {
+    char_type = kBMP;
+  }
+#endif
+  for (; i < array_len; i++) {
     uint8_t code_unit = utf8_array[i];
     if (!IsTrailByte(code_unit)) {
       ++len;
@@ -86,7 +228,10 @@ bool Utf8::IsValid(const uint8_t* utf8_array, intptr_t array_len) {
   while (i < array_len) {
     uint32_t ch = utf8_array[i] & 0xFF;
     intptr_t j = 1;
-    if (ch >= 0x80) {
+    if (ch <= kMaxOneByteChar) {
+      // Skip the whole run of ASCII characters.
+      j = AsciiPrefixLength(&utf8_array[i], array_len - i);
+    } else {
       int8_t num_trail_bytes = kTrailBytes[ch];
       bool is_malformed = false;
       for (; j < num_trail_bytes; ++j) {
@@ -218,6 +363,14 @@ bool Utf8::DecodeToLatin1(const uint8_t* utf8_array,
   intptr_t j = 0;
   intptr_t num_bytes;
   for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+    if (utf8_array[i] <= kMaxOneByteChar) {
+      // Copy the whole run of ASCII characters.
+      num_bytes = CopyAsciiPrefix(&utf8_array[i],
+                                  Utils::Minimum(array_len - i, len - j),
+                                  &dst[j]);
+      j += num_bytes - 1;
+      continue;
+    }
     int32_t ch;
     ASSERT(IsLatin1SequenceStart(utf8_array[i]));
     num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
@@ -242,6 +395,14 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
   intptr_t j = 0;
   intptr_t num_bytes;
   for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+    if (utf8_array[i] <= kMaxOneByteChar) {
+      // Copy the whole run of ASCII characters.
+      num_bytes = CopyAsciiPrefix(&utf8_array[i],
+                                  Utils::Minimum(array_len - i, len - j),
+                                  &dst[j]);
+      j += num_bytes - 1;
+      continue;
+    }
     int32_t ch;
     bool is_supplementary = IsSupplementarySequenceStart(utf8_array[i]);
     num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
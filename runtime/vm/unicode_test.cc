@@ -1032,4 +1032,57 @@ TEST_CASE(Utf8Decode) {
   }
 }
 
+
+TEST_CASE(Utf8DecodeLong) {
+  // Runs of ASCII characters longer than a vector block, interleaved with
+  // multi-byte sequences at every offset of a block.
+  for (intptr_t offset = 0; offset < 40; offset++) {
+    uint8_t src[128];
+    intptr_t src_len = 0;
+    for (intptr_t i = 0; i < offset; i++) {
+      src[src_len++] = 'a' + (i % 26);
+    }
+    src[src_len++] = 0xC3;  // U+00F1
+    src[src_len++] = 0xB1;
+    for (intptr_t i = 0; i < 40; i++) {
+      src[src_len++] = 'A' + (i % 26);
+    }
+    const intptr_t latin1_len = src_len;
+    src[src_len++] = 0xE2;  // U+20AC
+    src[src_len++] = 0x82;
+    src[src_len++] = 0xAC;
+    src[src_len++] = 'z';
+
+    EXPECT(Utf8::IsValid(src, src_len));
+    Utf8::Type type;
+    EXPECT_EQ(offset + 41, Utf8::CodeUnitCount(src, latin1_len, &type));
+    EXPECT_EQ(Utf8::kLatin1, type);
+    EXPECT_EQ(offset + 43, Utf8::CodeUnitCount(src, src_len, &type));
+    EXPECT_EQ(Utf8::kBMP, type);
+
+    uint8_t latin1[128];
+    EXPECT(Utf8::DecodeToLatin1(src, latin1_len, latin1, offset + 41));
+    EXPECT(!Utf8::DecodeToLatin1(src, latin1_len, latin1, offset + 40));
+    uint16_t utf16[128];
+    EXPECT(Utf8::DecodeToUTF16(src, src_len, utf16, offset + 43));
+    for (intptr_t i = 0; i < offset; i++) {
+      EXPECT_EQ('a' + (i % 26), latin1[i]);
+      EXPECT_EQ('a' + (i % 26), utf16[i]);
+    }
+    EXPECT_EQ(0xF1, latin1[offset]);
+    EXPECT_EQ(0xF1, utf16[offset]);
+    for (intptr_t i = 0; i < 40; i++) {
+      EXPECT_EQ('A' + (i % 26), latin1[offset + 1 + i]);
+      EXPECT_EQ('A' + (i % 26), utf16[offset + 1 + i]);
+    }
+    EXPECT_EQ(0x20AC, utf16[offset + 41]);
+    EXPECT_EQ('z', utf16[offset + 42]);
+
+    // Malformed sequences following long ASCII runs are detected.
+    src[src_len - 2] = 'x';
+    EXPECT(!Utf8::IsValid(src, src_len));
+    EXPECT(!Utf8::IsValid(src, src_len - 3));
+  }
+}
+
 }  // namespace dart
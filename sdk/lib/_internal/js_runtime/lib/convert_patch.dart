@@ -408,3 +408,21 @@ class _JsonDecoderSink extends _StringSinkConversionSink {
     return null;  // This call was not intercepted.
   }
 }
+
+@patch class JsonEncoder {
+  // Currently not intercepting JSON encoding.
+  @patch
+  static String _convertIntercepted(
+      Object object, toEncodable(object), String indent) {
+    return null;  // This call was not intercepted.
+  }
+}
+
+@patch class JsonUtf8Encoder {
+  // Currently not intercepting JSON encoding.
+  @patch
+  static List<int> _convertIntercepted(
+      Object object, toEncodable(object), List<int> indent) {
+    return null;  // This call was not intercepted.
+  }
+}
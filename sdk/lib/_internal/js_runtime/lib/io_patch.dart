@@ -40,7 +40,7 @@ class _Directory {
   }
   @patch
   static void _fillWithDirectoryListing(
-      List<FileSystemEntity> list, String path, bool recursive,
+      List<List> batches, String path, bool recursive,
       bool followLinks) {
     throw new UnsupportedError("Directory._fillWithDirectoryListing");
   }
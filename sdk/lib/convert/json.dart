@@ -242,8 +242,12 @@ class JsonEncoder extends Converter<Object, String>
    * for it. In other words, if the content of an object changes after it is
    * first serialized, the new values may not be reflected in the result.
    */
-  String convert(Object object) =>
-      _JsonStringStringifier.stringify(object, _toEncodable, indent);
+  String convert(Object object) {
+    // Allow the implementation to intercept and specialize the conversion.
+    String result = _convertIntercepted(object, _toEncodable, indent);
+    if (result != null) return result;
+    return _JsonStringStringifier.stringify(object, _toEncodable, indent);
+  }
 
   /**
    * Starts a chunked conversion.
@@ -268,6 +272,9 @@ class JsonEncoder extends Converter<Object, String>
   // Override the base class's bind, to provide a better type.
   Stream<String> bind(Stream<Object> stream) => super.bind(stream);
 
+  external static String _convertIntercepted(
+      Object object, toEncodable(object), String indent);
+
   Converter<Object, dynamic/*=T*/> fuse/*<T>*/(
       Converter<String, dynamic/*=T*/> other) {
     if (other is Utf8Encoder) {
@@ -343,6 +350,9 @@ class JsonUtf8Encoder extends Converter<Object, List<int>>
 
   /** Convert [object] into UTF-8 encoded JSON. */
   List<int> convert(Object object) {
+    // Allow the implementation to intercept and specialize the conversion.
+    List<int> result = _convertIntercepted(object, _toEncodable, _indent);
+    if (result != null) return result;
     List<List<int>> bytes = [];
     // The `stringify` function always converts into chunks.
     // Collect the chunks into the `bytes` list, then combine them afterwards.
@@ -398,6 +408,9 @@ class JsonUtf8Encoder extends Converter<Object, List<int>>
   Stream<List<int>> bind(Stream<Object> stream) {
     return super.bind(stream);
   }
+
+  external static List<int> _convertIntercepted(
+      Object object, toEncodable(object), List<int> indent);
 }
 
 /**
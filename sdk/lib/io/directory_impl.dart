@@ -23,7 +23,7 @@ class _Directory extends FileSystemEntity implements Directory {
   external static _deleteNative(String path, bool recursive);
   external static _rename(String path, String newPath);
   external static void _fillWithDirectoryListing(
-      List<FileSystemEntity> list, String path, bool recursive,
+      List<List> batches, String path, bool recursive,
       bool followLinks);
 
   static Directory get current {
@@ -205,12 +205,31 @@ class _Directory extends FileSystemEntity implements Directory {
     if (recursive is! bool || followLinks is! bool) {
       throw new ArgumentError();
     }
-    var result = <FileSystemEntity>[];
+    var batches = [];
     _fillWithDirectoryListing(
-        result,
+        batches,
         FileSystemEntity._ensureTrailingPathSeparators(path),
         recursive,
         followLinks);
+    var result = <FileSystemEntity>[];
+    for (var batch in batches) {
+      for (int i = 0; i < batch.length; i += 2) {
+        var type = batch[i];
+        if (type == null) break;
+        var entryPath = batch[i + 1];
+        switch (type) {
+          case _AsyncDirectoryLister.LIST_FILE:
+            result.add(new File(entryPath));
+            break;
+          case _AsyncDirectoryLister.LIST_DIRECTORY:
+            result.add(new Directory(entryPath));
+            break;
+          case _AsyncDirectoryLister.LIST_LINK:
+            result.add(new Link(entryPath));
+            break;
+        }
+      }
+    }
     return result;
   }
 
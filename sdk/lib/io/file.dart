@@ -55,6 +55,18 @@ enum FileLock {
   EXCLUSIVE
 }
 
+/// How the memory returned by [RandomAccessFile.map] will be accessed.
+enum FileMapAdvice {
+  /// No particular access pattern.
+  NORMAL,
+  /// The bytes are read in order, so they can be read ahead aggressively.
+  SEQUENTIAL,
+  /// The bytes are read in random order, so reading ahead is wasted.
+  RANDOM,
+  /// The bytes will be needed soon and should be read in now.
+  WILL_NEED
+}
+
 /**
  * A reference to a file on the file system.
  *
@@ -635,6 +647,51 @@ abstract class RandomAccessFile {
    */
   void writeFromSync(List<int> buffer, [int start = 0, int end]);
 
+  /**
+   * Reads up to [bytes] bytes from [position] in the file, without changing
+   * the file position, and returns the result as a list of bytes. Fewer
+   * bytes are returned at the end of the file.
+   */
+  Future<List<int>> readAt(int position, int bytes);
+
+  /**
+   * Synchronously reads up to [bytes] bytes from [position] in the file,
+   * without changing the file position.
+   *
+   * Throws a [FileSystemException] if the operation fails.
+   */
+  List<int> readAtSync(int position, int bytes);
+
+  /**
+   * Writes the bytes from index [start] to index [end] of [buffer] to the
+   * file at [position], without changing the file position.
+   *
+   * Returns a [:Future<RandomAccessFile>:] that completes with this
+   * [RandomAccessFile] when the write completes.
+   */
+  Future<RandomAccessFile> writeFromAt(
+      int position, List<int> buffer, [int start = 0, int end]);
+
+  /**
+   * Synchronously writes the bytes from index [start] to index [end] of
+   * [buffer] to the file at [position], without changing the file
+   * position.
+   *
+   * Throws a [FileSystemException] if the operation fails.
+   */
+  void writeFromAtSync(
+      int position, List<int> buffer, [int start = 0, int end]);
+
+  /**
+   * Reads the ranges of [lengths] bytes from [positions] in the file with
+   * one request, without changing the file position.
+   *
+   * Returns a [:Future<List<List<int>>>:] that completes with the bytes of
+   * each range, in the order of [positions]. Ranges past the end of the
+   * file are shorter.
+   */
+  Future<List<List<int>>> readBatch(List<int> positions, List<int> lengths);
+
   /**
    * Writes a string to the file using the given [Encoding]. Returns a
    * [:Future<RandomAccessFile>:] that completes with this
@@ -819,6 +876,41 @@ abstract class RandomAccessFile {
    */
   void unlockSync([int start = 0, int end = -1]);
 
+  /**
+   * Maps the byte range from [start] to [end] of the file into memory,
+   * with the byte at position `end` not included. If [end] is -1 or past
+   * the end of the file, the range ends at the end of the file.
+   *
+   * Returns a [:Future<Uint8List>:] that completes with a list backed by
+   * the mapping. The bytes are read from the file when they are first
+   * accessed, instead of being copied up front. Writes to the list are
+   * not written to the file.
+   *
+   * [advice] tells the operating system how the list will be accessed.
+   * It is ignored on Windows.
+   *
+   * The mapping stays valid after the file is closed and is unmapped when
+   * the list is garbage collected. Accessing bytes that have been removed
+   * by truncating the file while it is mapped crashes the process.
+   */
+  Future<Uint8List> map(
+      [int start = 0,
+       int end = -1,
+       FileMapAdvice advice = FileMapAdvice.NORMAL]);
+
+  /**
+   * Synchronously maps the byte range from [start] to [end] of the file
+   * into memory.
+   *
+   * Throws a [FileSystemException] if the operation fails.
+   *
+   * See [map] for more details.
+   */
+  Uint8List mapSync(
+      [int start = 0,
+       int end = -1,
+       FileMapAdvice advice = FileMapAdvice.NORMAL]);
+
   /**
    * Returns a human-readable string for this RandomAccessFile instance.
    */
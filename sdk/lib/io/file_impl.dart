@@ -574,12 +574,15 @@ abstract class _RandomAccessFileOps {
   readInto(List<int> buffer, int start, int end);
   writeByte(int value);
   writeFrom(List<int> buffer, int start, int end);
+  readAt(int position, int bytes);
+  writeFromAt(List<int> buffer, int start, int end, int position);
   position();
   setPosition(int position);
   truncate(int length);
   length();
   flush();
   lock(int lock, int start, int end);
+  map(int start, int end, int advice);
 }
 
 class _RandomAccessFile implements RandomAccessFile {
@@ -809,6 +812,135 @@ class _RandomAccessFile implements RandomAccessFile {
     _resourceInfo.addWrite(end - (start - bufferAndStart.start));
   }
 
+  Future<List<int>> readAt(int position, int bytes) {
+    if ((position is !int) || (position < 0) ||
+        (bytes is !int) || (bytes < 0)) {
+      throw new ArgumentError();
+    }
+    return _dispatch(_FILE_READ_AT, [null, position, bytes]).then((response) {
+      if (_isErrorResponse(response)) {
+        throw _exceptionFromResponse(response, "readAt failed", path);
+      }
+      _resourceInfo.addRead(response[1].length);
+      return response[1] as Object/*=List<int>*/;
+    });
+  }
+
+  List<int> readAtSync(int position, int bytes) {
+    _checkAvailable();
+    if ((position is !int) || (position < 0) ||
+        (bytes is !int) || (bytes < 0)) {
+      throw new ArgumentError();
+    }
+    var result = _ops.readAt(position, bytes);
+    if (result is OSError) {
+      throw new FileSystemException("readAtSync failed", path, result);
+    }
+    _resourceInfo.addRead(result.length);
+    return result as Object/*=List<int>*/;
+  }
+
+  Future<RandomAccessFile> writeFromAt(
+      int position, List<int> buffer, [int start = 0, int end]) {
+    if ((position is !int) || (position < 0) ||
+        (buffer is !List) ||
+        ((start != null) && (start is !int)) ||
+        ((end != null) && (end is !int))) {
+      throw new ArgumentError("Invalid arguments to writeFromAt");
+    }
+    end = RangeError.checkValidRange(start, end, buffer.length);
+    if (end == start) {
+      return new Future.value(this);
+    }
+    _BufferAndStart result;
+    try {
+      result = _ensureFastAndSerializableByteData(buffer, start, end);
+    } catch (e) {
+      return new Future.error(e);
+    }
+
+    List request = new List(5);
+    request[0] = null;
+    request[1] = result.buffer;
+    request[2] = result.start;
+    request[3] = end - (start - result.start);
+    request[4] = position;
+    return _dispatch(_FILE_WRITE_AT, request).then((response) {
+      if (_isErrorResponse(response)) {
+        throw _exceptionFromResponse(response, "writeFromAt failed", path);
+      }
+      _resourceInfo.addWrite(end - (start - result.start));
+      return this;
+    });
+  }
+
+  void writeFromAtSync(
+      int position, List<int> buffer, [int start = 0, int end]) {
+    _checkAvailable();
+    if ((position is !int) || (position < 0) ||
+        (buffer is !List) ||
+        ((start != null) && (start is !int)) ||
+        ((end != null) && (end is !int))) {
+      throw new ArgumentError("Invalid arguments to writeFromAtSync");
+    }
+    end = RangeError.checkValidRange(start, end, buffer.length);
+    if (end == start) {
+      return;
+    }
+    _BufferAndStart bufferAndStart =
+        _ensureFastAndSerializableByteData(buffer, start, end);
+    var result = _ops.writeFromAt(bufferAndStart.buffer,
+                                  bufferAndStart.start,
+                                  end - (start - bufferAndStart.start),
+                                  position);
+    if (result is OSError) {
+      throw new FileSystemException("writeFromAt failed", path, result);
+    }
+    _resourceInfo.addWrite(end - (start - bufferAndStart.start));
+  }
+
+  Future<List<List<int>>> readBatch(List<int> positions, List<int> lengths) {
+    if ((positions is !List) || (lengths is !List) ||
+        (positions.length != lengths.length)) {
+      throw new ArgumentError("Invalid arguments to readBatch");
+    }
+    var ranges = new List(positions.length * 2);
+    for (int i = 0; i < positions.length; i++) {
+      int position = positions[i];
+      int length = lengths[i];
+      if ((position is !int) || (position < 0) ||
+          (length is !int) || (length < 0)) {
+        throw new ArgumentError("Invalid arguments to readBatch");
+      }
+      ranges[2 * i] = position;
+      ranges[2 * i + 1] = length;
+    }
+    return _dispatch(_FILE_READ_BATCH, [null, ranges]).then((response) {
+      if (_isErrorResponse(response)) {
+        throw _exceptionFromResponse(response, "readBatch failed", path);
+      }
+      List<List<int>> result = new List<List<int>>.from(response[1]);
+      for (var bytes in result) {
+        _resourceInfo.addRead(bytes.length);
+      }
+      return result;
+    });
+  }
+
+  // Reads up to [length] bytes at [position] on the IO service and discards
+  // them, so that a following [_NativeSocket.sendFile] of the range does not
+  // wait on the disk. Completes with the number of bytes read, which is less
+  // than [length] only at the end of the file.
+  Future<int> _prefetch(int position, int length) {
+    return _dispatch(_FILE_PREFETCH, [null, position, length])
+        .then((response) {
+          if (_isErrorResponse(response)) {
+            throw _exceptionFromResponse(response, "prefetch failed", path);
+          }
+          return response;
+        });
+  }
+
   Future<RandomAccessFile> writeString(String string,
                                        {Encoding encoding: UTF8}) {
     if (encoding is! Encoding) {
@@ -984,6 +1116,43 @@ class _RandomAccessFile implements RandomAccessFile {
     }
   }
 
+  static void _checkMapArguments(int start, int end, FileMapAdvice advice) {
+    if ((start is !int) || (end is !int) || (advice is !FileMapAdvice)) {
+      throw new ArgumentError();
+    }
+    if ((start < 0) || (end < -1) || ((end != -1) && (start > end))) {
+      throw new ArgumentError();
+    }
+  }
+
+  Future<Uint8List> map(
+      [int start = 0,
+       int end = -1,
+       FileMapAdvice advice = FileMapAdvice.NORMAL]) {
+    _checkMapArguments(start, end, advice);
+    return _dispatch(_FILE_MAP, [null, start, end, advice.index])
+        .then((response) {
+          if (_isErrorResponse(response)) {
+            throw _exceptionFromResponse(response, 'map failed', path);
+          }
+          var result = response[1];
+          return (result == null) ? new Uint8List(0) : result;
+        });
+  }
+
+  Uint8List mapSync(
+      [int start = 0,
+       int end = -1,
+       FileMapAdvice advice = FileMapAdvice.NORMAL]) {
+    _checkAvailable();
+    _checkMapArguments(start, end, advice);
+    var result = _ops.map(start, end, advice.index);
+    if (result is OSError) {
+      throw new FileSystemException('map failed', path, result);
+    }
+    return (result == null) ? new Uint8List(0) : result;
+  }
+
   bool closed = false;
 
   // Calling this function will increase the reference count on the native
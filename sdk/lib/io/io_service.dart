@@ -45,6 +45,11 @@ const int _DIRECTORY_LIST_NEXT = 36;
 const int _DIRECTORY_LIST_STOP = 37;
 const int _DIRECTORY_RENAME = 38;
 const int _SSL_PROCESS_FILTER = 39;
+const int _FILE_MAP = 40;
+const int _FILE_READ_AT = 41;
+const int _FILE_WRITE_AT = 42;
+const int _FILE_READ_BATCH = 43;
+const int _FILE_PREFETCH = 44;
 
 class _IOService {
   external static Future _dispatch(int request, List data);
@@ -268,6 +268,118 @@ testCompound4() {
 }
 
 
+// Object escapes only on one path. Uses after the escape must see the
+// escaped object.
+testPartialEscape1() {
+  f(x, escape, sink) {
+    var p = new Point(x, x + 1.0);
+    if (escape) {
+      sink(p);
+      sink(p);
+      p.x = 0.0;
+      return p.x + p.y;
+    }
+    return p.x + p.y;
+  }
+
+  var escaped = [];
+  sink(val) { escaped.add(val); }
+
+  Expect.equals(3.0, f(1.0, false, sink));
+  for (var i = 0; i < 100; i++) f(1.0, false, sink);
+  Expect.equals(3.0, f(1.0, false, sink));
+  Expect.isTrue(escaped.isEmpty);
+  Expect.equals(2.0, f(1.0, true, sink));
+  Expect.equals(2, escaped.length);
+  Expect.identical(escaped[0], escaped[1]);
+  Expect.equals(0.0, escaped[0].x);
+  Expect.equals(2.0, escaped[0].y);
+}
+
+
+// Object escapes inside of a loop. Escaped object must be updated by the
+// following iterations.
+testPartialEscape2() {
+  f(n, sink) {
+    var p = new Point(1.0, 2.0);
+    for (var i = 0; i < n; i++) {
+      if (i == 3) sink(p);
+      p.x += 1.0;
+    }
+    return p.x;
+  }
+
+  var escaped;
+  sink(val) { escaped = val; }
+
+  Expect.equals(3.0, f(2, sink));
+  for (var i = 0; i < 100; i++) f(2, sink);
+  Expect.equals(3.0, f(2, sink));
+  Expect.isNull(escaped);
+  Expect.equals(11.0, f(10, sink));
+  Expect.equals(11.0, escaped.x);
+}
+
+
+// Object escapes on different paths which merge while the object is
+// still in use.
+testPartialEscape3() {
+  f(x, sink) {
+    var p = new Point(x, 0.0);
+    if (x > 10.0) {
+      sink(p);
+    } else if (x < -10.0) {
+      sink(p);
+    }
+    p.y = 1.0;
+    return p.x + p.y;
+  }
+
+  var escaped;
+  sink(val) { escaped = val; }
+
+  Expect.equals(2.0, f(1.0, sink));
+  for (var i = 0; i < 100; i++) f(1.0, sink);
+  Expect.equals(2.0, f(1.0, sink));
+  Expect.isNull(escaped);
+  Expect.equals(21.0, f(20.0, sink));
+  Expect.equals(1.0, escaped.y);
+  Expect.equals(-19.0, f(-20.0, sink));
+  Expect.equals(-20.0, escaped.x);
+  Expect.equals(1.0, escaped.y);
+}
+
+
+// Object is read after a call and escapes only on a rarely taken path.
+// Loads from the object must not be treated as escape points.
+testPartialEscape4() {
+  f(x, check, sink) {
+    var p = new Point(x, x * 2.0);
+    check(x);
+    var sum = p.x + p.y;
+    if (sum > 100.0) {
+      sink(p);
+      return -sum;
+    }
+    return sum;
+  }
+
+  var checked = 0;
+  check(val) { checked++; }
+  var escaped;
+  sink(val) { escaped = val; }
+
+  Expect.equals(3.0, f(1.0, check, sink));
+  for (var i = 0; i < 100; i++) f(1.0, check, sink);
+  Expect.equals(3.0, f(1.0, check, sink));
+  Expect.equals(102, checked);
+  Expect.isNull(escaped);
+  Expect.equals(-150.0, f(50.0, check, sink));
+  Expect.equals(50.0, escaped.x);
+  Expect.equals(100.0, escaped.y);
+}
+
+
 main() {
   var c = new C(new Point(0.1, 0.2));
 
@@ -329,4 +441,8 @@ main() {
   testCompound2();
   testCompound3();
   testCompound4();
+  testPartialEscape1();
+  testPartialEscape2();
+  testPartialEscape3();
+  testPartialEscape4();
 }
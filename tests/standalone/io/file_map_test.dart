@@ -0,0 +1,87 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Maps files into memory with RandomAccessFile.map and mapSync.
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int FILE_SIZE = 100000;
+
+List<int> fileContent() {
+  var content = new List<int>(FILE_SIZE);
+  for (int i = 0; i < FILE_SIZE; i++) {
+    content[i] = (i * 13 + i ~/ 256) & 0xff;
+  }
+  return content;
+}
+
+void testMapSync(File file, List<int> content) {
+  var raf = file.openSync();
+  Expect.listEquals(content, raf.mapSync());
+  Expect.listEquals(content.sublist(4097), raf.mapSync(4097));
+  Expect.listEquals(content.sublist(10, 20), raf.mapSync(10, 20));
+  Expect.listEquals(content.sublist(FILE_SIZE - 5),
+                    raf.mapSync(FILE_SIZE - 5, FILE_SIZE + 5));
+  Expect.equals(0, raf.mapSync(5, 5).length);
+  Expect.equals(0, raf.mapSync(FILE_SIZE + 1).length);
+  for (var advice in FileMapAdvice.values) {
+    Expect.listEquals(content.sublist(100, 9000),
+                      raf.mapSync(100, 9000, advice));
+  }
+  Expect.throws(() => raf.mapSync(-1), (e) => e is ArgumentError);
+  Expect.throws(() => raf.mapSync(10, 5), (e) => e is ArgumentError);
+
+  // The mapping outlives the file and writes to it do not reach the file.
+  Uint8List mapped = raf.mapSync();
+  raf.closeSync();
+  mapped[0] = mapped[0] ^ 0xff;
+  Expect.equals(content[0] ^ 0xff, mapped[0]);
+  Expect.listEquals(content, file.readAsBytesSync());
+  Expect.throws(() => raf.mapSync(), (e) => e is FileSystemException);
+}
+
+Future testMap(File file, List<int> content) async {
+  var raf = await file.open();
+  Expect.listEquals(content, await raf.map());
+  Expect.listEquals(content.sublist(10, 20), await raf.map(10, 20));
+  Expect.listEquals(content.sublist(5000),
+                    await raf.map(5000, -1, FileMapAdvice.SEQUENTIAL));
+  Expect.equals(0, (await raf.map(FILE_SIZE)).length);
+  Uint8List mapped = await raf.map(0, -1, FileMapAdvice.RANDOM);
+  await raf.close();
+  Expect.listEquals(content, mapped);
+}
+
+Future testMapWriteOnly(File file) async {
+  var raf = await file.open(mode: FileMode.WRITE_ONLY_APPEND);
+  Expect.throws(() => raf.mapSync(), (e) => e is FileSystemException);
+  try {
+    await raf.map();
+    Expect.fail("Write only file mapped");
+  } on FileSystemException {
+    // Expected.
+  }
+  await raf.close();
+}
+
+main() async {
+  asyncStart();
+  var temp = Directory.systemTemp.createTempSync('dart_file_map');
+  var content = fileContent();
+  var file = new File('${temp.path}/data');
+  file.writeAsBytesSync(content);
+  try {
+    testMapSync(file, content);
+    await testMap(file, content);
+    await testMapWriteOnly(file);
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+  asyncEnd();
+}
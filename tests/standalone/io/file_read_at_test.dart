@@ -0,0 +1,82 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Positional reads and writes, and batched reads, on a RandomAccessFile.
+
+import "dart:async";
+import "dart:io";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int FILE_SIZE = 20000;
+
+List<int> fileContent() {
+  return new List<int>.generate(FILE_SIZE, (i) => (i * 31 + i ~/ 256) & 0xff);
+}
+
+void testSync(File file, List<int> content) {
+  var raf = file.openSync(mode: FileMode.APPEND);
+  raf.setPositionSync(7);
+  Expect.listEquals(content.sublist(100, 200), raf.readAtSync(100, 100));
+  Expect.listEquals(content.sublist(FILE_SIZE - 3),
+                    raf.readAtSync(FILE_SIZE - 3, 10));
+  Expect.equals(0, raf.readAtSync(FILE_SIZE + 10, 10).length);
+  Expect.equals(0, raf.readAtSync(0, 0).length);
+  raf.writeFromAtSync(1000, [1, 2, 3, 4, 5], 1, 4);
+  Expect.listEquals([2, 3, 4], raf.readAtSync(1000, 3));
+  // The file position is not moved by positional reads and writes.
+  Expect.equals(7, raf.positionSync());
+  Expect.throws(() => raf.readAtSync(-1, 10), (e) => e is ArgumentError);
+  Expect.throws(() => raf.readAtSync(0, -1), (e) => e is ArgumentError);
+  Expect.throws(() => raf.writeFromAtSync(-1, [1]),
+                (e) => e is ArgumentError);
+  raf.writeFromAtSync(1000, content, 1000, 1003);
+  raf.closeSync();
+  Expect.listEquals(content, file.readAsBytesSync());
+}
+
+Future testAsync(File file, List<int> content) async {
+  var raf = await file.open(mode: FileMode.APPEND);
+  await raf.setPosition(11);
+  Expect.listEquals(content.sublist(5000, 9000), await raf.readAt(5000, 4000));
+  await raf.writeFromAt(FILE_SIZE + 2, [7, 8]);
+  Expect.listEquals([content[FILE_SIZE - 1], 0, 0, 7, 8],
+                    await raf.readAt(FILE_SIZE - 1, 10));
+  Expect.equals(11, await raf.position());
+  await raf.truncate(FILE_SIZE);
+
+  var positions = [0, 19000, 300, FILE_SIZE - 5, FILE_SIZE + 100, 300];
+  var lengths = [10, 1000, 0, 10, 10, 4096];
+  var batch = await raf.readBatch(positions, lengths);
+  Expect.equals(positions.length, batch.length);
+  for (int i = 0; i < positions.length; i++) {
+    int start = min(positions[i], FILE_SIZE);
+    int end = min(positions[i] + lengths[i], FILE_SIZE);
+    Expect.listEquals(content.sublist(start, end), batch[i]);
+  }
+  Expect.equals(0, (await raf.readBatch([], [])).length);
+  Expect.equals(11, await raf.position());
+  Expect.throws(() => raf.readBatch([0], []), (e) => e is ArgumentError);
+  Expect.throws(() => raf.readBatch([-1], [1]), (e) => e is ArgumentError);
+  await raf.close();
+  Expect.listEquals(content, file.readAsBytesSync());
+}
+
+int min(int a, int b) => a < b ? a : b;
+
+main() async {
+  asyncStart();
+  var temp = Directory.systemTemp.createTempSync('dart_file_read_at');
+  var content = fileContent();
+  var file = new File('${temp.path}/data');
+  file.writeAsBytesSync(content);
+  try {
+    testSync(file, content);
+    await testAsync(file, content);
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+  asyncEnd();
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests that executables are looked up on the PATH of the environment the
+// process is started with, that scripts without a #! line are run by the
+// shell, and that exec errors are reported.
+
+import "dart:async";
+import "dart:io";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+Future testPathFromEnvironment(Directory temp) async {
+  var script = new File('${temp.path}/exec_path_script');
+  script.writeAsStringSync('echo "ran \$1"\n');
+  Process.runSync('chmod', ['+x', script.path]);
+
+  var environment = {'PATH': '/nonexistent::${temp.path}'};
+  var result = await Process.run('exec_path_script', ['arg'],
+                                 environment: environment,
+                                 includeParentEnvironment: false);
+  Expect.equals(0, result.exitCode);
+  Expect.equals('ran arg', result.stdout.trim());
+}
+
+Future testExecErrors(Directory temp) async {
+  try {
+    await Process.start('exec_path_script', [],
+                        environment: {'PATH': '/nonexistent'},
+                        includeParentEnvironment: false);
+    Expect.fail("Process started with missing executable");
+  } on ProcessException catch (e) {
+    Expect.equals(2, e.errorCode);  // ENOENT.
+  }
+
+  var file = new File('${temp.path}/not_executable');
+  file.writeAsStringSync('exit 0\n');
+  try {
+    await Process.start(file.path, []);
+    Expect.fail("Process started with file that is not executable");
+  } on ProcessException catch (e) {
+    Expect.equals(13, e.errorCode);  // EACCES.
+  }
+}
+
+main() async {
+  if (Platform.isWindows) return;
+  asyncStart();
+  var temp = Directory.systemTemp.createTempSync('dart_process_exec_path');
+  try {
+    await testPathFromEnvironment(temp);
+    await testExecErrors(temp);
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+  asyncEnd();
+}
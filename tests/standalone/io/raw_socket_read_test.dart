@@ -0,0 +1,90 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=
+// VMOptions=--short_socket_read
+// VMOptions=--short_socket_write
+// VMOptions=--short_socket_read --short_socket_write
+
+// Reads with a range of lengths, with and without short reads, and checks
+// that the data returned is never shared between reads.
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int DATA_SIZE = 300000;
+const List<int> READ_LENGTHS = const [1, 100, 1024, 1025, 65536, 70000, null];
+
+void testReadLengths() {
+  asyncStart();
+  var data = new Uint8List(DATA_SIZE);
+  for (int i = 0; i < DATA_SIZE; i++) data[i] = i % 251;
+
+  RawServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, 0).then((server) {
+    server.listen((client) {
+      int written = 0;
+      client.listen((event) {
+        switch (event) {
+          case RawSocketEvent.WRITE:
+            written += client.write(data, written);
+            if (written < DATA_SIZE) {
+              client.writeEventsEnabled = true;
+            } else {
+              client.shutdown(SocketDirection.SEND);
+            }
+            break;
+          case RawSocketEvent.READ_CLOSED:
+            client.close();
+            server.close();
+            break;
+          default:
+            break;
+        }
+      });
+    });
+
+    RawSocket.connect(InternetAddress.LOOPBACK_IP_V4, server.port)
+        .then((socket) {
+      var chunks = [];
+      int received = 0;
+      int reads = 0;
+      socket.listen((event) {
+        switch (event) {
+          case RawSocketEvent.READ:
+            var length = READ_LENGTHS[reads++ % READ_LENGTHS.length];
+            var chunk = socket.read(length);
+            if (chunk == null) break;
+            Expect.isTrue(chunk is Uint8List);
+            Expect.isTrue(length == null || chunk.length <= length);
+            chunks.add(chunk);
+            received += chunk.length;
+            break;
+          case RawSocketEvent.READ_CLOSED:
+            Expect.equals(DATA_SIZE, received);
+            // Compare at the end, a chunk sharing its storage with another
+            // read would have been overwritten by a later read.
+            int position = 0;
+            for (var chunk in chunks) {
+              for (int i = 0; i < chunk.length; i++) {
+                Expect.equals(data[position++], chunk[i]);
+              }
+            }
+            socket.close();
+            asyncEnd();
+            break;
+          default:
+            break;
+        }
+      });
+    });
+  });
+}
+
+main() {
+  testReadLengths();
+}
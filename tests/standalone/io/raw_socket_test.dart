@@ -6,6 +6,10 @@
 // VMOptions=--short_socket_read
 // VMOptions=--short_socket_write
 // VMOptions=--short_socket_read --short_socket_write
+// VMOptions=--io-uring
+// VMOptions=--io-uring --short_socket_read --short_socket_write
+// VMOptions=--event-handler-threads=4
+// VMOptions=--event-handler-threads=4 --io-uring
 
 import "dart:async";
 import "dart:io";
@@ -6,6 +6,8 @@
 // VMOptions=--short_socket_read
 // VMOptions=--short_socket_write
 // VMOptions=--short_socket_read --short_socket_write
+// VMOptions=--io-uring
+// VMOptions=--io-uring --short_socket_read --short_socket_write
 
 import "package:expect/expect.dart";
 import "dart:async";
@@ -0,0 +1,72 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=
+// VMOptions=--short_socket_read
+// VMOptions=--short_socket_write
+// VMOptions=--short_socket_read --short_socket_write
+
+// Data added to a socket in the same turn of the event loop is written with
+// gather writes. Checks that all of it arrives in order, including more
+// chunks than fit in one write, repeated and non typed data chunks.
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int CHUNK_COUNT = 200;
+
+List<List<int>> makeChunks() {
+  var chunks = [];
+  var repeated = new Uint8List.fromList([1, 2, 3]);
+  for (int i = 0; i < CHUNK_COUNT; i++) {
+    switch (i % 4) {
+      case 0:
+        chunks.add(new Uint8List(i)..fillRange(0, i, i % 256));
+        break;
+      case 1:
+        chunks.add(new List<int>.filled(i, i % 256));
+        break;
+      case 2:
+        chunks.add(repeated);
+        break;
+      case 3:
+        chunks.add(new Uint8List(0));
+        break;
+    }
+  }
+  return chunks;
+}
+
+void testCoalescedWrites() {
+  asyncStart();
+  var chunks = makeChunks();
+  var expected = chunks.expand((chunk) => chunk).toList();
+
+  ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, 0).then((server) {
+    server.listen((client) {
+      var received = [];
+      client.listen(received.addAll, onDone: () {
+        Expect.listEquals(expected, received);
+        client.close();
+        server.close();
+        asyncEnd();
+      });
+    });
+
+    Socket.connect(InternetAddress.LOOPBACK_IP_V4, server.port)
+        .then((socket) {
+      chunks.forEach(socket.add);
+      socket.close();
+      socket.listen((_) {});
+    });
+  });
+}
+
+main() {
+  testCoalescedWrites();
+}
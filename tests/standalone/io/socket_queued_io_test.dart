@@ -0,0 +1,163 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=
+// VMOptions=--short_socket_read --short_socket_write
+// VMOptions=--io-uring
+// VMOptions=--io-uring --short_socket_read --short_socket_write
+
+// With --io-uring the eventhandler reads, writes and accepts for TCP
+// sockets itself. Tests that reads follow the pauses of the subscription,
+// that closing does not wait for a peer that does not read and that
+// connections are not lost while a server is paused.
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int DATA_SIZE = 4 * 1024 * 1024 + 3;
+
+final InternetAddress LOOPBACK = InternetAddress.LOOPBACK_IP_V4;
+
+Uint8List pattern(int size) {
+  var data = new Uint8List(size);
+  for (int i = 0; i < size; i++) {
+    data[i] = (i * 13 + i ~/ 1024) & 0xff;
+  }
+  return data;
+}
+
+void expectBytes(List<int> expected, List<int> actual) {
+  Expect.equals(expected.length, actual.length);
+  for (int i = 0; i < expected.length; i++) {
+    if (expected[i] != actual[i]) {
+      Expect.fail("Byte $i is ${actual[i]} instead of ${expected[i]}");
+    }
+  }
+}
+
+Future testReadBackpressure() async {
+  var data = pattern(DATA_SIZE);
+  var server = await ServerSocket.bind(LOOPBACK, 0);
+  server.listen((socket) {
+    socket.drain();
+    socket.add(data);
+    socket.close();
+  });
+  var client = await Socket.connect(LOOPBACK, server.port);
+  var received = new BytesBuilder(copy: false);
+  var done = new Completer();
+  int pauses = 0;
+  StreamSubscription subscription;
+  subscription = client.listen((chunk) {
+    received.add(chunk);
+    if (pauses < 3 && received.length > (pauses + 1) * DATA_SIZE ~/ 4) {
+      pauses++;
+      subscription.pause(
+          new Future.delayed(const Duration(milliseconds: 200)));
+    }
+  }, onDone: done.complete);
+  await done.future;
+  client.destroy();
+  await server.close();
+  Expect.equals(3, pauses);
+  expectBytes(data, received.takeBytes());
+}
+
+// Writes to the socket until it does not take more data, which is queued
+// with the eventhandler or the system. Returns the number of bytes taken.
+int writeAll(RawSocket socket, List<int> data) {
+  int written = 0;
+  while (written < data.length) {
+    int n = socket.write(data, written, data.length - written);
+    if (n == 0) break;
+    written += n;
+  }
+  return written;
+}
+
+Future testCloseWithoutReader() async {
+  var server = await RawServerSocket.bind(LOOPBACK, 0);
+  var accepted = server.first;
+  var client = await RawSocket.connect(LOOPBACK, server.port);
+  var peer = await accepted;
+  writeAll(client, pattern(DATA_SIZE));
+  // The peer never reads. The close gives up on the queued writes after a
+  // while.
+  var stopwatch = new Stopwatch()..start();
+  await client.close();
+  Expect.isTrue(stopwatch.elapsed < const Duration(seconds: 20));
+  await peer.close();
+  await server.close();
+}
+
+Future testDestroyWithoutReader() async {
+  var server = await ServerSocket.bind(LOOPBACK, 0);
+  var accepted = server.first;
+  var client = await Socket.connect(LOOPBACK, server.port);
+  var peer = await accepted;
+  client.add(pattern(DATA_SIZE));
+  await new Future.delayed(const Duration(milliseconds: 100));
+  client.destroy();
+  // The peer gets the end of the stream after the data sent before the
+  // socket was destroyed.
+  await peer.drain();
+  peer.destroy();
+  await server.close();
+}
+
+Future testCloseAfterWrite() async {
+  var data = pattern(DATA_SIZE);
+  var server = await ServerSocket.bind(LOOPBACK, 0);
+  var accepted = server.first;
+  var client = await RawSocket.connect(LOOPBACK, server.port);
+  var peer = await accepted;
+  int written = writeAll(client, data);
+  Expect.isTrue(written > 0);
+  // The data written right before the close is still sent.
+  var closed = client.close();
+  var received = new BytesBuilder(copy: false);
+  await peer.forEach(received.add);
+  await closed;
+  expectBytes(data.sublist(0, written), received.takeBytes());
+  peer.destroy();
+  await server.close();
+}
+
+Future testAcceptWhilePaused() async {
+  const int CONNECTIONS = 20;
+  var server = await ServerSocket.bind(LOOPBACK, 0);
+  var subscription = server.listen((socket) {
+    socket.listen(socket.add, onDone: socket.close);
+  });
+  subscription.pause();
+  var clients = [];
+  for (int i = 0; i < CONNECTIONS; i++) {
+    clients.add(await Socket.connect(LOOPBACK, server.port));
+  }
+  await new Future.delayed(const Duration(milliseconds: 200));
+  subscription.resume();
+  for (int i = 0; i < CONNECTIONS; i++) {
+    var client = clients[i];
+    var reply = client.fold(<int>[], (bytes, data) => bytes..addAll(data));
+    client.add([i]);
+    await client.close();
+    Expect.listEquals([i], await reply);
+    client.destroy();
+  }
+  await server.close();
+}
+
+main() async {
+  asyncStart();
+  await testReadBackpressure();
+  await testCloseWithoutReader();
+  await testDestroyWithoutReader();
+  await testCloseAfterWrite();
+  await testAcceptWhilePaused();
+  asyncEnd();
+}
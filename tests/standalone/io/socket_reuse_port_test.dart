@@ -0,0 +1,86 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=
+// VMOptions=--shared_sockets_reuse_port
+
+// Shared server sockets on the same port, with and without a listening
+// socket per server socket. Checks that connections are accepted while
+// members of the group are closed and new ones join it.
+
+import "dart:async";
+import "dart:io";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int CONNECTIONS = 20;
+
+Future<ServerSocket> bindShared(int port) =>
+    ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, port, shared: true);
+
+Future connect(int port, int count) async {
+  for (int i = 0; i < count; i++) {
+    var socket = await Socket.connect(InternetAddress.LOOPBACK_IP_V4, port);
+    // The server closes the connection once it is accepted.
+    await socket.drain();
+    socket.destroy();
+  }
+}
+
+class Acceptor {
+  final ServerSocket server;
+  int accepted = 0;
+
+  Acceptor(this.server) {
+    server.listen((socket) {
+      accepted++;
+      socket.destroy();
+    });
+  }
+}
+
+Future testGroup() async {
+  var first = new Acceptor(await bindShared(0));
+  int port = first.server.port;
+  var second = new Acceptor(await bindShared(port));
+  Expect.equals(port, second.server.port);
+
+  await connect(port, CONNECTIONS);
+  Expect.equals(CONNECTIONS, first.accepted + second.accepted);
+
+  // The group keeps listening when one of its sockets is closed.
+  await first.server.close();
+  await connect(port, CONNECTIONS);
+  Expect.equals(2 * CONNECTIONS, first.accepted + second.accepted);
+
+  // And accepts new sockets as long as one is left.
+  var third = new Acceptor(await bindShared(port));
+  await second.server.close();
+  await connect(port, CONNECTIONS);
+  Expect.equals(CONNECTIONS, third.accepted);
+  await third.server.close();
+
+  // Binding the port again starts a new group.
+  var fourth = new Acceptor(await bindShared(port));
+  await connect(port, CONNECTIONS);
+  Expect.equals(CONNECTIONS, fourth.accepted);
+  await fourth.server.close();
+}
+
+Future testNotShared() async {
+  var server = await bindShared(0);
+  await ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, server.port)
+      .then((_) => Expect.fail("Bind of a shared port should fail"),
+            onError: (error) {
+    Expect.isTrue(error is SocketException);
+    Expect.isTrue('$error'.contains('shared flag'));
+  });
+  await server.close();
+}
+
+main() {
+  asyncStart();
+  testGroup().then((_) => testNotShared()).then((_) => asyncEnd());
+}
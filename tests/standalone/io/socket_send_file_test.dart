@@ -0,0 +1,103 @@
+// Copyright (c) 2016, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=
+// VMOptions=--short_socket_write
+// VMOptions=--short_socket_read
+// VMOptions=--short_socket_read --short_socket_write
+// VMOptions=--io-uring
+// VMOptions=--io-uring --short_socket_read --short_socket_write
+
+// Pipes files and parts of files to sockets. Streams from File.openRead are
+// sent to the socket directly from the file where the platform supports it.
+
+import "dart:async";
+import "dart:io";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int FILE_SIZE = 3 * 1024 * 1024 + 17;
+
+List<int> fileContent() {
+  var content = new List<int>(FILE_SIZE);
+  for (int i = 0; i < FILE_SIZE; i++) {
+    content[i] = (i * 7 + i ~/ 256) & 0xff;
+  }
+  return content;
+}
+
+// Sends the stream to a socket and returns the bytes the server received.
+Future<List<int>> sendStream(Stream<List<int>> stream) async {
+  var server = await ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, 0);
+  var received = new Completer<List<int>>();
+  server.listen((socket) {
+    var data = <int>[];
+    socket.listen(data.addAll, onDone: () {
+      socket.destroy();
+      received.complete(data);
+    });
+  });
+  var socket = await Socket.connect(InternetAddress.LOOPBACK_IP_V4,
+                                    server.port);
+  await socket.addStream(stream);
+  await socket.close();
+  var data = await received.future;
+  await server.close();
+  return data;
+}
+
+Future testSendFile(File file, List<int> content, [int start, int end]) async {
+  var data = await sendStream(file.openRead(start, end));
+  if (start == null) start = 0;
+  if (end == null || end > content.length) end = content.length;
+  Expect.listEquals(content.sublist(start, end), data);
+}
+
+Future testSendError(Stream<List<int>> stream, bool isExpectedError(e)) async {
+  var server = await ServerSocket.bind(InternetAddress.LOOPBACK_IP_V4, 0);
+  server.listen((socket) => socket.drain().then((_) => socket.destroy()));
+  var socket = await Socket.connect(InternetAddress.LOOPBACK_IP_V4,
+                                    server.port);
+  try {
+    await socket.addStream(stream);
+    Expect.fail("Stream sent without error");
+  } catch (e) {
+    Expect.isTrue(isExpectedError(e));
+  }
+  socket.destroy();
+  await server.close();
+}
+
+Future testOtherStream(File file, List<int> content) async {
+  // Streams that are not plain file streams are sent as they are read.
+  var data = await sendStream(file.openRead().map((data) => data));
+  Expect.listEquals(content, data);
+}
+
+main() async {
+  asyncStart();
+  var temp = Directory.systemTemp.createTempSync('dart_socket_send_file');
+  var content = fileContent();
+  var file = new File('${temp.path}/data');
+  file.writeAsBytesSync(content);
+  var empty = new File('${temp.path}/empty');
+  empty.createSync();
+  try {
+    await testSendFile(file, content);
+    await testSendFile(file, content, 1000);
+    await testSendFile(file, content, 1000, 1000000);
+    await testSendFile(file, content, 0, 1);
+    await testSendFile(file, content, FILE_SIZE - 10, FILE_SIZE + 10);
+    await testSendFile(empty, []);
+    await testOtherStream(file, content);
+    await testSendError(file.openRead(-1), (e) => e is RangeError);
+    await testSendError(file.openRead(10, 5), (e) => e is RangeError);
+    await testSendError(new File('${temp.path}/missing').openRead(),
+                        (e) => e is FileSystemException);
+  } finally {
+    temp.deleteSync(recursive: true);
+  }
+  asyncEnd();
+}